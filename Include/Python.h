@@ -51,6 +51,7 @@
 #include "pymacro.h"
 
 #include "pyatomic.h"
+#include "pylock.h"
 
 /* Debug-mode build with pymalloc implies PYMALLOC_DEBUG.
  *  PYMALLOC_DEBUG is in error if pymalloc is not in use.
@@ -115,6 +116,7 @@
 #include "pythonrun.h"
 #include "pylifecycle.h"
 #include "ceval.h"
+#include "pychannel.h"
 #include "sysmodule.h"
 #include "intrcheck.h"
 #include "import.h"
@@ -43,6 +43,10 @@ PyAPI_FUNC(int) PyEval_MergeCompilerFlags(PyCompilerFlags *cf);
 
 PyAPI_FUNC(int) Py_AddPendingCall(int (*func)(void *), void *arg);
 PyAPI_FUNC(int) Py_MakePendingCalls(void);
+#ifndef Py_LIMITED_API
+PyAPI_FUNC(int) Py_AddPendingCallToThread(long thread_id,
+                                          int (*func)(void *), void *arg);
+#endif
 
 /* Protection against deeply nested recursive calls
 
@@ -182,6 +186,31 @@ PyAPI_FUNC(void) PyEval_ReInitThreads(void);
 #ifndef Py_LIMITED_API
 PyAPI_FUNC(void) _PyEval_SetSwitchInterval(unsigned long microseconds);
 PyAPI_FUNC(unsigned long) _PyEval_GetSwitchInterval(void);
+
+/* GIL scheduling policies, see sys.setgilpolicy() */
+#define _Py_GIL_POLICY_INTERVAL 0
+#define _Py_GIL_POLICY_FAIR     1
+PyAPI_FUNC(void) _PyEval_SetGILPolicy(int policy);
+PyAPI_FUNC(int) _PyEval_GetGILPolicy(void);
+
+/* GIL contention statistics, see sys._gil_stats().  Times are in
+   nanoseconds.  Bucket 0 of the histograms counts durations below 1
+   microsecond, bucket i durations in [2**(i-1), 2**i) microseconds, and the
+   last bucket everything longer. */
+#define _Py_GIL_STATS_BUCKETS 24
+typedef struct {
+    Py_ssize_t acquisitions;
+    Py_ssize_t contended;       /* acquisitions which had to wait */
+    Py_ssize_t forced_drops;    /* drops while gil_drop_request was set */
+    Py_ssize_t switches;        /* changes of the GIL holder */
+    _PyTime_t wait_time;
+    _PyTime_t max_wait;
+    _PyTime_t hold_time;
+    _PyTime_t max_hold;
+    Py_ssize_t wait_histogram[_Py_GIL_STATS_BUCKETS];
+    Py_ssize_t hold_histogram[_Py_GIL_STATS_BUCKETS];
+} _PyGILStats;
+PyAPI_FUNC(void) _PyEval_GetGILStats(_PyGILStats *stats);
 #endif
 
 #define Py_BEGIN_ALLOW_THREADS { \
@@ -203,7 +232,19 @@ PyAPI_FUNC(unsigned long) _PyEval_GetSwitchInterval(void);
 
 #ifndef Py_LIMITED_API
 PyAPI_FUNC(int) _PyEval_SliceIndex(PyObject *, Py_ssize_t *);
-PyAPI_FUNC(void) _PyEval_SignalAsyncExc(void);
+PyAPI_FUNC(void) _PyEval_SignalAsyncExc(PyThreadState *tstate);
+
+/* Suspend every other thread running Python code until the matching
+   _PyEval_StartTheWorld(); calls may be nested.  Only does something in
+   the --without-gil build, where the GIL doesn't already guarantee it. */
+PyAPI_FUNC(void) _PyEval_StopTheWorld(void);
+PyAPI_FUNC(void) _PyEval_StartTheWorld(void);
+
+#ifdef WITHOUT_GIL
+/* Make tstate check whether objects were handed back to it for their
+   reference counts to be merged (see _PyThreadState_QueueRefCntMerge()). */
+PyAPI_FUNC(void) _PyEval_SignalRefCntMerge(PyThreadState *tstate);
+#endif
 #endif
 
 /* Masks and values used by FORMAT_VALUE opcode. */
@@ -7,6 +7,31 @@
 extern "C" {
 #endif
 
+/* Inline cache entry of a LOAD_GLOBAL, LOAD_ATTR or LOAD_METHOD instruction,
+   see _PyCode_InitOpcache().  The references are borrowed. */
+typedef struct {
+    PyObject *ptr;              /* value of the global name */
+    PY_UINT64_T globals_ver;    /* ma_version_tag of the globals */
+    PY_UINT64_T builtins_ver;   /* ma_version_tag of the builtins */
+} _PyOpcache_LoadGlobal;
+
+/* Also used by LOAD_METHOD */
+typedef struct {
+    unsigned int tp_version;    /* tp_version_tag of the owner's type */
+    int kind;                   /* where the attribute was found */
+    Py_ssize_t hint;            /* index of the name in the instance dict */
+    PyObject *descr;            /* result of _PyType_Lookup() */
+} _PyOpcache_LoadAttr;
+
+typedef struct {
+    union {
+        _PyOpcache_LoadGlobal lg;
+        _PyOpcache_LoadAttr la;
+    } u;
+    char optimized;             /* the entry has been filled */
+    unsigned char misses;       /* the entry is given up after too many */
+} _PyOpcache;
+
 /* Bytecode object */
 typedef struct {
     PyObject_HEAD
@@ -35,6 +60,15 @@ typedef struct {
 				   Objects/lnotab_notes.txt for details. */
     void *co_zombieframe;     /* for optimization only (see frameobject.c) */
     PyObject *co_weakreflist;   /* to support weakrefs to code objects */
+
+    /* Per opcode inline caches, created once the code has run often
+       enough.  co_opcache_map is indexed by instruction (offset / 2) and
+       holds 1 + the index of the instruction's entry in co_opcache, or 0
+       for instructions without a cache entry. */
+    unsigned char *co_opcache_map;
+    _PyOpcache *co_opcache;
+    int co_opcache_flag;        /* runs so far, until the caches exist */
+    unsigned char co_opcache_size;  /* length of co_opcache */
 } PyCodeObject;
 
 /* Masks for co_flags above */
@@ -123,6 +157,9 @@ PyAPI_FUNC(int) _PyCode_CheckLineNumber(PyCodeObject* co,
  * depending on the type and the value. The type is the first item to not
  * compare bytes and str which can raise a BytesWarning exception. */
 PyAPI_FUNC(PyObject*) _PyCode_ConstantKey(PyObject *obj);
+
+/* Create the inline caches of a code object */
+PyAPI_FUNC(int) _PyCode_InitOpcache(PyCodeObject *co);
 #endif
 
 PyAPI_FUNC(PyObject*) PyCode_Optimize(PyObject *code, PyObject* consts,
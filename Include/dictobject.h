@@ -23,8 +23,14 @@ typedef struct _dictkeysobject PyDictKeysObject;
 typedef struct {
     PyObject_HEAD
     Py_ssize_t ma_used;
+
+    /* Dictionary version: globally unique, value change each time
+       the dictionary is modified */
+    PY_UINT64_T ma_version_tag;
+
     PyDictKeysObject *ma_keys;
     PyObject **ma_values;
+    _PyObject_LOCK_HEAD
 } PyDictObject;
 
 typedef struct {
@@ -94,6 +100,13 @@ PyAPI_FUNC(PyObject *) PyDict_Copy(PyObject *mp);
 PyAPI_FUNC(int) PyDict_Contains(PyObject *mp, PyObject *key);
 #ifndef Py_LIMITED_API
 PyAPI_FUNC(int) _PyDict_Contains(PyObject *mp, PyObject *key, Py_hash_t hash);
+
+/* Version tag of a dict: every dict gets a new tag when it is created and
+   each time it is modified, so a cache of lookups in a dict is valid as long
+   as the tag is the one it was filled with.  Tags are never 0. */
+PyAPI_FUNC(PY_UINT64_T) PyDict_GetVersion(PyObject *mp);
+#define PyDict_GET_VERSION(mp) (((PyDictObject *)(mp))->ma_version_tag)
+
 PyAPI_FUNC(PyObject *) _PyDict_NewPresized(Py_ssize_t minused);
 PyAPI_FUNC(void) _PyDict_MaybeUntrack(PyObject *mp);
 PyAPI_FUNC(int) _PyDict_HasOnlyStringKeys(PyObject *mp);
@@ -143,6 +156,8 @@ PyAPI_FUNC(void) _PyDict_DebugMallocStats(FILE *out);
 
 int _PyObjectDict_SetItem(PyTypeObject *tp, PyObject **dictptr, PyObject *name, PyObject *value);
 PyObject *_PyDict_LoadGlobal(PyDictObject *, PyDictObject *, PyObject *);
+Py_ssize_t _PyDict_GetItemHint(PyDictObject *, PyObject *, Py_ssize_t,
+                               PyObject **);
 #endif
 
 #ifdef __cplusplus
@@ -37,6 +37,7 @@ typedef struct {
      * the list is not yet visible outside the function that builds it.
      */
     Py_ssize_t allocated;
+    _PyObject_LOCK_HEAD
 } PyListObject;
 #endif
 
@@ -19,6 +19,10 @@ typedef PyObject *(*PyCFunction)(PyObject *, PyObject *);
 typedef PyObject *(*PyCFunctionWithKeywords)(PyObject *, PyObject *,
                                              PyObject *);
 typedef PyObject *(*PyNoArgsFunction)(PyObject *);
+#ifndef Py_LIMITED_API
+typedef PyObject *(*_PyCFunctionFast)(PyObject *self, PyObject **args,
+                                      Py_ssize_t nargs, PyObject *kwnames);
+#endif
 
 PyAPI_FUNC(PyCFunction) PyCFunction_GetFunction(PyObject *);
 PyAPI_FUNC(PyObject *) PyCFunction_GetSelf(PyObject *);
@@ -71,6 +75,18 @@ PyAPI_FUNC(PyObject *) PyCFunction_NewEx(PyMethodDef *, PyObject *,
 
 #define METH_COEXIST   0x0040
 
+/* METH_FASTCALL functions have the _PyCFunctionFast signature: they get
+   their nargs positional arguments, followed by the values of the keyword
+   arguments, in a C array, and the names of the keyword arguments in the
+   kwnames tuple, which is NULL if there are none.  The caller keeps
+   ownership of all of them.  The eval loop passes its value stack
+   directly, without building an argument tuple or a keyword dict.
+   METH_FASTCALL must not be combined with METH_VARARGS, METH_KEYWORDS,
+   METH_NOARGS or METH_O. */
+#ifndef Py_LIMITED_API
+#define METH_FASTCALL  0x0080
+#endif
+
 #ifndef Py_LIMITED_API
 typedef struct {
     PyObject_HEAD
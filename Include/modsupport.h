@@ -17,6 +17,8 @@ extern "C" {
 #define PyArg_ParseTupleAndKeywords     _PyArg_ParseTupleAndKeywords_SizeT
 #define PyArg_VaParse                   _PyArg_VaParse_SizeT
 #define PyArg_VaParseTupleAndKeywords   _PyArg_VaParseTupleAndKeywords_SizeT
+#define _PyArg_ParseStack               _PyArg_ParseStack_SizeT
+#define _PyArg_ParseStackAndKeywords    _PyArg_ParseStackAndKeywords_SizeT
 #define Py_BuildValue                   _Py_BuildValue_SizeT
 #define Py_VaBuildValue                 _Py_VaBuildValue_SizeT
 #else
@@ -38,6 +40,22 @@ PyAPI_FUNC(PyObject *) _Py_BuildValue_SizeT(const char *, ...);
 PyAPI_FUNC(int) _PyArg_NoKeywords(const char *funcname, PyObject *kw);
 PyAPI_FUNC(int) _PyArg_NoPositional(const char *funcname, PyObject *args);
 
+/* Parse the arguments of a METH_FASTCALL function (see methodobject.h):
+   like PyArg_ParseTuple(), PyArg_ParseTupleAndKeywords() and
+   PyArg_UnpackTuple(), with the arguments in a C array. */
+PyAPI_FUNC(int) _PyArg_ParseStack(PyObject **args, Py_ssize_t nargs,
+                                  const char *format, ...);
+PyAPI_FUNC(int) _PyArg_ParseStackAndKeywords(PyObject **args,
+                                             Py_ssize_t nargs,
+                                             PyObject *kwnames,
+                                             const char *format,
+                                             char **kwlist, ...);
+PyAPI_FUNC(int) _PyArg_UnpackStack(PyObject **args, Py_ssize_t nargs,
+                                   const char *name,
+                                   Py_ssize_t min, Py_ssize_t max, ...);
+PyAPI_FUNC(int) _PyArg_NoStackKeywords(const char *funcname,
+                                       PyObject *kwnames);
+
 PyAPI_FUNC(int) PyArg_VaParse(PyObject *, const char *, va_list);
 PyAPI_FUNC(int) PyArg_VaParseTupleAndKeywords(PyObject *, PyObject *,
                                                   const char *, char **, va_list);
@@ -82,9 +82,24 @@ whose size is determined when the object is allocated.
 /* PyObject_HEAD defines the initial segment of every PyObject. */
 #define PyObject_HEAD                   PyObject ob_base;
 
+/* Statically allocated objects are never deallocated.  Without the GIL they
+ * are immortal (see "Immortal objects" below), so that threads don't fight
+ * over their reference counts.
+ */
+#ifdef WITHOUT_GIL
+#if SIZEOF_VOID_P > 4
+#define _Py_IMMORTAL_REFCNT     ((Py_ssize_t)UINT_MAX)
+#else
+#define _Py_IMMORTAL_REFCNT     ((Py_ssize_t)(UINT_MAX >> 2))
+#endif
+#define _Py_STATIC_REFCNT       _Py_IMMORTAL_REFCNT
+#else
+#define _Py_STATIC_REFCNT       1
+#endif
+
 #define PyObject_HEAD_INIT(type)        \
     { _PyObject_EXTRA_INIT              \
-    1, type },
+    _Py_STATIC_REFCNT, type },
 
 #define PyVarObject_HEAD_INIT(type, size)       \
     { PyObject_HEAD_INIT(type) size },
@@ -107,6 +122,11 @@ typedef struct _object {
     _PyObject_HEAD_EXTRA
     Py_ssize_t ob_refcnt;
     struct _typeobject *ob_type;
+#ifdef WITHOUT_GIL
+    /* See "Biased reference counting" below */
+    Py_uintptr_t ob_owner;
+    Py_ssize_t ob_ref_shared;
+#endif
 } PyObject;
 
 typedef struct {
@@ -114,10 +134,95 @@ typedef struct {
     Py_ssize_t ob_size; /* Number of items in variable part */
 } PyVarObject;
 
+#ifdef WITHOUT_GIL
+#define Py_REFCNT(ob)           _Py_RefCnt((PyObject *)(ob))
+#define _Py_SET_REFCNT(ob, n)   _Py_SetRefCnt((PyObject *)(ob), (n))
+#else
 #define Py_REFCNT(ob)           (((PyObject*)(ob))->ob_refcnt)
+#define _Py_SET_REFCNT(ob, n)   (Py_REFCNT(ob) = (n))
+#endif
 #define Py_TYPE(ob)             (((PyObject*)(ob))->ob_type)
 #define Py_SIZE(ob)             (((PyVarObject*)(ob))->ob_size)
 
+#ifdef WITHOUT_GIL
+/* Biased reference counting
+ * =========================
+ *
+ * Without the GIL, updating ob_refcnt with atomic instructions would be
+ * correct but slow: most objects are only ever used by the thread which
+ * created them, and atomic read-modify-write instructions on a cache line
+ * shared between cores are expensive.  Instead, every object is owned by
+ * one thread state (ob_owner), and its reference count is split in two:
+ *
+ * - ob_refcnt counts the references taken by the owner thread, which
+ *   updates it with plain instructions;
+ * - ob_ref_shared counts the references taken by every other thread, which
+ *   update it with atomic instructions.  The count is shifted left by
+ *   _Py_REF_SHARED_SHIFT bits to make room for the _Py_REF_QUEUED and
+ *   _Py_REF_MERGED flags.
+ *
+ * The true reference count is the sum of both, and either part may be
+ * negative on its own (for instance when another thread drops a reference
+ * taken by the owner).  When the shared part is about to become negative,
+ * the thread dropping the reference sets _Py_REF_QUEUED instead and hands
+ * the object (with its reference) to the owner, which merges both counts
+ * the next time it runs the eval loop.  When the local part drops to zero
+ * while other threads still hold references, the owner gives the object
+ * up: it sets _Py_REF_MERGED, and the shared count alone decides when the
+ * object dies.  Objects without an owner (ob_owner == 0), such as
+ * statically allocated objects, only use the shared count.
+ *
+ * _Py_ThreadId identifies the thread state of the running thread, or is 0
+ * if the thread has none.
+ */
+#define _Py_REF_SHARED_SHIFT    2
+#define _Py_REF_QUEUED          1
+#define _Py_REF_MERGED          2
+#define _Py_REF_FLAGS_MASK      3
+#define _Py_REF_SHARED_ONE      ((Py_ssize_t)1 << _Py_REF_SHARED_SHIFT)
+
+PyAPI_DATA(Py_THREAD_LOCAL Py_uintptr_t) _Py_ThreadId;
+
+PyAPI_FUNC(void) _Py_SetRefCnt(PyObject *, Py_ssize_t);
+
+Py_LOCAL_INLINE(Py_ssize_t)
+_Py_RefCnt(PyObject *op)
+{
+    Py_ssize_t shared = __atomic_load_n(&op->ob_ref_shared, __ATOMIC_RELAXED);
+    return op->ob_refcnt + (shared >> _Py_REF_SHARED_SHIFT);
+}
+
+Py_LOCAL_INLINE(int)
+_Py_IsOwnedByCurrentThread(PyObject *op)
+{
+    Py_uintptr_t id = _Py_ThreadId;
+    return id != 0 && op->ob_owner == id;
+}
+
+/* Immortal objects
+ * ================
+ *
+ * Some objects are used by every thread all the time: None, True and
+ * False, the small ints and interned strings.  Even with biased reference
+ * counting, their shared counts would make their cache lines bounce between
+ * cores.  Such objects are made immortal instead: they have no owner and
+ * their ob_refcnt is _Py_IMMORTAL_REFCNT, which Py_INCREF() and Py_DECREF()
+ * check for before touching anything, and they are never deallocated.
+ * Py_REFCNT() of an immortal object stays around _Py_IMMORTAL_REFCNT.
+ *
+ * _Py_SetImmortal() forgets the references the object had, including those
+ * other threads hold: it may only be used on objects that are meant to live
+ * until the interpreter exits.
+ */
+PyAPI_FUNC(void) _Py_SetImmortal(PyObject *);
+
+Py_LOCAL_INLINE(int)
+_Py_IsImmortal(PyObject *op)
+{
+    return op->ob_owner == 0 && op->ob_refcnt == _Py_IMMORTAL_REFCNT;
+}
+#endif /* WITHOUT_GIL */
+
 /********************* String Literals ****************************************/
 /* This structure helps managing static strings. The basic usage goes like this:
    Instead of doing
@@ -564,6 +669,10 @@ _PyObject_GenericGetAttrWithDict(PyObject *, PyObject *, PyObject *);
 PyAPI_FUNC(int)
 _PyObject_GenericSetAttrWithDict(PyObject *, PyObject *,
                                  PyObject *, PyObject *);
+#ifndef Py_LIMITED_API
+/* Attribute lookup for LOAD_METHOD, see Objects/object.c */
+PyAPI_FUNC(int) _PyObject_GetMethod(PyObject *, PyObject *, PyObject **);
+#endif
 
 /* Helper to look up a builtin object */
 #ifndef Py_LIMITED_API
@@ -708,13 +817,17 @@ you can count such references to the type object.)
 PyAPI_DATA(Py_ssize_t) _Py_RefTotal;
 PyAPI_FUNC(void) _Py_NegativeRefcount(const char *fname,
                                             int lineno, PyObject *op);
-PyAPI_FUNC(PyObject *) _PyDict_Dummy(void);
 PyAPI_FUNC(Py_ssize_t) _Py_GetRefTotal(void);
+#ifdef WITHOUT_GIL
+#define _Py_INC_REFTOTAL        __atomic_add_fetch(&_Py_RefTotal, 1, __ATOMIC_RELAXED)
+#define _Py_DEC_REFTOTAL        __atomic_sub_fetch(&_Py_RefTotal, 1, __ATOMIC_RELAXED)
+#else
 #define _Py_INC_REFTOTAL        _Py_RefTotal++
 #define _Py_DEC_REFTOTAL        _Py_RefTotal--
+#endif
 #define _Py_REF_DEBUG_COMMA     ,
 #define _Py_CHECK_REFCNT(OP)                                    \
-{       if (((PyObject*)OP)->ob_refcnt < 0)                             \
+{       if (Py_REFCNT(OP) < 0)                                          \
                 _Py_NegativeRefcount(__FILE__, __LINE__,        \
                                      (PyObject *)(OP));         \
 }
@@ -761,7 +874,7 @@ PyAPI_FUNC(void) _Py_AddToAllObjects(PyObject *, int force);
 #define _Py_NewReference(op) (                          \
     _Py_INC_TPALLOCS(op) _Py_COUNT_ALLOCS_COMMA         \
     _Py_INC_REFTOTAL  _Py_REF_DEBUG_COMMA               \
-    Py_REFCNT(op) = 1)
+    _Py_INIT_REFCNT(op))
 
 #define _Py_ForgetReference(op) _Py_INC_TPFREES(op)
 
@@ -774,6 +887,61 @@ PyAPI_FUNC(void) _Py_Dealloc(PyObject *);
 #endif
 #endif /* !Py_TRACE_REFS */
 
+#ifdef WITHOUT_GIL
+/* See "Biased reference counting" above.  The slow paths live in
+ * Objects/object.c.
+ */
+PyAPI_FUNC(void) _Py_DecRefShared(PyObject *);
+PyAPI_FUNC(void) _Py_MergeZeroRefCnt(PyObject *);
+PyAPI_FUNC(Py_ssize_t) _Py_ExplicitMergeRefCnt(PyObject *, Py_ssize_t);
+
+Py_LOCAL_INLINE(void)
+_Py_InitRefCnt(PyObject *op)
+{
+    op->ob_owner = _Py_ThreadId;
+    op->ob_refcnt = 1;
+    op->ob_ref_shared = 0;
+}
+
+Py_LOCAL_INLINE(void)
+_Py_IncRefBiased(PyObject *op)
+{
+    if (_Py_IsOwnedByCurrentThread(op))
+        op->ob_refcnt++;
+    else if (!_Py_IsImmortal(op))
+        __atomic_add_fetch(&op->ob_ref_shared, _Py_REF_SHARED_ONE,
+                           __ATOMIC_RELAXED);
+}
+
+Py_LOCAL_INLINE(void)
+_Py_DecRefBiased(PyObject *op)
+{
+    if (_Py_IsOwnedByCurrentThread(op)) {
+        if (--op->ob_refcnt == 0)
+            _Py_MergeZeroRefCnt(op);
+    }
+    else if (!_Py_IsImmortal(op))
+        _Py_DecRefShared(op);
+}
+
+#define _Py_INIT_REFCNT(op) _Py_InitRefCnt((PyObject *)(op))
+
+#define Py_INCREF(op) (                         \
+    _Py_INC_REFTOTAL  _Py_REF_DEBUG_COMMA       \
+    _Py_IncRefBiased((PyObject *)(op)))
+
+/* The slow paths decide whether the object dies: the sign of either part
+   of the reference count means nothing on its own, so there is no
+   _Py_CHECK_REFCNT() here. */
+#define Py_DECREF(op)                                   \
+    do {                                                \
+        PyObject *_py_decref_tmp = (PyObject *)(op);    \
+        _Py_DEC_REFTOTAL;                               \
+        _Py_DecRefBiased(_py_decref_tmp);               \
+    } while (0)
+#else
+#define _Py_INIT_REFCNT(op) (Py_REFCNT(op) = 1)
+
 #define Py_INCREF(op) (                         \
     _Py_INC_REFTOTAL  _Py_REF_DEBUG_COMMA       \
     ((PyObject *)(op))->ob_refcnt++)
@@ -787,6 +955,7 @@ PyAPI_FUNC(void) _Py_Dealloc(PyObject *);
         else                                            \
             _Py_Dealloc(_py_decref_tmp);                \
     } while (0)
+#endif /* WITHOUT_GIL */
 
 /* Safely decref `op` and set `op` to NULL, especially useful in tp_clear
  * and tp_dealloc implementations.
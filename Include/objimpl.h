@@ -109,6 +109,15 @@ PyAPI_FUNC(void) _PyObject_DebugMallocStats(FILE *out);
 #endif /* #ifndef Py_LIMITED_API */
 #endif
 
+#if defined(WITHOUT_GIL) && !defined(Py_LIMITED_API)
+/* Without the GIL, every thread allocates small objects from its own heap.
+   _PyObject_ReleaseHeap() hands the heap of an exiting thread over to the
+   next thread, and _PyObject_AfterForkHeaps() does the same in the child
+   process for the heaps of the threads which didn't survive fork(). */
+PyAPI_FUNC(void) _PyObject_ReleaseHeap(void);
+PyAPI_FUNC(void) _PyObject_AfterForkHeaps(void);
+#endif
+
 /* Macros */
 #define PyObject_MALLOC         PyObject_Malloc
 #define PyObject_REALLOC        PyObject_Realloc
@@ -259,8 +268,11 @@ extern PyGC_Head *_PyGC_generation0;
 
 /* Bit 0 is set when tp_finalize is called */
 #define _PyGC_REFS_MASK_FINALIZED  (1 << 0)
-/* The (N-1) most significant bits contain the gc state / refcount */
-#define _PyGC_REFS_SHIFT           (1)
+/* Bit 1 tells the incremental collection of the oldest generation which
+   objects it already scanned during the current pass */
+#define _PyGC_REFS_MASK_VISITED    (1 << 1)
+/* The (N-2) most significant bits contain the gc state / refcount */
+#define _PyGC_REFS_SHIFT           (2)
 #define _PyGC_REFS_MASK            (((size_t) -1) << _PyGC_REFS_SHIFT)
 
 #define _PyGCHead_REFS(g) ((g)->gc.gc_refs >> _PyGC_REFS_SHIFT)
@@ -285,6 +297,12 @@ extern PyGC_Head *_PyGC_generation0;
 #define _PyGC_REFS_REACHABLE                    (-3)
 #define _PyGC_REFS_TENTATIVELY_UNREACHABLE      (-4)
 
+#ifdef WITHOUT_GIL
+/* Without the GIL, the generation lists are protected by a lock which
+ * lives in gcmodule.c, so the macros defer to the functions. */
+#define _PyObject_GC_TRACK(o) PyObject_GC_Track(o)
+#define _PyObject_GC_UNTRACK(o) PyObject_GC_UnTrack(o)
+#else
 /* Tell the GC to track this object.  NB: While the object is tracked the
  * collector it must be safe to call the ob_traverse method. */
 #define _PyObject_GC_TRACK(o) do { \
@@ -310,6 +328,7 @@ extern PyGC_Head *_PyGC_generation0;
     g->gc.gc_next->gc.gc_prev = g->gc.gc_prev; \
     g->gc.gc_next = NULL; \
     } while (0);
+#endif /* WITHOUT_GIL */
 
 /* True if the object is currently tracked by the GC. */
 #define _PyObject_GC_IS_TRACKED(o) \
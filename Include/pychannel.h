@@ -0,0 +1,50 @@
+#ifndef Py_PYCHANNEL_H
+#define Py_PYCHANNEL_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Channels pass buffers between interpreters, or between threads, of the
+   same process without copying them.
+
+   A channel is a FIFO queue identified by a number, so that any
+   interpreter can use it: Python objects can't be shared between
+   interpreters, but ids can be passed in the source code given to a
+   sub-interpreter.  The sender keeps ownership of the memory: the receiver
+   gets a read-only memoryview of the sender's buffer, which keeps the
+   exporting object (bytes, bytearray, array...) alive until the view is
+   released.  Writes made through the sender's object after sending are
+   visible to the receiver. */
+
+#if defined(WITH_THREAD) && !defined(Py_LIMITED_API)
+
+/* Create a channel.  Return its id, or -1 with an exception set. */
+PyAPI_FUNC(Py_ssize_t) _PyChannel_Create(void);
+
+/* Send the buffer of obj, which must support the buffer protocol.  Return 0
+   on success, or -1 with an exception set: ValueError if the channel doesn't
+   exist or is closed. */
+PyAPI_FUNC(int) _PyChannel_Send(Py_ssize_t id, PyObject *obj);
+
+/* Receive the oldest buffer sent, waiting for at most timeout (0 not to
+   wait, a negative value to wait forever).  Return a new reference to a
+   read-only memoryview, or NULL with an exception set: TimeoutError if
+   nothing came in time, EOFError if the channel was closed and all its
+   buffers received (receiving from a channel which was closed and drained
+   keeps raising EOFError), ValueError if the channel doesn't exist. */
+PyAPI_FUNC(PyObject *) _PyChannel_Recv(Py_ssize_t id, _PyTime_t timeout);
+
+/* Close a channel: it accepts no more buffers, and receivers get EOFError
+   once the buffers already sent are received.  Return 0 on success, or -1
+   with ValueError set if the channel doesn't exist or was already closed. */
+PyAPI_FUNC(int) _PyChannel_Close(Py_ssize_t id);
+
+/* The type of the objects holding received buffers */
+PyAPI_DATA(PyTypeObject) _PyChannelBuffer_Type;
+
+#endif /* WITH_THREAD && !Py_LIMITED_API */
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* !Py_PYCHANNEL_H */
@@ -0,0 +1,64 @@
+#ifndef Py_PYLOCK_H
+#define Py_PYLOCK_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Locks protecting individual objects when the interpreter is built
+   without the global interpreter lock (--without-gil).
+
+   In the default build the GIL already serializes all access to objects,
+   so _PyObject_LOCK() and _PyObject_UNLOCK() expand to nothing and the
+   object structures carry no lock at all. */
+
+#if defined(WITHOUT_GIL) && !defined(Py_LIMITED_API)
+
+/* A recursive lock small enough to be embedded in every container.
+   `owner` is the PyThread_get_thread_ident() of the thread holding the lock,
+   or 0 when it is free; `depth` counts the nested acquisitions made by the
+   owner.  Acquiring an uncontended lock is a single compare-and-swap.
+
+   The lock is recursive because the code holding it may call back into
+   Python (__hash__, __eq__, __del__...), which can touch the same object
+   again from the same thread. */
+typedef struct {
+    long owner;
+    long depth;
+} _PyLock;
+
+#define _PyLock_INIT {0, 0}
+
+PyAPI_FUNC(void) _PyLock_Acquire(_PyLock *lock);
+PyAPI_FUNC(void) _PyLock_Release(_PyLock *lock);
+PyAPI_FUNC(int) _PyLock_IsOwned(_PyLock *lock);
+
+/* Forget the owner of a lock; used in the child process after fork(), where
+   the thread which held the lock no longer exists. */
+#define _PyLock_Reset(lock) ((lock)->owner = 0, (lock)->depth = 0)
+
+/* Objects which need a lock declare one with _PyObject_LOCK_HEAD, as their
+   last member so that the layout of the other members doesn't change. */
+#define _PyObject_LOCK_HEAD     _PyLock ob_lock;
+#define _PyObject_LOCK_INIT(op) _PyLock_Reset(&(op)->ob_lock)
+#define _PyObject_LOCK(op)      _PyLock_Acquire(&(op)->ob_lock)
+#define _PyObject_UNLOCK(op)    _PyLock_Release(&(op)->ob_lock)
+
+/* Interpreter-wide caches which are cheap to duplicate, such as the free
+   lists of the builtin types, are kept per thread rather than locked.
+   Objects left in the caches of a thread which exits are never reused. */
+#define _Py_PER_THREAD          Py_THREAD_LOCAL
+
+#else
+
+#define _PyObject_LOCK_HEAD
+#define _PyObject_LOCK_INIT(op) ((void)0)
+#define _PyObject_LOCK(op)      ((void)0)
+#define _PyObject_UNLOCK(op)    ((void)0)
+#define _Py_PER_THREAD
+
+#endif /* WITHOUT_GIL */
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* !Py_PYLOCK_H */
@@ -62,6 +62,8 @@
     (sizeof(array) / sizeof((array)[0]))
 #endif
 
+/* Get the size of a structure member in bytes */
+#define Py_MEMBER_SIZE(type, member) sizeof(((type *)0)->member)
 
 /* Define macros for inline documentation. */
 #define PyDoc_VAR(name) static char name[]
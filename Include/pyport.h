@@ -834,6 +834,16 @@ extern pid_t forkpty(int *, char *, struct termios *, struct winsize *);
 #define Py_ALIGNED(x)
 #endif
 
+/*
+ * Declare a variable with one instance per thread, on compilers that
+ * support it.  Py_THREAD_LOCAL is left undefined everywhere else.
+ */
+#if defined(_MSC_VER)
+#define Py_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) && __GNUC__ >= 3
+#define Py_THREAD_LOCAL __thread
+#endif
+
 /* Eliminate end-of-loop code not reached warnings from SunPro C
  * when using do{...}while(0) macros
  */
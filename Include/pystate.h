@@ -66,6 +66,9 @@ typedef int (*Py_tracefunc)(PyObject *, struct _frame *, int, PyObject *);
 #ifdef Py_LIMITED_API
 typedef struct _ts PyThreadState;
 #else
+/* Size of the ring of pending calls of a thread state */
+#define _Py_THREAD_NPENDINGCALLS 16
+
 typedef struct _ts {
     /* See Python/ceval.c for comments explaining most fields */
 
@@ -137,6 +140,51 @@ typedef struct _ts {
     PyObject *coroutine_wrapper;
     int in_coroutine_wrapper;
 
+    /* GIL statistics of this thread (see Python/ceval_gil.h): number of
+       acquisitions, of acquisitions which had to wait, and total time spent
+       waiting for and holding the GIL, in nanoseconds.  gil_taken_at is
+       the time of the last acquisition, or 0 if the GIL isn't held. */
+    Py_ssize_t gil_acquire_count;
+    Py_ssize_t gil_wait_count;
+    _PyTime_t gil_wait_time;
+    _PyTime_t gil_hold_time;
+    _PyTime_t gil_taken_at;
+
+    /* Requests for this thread, and only this one, to break out of the
+     * fast path of the eval loop (see Python/ceval.c), and the ring of
+     * calls queued for it by Py_AddPendingCallToThread().  The requests
+     * are set by any thread and cleared by this one; the ring is
+     * protected by a lock in ceval.c.
+     */
+    int eval_breaker;
+    int pendingcalls_to_do;
+    int pendingfirst;
+    int pendinglast;
+    struct {
+        int (*func)(void *);
+        void *arg;
+    } pendingcalls[_Py_THREAD_NPENDINGCALLS];
+
+    /* Storage of the _thread._local objects: each of them owns a slot
+     * number, and keeps its data for this thread in that slot.  The
+     * array holds strong references, grows on demand and is protected by
+     * a lock in pystate.c, except that this thread reads it without one.
+     */
+    PyObject **tls_slots;
+    Py_ssize_t tls_nslots;
+
+#ifdef WITHOUT_GIL
+    /* Objects owned by this thread that other threads handed back, for
+     * their reference counts to be merged (see "Biased reference counting"
+     * in object.h).  Protected by a lock in pystate.c, which also links
+     * the live thread states through refcnt_merge_next.
+     */
+    PyObject **refcnt_merge_queue;
+    Py_ssize_t refcnt_merge_len;
+    Py_ssize_t refcnt_merge_allocated;
+    struct _ts *refcnt_merge_next;
+#endif
+
     /* XXX signal handlers should also be here */
 
 } PyThreadState;
@@ -163,6 +211,10 @@ PyAPI_FUNC(void) _PyThreadState_Init(PyThreadState *);
 PyAPI_FUNC(void) PyThreadState_Clear(PyThreadState *);
 PyAPI_FUNC(void) PyThreadState_Delete(PyThreadState *);
 PyAPI_FUNC(void) _PyThreadState_DeleteExcept(PyThreadState *tstate);
+#ifdef WITHOUT_GIL
+PyAPI_FUNC(void) _PyThreadState_QueueRefCntMerge(PyObject *);
+PyAPI_FUNC(void) _PyThreadState_MergeRefCnts(PyThreadState *);
+#endif
 #ifdef WITH_THREAD
 PyAPI_FUNC(void) PyThreadState_DeleteCurrent(void);
 PyAPI_FUNC(void) _PyGILState_Reinit(void);
@@ -185,9 +237,24 @@ PyAPI_FUNC(int) PyThreadState_SetAsyncExc(long, PyObject *);
 /* Variable and macro for in-line access to current thread state */
 
 /* Assuming the current thread holds the GIL, this is the
-   PyThreadState for the current thread. */
+   PyThreadState for the current thread.  Without the GIL, every running
+   thread has its own current thread state.
+
+   Where the compiler supports thread-local variables, the variable is
+   thread-local with the GIL too, so that reading it is a single load
+   which never races with another thread switching the GIL.  It is then
+   NULL in every thread which doesn't hold the GIL. */
+#if defined(WITHOUT_GIL) || \
+    (defined(WITH_THREAD) && defined(Py_THREAD_LOCAL) && !defined(MS_WINDOWS))
+#define _Py_TSTATE_THREAD_LOCAL
+#endif
+
 #ifdef Py_BUILD_CORE
+#ifdef _Py_TSTATE_THREAD_LOCAL
+PyAPI_DATA(Py_THREAD_LOCAL _Py_atomic_address) _PyThreadState_Current;
+#else
 PyAPI_DATA(_Py_atomic_address) _PyThreadState_Current;
+#endif
 #  define PyThreadState_GET() \
              ((PyThreadState*)_Py_atomic_load_relaxed(&_PyThreadState_Current))
 #else
@@ -267,6 +334,19 @@ PyAPI_FUNC(PyInterpreterState *) _PyGILState_GetInterpreterStateUnsafe(void);
 */
 #ifndef Py_LIMITED_API
 PyAPI_FUNC(PyObject *) _PyThread_CurrentFrames(void);
+PyAPI_FUNC(PyObject *) _PyThread_GILStats(void);
+PyAPI_FUNC(int) _PyThreadState_ForThread(
+    long id, int (*func)(PyThreadState *, void *), void *arg);
+
+/* Slots of thread-local storage (see tls_slots above).
+   _PyThreadState_GET_TLS_SLOT() returns a borrowed reference, or NULL if
+   nothing is stored in the slot for that thread. */
+PyAPI_FUNC(Py_ssize_t) _PyThreadState_NewTLSSlot(void);
+PyAPI_FUNC(void) _PyThreadState_FreeTLSSlot(Py_ssize_t index);
+PyAPI_FUNC(int) _PyThreadState_SetTLSSlot(
+    PyThreadState *tstate, Py_ssize_t index, PyObject *value);
+#define _PyThreadState_GET_TLS_SLOT(tstate, index) \
+    ((index) < (tstate)->tls_nslots ? (tstate)->tls_slots[index] : NULL)
 #endif
 
 /* Routines for advanced debuggers, requested by David Beazley.
@@ -71,6 +71,38 @@ PyAPI_FUNC(PyLockStatus) PyThread_acquire_lock_timed(PyThread_type_lock,
 
 PyAPI_FUNC(void) PyThread_release_lock(PyThread_type_lock);
 
+#ifndef Py_LIMITED_API
+/* A lock embedded in the structure which uses it, rather than allocated by
+   PyThread_allocate_lock().  The functions below behave like their
+   PyThread_*_lock() counterparts.
+
+   On Linux the lock is a futex word: an uncontended acquire or release is
+   a single atomic instruction, and a contended acquire spins for a while,
+   adapting to how long the lock is usually held, before sleeping in the
+   kernel.  On other platforms it wraps a lock from PyThread_allocate_lock().
+
+   _PyThread_lock_init() returns -1, without setting an exception, if the
+   lock cannot be created; _PyThread_lock_fini() must still be called. */
+#if defined(__linux__) && defined(WITH_THREAD)
+#define _Py_HAVE_FUTEX_LOCKS
+typedef struct {
+    int state;  /* 0: unlocked, 1: locked, 2: locked with waiters */
+    int spins;  /* average number of spins before acquiring */
+} _PyThread_lock;
+#else
+typedef struct {
+    PyThread_type_lock lock;
+} _PyThread_lock;
+#endif
+
+PyAPI_FUNC(int) _PyThread_lock_init(_PyThread_lock *);
+PyAPI_FUNC(void) _PyThread_lock_fini(_PyThread_lock *);
+PyAPI_FUNC(PyLockStatus) _PyThread_lock_acquire_timed(_PyThread_lock *,
+                                                      PY_TIMEOUT_T microseconds,
+                                                      int intr_flag);
+PyAPI_FUNC(void) _PyThread_lock_release(_PyThread_lock *);
+#endif
+
 PyAPI_FUNC(size_t) PyThread_get_stacksize(void);
 PyAPI_FUNC(int) PyThread_set_stacksize(size_t);
 
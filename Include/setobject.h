@@ -62,6 +62,7 @@ typedef struct {
 
     setentry smalltable[PySet_MINSIZE];
     PyObject *weakreflist;      /* List of weak references */
+    _PyObject_LOCK_HEAD
 } PySetObject;
 
 #define PySet_GET_SIZE(so) (((PySetObject *)(so))->used)
@@ -34,7 +34,7 @@ def _python_exit():
     _shutdown = True
     items = list(_threads_queues.items())
     for t, q in items:
-        q.put(None)
+        q.close()
     for t, q in items:
         t.join()
 
@@ -58,25 +58,48 @@ class _WorkItem(object):
         else:
             self.future.set_result(result)
 
-def _worker(executor_reference, work_queue):
-    try:
+class _WorkQueue(object):
+    """A queue of callables run by worker threads.
+
+    This is the pure Python version of _executor.WorkQueue, which gives
+    each worker its own deque and lets idle workers steal from the others.
+    """
+    def __init__(self, nworkers):
+        if nworkers <= 0:
+            raise ValueError("nworkers must be greater than 0")
+        self._queue = queue.Queue()
+        self._closed = False
+
+    def put(self, item):
+        if self._closed:
+            raise RuntimeError('cannot put items in a closed queue')
+        self._queue.put(item)
+
+    def close(self):
+        self._closed = True
+        self._queue.put(None)
+
+    def run_worker(self, index):
         while True:
-            work_item = work_queue.get(block=True)
-            if work_item is not None:
-                work_item.run()
-                # Delete references to object. See issue16284
-                del work_item
-                continue
-            executor = executor_reference()
-            # Exit if:
-            #   - The interpreter is shutting down OR
-            #   - The executor that owns the worker has been collected OR
-            #   - The executor that owns the worker has been shutdown.
-            if _shutdown or executor is None or executor._shutdown:
+            item = self._queue.get(block=True)
+            if item is None:
                 # Notice other workers
-                work_queue.put(None)
+                self._queue.put(None)
                 return
-            del executor
+            item()
+            # Delete references to object. See issue16284
+            del item
+
+try:
+    from _executor import WorkQueue as _WorkQueue
+except ImportError:
+    pass
+
+def _worker(executor_reference, work_queue, index):
+    # executor_reference is only there for its callback, which closes
+    # work_queue when the executor gets lost.
+    try:
+        work_queue.run_worker(index)
     except BaseException:
         _base.LOGGER.critical('Exception in worker', exc_info=True)
 
@@ -96,7 +119,7 @@ class ThreadPoolExecutor(_base.Executor):
             raise ValueError("max_workers must be greater than 0")
 
         self._max_workers = max_workers
-        self._work_queue = queue.Queue()
+        self._work_queue = _WorkQueue(max_workers)
         self._threads = set()
         self._shutdown = False
         self._shutdown_lock = threading.Lock()
@@ -109,22 +132,23 @@ class ThreadPoolExecutor(_base.Executor):
             f = _base.Future()
             w = _WorkItem(f, fn, args, kwargs)
 
-            self._work_queue.put(w)
+            self._work_queue.put(w.run)
             self._adjust_thread_count()
             return f
     submit.__doc__ = _base.Executor.submit.__doc__
 
     def _adjust_thread_count(self):
-        # When the executor gets lost, the weakref callback will wake up
-        # the worker threads.
+        # When the executor gets lost, the weakref callback closes the
+        # queue, and the worker threads exit once it is empty.
         def weakref_cb(_, q=self._work_queue):
-            q.put(None)
+            q.close()
         # TODO(bquinlan): Should avoid creating new threads if there are more
         # idle threads than items in the work queue.
         if len(self._threads) < self._max_workers:
             t = threading.Thread(target=_worker,
                                  args=(weakref.ref(self, weakref_cb),
-                                       self._work_queue))
+                                       self._work_queue,
+                                       len(self._threads)))
             t.daemon = True
             t.start()
             self._threads.add(t)
@@ -133,7 +157,7 @@ class ThreadPoolExecutor(_base.Executor):
     def shutdown(self, wait=True):
         with self._shutdown_lock:
             self._shutdown = True
-            self._work_queue.put(None)
+            self._work_queue.close()
         if wait:
             for t in self._threads:
                 t.join()
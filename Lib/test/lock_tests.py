@@ -138,6 +138,24 @@ class BaseLockTests(BaseTestCase):
         b.wait_for_finished()
         self.assertEqual(len(b.finished), N)
 
+    def test_mutual_exclusion(self):
+        # Several threads hammering the same lock must never be inside the
+        # critical section at the same time.
+        lock = self.locktype()
+        N = 5
+        inside = []
+        errors = []
+        def f():
+            for i in range(1000):
+                lock.acquire()
+                inside.append(None)
+                if len(inside) != 1:
+                    errors.append(len(inside))
+                inside.pop()
+                lock.release()
+        Bunch(f, N).wait_for_finished()
+        self.assertEqual(errors, [])
+
     def test_with(self):
         lock = self.locktype()
         def f():
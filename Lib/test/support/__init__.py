@@ -1473,6 +1473,9 @@ _align = '0n'
 if hasattr(sys, "gettotalrefcount"):
     _header = '2P' + _header
     _align = '0P'
+if sysconfig.get_config_var('WITHOUT_GIL'):
+    # ob_owner and ob_ref_shared
+    _header += 'Pn'
 _vheader = _header + 'n'
 
 def calcobjsize(fmt):
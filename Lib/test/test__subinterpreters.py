@@ -0,0 +1,185 @@
+import textwrap
+import time
+import unittest
+from test import support
+threading = support.import_module('threading')
+_subinterpreters = support.import_module('_subinterpreters')
+
+run_string = _subinterpreters.run_string
+create = _subinterpreters.channel_create
+send = _subinterpreters.channel_send
+recv = _subinterpreters.channel_recv
+close = _subinterpreters.channel_close
+
+
+def subinterp_source(source, **names):
+    return textwrap.dedent(source).format(**names)
+
+
+class RunStringTest(unittest.TestCase):
+
+    def test_run_string(self):
+        cid = create()
+        run_string(subinterp_source("""
+            import _subinterpreters, sys
+            _subinterpreters.channel_send({cid}, repr(sys.modules is not None).encode())
+            """, cid=cid))
+        self.assertEqual(bytes(recv(cid, 0)), b'True')
+        close(cid)
+
+    def test_isolation(self):
+        cid = create()
+        run_string(subinterp_source("""
+            import _subinterpreters
+            x = 42
+            """))
+        run_string(subinterp_source("""
+            import _subinterpreters
+            _subinterpreters.channel_send({cid}, repr('x' in globals()).encode())
+            """, cid=cid))
+        self.assertEqual(bytes(recv(cid, 0)), b'False')
+        close(cid)
+
+    def test_error(self):
+        with self.assertRaises(RuntimeError):
+            run_string("import io, sys; sys.stderr = io.StringIO(); 1/0")
+        with self.assertRaises(TypeError):
+            run_string(b"pass")
+
+    def test_threads(self):
+        cid = create()
+        source = subinterp_source("""
+            import _subinterpreters
+            total = 0
+            for i in range(1000):
+                total += i
+            _subinterpreters.channel_send({cid}, str(total).encode())
+            """, cid=cid)
+        threads = [threading.Thread(target=run_string, args=(source,))
+                   for i in range(4)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        results = [bytes(recv(cid, 0)) for t in threads]
+        self.assertEqual(results, [b'499500'] * len(threads))
+        close(cid)
+
+
+class ChannelTest(unittest.TestCase):
+
+    def test_fifo(self):
+        cid = create()
+        for i in range(10):
+            send(cid, str(i).encode())
+        self.assertEqual([bytes(recv(cid)) for i in range(10)],
+                         [str(i).encode() for i in range(10)])
+        close(cid)
+
+    def test_ids(self):
+        a = create()
+        b = create()
+        self.assertIsInstance(a, int)
+        self.assertNotEqual(a, b)
+        send(a, b'a')
+        with self.assertRaises(TimeoutError):
+            recv(b, 0)
+        self.assertEqual(bytes(recv(a, 0)), b'a')
+        close(a)
+        close(b)
+
+    def test_no_copy(self):
+        cid = create()
+        data = bytearray(b'spam')
+        send(cid, data)
+        view = recv(cid)
+        self.assertIsInstance(view, memoryview)
+        self.assertTrue(view.readonly)
+        data[0] = ord('S')
+        self.assertEqual(bytes(view), b'Spam')
+        with self.assertRaises(TypeError):
+            view[0] = 0
+        # The view keeps the buffer exported
+        with self.assertRaises(BufferError):
+            data.append(0)
+        view.release()
+        data.append(0)
+        close(cid)
+
+    def test_send_errors(self):
+        cid = create()
+        with self.assertRaises(TypeError):
+            send(cid, 'str')
+        with self.assertRaises(TypeError):
+            send(cid, None)
+        close(cid)
+
+    def test_timeout(self):
+        cid = create()
+        with self.assertRaises(TimeoutError):
+            recv(cid, 0)
+        t = time.monotonic()
+        with self.assertRaises(TimeoutError):
+            recv(cid, 0.01)
+        self.assertGreaterEqual(time.monotonic() - t, 0.005)
+        with self.assertRaises(ValueError):
+            recv(cid, -1)
+        with self.assertRaises(OverflowError):
+            recv(cid, 1e20)
+        close(cid)
+
+    def test_wait(self):
+        cid = create()
+        timer = threading.Timer(0.01, send, (cid, b'late'))
+        timer.start()
+        self.assertEqual(bytes(recv(cid, 60)), b'late')
+        timer.join()
+        close(cid)
+
+    def test_close(self):
+        cid = create()
+        send(cid, b'1')
+        send(cid, b'2')
+        close(cid)
+        with self.assertRaises(ValueError):
+            send(cid, b'3')
+        with self.assertRaises(ValueError):
+            close(cid)
+        self.assertEqual(bytes(recv(cid)), b'1')
+        self.assertEqual(bytes(recv(cid)), b'2')
+        with self.assertRaises(EOFError):
+            recv(cid)
+        with self.assertRaises(EOFError):
+            recv(cid, 0)
+        with self.assertRaises(ValueError):
+            send(cid, b'3')
+
+    def test_close_wakes_receivers(self):
+        cid = create()
+        errors = []
+        def receive():
+            try:
+                recv(cid, 60)
+            except EOFError:
+                errors.append('EOF')
+        threads = [threading.Thread(target=receive) for i in range(3)]
+        for t in threads:
+            t.start()
+        time.sleep(0.01)
+        close(cid)
+        for t in threads:
+            t.join()
+        self.assertEqual(errors, ['EOF'] * 3)
+
+    def test_unknown(self):
+        for cid in (-1, 0, 2**40):
+            with self.assertRaises(ValueError):
+                send(cid, b'')
+            with self.assertRaises(ValueError):
+                recv(cid, 0)
+            with self.assertRaises(ValueError):
+                close(cid)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -1,3 +1,4 @@
+import functools
 import unittest
 
 # The test cases here cover several paths through the function calling
@@ -122,5 +123,58 @@ class CFunctionCalls(unittest.TestCase):
         self.assertRaises(TypeError, [].count, x=2, y=2)
 
 
+class FastCallTests(unittest.TestCase):
+    # dict.get() and int.to_bytes() are METH_FASTCALL functions: the eval
+    # loop passes them its stack, while the ext and partial calls go
+    # through PyCFunction_Call() with an argument tuple and dict.
+
+    def test_positional(self):
+        d = {1: 2}
+        self.assertEqual(d.get(1), 2)
+        self.assertEqual(d.get(3, 4), 4)
+        self.assertRaises(TypeError, d.get)
+        self.assertRaises(TypeError, d.get, 1, 2, 3)
+
+    def test_positional_ext(self):
+        d = {1: 2}
+        self.assertEqual(d.get(*(3, 4)), 4)
+        self.assertEqual(d.get(*(1,), **{}), 2)
+        self.assertEqual(dict.get(*(d, 1)), 2)
+
+    def test_positional_kw(self):
+        d = {1: 2}
+        with self.assertRaisesRegex(TypeError, 'takes no keyword arguments'):
+            d.get(1, default=2)
+        with self.assertRaisesRegex(TypeError, 'takes no keyword arguments'):
+            d.get(**{'key': 1})
+
+    def test_keywords(self):
+        self.assertEqual((5).to_bytes(2, 'big'), b'\x00\x05')
+        self.assertEqual((5).to_bytes(2, byteorder='big'), b'\x00\x05')
+        self.assertEqual((5).to_bytes(byteorder='little', length=2),
+                         b'\x05\x00')
+        self.assertEqual((-1).to_bytes(1, 'big', signed=True), b'\xff')
+
+    def test_keywords_ext(self):
+        kwargs = {'byteorder': 'little', 'length': 2}
+        self.assertEqual((5).to_bytes(**kwargs), b'\x05\x00')
+        self.assertEqual((5).to_bytes(*(2,), **{'byteorder': 'big'}),
+                         b'\x00\x05')
+        to_bytes = functools.partial(int.to_bytes, byteorder='big')
+        self.assertEqual(to_bytes(5, 2), b'\x00\x05')
+
+    def test_keywords_errors(self):
+        with self.assertRaisesRegex(TypeError, 'given by name'):
+            (5).to_bytes(2, 'big', length=2)
+        with self.assertRaisesRegex(TypeError, 'invalid keyword'):
+            (5).to_bytes(2, 'big', spam=1)
+        with self.assertRaisesRegex(TypeError, 'invalid keyword'):
+            (5).to_bytes(2, 'big', **{'spam': 1})
+        with self.assertRaises(TypeError):
+            (5).to_bytes(2)
+        with self.assertRaises(TypeError):
+            (5).to_bytes(**{1: 2})
+
+
 if __name__ == "__main__":
     unittest.main()
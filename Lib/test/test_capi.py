@@ -321,6 +321,31 @@ class TestPendingCalls(unittest.TestCase):
         self.pendingcalls_submit(l, n)
         self.pendingcalls_wait(l, n)
 
+    def test_pendingcalls_to_thread(self):
+        # The callbacks run in the target thread, not in the main thread
+        n = 40 # more than the ring of a thread state holds
+        idents = []
+        started = threading.Event()
+        done = threading.Event()
+        def worker():
+            started.set()
+            while len(idents) < n:
+                for i in range(1000):
+                    a = i*i
+            done.set()
+        t = threading.Thread(target=worker)
+        with support.start_threads([t]):
+            started.wait()
+            for i in range(n):
+                while not _testcapi._pending_threadfunc_to_thread(
+                        t.ident, lambda: idents.append(threading.get_ident())):
+                    time.sleep(0.001)
+            self.assertTrue(done.wait(10))
+        self.assertEqual(idents, [t.ident] * n)
+        # Unknown thread
+        self.assertFalse(_testcapi._pending_threadfunc_to_thread(
+            t.ident, lambda: None))
+
 
 class SubinterpreterTest(unittest.TestCase):
 
@@ -23,6 +23,9 @@ from concurrent.futures._base import (
     PENDING, RUNNING, CANCELLED, CANCELLED_AND_NOTIFIED, FINISHED, Future)
 from concurrent.futures.process import BrokenProcessPool
 
+c_thread = test.support.import_fresh_module('concurrent.futures.thread',
+                                            fresh=['_executor'])
+
 
 def create_future(state=PENDING, exception=None, result=None):
     f = Future()
@@ -729,6 +732,86 @@ class FutureTests(unittest.TestCase):
 
         self.assertTrue(isinstance(f1.exception(timeout=5), OSError))
 
+class WorkQueueTests:
+    def start_worker(self, q, index):
+        t = threading.Thread(target=q.run_worker, args=(index,))
+        t.start()
+        self.addCleanup(t.join)
+        return t
+
+    def test_run_all(self):
+        q = self.module._WorkQueue(4)
+        results = []
+        for i in range(100):
+            q.put(lambda i=i: results.append(i))
+        threads = [self.start_worker(q, i) for i in range(4)]
+        for i in range(100, 200):
+            q.put(lambda i=i: results.append(i))
+        q.close()
+        for t in threads:
+            t.join()
+        self.assertCountEqual(results, range(200))
+
+    def test_close(self):
+        q = self.module._WorkQueue(1)
+        q.put(int)
+        q.close()
+        self.assertRaises(RuntimeError, q.put, int)
+        self.assertIsNone(q.run_worker(0))
+
+    def test_steal(self):
+        # The items left in the deque of a busy worker are run by the others
+        q = self.module._WorkQueue(2)
+        started = threading.Event()
+        release = threading.Event()
+        def block():
+            started.set()
+            release.wait()
+        done = []
+        def record():
+            done.append(threading.get_ident())
+        q.put(block)
+        busy = self.start_worker(q, 0)
+        started.wait()
+        idle = self.start_worker(q, 1)
+        for i in range(10):
+            q.put(record)
+        deadline = time.monotonic() + 60
+        while len(done) < 10 and time.monotonic() < deadline:
+            time.sleep(0.01)
+        release.set()
+        q.close()
+        self.assertEqual(done, [idle.ident] * 10)
+
+    def test_exception(self):
+        q = self.module._WorkQueue(1)
+        def fail():
+            raise ZeroDivisionError
+        results = []
+        q.put(fail)
+        q.put(lambda: results.append(1))
+        q.close()
+        self.assertRaises(ZeroDivisionError, q.run_worker, 0)
+        q.run_worker(0)
+        self.assertEqual(results, [1])
+
+
+class PyWorkQueueTests(WorkQueueTests, unittest.TestCase):
+    module = test.support.import_fresh_module('concurrent.futures.thread',
+                                              blocked=['_executor'])
+
+
+@unittest.skipUnless(c_thread, 'requires _executor')
+class CWorkQueueTests(WorkQueueTests, unittest.TestCase):
+    module = c_thread
+
+    def test_worker_index(self):
+        q = self.module._WorkQueue(2)
+        self.assertRaises(ValueError, q.run_worker, 2)
+        self.assertRaises(ValueError, q.run_worker, -1)
+        self.assertRaises(ValueError, self.module._WorkQueue, 0)
+
+
 @test.support.reap_threads
 def test_main():
     try:
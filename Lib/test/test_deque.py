@@ -8,6 +8,11 @@ import pickle
 from io import StringIO
 import random
 import struct
+import sysconfig
+try:
+    import threading
+except ImportError:
+    threading = None
 
 BIG = 100000
 
@@ -755,7 +760,9 @@ class TestBasic(unittest.TestCase):
     @support.cpython_only
     def test_sizeof(self):
         BLOCKLEN = 64
-        basesize = support.calcvobjsize('2P4nP')
+        # Without the GIL, a deque embeds a lock
+        lock = '2l' if sysconfig.get_config_var('WITHOUT_GIL') else ''
+        basesize = support.calcvobjsize('2P4nPP' + lock)
         blocksize = struct.calcsize('P%dPP' % BLOCKLEN)
         self.assertEqual(object.__sizeof__(deque()), basesize)
         check = self.check_sizeof
@@ -765,6 +772,140 @@ class TestBasic(unittest.TestCase):
         check(deque('a' * BLOCKLEN), basesize + 2 * blocksize)
         check(deque('a' * (42 * BLOCKLEN)), basesize + 43 * blocksize)
 
+    @unittest.skipUnless(threading, 'Threading required for this test.')
+    def test_threads(self):
+        # Items appended from several threads and popped from several
+        # others are neither lost nor duplicated.
+        d = deque()
+        n = 10000
+        nthreads = 4
+        results = []
+        def producer(start):
+            for i in range(start, start + n):
+                d.append(i)
+        def consumer():
+            got = []
+            while len(got) < n:
+                try:
+                    got.append(d.popleft())
+                except IndexError:
+                    pass
+            results.append(got)
+        threads = [threading.Thread(target=producer, args=(i * n,))
+                   for i in range(nthreads)]
+        threads += [threading.Thread(target=consumer)
+                    for i in range(nthreads)]
+        with support.start_threads(threads):
+            pass
+        self.assertEqual(sorted(x for got in results for x in got),
+                         list(range(nthreads * n)))
+        self.assertEqual(len(d), 0)
+
+class TestConcurrent(unittest.TestCase):
+
+    def test_fifo(self):
+        d = deque(concurrent=True)
+        self.assertEqual(len(d), 0)
+        self.assertFalse(d)
+        self.assertIsNone(d.maxlen)
+        # Cross many block boundaries, with the deque growing and shrinking
+        expected = 0
+        for i in range(20):
+            d.extend(range(i * 300, (i + 1) * 300))
+            for j in range(250):
+                self.assertEqual(d.popleft(), expected)
+                expected += 1
+            self.assertEqual(len(d), (i + 1) * 50)
+        self.assertTrue(d)
+        d.append('x')
+        self.assertEqual(len(d), 1001)
+        d.clear()
+        self.assertEqual(len(d), 0)
+        self.assertRaises(IndexError, d.popleft)
+
+    def test_constructor(self):
+        d = deque('abc', concurrent=True)
+        self.assertEqual([d.popleft() for i in range(3)], ['a', 'b', 'c'])
+        d.__init__('de', concurrent=True)
+        d.__init__('fg')
+        self.assertEqual(len(d), 2)
+        self.assertEqual(repr(d), 'deque(<2 items>, concurrent=True)')
+        self.assertRaises(ValueError, d.__init__, concurrent=False)
+        self.assertRaises(ValueError, deque().__init__, concurrent=True)
+        self.assertRaises(ValueError, deque, 'abc', 2, concurrent=True)
+        self.assertRaises(TypeError, deque, 'abc', None, True)
+        d += 'hi'
+        self.assertEqual(len(d), 4)
+
+    def test_unsupported(self):
+        d = deque('abc', concurrent=True)
+        for op in (d.pop, d.reverse, d.copy, d.__reduce__, d.__reversed__,
+                   lambda: d.appendleft(1), lambda: d.extendleft('a'),
+                   lambda: d.rotate(1), lambda: d.count('a'),
+                   lambda: d.index('a'), lambda: d.insert(0, 'a'),
+                   lambda: d.remove('a'), lambda: d[0],
+                   lambda: d.__setitem__(0, 'a'), lambda: d.__delitem__(0),
+                   lambda: 'a' in d, lambda: iter(d), lambda: d * 2,
+                   lambda: d + deque(), lambda: deque() + d,
+                   lambda: d.extend(d), lambda: copy.copy(d),
+                   lambda: pickle.dumps(d)):
+            self.assertRaises(TypeError, op)
+        self.assertEqual(d, d)
+        self.assertNotEqual(d, deque('abc', concurrent=True))
+        self.assertNotEqual(d, deque('abc'))
+        self.assertEqual(len(d), 3)
+
+    def test_gc(self):
+        class C:
+            pass
+        d = deque(concurrent=True)
+        obj = C()
+        obj.x = d
+        d.append(obj)
+        ref = weakref.ref(obj)
+        del obj, d
+        gc.collect()
+        self.assertIsNone(ref())
+
+    def test_sizeof(self):
+        d = deque(concurrent=True)
+        size = d.__sizeof__()
+        d.extend(range(1000))
+        self.assertGreater(d.__sizeof__(), size + 1000 * struct.calcsize('P'))
+
+    @unittest.skipUnless(threading, 'Threading required for this test.')
+    def test_threads(self):
+        d = deque(concurrent=True)
+        n = 10000
+        nthreads = 4
+        results = []
+        def producer(start):
+            for i in range(start, start + n, 100):
+                d.append(i)
+                d.extend(range(i + 1, i + 100))
+        def consumer():
+            got = []
+            while len(got) < n:
+                try:
+                    got.append(d.popleft())
+                except IndexError:
+                    pass
+            results.append(got)
+        threads = [threading.Thread(target=producer, args=(i * n,))
+                   for i in range(nthreads)]
+        threads += [threading.Thread(target=consumer)
+                    for i in range(nthreads)]
+        with support.start_threads(threads):
+            pass
+        for got in results:
+            # Each producer's items come out in order
+            for i in range(nthreads):
+                mine = [x for x in got if i * n <= x < (i + 1) * n]
+                self.assertEqual(mine, sorted(mine))
+        self.assertEqual(sorted(x for got in results for x in got),
+                         list(range(nthreads * n)))
+        self.assertEqual(len(d), 0)
+
 class TestVariousIteratorArgs(unittest.TestCase):
 
     def test_constructor(self):
@@ -1033,6 +1174,7 @@ def test_main(verbose=None):
     import sys
     test_classes = (
         TestBasic,
+        TestConcurrent,
         TestVariousIteratorArgs,
         TestSubclass,
         TestSubclassWithKwargs,
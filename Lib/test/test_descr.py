@@ -5,6 +5,7 @@ import itertools
 import math
 import pickle
 import sys
+import sysconfig
 import types
 import unittest
 import weakref
@@ -5114,6 +5115,8 @@ class PicklingTests(unittest.TestCase):
 class SharedKeyTests(unittest.TestCase):
 
     @support.cpython_only
+    @unittest.skipIf(sysconfig.get_config_var('WITHOUT_GIL'),
+                     'instances do not share keys without the GIL')
     def test_subclasses(self):
         # Verify that subclasses can share keys (per PEP 412)
         class A:
@@ -115,6 +115,39 @@ dis_f_co_code = """\
 """
 
 
+def _method_calls(a):
+    a.append(1)
+    a.insert(0, *a)
+    a.sort(key=abs)
+
+dis_method_calls = """\
+%3d           0 LOAD_FAST                0 (a)
+              2 LOAD_METHOD              0 (append)
+              4 LOAD_CONST               1 (1)
+              6 CALL_METHOD              1
+              8 POP_TOP
+
+%3d          10 LOAD_FAST                0 (a)
+             12 LOAD_ATTR                1 (insert)
+             14 LOAD_CONST               2 (0)
+             16 LOAD_FAST                0 (a)
+             18 CALL_FUNCTION_VAR        1 (1 positional, 0 keyword pair)
+             20 POP_TOP
+
+%3d          22 LOAD_FAST                0 (a)
+             24 LOAD_ATTR                2 (sort)
+             26 LOAD_CONST               3 ('key')
+             28 LOAD_GLOBAL              3 (abs)
+             30 EXTENDED_ARG             1
+             32 CALL_FUNCTION          256 (0 positional, 1 keyword pair)
+             34 POP_TOP
+             36 LOAD_CONST               0 (None)
+             38 RETURN_VALUE
+""" % (_method_calls.__code__.co_firstlineno + 1,
+       _method_calls.__code__.co_firstlineno + 2,
+       _method_calls.__code__.co_firstlineno + 3)
+
+
 def bug708901():
     for res in range(1,
                      10):
@@ -311,6 +344,10 @@ class DisTests(unittest.TestCase):
     def test_dis(self):
         self.do_disassembly_test(_f, dis_f)
 
+    def test_method_calls(self):
+        # Only calls with positional arguments use LOAD_METHOD/CALL_METHOD
+        self.do_disassembly_test(_method_calls, dis_method_calls)
+
     def test_bug_708901(self):
         self.do_disassembly_test(bug708901, dis_bug708901)
 
@@ -736,6 +736,54 @@ class GCTests(unittest.TestCase):
         self.assertEqual(new[1]["collections"], old[1]["collections"])
         self.assertEqual(new[2]["collections"], old[2]["collections"] + 1)
 
+    def test_pause_target(self):
+        self.addCleanup(gc.set_pause_target, gc.get_pause_target())
+        gc.set_pause_target(2.5)
+        self.assertEqual(gc.get_pause_target(), 2.5)
+        gc.set_pause_target(0)
+        self.assertEqual(gc.get_pause_target(), 0.0)
+        self.assertRaises(ValueError, gc.set_pause_target, -1)
+        self.assertRaises(ValueError, gc.set_pause_target, float('nan'))
+        self.assertRaises(TypeError, gc.set_pause_target, '1')
+
+    def test_incremental_collection(self):
+        # With a pause target, automatic collections of the oldest
+        # generation only examine an increment of it at a time.  They must
+        # still find the cycles living there.
+        class A:
+            pass
+        gc.collect()
+        self.addCleanup(gc.set_pause_target, gc.get_pause_target())
+        self.addCleanup(gc.set_threshold, *gc.get_threshold())
+        if not gc.isenabled():
+            self.addCleanup(gc.disable)
+        gc.enable()
+        gc.set_pause_target(0.001)
+        gc.set_threshold(100, 1, 1)
+
+        a = A()
+        a.a = a
+        wr = weakref.ref(a)
+        live = A()
+        live.a = live
+        # Move both objects to the oldest generation
+        gc.collect(1)
+        collections = gc.get_stats()[2]["collections"]
+        del a
+        junk = []
+        for i in range(100000):
+            if wr() is None:
+                break
+            junk.append([])
+            if len(junk) > 1000:
+                junk = []
+        self.assertIsNone(wr())
+        self.assertGreater(gc.get_stats()[2]["collections"], collections)
+        # The objects surviving an increment are still tracked
+        self.assertTrue(gc.is_tracked(live))
+        self.assertTrue(any(o is live for o in gc.get_objects()))
+        self.assertIn(live, gc.get_referrers(live.__dict__))
+
 
 class GCCallbackTests(unittest.TestCase):
     def setUp(self):
@@ -0,0 +1,316 @@
+"""Tests for the inline caches of LOAD_GLOBAL, LOAD_ATTR and LOAD_METHOD.
+
+The caches are only created once a code object has run a number of times,
+so each test warms its function up before changing the namespaces it reads.
+"""
+
+import types
+import unittest
+
+# More than the number of runs after which a code object gets its caches
+WARMUP = 2000
+
+
+def warm_up(func, *args):
+    for i in range(WARMUP):
+        result = func(*args)
+    return result
+
+
+class LoadGlobalTests(unittest.TestCase):
+
+    def make_func(self, source, namespace):
+        exec(source, namespace)
+        return namespace['f']
+
+    def test_rebind_global(self):
+        ns = {'x': 1}
+        f = self.make_func("def f(): return x", ns)
+        self.assertEqual(warm_up(f), 1)
+        ns['x'] = 2
+        self.assertEqual(f(), 2)
+        del ns['x']
+        self.assertRaises(NameError, f)
+        ns['x'] = 3
+        self.assertEqual(f(), 3)
+
+    def test_builtins(self):
+        builtins = {'x': 'builtin'}
+        ns = {'__builtins__': builtins}
+        f = self.make_func("def f(): return x", ns)
+        self.assertEqual(warm_up(f), 'builtin')
+        # A global shadows the builtin
+        ns['x'] = 'global'
+        self.assertEqual(f(), 'global')
+        del ns['x']
+        self.assertEqual(f(), 'builtin')
+        builtins['x'] = 'new builtin'
+        self.assertEqual(f(), 'new builtin')
+        builtins.clear()
+        self.assertRaises(NameError, f)
+
+    def test_other_globals(self):
+        # The same code run with different globals
+        ns = {'x': 1}
+        f = self.make_func("def f(): return x", ns)
+        warm_up(f)
+        g = types.FunctionType(f.__code__, {'x': 2})
+        self.assertEqual(g(), 2)
+        self.assertEqual(f(), 1)
+
+    def test_update_globals(self):
+        ns = {'x': 1}
+        f = self.make_func("def f(): return x", ns)
+        warm_up(f)
+        ns.update(x=2)
+        self.assertEqual(f(), 2)
+        ns.setdefault('y', 3)
+        self.assertEqual(f(), 2)
+        ns.pop('x')
+        self.assertRaises(NameError, f)
+        ns.clear()
+        ns['x'] = 4
+        self.assertEqual(f(), 4)
+
+
+class LoadAttrTests(unittest.TestCase):
+
+    def test_instance_attribute(self):
+        class C:
+            pass
+        def f(obj):
+            return obj.x
+        a = C()
+        a.x = 1
+        self.assertEqual(warm_up(f, a), 1)
+        a.x = 2
+        self.assertEqual(f(a), 2)
+        # Same type, different layouts of the instance dict
+        b = C()
+        b.y = 0
+        b.x = 3
+        self.assertEqual(f(b), 3)
+        self.assertEqual(f(a), 2)
+        del a.x
+        self.assertRaises(AttributeError, f, a)
+        a.__dict__ = {1: 'one', 'x': 4}
+        self.assertEqual(f(a), 4)
+
+    def test_class_attribute(self):
+        class C:
+            x = 'class'
+        def f(obj):
+            return obj.x
+        c = C()
+        self.assertEqual(warm_up(f, c), 'class')
+        C.x = 'new class'
+        self.assertEqual(f(c), 'new class')
+        # The instance dict takes precedence over non data descriptors
+        c.x = 'instance'
+        self.assertEqual(f(c), 'instance')
+        del c.x
+        self.assertEqual(f(c), 'new class')
+        del C.x
+        self.assertRaises(AttributeError, f, c)
+
+    def test_base_class_modified(self):
+        class A:
+            x = 'A'
+        class B(A):
+            pass
+        def f(obj):
+            return obj.x
+        b = B()
+        self.assertEqual(warm_up(f, b), 'A')
+        A.x = 'new A'
+        self.assertEqual(f(b), 'new A')
+        B.x = 'B'
+        self.assertEqual(f(b), 'B')
+
+    def test_bound_method(self):
+        class C:
+            def meth(self):
+                return 1
+        def f(obj):
+            meth = obj.meth
+            return meth()
+        c = C()
+        self.assertEqual(warm_up(f, c), 1)
+        C.meth = lambda self: 2
+        self.assertEqual(f(c), 2)
+        c.meth = lambda: 3
+        self.assertEqual(f(c), 3)
+
+    def test_data_descriptor(self):
+        class C:
+            @property
+            def x(self):
+                return 'property'
+        def f(obj):
+            return obj.x
+        c = C()
+        self.assertEqual(warm_up(f, c), 'property')
+        # Data descriptors take precedence over the instance dict
+        c.__dict__['x'] = 'instance'
+        self.assertEqual(f(c), 'property')
+        del C.x
+        self.assertEqual(f(c), 'instance')
+        C.x = property(lambda self: 'new property')
+        self.assertEqual(f(c), 'new property')
+
+    def test_descriptor_raises(self):
+        class C:
+            @property
+            def x(self):
+                if self.fail:
+                    raise KeyError('x')
+                return 1
+        def f(obj):
+            return obj.x
+        c = C()
+        c.fail = False
+        warm_up(f, c)
+        c.fail = True
+        self.assertRaises(KeyError, f, c)
+
+    def test_slots(self):
+        class C:
+            __slots__ = ('x',)
+        def f(obj):
+            return obj.x
+        c = C()
+        c.x = 1
+        self.assertEqual(warm_up(f, c), 1)
+        c.x = 2
+        self.assertEqual(f(c), 2)
+        del c.x
+        self.assertRaises(AttributeError, f, c)
+
+    def test_getattr_added(self):
+        class C:
+            pass
+        def f(obj):
+            return obj.x
+        c = C()
+        c.x = 1
+        self.assertEqual(warm_up(f, c), 1)
+        C.__getattribute__ = lambda self, name: 'getattribute'
+        self.assertEqual(f(c), 'getattribute')
+
+    def test_module_attribute(self):
+        mod = types.ModuleType('mod')
+        mod.x = 1
+        def f(obj):
+            return obj.x
+        self.assertEqual(warm_up(f, mod), 1)
+        mod.x = 2
+        self.assertEqual(f(mod), 2)
+        del mod.x
+        self.assertRaises(AttributeError, f, mod)
+
+    def test_many_types(self):
+        classes = [type('C%d' % i, (), {'x': i}) for i in range(50)]
+        def f(obj):
+            return obj.x
+        for i in range(WARMUP):
+            cls = classes[i % len(classes)]
+            self.assertEqual(f(cls()), i % len(classes))
+
+
+class LoadMethodTests(unittest.TestCase):
+
+    def test_method(self):
+        class C:
+            def meth(self, arg):
+                return ('meth', self, arg)
+        def f(obj):
+            return obj.meth(1)
+        c = C()
+        self.assertEqual(warm_up(f, c), ('meth', c, 1))
+        C.meth = lambda self, arg: ('new meth', self, arg)
+        self.assertEqual(f(c), ('new meth', c, 1))
+        # The instance dict hides methods
+        c.meth = lambda arg: ('instance', arg)
+        self.assertEqual(f(c), ('instance', 1))
+        del c.meth
+        self.assertEqual(f(c), ('new meth', c, 1))
+        del C.meth
+        self.assertRaises(AttributeError, f, c)
+
+    def test_inherited_method(self):
+        class A:
+            def meth(self):
+                return 'A'
+        class B(A):
+            pass
+        def f(obj):
+            return obj.meth()
+        b = B()
+        self.assertEqual(warm_up(f, b), 'A')
+        B.meth = lambda self: 'B'
+        self.assertEqual(f(b), 'B')
+
+    def test_not_functions(self):
+        class C:
+            @staticmethod
+            def static(arg):
+                return ('static', arg)
+            @classmethod
+            def cls(cls, arg):
+                return ('cls', cls, arg)
+            @property
+            def prop(self):
+                return lambda arg: ('prop', arg)
+        def f(obj):
+            return [obj.static(1), obj.cls(2), obj.prop(3)]
+        c = C()
+        expected = [('static', 1), ('cls', C, 2), ('prop', 3)]
+        self.assertEqual(warm_up(f, c), expected)
+
+    def test_builtin_methods(self):
+        def f(obj):
+            obj.append(1)
+            return obj.pop()
+        self.assertEqual(warm_up(f, []), 1)
+        # Method descriptors check the type of self
+        class L(list):
+            pass
+        self.assertEqual(f(L()), 1)
+
+    def test_module_function(self):
+        mod = types.ModuleType('mod')
+        mod.func = lambda arg: ('func', arg)
+        def f(obj):
+            return obj.func(1)
+        self.assertEqual(warm_up(f, mod), ('func', 1))
+        mod.func = lambda arg: ('new func', arg)
+        self.assertEqual(f(mod), ('new func', 1))
+        del mod.func
+        self.assertRaises(AttributeError, f, mod)
+
+    def test_getattr(self):
+        class C:
+            def __getattr__(self, name):
+                return lambda: name
+        def f(obj):
+            return obj.missing()
+        self.assertEqual(warm_up(f, C()), 'missing')
+
+    def test_exceptions(self):
+        class C:
+            def meth(self, arg):
+                if arg:
+                    raise KeyError(arg)
+                return arg
+        def f(obj, arg):
+            return obj.meth(arg)
+        c = C()
+        self.assertEqual(warm_up(f, c, 0), 0)
+        self.assertRaises(KeyError, f, c, 1)
+        self.assertRaises(TypeError, c.meth)
+        with self.assertRaisesRegex(TypeError, 'positional argument'):
+            c.meth(1, 2)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -6,6 +6,11 @@ import unittest
 from test import support
 threading = support.import_module('threading')
 
+try:
+    import _queue
+except ImportError:
+    _queue = None
+
 QUEUE_SIZE = 5
 
 def qfull(q):
@@ -353,6 +358,114 @@ class FailingQueueTest(BlockingTestMixin, unittest.TestCase):
         self.failing_queue_test(q)
         self.failing_queue_test(q)
 
+class BaseSimpleQueueTest(BlockingTestMixin):
+
+    def setUp(self):
+        self.q = self.type2test()
+
+    def test_basic(self):
+        q = self.q
+        self.assertTrue(q.empty())
+        self.assertEqual(q.qsize(), 0)
+        q.put(1)
+        q.put_nowait(2)
+        q.put(3, block=False, timeout=-1)
+        self.assertFalse(q.empty())
+        self.assertEqual(q.qsize(), 3)
+        self.assertEqual(q.get(), 1)
+        self.assertEqual(q.get_nowait(), 2)
+        self.assertEqual(q.get(timeout=10), 3)
+        self.assertTrue(q.empty())
+        self.assertRaises(queue.Empty, q.get_nowait)
+        self.assertRaises(queue.Empty, q.get, block=False)
+        self.assertRaises(queue.Empty, q.get, timeout=0.01)
+        self.assertRaises(ValueError, q.get, timeout=-1)
+
+    def test_blocking_get(self):
+        result = self.do_blocking_test(self.q.get, (), self.q.put, ('x',))
+        self.assertEqual(result, 'x')
+        result = self.do_blocking_test(self.q.get_many, (3,),
+                                       self.q.put_many, ('xyz',))
+        while len(result) < 3:
+            result += self.q.get_many(3)
+        self.assertEqual(result, ['x', 'y', 'z'])
+
+    def test_put_many_get_many(self):
+        q = self.q
+        q.put_many(range(100))
+        q.put_many(iter(range(100, 200)))
+        self.assertEqual(q.qsize(), 200)
+        self.assertEqual(q.get_many(1), [0])
+        self.assertEqual(q.get_many(99), list(range(1, 100)))
+        self.assertEqual(q.get_many(1000), list(range(100, 200)))
+        self.assertRaises(queue.Empty, q.get_many, 10, block=False)
+        self.assertRaises(queue.Empty, q.get_many, 10, timeout=0.01)
+        self.assertRaises(ValueError, q.get_many, 0)
+        self.assertRaises(TypeError, q.put_many, 1)
+
+    def test_many_threads(self):
+        # Items are neither lost nor duplicated when several threads put
+        # and get concurrently, some of them waiting
+        q = self.q
+        results = []
+        lock = threading.Lock()
+        def produce(start):
+            for i in range(start, start + 1000, 10):
+                q.put_many(range(i, i + 5))
+                for j in range(i + 5, i + 10):
+                    q.put(j)
+        def consume():
+            got = []
+            while True:
+                for item in q.get_many(7):
+                    if item is None:
+                        with lock:
+                            results.extend(got)
+                        return
+                    got.append(item)
+        consumers = [threading.Thread(target=consume) for i in range(4)]
+        producers = [threading.Thread(target=produce, args=(i * 1000,))
+                     for i in range(4)]
+        for t in consumers + producers:
+            t.start()
+        for t in producers:
+            t.join()
+        # get_many() can take several sentinels at once, so put one per
+        # call and let every consumer see one
+        for t in consumers:
+            while t.is_alive():
+                q.put(None)
+                t.join(0.01)
+        self.assertEqual(sorted(results), list(range(4000)))
+
+
+class PySimpleQueueTest(BaseSimpleQueueTest, unittest.TestCase):
+    type2test = queue._PySimpleQueue
+
+
+@unittest.skipIf(_queue is None, "No _queue module found")
+class CSimpleQueueTest(BaseSimpleQueueTest, unittest.TestCase):
+
+    def setUp(self):
+        self.type2test = _queue.SimpleQueue
+        super().setUp()
+
+    def test_is_default(self):
+        self.assertIs(self.type2test, queue.SimpleQueue)
+        self.assertIs(queue.Empty, _queue.Empty)
+
+    def test_reentrancy(self):
+        # A finalizer run by the queue itself can use it
+        q = self.q
+        gen = iter(range(10))
+        class Circle:
+            def __del__(self):
+                q.put(next(gen))
+        q.put(Circle())
+        del Circle
+        q.get()
+        self.assertEqual(q.get_nowait(), 0)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -10,6 +10,7 @@ import codecs
 import gc
 import sysconfig
 import platform
+import time
 
 # count the number of test runs, used to create unique
 # strings to intern in test_intern()
@@ -188,6 +189,68 @@ class SysModuleTest(unittest.TestCase):
         finally:
             sys.setswitchinterval(orig)
 
+    @unittest.skipUnless(threading, 'Threading required for this test.')
+    def test_gilpolicy(self):
+        self.assertRaises(TypeError, sys.setgilpolicy)
+        self.assertRaises(TypeError, sys.setgilpolicy, 1)
+        self.assertRaises(ValueError, sys.setgilpolicy, "unknown")
+        orig = sys.getgilpolicy()
+        self.assertEqual(orig, "interval")
+        try:
+            for policy in "fair", "interval", "fair":
+                sys.setgilpolicy(policy)
+                self.assertEqual(sys.getgilpolicy(), policy)
+            # Threads competing for the GIL under the fair policy
+            results = []
+            def f():
+                total = 0
+                for i in range(20000):
+                    total += i
+                time.sleep(0.001)
+                results.append(total)
+            threads = [threading.Thread(target=f) for i in range(4)]
+            for t in threads:
+                t.start()
+            for t in threads:
+                t.join()
+            self.assertEqual(results, [sum(range(20000))] * 4)
+        finally:
+            sys.setgilpolicy(orig)
+
+    @unittest.skipUnless(threading, 'Threading required for this test.')
+    def test_gil_stats(self):
+        def f():
+            for i in range(3):
+                time.sleep(0.001)
+        before = sys._gil_stats()
+        t = threading.Thread(target=f)
+        t.start()
+        t.join()
+        stats = sys._gil_stats()
+        for key in ('acquisitions', 'contended', 'forced_drops', 'switches'):
+            self.assertIsInstance(stats[key], int)
+            self.assertGreaterEqual(stats[key], before[key])
+        self.assertGreater(stats['acquisitions'], before['acquisitions'])
+        self.assertGreaterEqual(stats['acquisitions'], stats['contended'])
+        for key in ('wait_time', 'max_wait', 'hold_time', 'max_hold'):
+            self.assertIsInstance(stats[key], float)
+            self.assertGreaterEqual(stats[key], before[key])
+        self.assertGreaterEqual(stats['wait_time'], stats['max_wait'])
+        self.assertGreaterEqual(stats['hold_time'], stats['max_hold'])
+        wait_histogram = stats['wait_histogram']
+        hold_histogram = stats['hold_histogram']
+        self.assertEqual(len(wait_histogram), len(hold_histogram))
+        self.assertEqual(sum(wait_histogram), stats['acquisitions'])
+        self.assertLessEqual(sum(hold_histogram), stats['acquisitions'])
+
+        threads = stats['threads']
+        self.assertIn(threading.get_ident(), threads)
+        for thread_stats in threads.values():
+            self.assertGreaterEqual(thread_stats['acquisitions'],
+                                    thread_stats['contended'])
+            self.assertGreaterEqual(thread_stats['wait_time'], 0.0)
+            self.assertGreaterEqual(thread_stats['hold_time'], 0.0)
+
     def test_recursionlimit(self):
         self.assertRaises(TypeError, sys.getrecursionlimit, 42)
         oldlimit = sys.getrecursionlimit()
@@ -333,12 +396,34 @@ class SysModuleTest(unittest.TestCase):
         self.assertRaises(TypeError, sys.getrefcount)
         c = sys.getrefcount(None)
         n = None
-        self.assertEqual(sys.getrefcount(None), c+1)
+        if sysconfig.get_config_var('WITHOUT_GIL'):
+            # None is immortal: its reference count doesn't change
+            self.assertEqual(sys.getrefcount(None), c)
+        else:
+            self.assertEqual(sys.getrefcount(None), c+1)
         del n
         self.assertEqual(sys.getrefcount(None), c)
         if hasattr(sys, "gettotalrefcount"):
             self.assertIsInstance(sys.gettotalrefcount(), int)
 
+    @unittest.skipUnless(sysconfig.get_config_var('WITHOUT_GIL'),
+                         'immortal objects only exist without the GIL')
+    def test_immortal_refcount(self):
+        global n
+        s = sys.intern('test_immortal_refcount' + str(id(self)))
+        for obj in (True, False, Ellipsis, NotImplemented, 0, 256, -5, s):
+            c = sys.getrefcount(obj)
+            n = [obj] * 10
+            self.assertEqual(sys.getrefcount(obj), c, obj)
+            del n
+            self.assertEqual(sys.getrefcount(obj), c, obj)
+        # Mortal objects are still counted
+        n = 257
+        c = sys.getrefcount(n)
+        m = [n] * 10
+        self.assertEqual(sys.getrefcount(n), c + 10)
+        del m, n
+
     def test_getframe(self):
         self.assertRaises(TypeError, sys._getframe, 42, 42)
         self.assertRaises(ValueError, sys._getframe, 2000000000)
@@ -432,6 +517,30 @@ class SysModuleTest(unittest.TestCase):
         self.assertIn(0, d)
         self.assertTrue(d[0] is sys._getframe())
 
+    @unittest.skipUnless(threading, 'Threading required for this test.')
+    def test_current_frames_thread_churn(self):
+        # sys._current_frames() walks the thread states without a lock
+        # while other threads are created and deleted.
+        done = threading.Event()
+        def churn():
+            while not done.is_set():
+                t = threading.Thread(target=lambda: None)
+                t.start()
+                t.join()
+        churners = [threading.Thread(target=churn) for i in range(2)]
+        for t in churners:
+            t.start()
+        try:
+            main_id = threading.get_ident()
+            for i in range(200):
+                self.assertIs(sys._current_frames()[main_id],
+                              sys._getframe())
+                self.assertIn(main_id, sys._gil_stats()['threads'])
+        finally:
+            done.set()
+            for t in churners:
+                t.join()
+
     def test_attributes(self):
         self.assertIsInstance(sys.api_version, int)
         self.assertIsInstance(sys.argv, list)
@@ -519,7 +628,7 @@ class SysModuleTest(unittest.TestCase):
         info = sys.thread_info
         self.assertEqual(len(info), 3)
         self.assertIn(info.name, ('nt', 'pthread', 'solaris', None))
-        self.assertIn(info.lock, ('semaphore', 'mutex+cond', None))
+        self.assertIn(info.lock, ('futex', 'semaphore', 'mutex+cond', None))
 
     def test_43581(self):
         # Can't use sys.stdout, as this is a StringIO object when
@@ -774,6 +883,24 @@ class SysModuleTest(unittest.TestCase):
         # The function has no parameter
         self.assertRaises(TypeError, sys._debugmallocstats, True)
 
+    @unittest.skipUnless(sysconfig.get_config_var('WITH_PYMALLOC'),
+                         'need pymalloc')
+    @unittest.skipIf(sys.platform == 'win32', 'arenas are not mmap()ed')
+    def test_debugmallocstats_hugepages(self):
+        # Arenas carved out of huge page chunks are reported
+        from test.support.script_helper import assert_python_ok
+        code = ('import sys; x = [[] for i in range(50000)]; '
+                'sys._debugmallocstats()')
+        ret, out, err = assert_python_ok('-c', code,
+                                         PYTHONMALLOCHUGEPAGES='1',
+                                         PYTHONMALLOC='')
+        self.assertIn(b"# huge chunks allocated current", err)
+        self.assertIn(b"# arenas in huge chunks", err)
+
+        ret, out, err = assert_python_ok('-c', code, PYTHONMALLOCHUGEPAGES='',
+                                         PYTHONMALLOC='')
+        self.assertNotIn(b"huge chunks", err)
+
     @unittest.skipUnless(hasattr(sys, "getallocatedblocks"),
                          "sys.getallocatedblocks unavailable on this build")
     def test_getallocatedblocks(self):
@@ -833,6 +960,9 @@ class SizeofTest(unittest.TestCase):
         self.longdigit = sys.int_info.sizeof_digit
         import _testcapi
         self.gc_headsize = _testcapi.SIZEOF_PYGC_HEAD
+        # Without the GIL, lists, dicts and sets embed a lock
+        self.without_gil = bool(sysconfig.get_config_var('WITHOUT_GIL'))
+        self.lock = '2l' if self.without_gil else ''
 
     check_sizeof = test.support.check_sizeof
 
@@ -843,7 +973,8 @@ class SizeofTest(unittest.TestCase):
         # bool objects are not gc tracked
         self.assertEqual(sys.getsizeof(True), vsize('') + self.longdigit)
         # but lists are
-        self.assertEqual(sys.getsizeof([]), vsize('Pn') + gc_header_size)
+        self.assertEqual(sys.getsizeof([]),
+                         vsize('Pn' + self.lock) + gc_header_size)
 
     def test_errors(self):
         class BadSizeof:
@@ -911,13 +1042,13 @@ class SizeofTest(unittest.TestCase):
             return inner
         check(get_cell().__closure__[0], size('P'))
         # code
-        check(get_cell().__code__, size('5i9Pi3P'))
-        check(get_cell.__code__, size('5i9Pi3P'))
+        check(get_cell().__code__, size('5i9Pi5Pic'))
+        check(get_cell.__code__, size('5i9Pi5Pic'))
         def get_cell2(x):
             def inner():
                 return x
             return inner
-        check(get_cell2.__code__, size('5i9Pi3P') + 1)
+        check(get_cell2.__code__, size('5i9Pi5Pic') + 1)
         # complex
         check(complex(0,1), size('2d'))
         # method_descriptor (descriptor object)
@@ -935,9 +1066,11 @@ class SizeofTest(unittest.TestCase):
         # method-wrapper (descriptor object)
         check({}.__iter__, size('2P'))
         # dict
-        check({}, size('n2P') + calcsize('2nPn') + 8*calcsize('n2P'))
+        check({}, size('nQ2P' + self.lock) + calcsize('2nP2n') +
+                  8 + ((8*2+1)//3)*calcsize('n2P'))
         longdict = {1:1, 2:2, 3:3, 4:4, 5:5, 6:6, 7:7, 8:8}
-        check(longdict, size('n2P') + calcsize('2nPn') + 16*calcsize('n2P'))
+        check(longdict, size('nQ2P' + self.lock) + calcsize('2nP2n') +
+                        16 + ((16*2+1)//3)*calcsize('n2P'))
         # dictionary-keyview
         check({}.keys(), size('P'))
         # dictionary-valueview
@@ -1011,7 +1144,7 @@ class SizeofTest(unittest.TestCase):
         # list
         samples = [[], [1,2,3], ['1', '2', '3']]
         for sample in samples:
-            check(sample, vsize('Pn') + len(sample)*self.P)
+            check(sample, vsize('Pn' + self.lock) + len(sample)*self.P)
         # sortwrapper (list)
         # XXX
         # cmpwrapper (list)
@@ -1056,7 +1189,7 @@ class SizeofTest(unittest.TestCase):
         # frozenset
         PySet_MINSIZE = 8
         samples = [[], range(10), range(50)]
-        s = size('3nP' + PySet_MINSIZE*'nP' + '2nP')
+        s = size('3nP' + PySet_MINSIZE*'nP' + '2nP' + self.lock)
         for sample in samples:
             minused = len(sample)
             if minused == 0: tmp = 1
@@ -1092,13 +1225,16 @@ class SizeofTest(unittest.TestCase):
                   '10P'                 # PySequenceMethods
                   '2P'                  # PyBufferProcs
                   '4P')
-        # Separate block for PyDictKeysObject with 4 entries
-        s += calcsize("2nPn") + 4*calcsize("n2P")
+        # Separate block for PyDictKeysObject with 4 slots and 3 entries
+        # (instances don't share keys without the GIL)
+        if not self.without_gil:
+            s += calcsize("2nP2n") + 4 + 3*calcsize("n2P")
         # class
         class newstyleclass(object): pass
         check(newstyleclass, s)
         # dict with shared keys
-        check(newstyleclass().__dict__, size('n2P' + '2nPn'))
+        if not self.without_gil:
+            check(newstyleclass().__dict__, size('nQ2P') + 3*self.P)
         # unicode
         # each tuple contains a string and its expected character size
         # don't put any static strings here, as they may contain
@@ -195,6 +195,35 @@ class BaseLocalTest:
 class ThreadLocalTest(unittest.TestCase, BaseLocalTest):
     _local = _thread._local
 
+    def test_slot_reuse(self):
+        # The storage of a dead local object is reused by new ones, which
+        # must start out empty in every thread.
+        started = threading.Event()
+        done = threading.Event()
+        def f(locals_):
+            for local in locals_:
+                local.x = 1
+            del local
+            started.set()
+            done.wait()
+            results.extend(hasattr(local, 'x') for local in new)
+
+        locals_ = [self._local() for i in range(20)]
+        results = []
+        new = []
+        t = threading.Thread(target=f, args=(locals_,))
+        t.start()
+        started.wait()
+        for local in locals_:
+            local.x = 2
+        del locals_[:]
+        gc.collect()
+        new = [self._local() for i in range(40)]
+        self.assertFalse(any(hasattr(local, 'x') for local in new))
+        done.set()
+        t.join()
+        self.assertEqual(results, [False] * 40)
+
 class PyThreadingLocalTest(unittest.TestCase, BaseLocalTest):
     _local = _threading_local.local
 
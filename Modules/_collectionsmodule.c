@@ -66,6 +66,12 @@
  *     d.rightindex == CENTER
  *
  * Checking for d.len == 0 is the intended way to see whether d is empty.
+ *
+ * Without the GIL, the fields above are protected by the deque's object
+ * lock (see Include/pylock.h).  It is never held while calling back into
+ * Python: methods which compare items, like count() and remove(), drop it
+ * around each comparison and rely on d.state to notice concurrent changes,
+ * just as they notice changes made by __eq__() methods.
  */
 
 typedef struct BLOCK {
@@ -83,6 +89,8 @@ typedef struct {
     size_t state;               /* incremented whenever the indices move */
     Py_ssize_t maxlen;          /* maxlen is -1 for unbounded deques */
     PyObject *weakreflist;
+    struct CQUEUE *cq;          /* NULL unless the deque is concurrent */
+    _PyObject_LOCK_HEAD
 } dequeobject;
 
 static PyTypeObject deque_type;
@@ -114,8 +122,8 @@ static PyTypeObject deque_type;
  */
 
 #define MAXFREEBLOCKS 16
-static Py_ssize_t numfreeblocks = 0;
-static block *freeblocks[MAXFREEBLOCKS];
+static _Py_PER_THREAD Py_ssize_t numfreeblocks = 0;
+static _Py_PER_THREAD block *freeblocks[MAXFREEBLOCKS];
 
 static block *
 newblock(void) {
@@ -143,11 +151,328 @@ freeblock(block *b)
     }
 }
 
+/* Concurrent deques ********************************************************/
+
+/* deque(concurrent=True) keeps its items in a lock-free queue instead of the
+ * doubly-linked blocks above, so that threads handing items to each other
+ * with append() and popleft() never wait for a lock, whether there is one
+ * producer and one consumer or many of each.  Only the operations of a FIFO
+ * queue are supported: append(), extend(), popleft(), clear(), len() and
+ * truth testing.  The other methods raise TypeError.
+ *
+ * The queue is a singly-linked list of blocks of CBLOCKLEN slots, after the
+ * SegQueue of the crossbeam project.  Both ends are a position: a running
+ * slot index plus the block holding that slot.  A producer claims a slot by
+ * advancing tail.index with a compare-and-swap, stores its item, and then
+ * sets the slot's CQ_WRITTEN flag.  A consumer claims a slot the same way
+ * through head.index, and waits for CQ_WRITTEN before taking the item.
+ *
+ * The thread which claims the last slot of a block links in the next block.
+ * Each block spans CQ_LAP indices, one more than it has slots.  An index
+ * whose offset is CBLOCKLEN tells the other threads that the next block is
+ * being linked in, and that they must wait for it.
+ *
+ * A block is freed by the last consumer to finish with it.  Each consumer
+ * flags its slot CQ_READ.  The consumer of the last slot then walks the
+ * block.  If it finds a slot whose consumer hasn't finished yet, it flags
+ * that slot CQ_DESTROY and leaves the duty to that slot's consumer.
+ *
+ * Indices count in units of 1 << CQ_SHIFT.  The spare low bit of head.index
+ * (CQ_HAS_NEXT) records that the block after the head block exists, which
+ * saves consumers from loading tail.index.
+ *
+ * Threads only ever wait for one another between two stores made by the
+ * same C function, so a wait never spans a call back into Python.
+ */
+
+#define CQ_LAP 64                       /* must be a power of 2 */
+#define CBLOCKLEN (CQ_LAP - 1)
+#define CQ_SHIFT 1
+#define CQ_HAS_NEXT 1
+
+#define CQ_WRITTEN 1
+#define CQ_READ 2
+#define CQ_DESTROY 4
+
+#ifdef HAVE_SCHED_H
+#include <sched.h>
+#define CQ_YIELD() sched_yield()
+#else
+#define CQ_YIELD()
+#endif
+
+typedef struct {
+    PyObject *item;
+    int state;                  /* CQ_WRITTEN | CQ_READ | CQ_DESTROY */
+} cslot;
+
+typedef struct CBLOCK {
+    struct CBLOCK *next;
+    cslot slots[CBLOCKLEN];
+} cblock;
+
+typedef struct {
+    size_t index;
+    cblock *block;
+} cposition;
+
+typedef struct CQUEUE {
+    cposition head;
+    /* keep the consumers' and the producers' positions on separate
+       cache lines */
+    char pad[64 - sizeof(cposition)];
+    cposition tail;
+} cqueue;
+
+static cblock *
+cblock_new(void)
+{
+    /* The raw allocator, as there may be no thread state to speak of */
+    cblock *b = PyMem_RawCalloc(1, sizeof(cblock));
+    if (b == NULL)
+        PyErr_NoMemory();
+    return b;
+}
+
+static cqueue *
+cq_new(void)
+{
+    cqueue *cq = PyMem_RawCalloc(1, sizeof(cqueue));
+    if (cq == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    cq->head.block = cblock_new();
+    if (cq->head.block == NULL) {
+        PyMem_RawFree(cq);
+        return NULL;
+    }
+    cq->tail.block = cq->head.block;
+    return cq;
+}
+
+/* Free block b once the consumers of its slots from start onwards are done
+   with it, or hand the job over to the first one which is still busy. */
+static void
+cblock_destroy(cblock *b, Py_ssize_t start)
+{
+    Py_ssize_t i;
+
+    /* The consumer of the last slot always starts the destruction, so its
+       flag doesn't need checking. */
+    for (i = start; i < CBLOCKLEN - 1; i++) {
+        cslot *slot = &b->slots[i];
+        if (!(__atomic_load_n(&slot->state, __ATOMIC_ACQUIRE) & CQ_READ) &&
+            !(__atomic_fetch_or(&slot->state, CQ_DESTROY,
+                                __ATOMIC_ACQ_REL) & CQ_READ))
+            return;
+    }
+    PyMem_RawFree(b);
+}
+
+/* Append item, stealing the reference.  Return -1 with an exception set if
+   a new block couldn't be allocated. */
+static int
+cq_push(cqueue *cq, PyObject *item)
+{
+    size_t tail, new_tail, offset;
+    cblock *b, *next = NULL;
+    cslot *slot;
+
+    tail = __atomic_load_n(&cq->tail.index, __ATOMIC_ACQUIRE);
+    b = __atomic_load_n(&cq->tail.block, __ATOMIC_ACQUIRE);
+    for (;;) {
+        offset = (tail >> CQ_SHIFT) % CQ_LAP;
+        if (offset == CBLOCKLEN) {
+            /* Another producer is linking in the next block */
+            CQ_YIELD();
+            tail = __atomic_load_n(&cq->tail.index, __ATOMIC_ACQUIRE);
+            b = __atomic_load_n(&cq->tail.block, __ATOMIC_ACQUIRE);
+            continue;
+        }
+        /* Allocate the next block before claiming the last slot, so that
+           the other threads never wait for the memory allocator. */
+        if (offset + 1 == CBLOCKLEN && next == NULL) {
+            next = cblock_new();
+            if (next == NULL)
+                return -1;
+        }
+        new_tail = tail + (1 << CQ_SHIFT);
+        if (__atomic_compare_exchange_n(&cq->tail.index, &tail, new_tail, 1,
+                                        __ATOMIC_SEQ_CST, __ATOMIC_ACQUIRE))
+            break;
+        b = __atomic_load_n(&cq->tail.block, __ATOMIC_ACQUIRE);
+    }
+
+    if (offset + 1 == CBLOCKLEN) {
+        __atomic_store_n(&cq->tail.block, next, __ATOMIC_RELEASE);
+        __atomic_store_n(&cq->tail.index, new_tail + (1 << CQ_SHIFT),
+                         __ATOMIC_RELEASE);
+        __atomic_store_n(&b->next, next, __ATOMIC_RELEASE);
+        next = NULL;
+    }
+    slot = &b->slots[offset];
+    slot->item = item;
+    __atomic_fetch_or(&slot->state, CQ_WRITTEN, __ATOMIC_RELEASE);
+
+    if (next != NULL)
+        PyMem_RawFree(next);
+    return 0;
+}
+
+/* Remove and return the leftmost item, or return NULL without setting an
+   exception if the queue is empty. */
+static PyObject *
+cq_pop(cqueue *cq)
+{
+    size_t head, new_head, offset;
+    cblock *b;
+    cslot *slot;
+    PyObject *item;
+
+    head = __atomic_load_n(&cq->head.index, __ATOMIC_ACQUIRE);
+    b = __atomic_load_n(&cq->head.block, __ATOMIC_ACQUIRE);
+    for (;;) {
+        offset = (head >> CQ_SHIFT) % CQ_LAP;
+        if (offset == CBLOCKLEN) {
+            /* Another consumer is moving on to the next block */
+            CQ_YIELD();
+            head = __atomic_load_n(&cq->head.index, __ATOMIC_ACQUIRE);
+            b = __atomic_load_n(&cq->head.block, __ATOMIC_ACQUIRE);
+            continue;
+        }
+        new_head = head + (1 << CQ_SHIFT);
+        if (!(new_head & CQ_HAS_NEXT)) {
+            size_t tail;
+
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            tail = __atomic_load_n(&cq->tail.index, __ATOMIC_RELAXED);
+            if (head >> CQ_SHIFT == tail >> CQ_SHIFT)
+                return NULL;
+            if ((head >> CQ_SHIFT) / CQ_LAP != (tail >> CQ_SHIFT) / CQ_LAP)
+                new_head |= CQ_HAS_NEXT;
+        }
+        if (__atomic_compare_exchange_n(&cq->head.index, &head, new_head, 1,
+                                        __ATOMIC_SEQ_CST, __ATOMIC_ACQUIRE))
+            break;
+        b = __atomic_load_n(&cq->head.block, __ATOMIC_ACQUIRE);
+    }
+
+    if (offset + 1 == CBLOCKLEN) {
+        cblock *next;
+        size_t next_index;
+
+        /* The producer of our slot may not have linked in its successor */
+        while ((next = __atomic_load_n(&b->next, __ATOMIC_ACQUIRE)) == NULL)
+            CQ_YIELD();
+        next_index = (new_head & ~(size_t)CQ_HAS_NEXT) + (1 << CQ_SHIFT);
+        if (__atomic_load_n(&next->next, __ATOMIC_RELAXED) != NULL)
+            next_index |= CQ_HAS_NEXT;
+        __atomic_store_n(&cq->head.block, next, __ATOMIC_RELEASE);
+        __atomic_store_n(&cq->head.index, next_index, __ATOMIC_RELEASE);
+    }
+
+    slot = &b->slots[offset];
+    while (!(__atomic_load_n(&slot->state, __ATOMIC_ACQUIRE) & CQ_WRITTEN))
+        CQ_YIELD();
+    item = slot->item;
+
+    if (offset + 1 == CBLOCKLEN)
+        cblock_destroy(b, 0);
+    else if (__atomic_fetch_or(&slot->state, CQ_READ,
+                               __ATOMIC_ACQ_REL) & CQ_DESTROY)
+        cblock_destroy(b, offset + 1);
+    return item;
+}
+
+static Py_ssize_t
+cq_len(cqueue *cq)
+{
+    size_t head, tail, lap;
+    const size_t mask = ~(size_t)((1 << CQ_SHIFT) - 1);
+
+    for (;;) {
+        tail = __atomic_load_n(&cq->tail.index, __ATOMIC_SEQ_CST);
+        head = __atomic_load_n(&cq->head.index, __ATOMIC_SEQ_CST);
+        /* Retry until the two indices come from the same moment */
+        if (__atomic_load_n(&cq->tail.index, __ATOMIC_SEQ_CST) == tail)
+            break;
+    }
+    tail &= mask;
+    head &= mask;
+    /* An index pointing past the last slot of a block is on the next one */
+    if (((tail >> CQ_SHIFT) & (CQ_LAP - 1)) == CQ_LAP - 1)
+        tail += 1 << CQ_SHIFT;
+    if (((head >> CQ_SHIFT) & (CQ_LAP - 1)) == CQ_LAP - 1)
+        head += 1 << CQ_SHIFT;
+    /* Rebase both on the head block, then discount the unused indices */
+    lap = (head >> CQ_SHIFT) / CQ_LAP;
+    tail = (tail - ((lap * CQ_LAP) << CQ_SHIFT)) >> CQ_SHIFT;
+    head = (head - ((lap * CQ_LAP) << CQ_SHIFT)) >> CQ_SHIFT;
+    return (Py_ssize_t)(tail - head - tail / CQ_LAP);
+}
+
+/* Visit the items of a queue which no other thread is using: the deque is
+   being collected or deallocated, or the world is stopped. */
+static int
+cq_traverse(cqueue *cq, visitproc visit, void *arg)
+{
+    size_t head = cq->head.index & ~(size_t)CQ_HAS_NEXT;
+    size_t tail = cq->tail.index;
+    cblock *b = cq->head.block;
+
+    for (; head != tail; head += 1 << CQ_SHIFT) {
+        size_t offset = (head >> CQ_SHIFT) % CQ_LAP;
+        if (offset < CBLOCKLEN)
+            Py_VISIT(b->slots[offset].item);
+        else
+            b = b->next;
+    }
+    return 0;
+}
+
+/* Free a queue which no other thread is using; it must be empty. */
+static void
+cq_free(cqueue *cq)
+{
+    assert(cq_len(cq) == 0);
+    /* An empty queue is down to a single block */
+    PyMem_RawFree(cq->head.block);
+    PyMem_RawFree(cq);
+}
+
+#define DEQUE_IS_CONCURRENT(deque) ((deque)->cq != NULL)
+
+/* Check that the deque isn't concurrent before an operation which only
+   makes sense on a sequence; return -1 with TypeError set if it is. */
+static int
+deque_check_sequential(dequeobject *deque, const char *what)
+{
+    if (!DEQUE_IS_CONCURRENT(deque))
+        return 0;
+    PyErr_Format(PyExc_TypeError,
+                 "%s is not supported by concurrent deques", what);
+    return -1;
+}
+
 static PyObject *
 deque_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
     dequeobject *deque;
     block *b;
+    int concurrent = 0;
+
+    /* Whether the deque is concurrent is decided once and for all here,
+       because its storage can't be swapped while threads are using it
+       without a lock.  deque_init() checks its argument again. */
+    if (kwds != NULL) {
+        PyObject *flag = PyDict_GetItemString(kwds, "concurrent");
+        if (flag != NULL) {
+            concurrent = PyObject_IsTrue(flag);
+            if (concurrent < 0)
+                return NULL;
+        }
+    }
 
     /* create dequeobject structure */
     deque = (dequeobject *)type->tp_alloc(type, 0);
@@ -171,20 +496,35 @@ deque_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     deque->state = 0;
     deque->maxlen = -1;
     deque->weakreflist = NULL;
+    deque->cq = NULL;
+    _PyObject_LOCK_INIT(deque);
+
+    if (concurrent) {
+        deque->cq = cq_new();
+        if (deque->cq == NULL) {
+            Py_DECREF(deque);
+            return NULL;
+        }
+    }
 
     return (PyObject *)deque;
 }
 
+/* The *_internal() functions expect the caller to hold the deque's lock.
+   They never call back into Python, so that the lock is never held while
+   running arbitrary code; items which must be released are handed back to
+   the caller, to be decref'ed once the lock is dropped. */
+
+/* Remove and return the rightmost element, or return NULL without setting
+   an exception if the deque is empty. */
 static PyObject *
-deque_pop(dequeobject *deque, PyObject *unused)
+deque_pop_internal(dequeobject *deque)
 {
     PyObject *item;
     block *prevblock;
 
-    if (Py_SIZE(deque) == 0) {
-        PyErr_SetString(PyExc_IndexError, "pop from an empty deque");
+    if (Py_SIZE(deque) == 0)
         return NULL;
-    }
     item = deque->rightblock->data[deque->rightindex];
     deque->rightindex--;
     Py_SIZE(deque)--;
@@ -210,18 +550,33 @@ deque_pop(dequeobject *deque, PyObject *unused)
     return item;
 }
 
+static PyObject *
+deque_pop(dequeobject *deque, PyObject *unused)
+{
+    PyObject *item;
+
+    if (deque_check_sequential(deque, "pop()") < 0)
+        return NULL;
+    _PyObject_LOCK(deque);
+    item = deque_pop_internal(deque);
+    _PyObject_UNLOCK(deque);
+    if (item == NULL)
+        PyErr_SetString(PyExc_IndexError, "pop from an empty deque");
+    return item;
+}
+
 PyDoc_STRVAR(pop_doc, "Remove and return the rightmost element.");
 
+/* Remove and return the leftmost element, or return NULL without setting
+   an exception if the deque is empty. */
 static PyObject *
-deque_popleft(dequeobject *deque, PyObject *unused)
+deque_popleft_internal(dequeobject *deque)
 {
     PyObject *item;
     block *prevblock;
 
-    if (Py_SIZE(deque) == 0) {
-        PyErr_SetString(PyExc_IndexError, "pop from an empty deque");
+    if (Py_SIZE(deque) == 0)
         return NULL;
-    }
     assert(deque->leftblock != NULL);
     item = deque->leftblock->data[deque->leftindex];
     deque->leftindex++;
@@ -248,6 +603,23 @@ deque_popleft(dequeobject *deque, PyObject *unused)
     return item;
 }
 
+static PyObject *
+deque_popleft(dequeobject *deque, PyObject *unused)
+{
+    PyObject *item;
+
+    if (DEQUE_IS_CONCURRENT(deque)) {
+        item = cq_pop(deque->cq);
+    } else {
+        _PyObject_LOCK(deque);
+        item = deque_popleft_internal(deque);
+        _PyObject_UNLOCK(deque);
+    }
+    if (item == NULL)
+        PyErr_SetString(PyExc_IndexError, "pop from an empty deque");
+    return item;
+}
+
 PyDoc_STRVAR(popleft_doc, "Remove and return the leftmost element.");
 
 /* The deque's size limit is d.maxlen.  The limit can be zero or positive.
@@ -257,6 +629,8 @@ PyDoc_STRVAR(popleft_doc, "Remove and return the leftmost element.");
  * grown past the limit. If it has, we get the size back down to the limit
  * by popping an item off of the opposite end.  The methods that can
  * trigger this are append(), appendleft(), extend(), and extendleft().
+ * The popped item is stored in *trimmed (which is otherwise set to NULL)
+ * for the caller to decref.
  *
  * The macro to check whether a deque needs to be trimmed uses a single
  * unsigned test that returns true whenever 0 <= maxlen < Py_SIZE(deque).
@@ -265,8 +639,10 @@ PyDoc_STRVAR(popleft_doc, "Remove and return the leftmost element.");
 #define NEEDS_TRIM(deque, maxlen) ((size_t)(maxlen) < (size_t)(Py_SIZE(deque)))
 
 static int
-deque_append_internal(dequeobject *deque, PyObject *item, Py_ssize_t maxlen)
+deque_append_internal(dequeobject *deque, PyObject *item, Py_ssize_t maxlen,
+                      PyObject **trimmed)
 {
+    *trimmed = NULL;
     if (deque->rightindex == BLOCKLEN - 1) {
         block *b = newblock();
         if (b == NULL)
@@ -282,8 +658,7 @@ deque_append_internal(dequeobject *deque, PyObject *item, Py_ssize_t maxlen)
     deque->rightindex++;
     deque->rightblock->data[deque->rightindex] = item;
     if (NEEDS_TRIM(deque, maxlen)) {
-        PyObject *olditem = deque_popleft(deque, NULL);
-        Py_DECREF(olditem);
+        *trimmed = deque_popleft_internal(deque);
     } else {
         deque->state++;
     }
@@ -293,17 +668,35 @@ deque_append_internal(dequeobject *deque, PyObject *item, Py_ssize_t maxlen)
 static PyObject *
 deque_append(dequeobject *deque, PyObject *item)
 {
+    PyObject *trimmed;
+    int rv;
+
     Py_INCREF(item);
-    if (deque_append_internal(deque, item, deque->maxlen) < 0)
+    if (DEQUE_IS_CONCURRENT(deque)) {
+        if (cq_push(deque->cq, item) < 0) {
+            Py_DECREF(item);
+            return NULL;
+        }
+        Py_RETURN_NONE;
+    }
+    _PyObject_LOCK(deque);
+    rv = deque_append_internal(deque, item, deque->maxlen, &trimmed);
+    _PyObject_UNLOCK(deque);
+    if (rv < 0) {
+        Py_DECREF(item);
         return NULL;
+    }
+    Py_XDECREF(trimmed);
     Py_RETURN_NONE;
 }
 
 PyDoc_STRVAR(append_doc, "Add an element to the right side of the deque.");
 
-int
-deque_appendleft_internal(dequeobject *deque, PyObject *item, Py_ssize_t maxlen)
+static int
+deque_appendleft_internal(dequeobject *deque, PyObject *item,
+                          Py_ssize_t maxlen, PyObject **trimmed)
 {
+    *trimmed = NULL;
     if (deque->leftindex == 0) {
         block *b = newblock();
         if (b == NULL)
@@ -319,8 +712,7 @@ deque_appendleft_internal(dequeobject *deque, PyObject *item, Py_ssize_t maxlen)
     deque->leftindex--;
     deque->leftblock->data[deque->leftindex] = item;
     if (NEEDS_TRIM(deque, deque->maxlen)) {
-        PyObject *olditem = deque_pop(deque, NULL);
-        Py_DECREF(olditem);
+        *trimmed = deque_pop_internal(deque);
     } else {
         deque->state++;
     }
@@ -330,9 +722,20 @@ deque_appendleft_internal(dequeobject *deque, PyObject *item, Py_ssize_t maxlen)
 static PyObject *
 deque_appendleft(dequeobject *deque, PyObject *item)
 {
+    PyObject *trimmed;
+    int rv;
+
+    if (deque_check_sequential(deque, "appendleft()") < 0)
+        return NULL;
     Py_INCREF(item);
-    if (deque_appendleft_internal(deque, item, deque->maxlen) < 0)
+    _PyObject_LOCK(deque);
+    rv = deque_appendleft_internal(deque, item, deque->maxlen, &trimmed);
+    _PyObject_UNLOCK(deque);
+    if (rv < 0) {
+        Py_DECREF(item);
         return NULL;
+    }
+    Py_XDECREF(trimmed);
     Py_RETURN_NONE;
 }
 
@@ -368,17 +771,43 @@ consume_iterator(PyObject *it)
     return finalize_iterator(it);
 }
 
+/* extend() for concurrent deques: the items are appended one by one, and
+   may be interleaved with those of other producers. */
+static PyObject *
+deque_extend_concurrent(dequeobject *deque, PyObject *it)
+{
+    PyObject *(*iternext)(PyObject *);
+    PyObject *item;
+
+    iternext = *Py_TYPE(it)->tp_iternext;
+    while ((item = iternext(it)) != NULL) {
+        if (cq_push(deque->cq, item) < 0) {
+            Py_DECREF(item);
+            Py_DECREF(it);
+            return NULL;
+        }
+    }
+    return finalize_iterator(it);
+}
+
+/* The iterable may be arbitrary Python code, so extend() and extendleft()
+   only hold the lock while adding each item, not while fetching it. */
+
 static PyObject *
 deque_extend(dequeobject *deque, PyObject *iterable)
 {
-    PyObject *it, *item;
+    PyObject *it, *item, *trimmed;
     PyObject *(*iternext)(PyObject *);
     Py_ssize_t maxlen = deque->maxlen;
+    int rv;
 
     /* Handle case where id(deque) == id(iterable) */
     if ((PyObject *)deque == iterable) {
         PyObject *result;
-        PyObject *s = PySequence_List(iterable);
+        PyObject *s;
+        if (deque_check_sequential(deque, "extending a deque with itself") < 0)
+            return NULL;
+        s = PySequence_List(iterable);
         if (s == NULL)
             return NULL;
         result = deque_extend(deque, s);
@@ -390,24 +819,33 @@ deque_extend(dequeobject *deque, PyObject *iterable)
     if (it == NULL)
         return NULL;
 
+    if (DEQUE_IS_CONCURRENT(deque))
+        return deque_extend_concurrent(deque, it);
+
     if (maxlen == 0)
         return consume_iterator(it);
 
     /* Space saving heuristic.  Start filling from the left */
+    _PyObject_LOCK(deque);
     if (Py_SIZE(deque) == 0) {
         assert(deque->leftblock == deque->rightblock);
         assert(deque->leftindex == deque->rightindex+1);
         deque->leftindex = 1;
         deque->rightindex = 0;
     }
+    _PyObject_UNLOCK(deque);
 
     iternext = *Py_TYPE(it)->tp_iternext;
     while ((item = iternext(it)) != NULL) {
-        if (deque_append_internal(deque, item, maxlen) < 0) {
+        _PyObject_LOCK(deque);
+        rv = deque_append_internal(deque, item, maxlen, &trimmed);
+        _PyObject_UNLOCK(deque);
+        if (rv < 0) {
             Py_DECREF(item);
             Py_DECREF(it);
             return NULL;
         }
+        Py_XDECREF(trimmed);
     }
     return finalize_iterator(it);
 }
@@ -418,9 +856,13 @@ PyDoc_STRVAR(extend_doc,
 static PyObject *
 deque_extendleft(dequeobject *deque, PyObject *iterable)
 {
-    PyObject *it, *item;
+    PyObject *it, *item, *trimmed;
     PyObject *(*iternext)(PyObject *);
     Py_ssize_t maxlen = deque->maxlen;
+    int rv;
+
+    if (deque_check_sequential(deque, "extendleft()") < 0)
+        return NULL;
 
     /* Handle case where id(deque) == id(iterable) */
     if ((PyObject *)deque == iterable) {
@@ -441,20 +883,26 @@ deque_extendleft(dequeobject *deque, PyObject *iterable)
         return consume_iterator(it);
 
     /* Space saving heuristic.  Start filling from the right */
+    _PyObject_LOCK(deque);
     if (Py_SIZE(deque) == 0) {
         assert(deque->leftblock == deque->rightblock);
         assert(deque->leftindex == deque->rightindex+1);
         deque->leftindex = BLOCKLEN - 1;
         deque->rightindex = BLOCKLEN - 2;
     }
+    _PyObject_UNLOCK(deque);
 
     iternext = *Py_TYPE(it)->tp_iternext;
     while ((item = iternext(it)) != NULL) {
-        if (deque_appendleft_internal(deque, item, maxlen) < 0) {
+        _PyObject_LOCK(deque);
+        rv = deque_appendleft_internal(deque, item, maxlen, &trimmed);
+        _PyObject_UNLOCK(deque);
+        if (rv < 0) {
             Py_DECREF(item);
             Py_DECREF(it);
             return NULL;
         }
+        Py_XDECREF(trimmed);
     }
     return finalize_iterator(it);
 }
@@ -479,18 +927,26 @@ static PyObject *
 deque_copy(PyObject *deque)
 {
     dequeobject *old_deque = (dequeobject *)deque;
+    if (deque_check_sequential(old_deque, "copy()") < 0)
+        return NULL;
     if (Py_TYPE(deque) == &deque_type) {
         dequeobject *new_deque;
-        PyObject *rv;
+        PyObject *rv, *item = NULL;
 
         new_deque = (dequeobject *)deque_new(&deque_type, (PyObject *)NULL, (PyObject *)NULL);
         if (new_deque == NULL)
             return NULL;
         new_deque->maxlen = old_deque->maxlen;
         /* Fast path for the deque_repeat() common case where len(deque) == 1 */
+        _PyObject_LOCK(old_deque);
         if (Py_SIZE(deque) == 1) {
-            PyObject *item = old_deque->leftblock->data[old_deque->leftindex];
+            item = old_deque->leftblock->data[old_deque->leftindex];
+            Py_INCREF(item);
+        }
+        _PyObject_UNLOCK(old_deque);
+        if (item != NULL) {
             rv = deque_append(new_deque, item);
+            Py_DECREF(item);
         } else {
             rv = deque_extend(new_deque, deque);
         }
@@ -549,6 +1005,13 @@ deque_clear(dequeobject *deque)
     PyObject *item;
     PyObject **itemptr, **limit;
 
+    if (DEQUE_IS_CONCURRENT(deque)) {
+        /* Items appended meanwhile by other threads may or may not go */
+        while ((item = cq_pop(deque->cq)) != NULL)
+            Py_DECREF(item);
+        return;
+    }
+
     if (Py_SIZE(deque) == 0)
         return;
 
@@ -556,7 +1019,8 @@ deque_clear(dequeobject *deque)
        deque to mutate.  To avoid fatal confusion, we have to make the
        deque empty before clearing the blocks and never refer to
        anything via deque->ref while clearing.  (This is the same
-       technique used for clearing lists, sets, and dicts.)
+       technique used for clearing lists, sets, and dicts.)  This also
+       lets us drop the lock before any decref.
 
        Making the deque empty requires allocating a new empty block.  In
        the unlikely event that memory is full, we fall back to an
@@ -571,6 +1035,13 @@ deque_clear(dequeobject *deque)
         goto alternate_method;
     }
 
+    _PyObject_LOCK(deque);
+    if (Py_SIZE(deque) == 0) {
+        _PyObject_UNLOCK(deque);
+        freeblock(b);
+        return;
+    }
+
     /* Remember the old size, leftblock, and leftindex */
     n = Py_SIZE(deque);
     leftblock = deque->leftblock;
@@ -585,6 +1056,7 @@ deque_clear(dequeobject *deque)
     deque->leftindex = CENTER + 1;
     deque->rightindex = CENTER;
     deque->state++;
+    _PyObject_UNLOCK(deque);
 
     /* Now the old size, leftblock, and leftindex are disconnected from
        the empty deque and we can use them to decref the pointers.
@@ -614,11 +1086,15 @@ deque_clear(dequeobject *deque)
     return;
 
   alternate_method:
-    while (Py_SIZE(deque)) {
-        item = deque_pop(deque, NULL);
-        assert (item != NULL);
+    for (;;) {
+        _PyObject_LOCK(deque);
+        item = deque_pop_internal(deque);
+        _PyObject_UNLOCK(deque);
+        if (item == NULL)
+            break;
         Py_DECREF(item);
     }
+    return;
 }
 
 static PyObject *
@@ -637,13 +1113,19 @@ deque_inplace_repeat(dequeobject *deque, Py_ssize_t n)
     PyObject *seq;
     PyObject *rv;
 
+    if (deque_check_sequential(deque, "repetition") < 0)
+        return NULL;
+
+    _PyObject_LOCK(deque);
     size = Py_SIZE(deque);
     if (size == 0 || n == 1) {
+        _PyObject_UNLOCK(deque);
         Py_INCREF(deque);
         return (PyObject *)deque;
     }
 
     if (n <= 0) {
+        _PyObject_UNLOCK(deque);
         deque_clear(deque);
         Py_INCREF(deque);
         return (PyObject *)deque;
@@ -662,6 +1144,7 @@ deque_inplace_repeat(dequeobject *deque, Py_ssize_t n)
                 block *b = newblock();
                 if (b == NULL) {
                     Py_SIZE(deque) += i;
+                    _PyObject_UNLOCK(deque);
                     return NULL;
                 }
                 b->leftlink = deque->rightblock;
@@ -682,9 +1165,11 @@ deque_inplace_repeat(dequeobject *deque, Py_ssize_t n)
             }
         }
         Py_SIZE(deque) += i;
+        _PyObject_UNLOCK(deque);
         Py_INCREF(deque);
         return (PyObject *)deque;
     }
+    _PyObject_UNLOCK(deque);
 
     if ((size_t)size > PY_SSIZE_T_MAX / (size_t)n) {
         return PyErr_NoMemory();
@@ -744,8 +1229,9 @@ pointer is always moved.
 For high volume rotations, newblock() and freeblock() are never called
 more than once.  Previously emptied blocks are immediately reused as a
 destination block.  If a block is left-over at the end, it is freed.
-*/
 
+The caller must hold the deque's lock.
+*/
 static int
 _deque_rotate(dequeobject *deque, Py_ssize_t n)
 {
@@ -874,10 +1360,16 @@ static PyObject *
 deque_rotate(dequeobject *deque, PyObject *args)
 {
     Py_ssize_t n=1;
+    int rv;
 
+    if (deque_check_sequential(deque, "rotate()") < 0)
+        return NULL;
     if (!PyArg_ParseTuple(args, "|n:rotate", &n))
         return NULL;
-    if (!_deque_rotate(deque, n))
+    _PyObject_LOCK(deque);
+    rv = _deque_rotate(deque, n);
+    _PyObject_UNLOCK(deque);
+    if (!rv)
         Py_RETURN_NONE;
     return NULL;
 }
@@ -888,13 +1380,22 @@ PyDoc_STRVAR(rotate_doc,
 static PyObject *
 deque_reverse(dequeobject *deque, PyObject *unused)
 {
-    block *leftblock = deque->leftblock;
-    block *rightblock = deque->rightblock;
-    Py_ssize_t leftindex = deque->leftindex;
-    Py_ssize_t rightindex = deque->rightindex;
-    Py_ssize_t n = Py_SIZE(deque) >> 1;
+    block *leftblock;
+    block *rightblock;
+    Py_ssize_t leftindex;
+    Py_ssize_t rightindex;
+    Py_ssize_t n;
     PyObject *tmp;
 
+    if (deque_check_sequential(deque, "reverse()") < 0)
+        return NULL;
+    _PyObject_LOCK(deque);
+    leftblock = deque->leftblock;
+    rightblock = deque->rightblock;
+    leftindex = deque->leftindex;
+    rightindex = deque->rightindex;
+    n = Py_SIZE(deque) >> 1;
+
     n++;
     while (--n) {
         /* Validate that pointers haven't met in the middle */
@@ -921,33 +1422,52 @@ deque_reverse(dequeobject *deque, PyObject *unused)
             rightindex = BLOCKLEN - 1;
         }
     }
+    _PyObject_UNLOCK(deque);
     Py_RETURN_NONE;
 }
 
 PyDoc_STRVAR(reverse_doc,
 "D.reverse() -- reverse *IN PLACE*");
 
+/* count(), __contains__() and index() compare each item outside the lock,
+   holding a reference to it.  Before reading the next item under the lock,
+   they check that the deque hasn't moved its indices meanwhile, which
+   keeps the block and index they carry from one item to the next valid. */
+
 static PyObject *
 deque_count(dequeobject *deque, PyObject *v)
 {
-    block *b = deque->leftblock;
-    Py_ssize_t index = deque->leftindex;
-    Py_ssize_t n = Py_SIZE(deque);
+    block *b;
+    Py_ssize_t index;
+    Py_ssize_t n;
     Py_ssize_t count = 0;
-    size_t start_state = deque->state;
+    size_t start_state;
     PyObject *item;
     int cmp;
 
+    if (deque_check_sequential(deque, "count()") < 0)
+        return NULL;
+    _PyObject_LOCK(deque);
+    b = deque->leftblock;
+    index = deque->leftindex;
+    n = Py_SIZE(deque);
+    start_state = deque->state;
+
     n++;
     while (--n) {
         CHECK_NOT_END(b);
         item = b->data[index];
+        Py_INCREF(item);
+        _PyObject_UNLOCK(deque);
         cmp = PyObject_RichCompareBool(item, v, Py_EQ);
+        Py_DECREF(item);
         if (cmp < 0)
             return NULL;
         count += cmp;
 
+        _PyObject_LOCK(deque);
         if (start_state != deque->state) {
+            _PyObject_UNLOCK(deque);
             PyErr_SetString(PyExc_RuntimeError,
                             "deque mutated during iteration");
             return NULL;
@@ -960,6 +1480,7 @@ deque_count(dequeobject *deque, PyObject *v)
             index = 0;
         }
     }
+    _PyObject_UNLOCK(deque);
     return PyLong_FromSsize_t(count);
 }
 
@@ -969,22 +1490,35 @@ PyDoc_STRVAR(count_doc,
 static int
 deque_contains(dequeobject *deque, PyObject *v)
 {
-    block *b = deque->leftblock;
-    Py_ssize_t index = deque->leftindex;
-    Py_ssize_t n = Py_SIZE(deque);
-    size_t start_state = deque->state;
+    block *b;
+    Py_ssize_t index;
+    Py_ssize_t n;
+    size_t start_state;
     PyObject *item;
     int cmp;
 
+    if (deque_check_sequential(deque, "'in'") < 0)
+        return -1;
+    _PyObject_LOCK(deque);
+    b = deque->leftblock;
+    index = deque->leftindex;
+    n = Py_SIZE(deque);
+    start_state = deque->state;
+
     n++;
     while (--n) {
         CHECK_NOT_END(b);
         item = b->data[index];
+        Py_INCREF(item);
+        _PyObject_UNLOCK(deque);
         cmp = PyObject_RichCompareBool(item, v, Py_EQ);
+        Py_DECREF(item);
         if (cmp) {
             return cmp;
         }
+        _PyObject_LOCK(deque);
         if (start_state != deque->state) {
+            _PyObject_UNLOCK(deque);
             PyErr_SetString(PyExc_RuntimeError,
                             "deque mutated during iteration");
             return -1;
@@ -995,29 +1529,39 @@ deque_contains(dequeobject *deque, PyObject *v)
             index = 0;
         }
     }
+    _PyObject_UNLOCK(deque);
     return 0;
 }
 
 static Py_ssize_t
 deque_len(dequeobject *deque)
 {
+    if (DEQUE_IS_CONCURRENT(deque))
+        return cq_len(deque->cq);
     return Py_SIZE(deque);
 }
 
 static PyObject *
 deque_index(dequeobject *deque, PyObject *args)
 {
-    Py_ssize_t i, n, start=0, stop=Py_SIZE(deque);
+    Py_ssize_t i, n, start=0, stop=PY_SSIZE_T_MAX;
     PyObject *v, *item;
-    block *b = deque->leftblock;
-    Py_ssize_t index = deque->leftindex;
-    size_t start_state = deque->state;
+    block *b;
+    Py_ssize_t index;
+    size_t start_state;
     int cmp;
 
+    if (deque_check_sequential(deque, "index()") < 0)
+        return NULL;
     if (!PyArg_ParseTuple(args, "O|O&O&:index", &v,
                                 _PyEval_SliceIndex, &start,
                                 _PyEval_SliceIndex, &stop))
         return NULL;
+
+    _PyObject_LOCK(deque);
+    b = deque->leftblock;
+    index = deque->leftindex;
+    start_state = deque->state;
     if (start < 0) {
         start += Py_SIZE(deque);
         if (start < 0)
@@ -1047,12 +1591,17 @@ deque_index(dequeobject *deque, PyObject *args)
     while (--n) {
         CHECK_NOT_END(b);
         item = b->data[index];
+        Py_INCREF(item);
+        _PyObject_UNLOCK(deque);
         cmp = PyObject_RichCompareBool(item, v, Py_EQ);
+        Py_DECREF(item);
         if (cmp > 0)
             return PyLong_FromSsize_t(stop - n);
         if (cmp < 0)
             return NULL;
+        _PyObject_LOCK(deque);
         if (start_state != deque->state) {
+            _PyObject_UNLOCK(deque);
             PyErr_SetString(PyExc_RuntimeError,
                             "deque mutated during iteration");
             return NULL;
@@ -1063,6 +1612,7 @@ deque_index(dequeobject *deque, PyObject *args)
             index = 0;
         }
     }
+    _PyObject_UNLOCK(deque);
     PyErr_Format(PyExc_ValueError, "%R is not in deque", v);
     return NULL;
 }
@@ -1083,31 +1633,50 @@ static PyObject *
 deque_insert(dequeobject *deque, PyObject *args)
 {
     Py_ssize_t index;
-    Py_ssize_t n = Py_SIZE(deque);
+    Py_ssize_t n;
     PyObject *value;
-    PyObject *rv;
+    PyObject *trimmed = NULL;
+    int rv;
 
+    if (deque_check_sequential(deque, "insert()") < 0)
+        return NULL;
     if (!PyArg_ParseTuple(args, "nO:insert", &index, &value))
         return NULL;
-    if (deque->maxlen == Py_SIZE(deque)) {
+    Py_INCREF(value);
+    _PyObject_LOCK(deque);
+    n = Py_SIZE(deque);
+    if (deque->maxlen == n) {
+        _PyObject_UNLOCK(deque);
+        Py_DECREF(value);
         PyErr_SetString(PyExc_IndexError, "deque already at its maximum size");
         return NULL;
     }
+    /* As the deque is below its maximum size, nothing gets trimmed */
     if (index >= n)
-        return deque_append(deque, value);
-    if (index <= -n || index == 0)
-        return deque_appendleft(deque, value);
-    if (_deque_rotate(deque, -index))
-        return NULL;
-    if (index < 0)
-        rv = deque_append(deque, value);
-    else
-        rv = deque_appendleft(deque, value);
-    if (rv == NULL)
-        return NULL;
-    Py_DECREF(rv);
-    if (_deque_rotate(deque, index))
+        rv = deque_append_internal(deque, value, deque->maxlen, &trimmed);
+    else if (index <= -n || index == 0)
+        rv = deque_appendleft_internal(deque, value, deque->maxlen, &trimmed);
+    else {
+        rv = _deque_rotate(deque, -index);
+        if (!rv) {
+            if (index < 0)
+                rv = deque_append_internal(deque, value, deque->maxlen,
+                                           &trimmed);
+            else
+                rv = deque_appendleft_internal(deque, value, deque->maxlen,
+                                               &trimmed);
+            if (!rv)
+                rv = _deque_rotate(deque, index);
+            else
+                (void)_deque_rotate(deque, index);
+        }
+    }
+    _PyObject_UNLOCK(deque);
+    assert(rv < 0 || trimmed == NULL);
+    if (rv < 0) {
+        Py_DECREF(value);
         return NULL;
+    }
     Py_RETURN_NONE;
 }
 
@@ -1117,31 +1686,47 @@ PyDoc_STRVAR(insert_doc,
 static PyObject *
 deque_remove(dequeobject *deque, PyObject *value)
 {
-    Py_ssize_t i, n=Py_SIZE(deque);
+    Py_ssize_t i, n;
 
+    if (deque_check_sequential(deque, "remove()") < 0)
+        return NULL;
+    _PyObject_LOCK(deque);
+    n = Py_SIZE(deque);
     for (i=0 ; i<n ; i++) {
         PyObject *item = deque->leftblock->data[deque->leftindex];
-        int cmp = PyObject_RichCompareBool(item, value, Py_EQ);
+        int cmp;
+
+        Py_INCREF(item);
+        _PyObject_UNLOCK(deque);
+        cmp = PyObject_RichCompareBool(item, value, Py_EQ);
+        Py_DECREF(item);
+        _PyObject_LOCK(deque);
 
         if (Py_SIZE(deque) != n) {
+            _PyObject_UNLOCK(deque);
             PyErr_SetString(PyExc_IndexError,
                 "deque mutated during remove().");
             return NULL;
         }
         if (cmp > 0) {
-            PyObject *tgt = deque_popleft(deque, NULL);
+            PyObject *tgt = deque_popleft_internal(deque);
+            int rv;
             assert (tgt != NULL);
-            if (_deque_rotate(deque, i))
+            rv = _deque_rotate(deque, i);
+            _PyObject_UNLOCK(deque);
+            if (rv)
                 return NULL;
             Py_DECREF(tgt);
             Py_RETURN_NONE;
         }
         else if (cmp < 0) {
             _deque_rotate(deque, i);
+            _PyObject_UNLOCK(deque);
             return NULL;
         }
         _deque_rotate(deque, -1);
     }
+    _PyObject_UNLOCK(deque);
     PyErr_SetString(PyExc_ValueError, "deque.remove(x): x not in deque");
     return NULL;
 }
@@ -1164,7 +1749,11 @@ deque_item(dequeobject *deque, Py_ssize_t i)
     PyObject *item;
     Py_ssize_t n, index=i;
 
+    if (deque_check_sequential(deque, "indexing") < 0)
+        return NULL;
+    _PyObject_LOCK(deque);
     if (!valid_index(i, Py_SIZE(deque))) {
+        _PyObject_UNLOCK(deque);
         PyErr_SetString(PyExc_IndexError, "deque index out of range");
         return NULL;
     }
@@ -1196,22 +1785,24 @@ deque_item(dequeobject *deque, Py_ssize_t i)
     }
     item = b->data[i];
     Py_INCREF(item);
+    _PyObject_UNLOCK(deque);
     return item;
 }
 
+/* Remove the item at index i and store it in *item for the caller to
+   decref; the caller must hold the lock. */
 static int
-deque_del_item(dequeobject *deque, Py_ssize_t i)
+deque_del_item(dequeobject *deque, Py_ssize_t i, PyObject **item)
 {
-    PyObject *item;
     int rv;
 
     assert (i >= 0 && i < Py_SIZE(deque));
+    *item = NULL;
     if (_deque_rotate(deque, -i))
         return -1;
-    item = deque_popleft(deque, NULL);
+    *item = deque_popleft_internal(deque);
     rv = _deque_rotate(deque, i);
-    assert (item != NULL);
-    Py_DECREF(item);
+    assert (*item != NULL);
     return rv;
 }
 
@@ -1220,14 +1811,25 @@ deque_ass_item(dequeobject *deque, Py_ssize_t i, PyObject *v)
 {
     PyObject *old_value;
     block *b;
-    Py_ssize_t n, len=Py_SIZE(deque), halflen=(len+1)>>1, index=i;
+    Py_ssize_t n, len, halflen, index=i;
+    int rv;
 
+    if (deque_check_sequential(deque, "item assignment") < 0)
+        return -1;
+    _PyObject_LOCK(deque);
+    len = Py_SIZE(deque);
+    halflen = (len+1)>>1;
     if (!valid_index(i, len)) {
+        _PyObject_UNLOCK(deque);
         PyErr_SetString(PyExc_IndexError, "deque index out of range");
         return -1;
     }
-    if (v == NULL)
-        return deque_del_item(deque, i);
+    if (v == NULL) {
+        rv = deque_del_item(deque, i, &old_value);
+        _PyObject_UNLOCK(deque);
+        Py_XDECREF(old_value);
+        return rv;
+    }
 
     i += deque->leftindex;
     n = (Py_ssize_t)((size_t) i / BLOCKLEN);
@@ -1249,6 +1851,7 @@ deque_ass_item(dequeobject *deque, Py_ssize_t i, PyObject *v)
     Py_INCREF(v);
     old_value = b->data[i];
     b->data[i] = v;
+    _PyObject_UNLOCK(deque);
     Py_DECREF(old_value);
     return 0;
 }
@@ -1264,8 +1867,11 @@ deque_dealloc(dequeobject *deque)
         assert(deque->leftblock != NULL);
         freeblock(deque->leftblock);
     }
+    if (deque->cq != NULL)
+        cq_free(deque->cq);
     deque->leftblock = NULL;
     deque->rightblock = NULL;
+    deque->cq = NULL;
     Py_TYPE(deque)->tp_free(deque);
 }
 
@@ -1278,6 +1884,9 @@ deque_traverse(dequeobject *deque, visitproc visit, void *arg)
     Py_ssize_t indexlo = deque->leftindex;
     Py_ssize_t indexhigh;
 
+    if (DEQUE_IS_CONCURRENT(deque))
+        return cq_traverse(deque->cq, visit, arg);
+
     for (b = deque->leftblock; b != deque->rightblock; b = b->rightlink) {
         for (index = indexlo; index < BLOCKLEN ; index++) {
             item = b->data[index];
@@ -1299,6 +1908,9 @@ deque_reduce(dequeobject *deque)
     PyObject *dict, *it;
     _Py_IDENTIFIER(__dict__);
 
+    if (deque_check_sequential(deque, "pickling") < 0)
+        return NULL;
+
     dict = _PyObject_GetAttrId((PyObject *)deque, &PyId___dict__);
     if (dict == NULL) {
         if (!PyErr_ExceptionMatches(PyExc_AttributeError)) {
@@ -1331,6 +1943,11 @@ deque_repr(PyObject *deque)
     PyObject *aslist, *result;
     int i;
 
+    /* The items of a concurrent deque can't be looked at in place */
+    if (DEQUE_IS_CONCURRENT((dequeobject *)deque))
+        return PyUnicode_FromFormat("deque(<%zd items>, concurrent=True)",
+                                    cq_len(((dequeobject *)deque)->cq));
+
     i = Py_ReprEnter(deque);
     if (i != 0) {
         if (i < 0)
@@ -1361,7 +1978,9 @@ deque_richcompare(PyObject *v, PyObject *w, int op)
     int b, cmp=-1;
 
     if (!PyObject_TypeCheck(v, &deque_type) ||
-        !PyObject_TypeCheck(w, &deque_type)) {
+        !PyObject_TypeCheck(w, &deque_type) ||
+        DEQUE_IS_CONCURRENT((dequeobject *)v) ||
+        DEQUE_IS_CONCURRENT((dequeobject *)w)) {
         Py_RETURN_NOTIMPLEMENTED;
     }
 
@@ -1436,17 +2055,29 @@ deque_init(dequeobject *deque, PyObject *args, PyObject *kwdargs)
 {
     PyObject *iterable = NULL;
     PyObject *maxlenobj = NULL;
+    PyObject *concurrentobj = NULL;
     Py_ssize_t maxlen = -1;
-    char *kwlist[] = {"iterable", "maxlen", 0};
+    char *kwlist[] = {"iterable", "maxlen", "concurrent", 0};
 
     if (kwdargs == NULL) {
         if (!PyArg_UnpackTuple(args, "deque()", 0, 2, &iterable, &maxlenobj))
             return -1;
     } else {
-        if (!PyArg_ParseTupleAndKeywords(args, kwdargs, "|OO:deque", kwlist,
-                                         &iterable, &maxlenobj))
+        if (!PyArg_ParseTupleAndKeywords(args, kwdargs, "|OO$O:deque", kwlist,
+                                         &iterable, &maxlenobj,
+                                         &concurrentobj))
             return -1;
     }
+    if (concurrentobj != NULL) {
+        int concurrent = PyObject_IsTrue(concurrentobj);
+        if (concurrent < 0)
+            return -1;
+        if (concurrent != DEQUE_IS_CONCURRENT(deque)) {
+            PyErr_SetString(PyExc_ValueError,
+                            "cannot change whether a deque is concurrent");
+            return -1;
+        }
+    }
     if (maxlenobj != NULL && maxlenobj != Py_None) {
         maxlen = PyLong_AsSsize_t(maxlenobj);
         if (maxlen == -1 && PyErr_Occurred())
@@ -1455,9 +2086,14 @@ deque_init(dequeobject *deque, PyObject *args, PyObject *kwdargs)
             PyErr_SetString(PyExc_ValueError, "maxlen must be non-negative");
             return -1;
         }
+        if (DEQUE_IS_CONCURRENT(deque)) {
+            PyErr_SetString(PyExc_ValueError,
+                            "concurrent deques can't have a maxlen");
+            return -1;
+        }
     }
     deque->maxlen = maxlen;
-    if (Py_SIZE(deque) > 0)
+    if (deque_len(deque) > 0)
         deque_clear(deque);
     if (iterable != NULL) {
         PyObject *rv = deque_extend(deque, iterable);
@@ -1475,10 +2111,17 @@ deque_sizeof(dequeobject *deque, void *unused)
     Py_ssize_t blocks;
 
     res = _PyObject_SIZE(Py_TYPE(deque));
+    _PyObject_LOCK(deque);
     blocks = (size_t)(deque->leftindex + Py_SIZE(deque) + BLOCKLEN - 1) / BLOCKLEN;
     assert(deque->leftindex + Py_SIZE(deque) - 1 ==
            (blocks - 1) * BLOCKLEN + deque->rightindex);
+    _PyObject_UNLOCK(deque);
     res += blocks * sizeof(block);
+    if (DEQUE_IS_CONCURRENT(deque)) {
+        /* A close estimate: the head block may be partly consumed */
+        blocks = cq_len(deque->cq) / CBLOCKLEN + 1;
+        res += sizeof(cqueue) + blocks * sizeof(cblock);
+    }
     return PyLong_FromSsize_t(res);
 }
 
@@ -1488,7 +2131,7 @@ PyDoc_STRVAR(sizeof_doc,
 static int
 deque_bool(dequeobject *deque)
 {
-    return Py_SIZE(deque) != 0;
+    return deque_len(deque) != 0;
 }
 
 static PyObject *
@@ -1581,9 +2224,11 @@ static PyMethodDef deque_methods[] = {
 };
 
 PyDoc_STRVAR(deque_doc,
-"deque([iterable[, maxlen]]) --> deque object\n\
+"deque([iterable[, maxlen]], *, concurrent=False) --> deque object\n\
 \n\
-A list-like sequence optimized for data accesses near its endpoints.");
+A list-like sequence optimized for data accesses near its endpoints.\n\
+A concurrent deque is a lock-free FIFO queue which only supports\n\
+append(), extend(), popleft(), clear() and len().");
 
 static PyTypeObject deque_type = {
     PyVarObject_HEAD_INIT(NULL, 0)
@@ -1647,15 +2292,19 @@ deque_iter(dequeobject *deque)
 {
     dequeiterobject *it;
 
+    if (deque_check_sequential(deque, "iteration") < 0)
+        return NULL;
     it = PyObject_GC_New(dequeiterobject, &dequeiter_type);
     if (it == NULL)
         return NULL;
+    _PyObject_LOCK(deque);
     it->b = deque->leftblock;
     it->index = deque->leftindex;
-    Py_INCREF(deque);
-    it->deque = deque;
     it->state = deque->state;
     it->counter = Py_SIZE(deque);
+    _PyObject_UNLOCK(deque);
+    Py_INCREF(deque);
+    it->deque = deque;
     PyObject_GC_Track(it);
     return (PyObject *)it;
 }
@@ -1679,14 +2328,18 @@ dequeiter_next(dequeiterobject *it)
 {
     PyObject *item;
 
+    _PyObject_LOCK(it->deque);
     if (it->deque->state != it->state) {
+        _PyObject_UNLOCK(it->deque);
         it->counter = 0;
         PyErr_SetString(PyExc_RuntimeError,
                         "deque mutated during iteration");
         return NULL;
     }
-    if (it->counter == 0)
+    if (it->counter == 0) {
+        _PyObject_UNLOCK(it->deque);
         return NULL;
+    }
     assert (!(it->b == it->deque->rightblock &&
               it->index > it->deque->rightindex));
 
@@ -1699,6 +2352,7 @@ dequeiter_next(dequeiterobject *it)
         it->index = 0;
     }
     Py_INCREF(item);
+    _PyObject_UNLOCK(it->deque);
     return item;
 }
 
@@ -1803,15 +2457,19 @@ deque_reviter(dequeobject *deque)
 {
     dequeiterobject *it;
 
+    if (deque_check_sequential(deque, "iteration") < 0)
+        return NULL;
     it = PyObject_GC_New(dequeiterobject, &dequereviter_type);
     if (it == NULL)
         return NULL;
+    _PyObject_LOCK(deque);
     it->b = deque->rightblock;
     it->index = deque->rightindex;
-    Py_INCREF(deque);
-    it->deque = deque;
     it->state = deque->state;
     it->counter = Py_SIZE(deque);
+    _PyObject_UNLOCK(deque);
+    Py_INCREF(deque);
+    it->deque = deque;
     PyObject_GC_Track(it);
     return (PyObject *)it;
 }
@@ -1823,7 +2481,9 @@ dequereviter_next(dequeiterobject *it)
     if (it->counter == 0)
         return NULL;
 
+    _PyObject_LOCK(it->deque);
     if (it->deque->state != it->state) {
+        _PyObject_UNLOCK(it->deque);
         it->counter = 0;
         PyErr_SetString(PyExc_RuntimeError,
                         "deque mutated during iteration");
@@ -1841,6 +2501,7 @@ dequereviter_next(dequeiterobject *it)
         it->index = BLOCKLEN - 1;
     }
     Py_INCREF(item);
+    _PyObject_UNLOCK(it->deque);
     return item;
 }
 
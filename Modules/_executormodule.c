@@ -0,0 +1,462 @@
+/* Work-stealing work queue for concurrent.futures.ThreadPoolExecutor */
+
+#include "Python.h"
+#include "structmember.h" /* offsetof */
+
+#ifndef WITH_THREAD
+#error "Error!  The rest of Python is not compiled with thread support."
+#error "Rerun configure, adding a --with-threads option."
+#error "Then run `make clean' followed by `make'."
+#endif
+
+#include "pythread.h"
+
+/* Quick overview:
+
+   A WorkQueue is created for a fixed number of workers, and each worker
+   has its own deque of items (callables taking no argument).  The worker
+   threads are started by the executor, and each of them runs
+   WorkQueue.run_worker(index) until the queue is closed and drained.
+
+   A worker takes the items of its own deque from the front, so that they
+   run in the order in which they were put.  When its deque is empty it
+   steals from the back of the deques of the other workers, and when they
+   are all empty it goes to sleep on its wake lock.
+
+   put() appends each item to the deque of the next worker in turn, and
+   wakes up a sleeping worker, if any: because of the stealing it doesn't
+   matter whose deque an item lands in.
+
+   Locking: each deque has its own lock, which is taken by its worker to
+   take an item and by the other threads to put or steal one.  The queue
+   lock (wq_lock) protects the list of sleeping workers and the closed
+   flag, and is held by put() while it appends an item, and by a worker
+   while it checks the deques for the last time before sleeping, so that
+   no wakeup can be lost.  The queue lock is always taken before a deque
+   lock.  No lock is held while running Python code or while waiting for
+   the GIL.
+*/
+
+typedef struct {
+    _PyThread_lock lock;
+    PyObject **items;           /* Ring buffer of strong references */
+    Py_ssize_t allocated;       /* A power of 2, or 0 */
+    Py_ssize_t first;
+    Py_ssize_t len;
+    _PyThread_lock wake;        /* Held while the worker isn't woken up */
+    int running;                /* run_worker() is running for this one */
+} workerobject;
+
+typedef struct {
+    PyObject_HEAD
+    _PyThread_lock wq_lock;
+    Py_ssize_t nworkers;
+    workerobject *workers;
+    Py_ssize_t *sleeping;       /* Stack of the indices of sleeping workers */
+    Py_ssize_t nsleeping;
+    Py_ssize_t nstarted;        /* Number of workers which ever ran */
+    Py_ssize_t next_worker;     /* Where put() appends the next item */
+    int closed;
+    PyObject *weakreflist;
+} workqueueobject;
+
+static PyTypeObject WorkQueue_Type;
+
+#define WQ_LOCK(wq) _PyThread_lock_acquire_timed(&(wq)->wq_lock, -1, 0)
+#define WQ_UNLOCK(wq) _PyThread_lock_release(&(wq)->wq_lock)
+#define WORKER_LOCK(w) _PyThread_lock_acquire_timed(&(w)->lock, -1, 0)
+#define WORKER_UNLOCK(w) _PyThread_lock_release(&(w)->lock)
+
+/* Append an item to the back of the deque of w, stealing the reference.
+   Called with w->lock held.  Return 0 on success, -1 on memory error
+   (without setting an exception). */
+static int
+worker_append(workerobject *w, PyObject *item)
+{
+    if (w->len == w->allocated) {
+        Py_ssize_t i, allocated = w->allocated ? w->allocated * 2 : 16;
+        PyObject **items;
+
+        if ((size_t)allocated > PY_SSIZE_T_MAX / sizeof(PyObject *))
+            return -1;
+        items = PyMem_RawMalloc(allocated * sizeof(PyObject *));
+        if (items == NULL)
+            return -1;
+        for (i = 0; i < w->len; i++)
+            items[i] = w->items[(w->first + i) & (w->allocated - 1)];
+        PyMem_RawFree(w->items);
+        w->items = items;
+        w->allocated = allocated;
+        w->first = 0;
+    }
+    w->items[(w->first + w->len) & (w->allocated - 1)] = item;
+    w->len++;
+    return 0;
+}
+
+/* Take the item at the front (for its own worker) or at the back (for a
+   thief) of the deque of w.  Return a new reference, or NULL if the deque
+   is empty. */
+static PyObject *
+worker_take(workerobject *w, int front)
+{
+    PyObject *item = NULL;
+
+    WORKER_LOCK(w);
+    if (w->len > 0) {
+        if (front) {
+            item = w->items[w->first];
+            w->first = (w->first + 1) & (w->allocated - 1);
+        }
+        else
+            item = w->items[(w->first + w->len - 1) & (w->allocated - 1)];
+        w->len--;
+    }
+    WORKER_UNLOCK(w);
+    return item;
+}
+
+/* Find an item for the worker index: from its own deque first, then from
+   the others, starting with its neighbour. */
+static PyObject *
+wq_find_item(workqueueobject *wq, Py_ssize_t index)
+{
+    PyObject *item;
+    Py_ssize_t i;
+
+    item = worker_take(&wq->workers[index], 1);
+    for (i = 1; item == NULL && i < wq->nworkers; i++)
+        item = worker_take(&wq->workers[(index + i) % wq->nworkers], 0);
+    return item;
+}
+
+/* Wake up one sleeping worker, if any.  Called with wq_lock held. */
+static void
+wq_wake_one(workqueueobject *wq)
+{
+    if (wq->nsleeping > 0) {
+        Py_ssize_t index = wq->sleeping[--wq->nsleeping];
+        _PyThread_lock_release(&wq->workers[index].wake);
+    }
+}
+
+static PyObject *
+workqueue_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"nworkers", NULL};
+    workqueueobject *wq;
+    Py_ssize_t nworkers, i;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "n:WorkQueue", kwlist,
+                                     &nworkers))
+        return NULL;
+    if (nworkers <= 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "nworkers must be greater than 0");
+        return NULL;
+    }
+    if ((size_t)nworkers > PY_SSIZE_T_MAX / sizeof(workerobject))
+        return PyErr_NoMemory();
+
+    wq = (workqueueobject *)type->tp_alloc(type, 0);
+    if (wq == NULL)
+        return NULL;
+    wq->workers = PyMem_Calloc(nworkers, sizeof(workerobject));
+    wq->sleeping = PyMem_Calloc(nworkers, sizeof(Py_ssize_t));
+    if (wq->workers == NULL || wq->sleeping == NULL) {
+        Py_DECREF(wq);
+        return PyErr_NoMemory();
+    }
+    if (_PyThread_lock_init(&wq->wq_lock) < 0)
+        goto lock_error;
+    /* nworkers only counts the workers whose locks are initialized */
+    for (i = 0; i < nworkers; i++) {
+        workerobject *w = &wq->workers[i];
+        if (_PyThread_lock_init(&w->lock) < 0 ||
+            _PyThread_lock_init(&w->wake) < 0) {
+            _PyThread_lock_fini(&w->lock);
+            _PyThread_lock_fini(&w->wake);
+            goto lock_error;
+        }
+        _PyThread_lock_acquire_timed(&w->wake, -1, 0);
+        wq->nworkers++;
+    }
+    return (PyObject *)wq;
+
+  lock_error:
+    Py_DECREF(wq);
+    PyErr_SetString(PyExc_RuntimeError, "can't allocate lock");
+    return NULL;
+}
+
+static int
+workqueue_traverse(workqueueobject *wq, visitproc visit, void *arg)
+{
+    Py_ssize_t i, j;
+
+    for (i = 0; i < wq->nworkers; i++) {
+        workerobject *w = &wq->workers[i];
+        for (j = 0; j < w->len; j++)
+            Py_VISIT(w->items[(w->first + j) & (w->allocated - 1)]);
+    }
+    return 0;
+}
+
+static int
+workqueue_clear(workqueueobject *wq)
+{
+    Py_ssize_t i;
+
+    for (i = 0; i < wq->nworkers; i++) {
+        PyObject *item;
+        while ((item = worker_take(&wq->workers[i], 1)) != NULL)
+            Py_DECREF(item);
+    }
+    return 0;
+}
+
+static void
+workqueue_dealloc(workqueueobject *wq)
+{
+    Py_ssize_t i;
+
+    PyObject_GC_UnTrack(wq);
+    if (wq->weakreflist != NULL)
+        PyObject_ClearWeakRefs((PyObject *)wq);
+    if (wq->workers != NULL) {
+        /* run_worker() holds a reference, so no worker is running */
+        workqueue_clear(wq);
+        for (i = 0; i < wq->nworkers; i++) {
+            workerobject *w = &wq->workers[i];
+            PyMem_RawFree(w->items);
+            _PyThread_lock_fini(&w->lock);
+            /* Unlock the lock so it's safe to free it */
+            _PyThread_lock_release(&w->wake);
+            _PyThread_lock_fini(&w->wake);
+        }
+        PyMem_Free(wq->workers);
+    }
+    PyMem_Free(wq->sleeping);
+    _PyThread_lock_fini(&wq->wq_lock);
+    Py_TYPE(wq)->tp_free(wq);
+}
+
+PyDoc_STRVAR(put_doc,
+"put(item)\n\
+\n\
+Put a callable in the queue, for a worker to call it without arguments.\n\
+Raise RuntimeError if the queue is closed.");
+
+static PyObject *
+workqueue_put(workqueueobject *wq, PyObject *item)
+{
+    workerobject *w;
+    int r;
+
+    Py_INCREF(item);
+    WQ_LOCK(wq);
+    if (wq->closed) {
+        WQ_UNLOCK(wq);
+        Py_DECREF(item);
+        PyErr_SetString(PyExc_RuntimeError,
+                        "cannot put items in a closed queue");
+        return NULL;
+    }
+    /* Spread the items over the workers which run, or will run soon */
+    w = &wq->workers[wq->next_worker];
+    if (++wq->next_worker >= Py_MAX(wq->nstarted, 1))
+        wq->next_worker = 0;
+    WORKER_LOCK(w);
+    r = worker_append(w, item);
+    WORKER_UNLOCK(w);
+    if (r == 0)
+        wq_wake_one(wq);
+    WQ_UNLOCK(wq);
+    if (r < 0) {
+        Py_DECREF(item);
+        return PyErr_NoMemory();
+    }
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(close_doc,
+"close()\n\
+\n\
+Close the queue: the workers exit once all the items put so far ran.");
+
+static PyObject *
+workqueue_close(workqueueobject *wq)
+{
+    WQ_LOCK(wq);
+    wq->closed = 1;
+    while (wq->nsleeping > 0)
+        wq_wake_one(wq);
+    WQ_UNLOCK(wq);
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(run_worker_doc,
+"run_worker(index)\n\
+\n\
+Run the items of the queue in the current thread, as the worker index,\n\
+until the queue is closed and empty.  If an item raises an exception,\n\
+it is propagated and the worker stops.");
+
+static PyObject *
+workqueue_run_worker(workqueueobject *wq, PyObject *arg)
+{
+    Py_ssize_t index;
+    workerobject *w;
+    PyObject *item, *result = NULL;
+
+    index = PyNumber_AsSsize_t(arg, PyExc_OverflowError);
+    if (index == -1 && PyErr_Occurred())
+        return NULL;
+    if (index < 0 || index >= wq->nworkers) {
+        PyErr_SetString(PyExc_ValueError, "worker index out of range");
+        return NULL;
+    }
+    w = &wq->workers[index];
+
+    WQ_LOCK(wq);
+    if (w->running) {
+        WQ_UNLOCK(wq);
+        PyErr_Format(PyExc_RuntimeError, "worker %zd is already running",
+                     index);
+        return NULL;
+    }
+    w->running = 1;
+    if (index >= wq->nstarted)
+        wq->nstarted = index + 1;
+    WQ_UNLOCK(wq);
+    Py_INCREF(wq);
+
+    for (;;) {
+        item = wq_find_item(wq, index);
+        if (item == NULL) {
+            /* Look once more while put() can't append anything, then
+               either exit or sleep until put() or close() wakes us up */
+            WQ_LOCK(wq);
+            item = wq_find_item(wq, index);
+            if (item == NULL) {
+                if (wq->closed) {
+                    w->running = 0;
+                    WQ_UNLOCK(wq);
+                    result = Py_None;
+                    Py_INCREF(result);
+                    break;
+                }
+                wq->sleeping[wq->nsleeping++] = index;
+                WQ_UNLOCK(wq);
+                Py_BEGIN_ALLOW_THREADS
+                _PyThread_lock_acquire_timed(&w->wake, -1, 0);
+                Py_END_ALLOW_THREADS
+                continue;
+            }
+            WQ_UNLOCK(wq);
+        }
+        result = PyObject_CallObject(item, NULL);
+        Py_DECREF(item);
+        if (result == NULL) {
+            WQ_LOCK(wq);
+            w->running = 0;
+            /* Another worker must take over the items of our deque */
+            wq_wake_one(wq);
+            WQ_UNLOCK(wq);
+            break;
+        }
+        Py_CLEAR(result);
+    }
+    Py_DECREF(wq);
+    return result;
+}
+
+static PyMethodDef workqueue_methods[] = {
+    {"put",         (PyCFunction)workqueue_put,         METH_O,
+     put_doc},
+    {"close",       (PyCFunction)workqueue_close,       METH_NOARGS,
+     close_doc},
+    {"run_worker",  (PyCFunction)workqueue_run_worker,  METH_O,
+     run_worker_doc},
+    {NULL,          NULL}   /* sentinel */
+};
+
+PyDoc_STRVAR(workqueue_doc,
+"WorkQueue(nworkers)\n\
+\n\
+A queue of callables run by a fixed number of worker threads, with a\n\
+deque per worker and work stealing between them.");
+
+static PyTypeObject WorkQueue_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_executor.WorkQueue",              /* tp_name */
+    sizeof(workqueueobject),            /* tp_basicsize */
+    0,                                  /* tp_itemsize */
+    (destructor)workqueue_dealloc,      /* tp_dealloc */
+    0,                                  /* tp_print */
+    0,                                  /* tp_getattr */
+    0,                                  /* tp_setattr */
+    0,                                  /* tp_reserved */
+    0,                                  /* tp_repr */
+    0,                                  /* tp_as_number */
+    0,                                  /* tp_as_sequence */
+    0,                                  /* tp_as_mapping */
+    0,                                  /* tp_hash */
+    0,                                  /* tp_call */
+    0,                                  /* tp_str */
+    PyObject_GenericGetAttr,            /* tp_getattro */
+    0,                                  /* tp_setattro */
+    0,                                  /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,    /* tp_flags */
+    workqueue_doc,                      /* tp_doc */
+    (traverseproc)workqueue_traverse,   /* tp_traverse */
+    (inquiry)workqueue_clear,           /* tp_clear */
+    0,                                  /* tp_richcompare */
+    offsetof(workqueueobject, weakreflist), /* tp_weaklistoffset */
+    0,                                  /* tp_iter */
+    0,                                  /* tp_iternext */
+    workqueue_methods,                  /* tp_methods */
+    0,                                  /* tp_members */
+    0,                                  /* tp_getset */
+    0,                                  /* tp_base */
+    0,                                  /* tp_dict */
+    0,                                  /* tp_descr_get */
+    0,                                  /* tp_descr_set */
+    0,                                  /* tp_dictoffset */
+    0,                                  /* tp_init */
+    0,                                  /* tp_alloc */
+    workqueue_new,                      /* tp_new */
+    PyObject_GC_Del,                    /* tp_free */
+};
+
+PyDoc_STRVAR(module_doc,
+"C implementation of the work queue of\n\
+concurrent.futures.ThreadPoolExecutor.");
+
+static struct PyModuleDef _executormodule = {
+    PyModuleDef_HEAD_INIT,
+    "_executor",
+    module_doc,
+    -1,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL
+};
+
+PyMODINIT_FUNC
+PyInit__executor(void)
+{
+    PyObject *m;
+
+    if (PyType_Ready(&WorkQueue_Type) < 0)
+        return NULL;
+    m = PyModule_Create(&_executormodule);
+    if (m == NULL)
+        return NULL;
+    Py_INCREF(&WorkQueue_Type);
+    if (PyModule_AddObject(m, "WorkQueue", (PyObject *)&WorkQueue_Type) < 0)
+        return NULL;
+    return m;
+}
@@ -670,6 +670,13 @@ subprocess_fork_exec(PyObject* self, PyObject *args)
         cwd_obj2 = NULL;
     }
 
+#ifdef WITH_THREAD
+    /* Don't let the child inherit locks held by other threads if it is going
+       to run Python code */
+    if (preexec_fn != Py_None)
+        _PyEval_StopTheWorld();
+#endif
+
     pid = fork();
     if (pid == 0) {
         /* Child process */
@@ -702,6 +709,8 @@ subprocess_fork_exec(PyObject* self, PyObject *args)
         PyErr_SetFromErrno(PyExc_OSError);
     }
 #ifdef WITH_THREAD
+    if (preexec_fn != Py_None)
+        _PyEval_StartTheWorld();
     if (preexec_fn != Py_None
         && _PyImport_ReleaseLock() < 0 && !PyErr_Occurred()) {
         PyErr_SetString(PyExc_RuntimeError,
@@ -0,0 +1,669 @@
+/* C implementation of queue.SimpleQueue */
+
+#include "Python.h"
+#include "structmember.h" /* offsetof */
+
+#ifndef WITH_THREAD
+#error "Error!  The rest of Python is not compiled with thread support."
+#error "Rerun configure, adding a --with-threads option."
+#error "Then run `make clean' followed by `make'."
+#endif
+
+#include "pythread.h"
+
+/* Quick overview:
+
+   A SimpleQueue is an unbounded FIFO queue: a ring buffer of items, and a
+   list of the threads waiting in get(), protected by a single lock.  The
+   lock is only held for a few instructions: never while allocating Python
+   objects or releasing references, which could run arbitrary code, and
+   never while waiting for the GIL.
+
+   A thread which finds the queue empty links a waiter, allocated on its
+   own stack, at the end of the list, and blocks on the lock of the waiter.
+   put() hands its item directly to the first waiter and releases the
+   lock of the waiter: the woken thread returns the item without taking
+   the queue lock again, and the buffer is only used while nobody waits.
+   A waiter which times out or is interrupted takes the queue lock to
+   unlink itself, unless an item was handed to it in the meantime.
+
+   put_many() and get_many() move a batch of items with a single round of
+   locking. */
+
+typedef struct waiter {
+    struct waiter *next;
+    _PyThread_lock lock;        /* Held until an item is handed over */
+    PyObject *item;             /* The item handed over, or NULL */
+} waiter;
+
+typedef struct {
+    PyObject_HEAD
+    _PyThread_lock mutex;
+    PyObject **items;           /* Ring buffer of strong references */
+    Py_ssize_t allocated;       /* A power of 2, or 0 */
+    Py_ssize_t first;
+    Py_ssize_t len;
+    waiter *waiters_head;
+    waiter *waiters_tail;
+    PyObject *weakreflist;
+} simplequeueobject;
+
+static PyObject *EmptyError;
+
+#define QUEUE_LOCK(q) _PyThread_lock_acquire_timed(&(q)->mutex, -1, 0)
+#define QUEUE_UNLOCK(q) _PyThread_lock_release(&(q)->mutex)
+#define QUEUE_ITEM(q, i) ((q)->items[((q)->first + (i)) & ((q)->allocated - 1)])
+
+/* Make room for n more items in the buffer.  Called with the queue lock
+   held.  Return 0 on success, -1 on memory error (without setting an
+   exception). */
+static int
+queue_reserve(simplequeueobject *q, Py_ssize_t n)
+{
+    Py_ssize_t i, allocated;
+    PyObject **items;
+
+    if (q->allocated - q->len >= n)
+        return 0;
+    allocated = q->allocated ? q->allocated : 16;
+    while (allocated - q->len < n) {
+        if ((size_t)allocated > PY_SSIZE_T_MAX / sizeof(PyObject *) / 2)
+            return -1;
+        allocated *= 2;
+    }
+    items = PyMem_RawMalloc(allocated * sizeof(PyObject *));
+    if (items == NULL)
+        return -1;
+    for (i = 0; i < q->len; i++)
+        items[i] = QUEUE_ITEM(q, i);
+    PyMem_RawFree(q->items);
+    q->items = items;
+    q->allocated = allocated;
+    q->first = 0;
+    return 0;
+}
+
+/* Give item (a stolen reference) to the first waiter, or store it at the
+   back (or front) of the buffer, for which there must be room.  Called
+   with the queue lock held. */
+static void
+queue_deliver(simplequeueobject *q, PyObject *item, int front)
+{
+    waiter *w = q->waiters_head;
+
+    if (w != NULL) {
+        assert(q->len == 0);
+        q->waiters_head = w->next;
+        if (q->waiters_head == NULL)
+            q->waiters_tail = NULL;
+        w->item = item;
+        _PyThread_lock_release(&w->lock);
+    }
+    else if (front) {
+        q->first = (q->first - 1) & (q->allocated - 1);
+        q->items[q->first] = item;
+        q->len++;
+    }
+    else {
+        QUEUE_ITEM(q, q->len) = item;
+        q->len++;
+    }
+}
+
+/* Take the item at the front of the buffer.  Called with the queue lock
+   held, and the buffer not empty. */
+static PyObject *
+queue_pop(simplequeueobject *q)
+{
+    PyObject *item = q->items[q->first];
+
+    q->first = (q->first + 1) & (q->allocated - 1);
+    q->len--;
+    return item;
+}
+
+/* Stop waiting: unlink w, unless an item was handed to it meanwhile.
+   Return that item (a new reference), or NULL. */
+static PyObject *
+queue_cancel_wait(simplequeueobject *q, waiter *w)
+{
+    PyObject *item;
+
+    QUEUE_LOCK(q);
+    item = w->item;
+    if (item == NULL) {
+        waiter **link = &q->waiters_head, *prev = NULL;
+        while (*link != w) {
+            prev = *link;
+            link = &prev->next;
+        }
+        *link = w->next;
+        if (q->waiters_tail == w)
+            q->waiters_tail = prev;
+    }
+    QUEUE_UNLOCK(q);
+    return item;
+}
+
+/* Parse the block and timeout arguments of get() into a timeout: 0 not to
+   block, -1 to block forever.  Return -1 with an exception set on error. */
+static int
+parse_timeout(int block, PyObject *timeout_obj, _PyTime_t *timeout)
+{
+    if (!block) {
+        *timeout = 0;
+        return 0;
+    }
+    if (timeout_obj == Py_None) {
+        *timeout = -1;
+        return 0;
+    }
+    if (_PyTime_FromSecondsObject(timeout, timeout_obj,
+                                  _PyTime_ROUND_CEILING) < 0)
+        return -1;
+    if (*timeout < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "'timeout' must be a non-negative number");
+        return -1;
+    }
+    if (_PyTime_AsMicroseconds(*timeout, _PyTime_ROUND_CEILING)
+            >= PY_TIMEOUT_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "timeout value is too large");
+        return -1;
+    }
+    return 0;
+}
+
+/* Remove and return the first item, waiting for at most timeout (see
+   parse_timeout()).  Return a new reference, or NULL with an exception
+   set: Empty if no item came in time. */
+static PyObject *
+queue_get(simplequeueobject *q, _PyTime_t timeout)
+{
+    waiter w;
+    PyLockStatus r;
+    PyObject *item = NULL;
+    _PyTime_t endtime = 0;
+
+    QUEUE_LOCK(q);
+    if (q->len > 0) {
+        item = queue_pop(q);
+        QUEUE_UNLOCK(q);
+        return item;
+    }
+    if (timeout == 0) {
+        QUEUE_UNLOCK(q);
+        PyErr_SetNone(EmptyError);
+        return NULL;
+    }
+    /* Initializing a futex lock doesn't allocate anything */
+    if (_PyThread_lock_init(&w.lock) < 0) {
+        QUEUE_UNLOCK(q);
+        PyErr_SetString(PyExc_RuntimeError, "can't allocate lock");
+        return NULL;
+    }
+    _PyThread_lock_acquire_timed(&w.lock, -1, 0);
+    w.item = NULL;
+    w.next = NULL;
+    if (q->waiters_tail != NULL)
+        q->waiters_tail->next = &w;
+    else
+        q->waiters_head = &w;
+    q->waiters_tail = &w;
+    QUEUE_UNLOCK(q);
+
+    if (timeout > 0)
+        endtime = _PyTime_GetMonotonicClock() + timeout;
+    for (;;) {
+        _PyTime_t microseconds;
+
+        if (timeout < 0)
+            microseconds = -1;
+        else
+            microseconds = _PyTime_AsMicroseconds(timeout,
+                                                  _PyTime_ROUND_CEILING);
+        Py_BEGIN_ALLOW_THREADS
+        r = _PyThread_lock_acquire_timed(&w.lock, microseconds, 1);
+        Py_END_ALLOW_THREADS
+        if (r == PY_LOCK_ACQUIRED) {
+            /* The item was handed over, and w unlinked, by put() */
+            item = w.item;
+            break;
+        }
+        if (r == PY_LOCK_INTR) {
+            /* Run signal handlers, and give up if they raise */
+            if (Py_MakePendingCalls() < 0) {
+                item = queue_cancel_wait(q, &w);
+                if (item != NULL) {
+                    /* Too late: give it to someone else */
+                    QUEUE_LOCK(q);
+                    if (q->waiters_head != NULL ||
+                        queue_reserve(q, 1) == 0) {
+                        queue_deliver(q, item, 1);
+                        item = NULL;
+                    }
+                    QUEUE_UNLOCK(q);
+                    /* If even that failed, the item is lost */
+                    Py_CLEAR(item);
+                }
+                break;
+            }
+            if (timeout < 0)
+                continue;
+            timeout = endtime - _PyTime_GetMonotonicClock();
+            if (timeout > 0)
+                continue;
+        }
+        /* Timed out */
+        item = queue_cancel_wait(q, &w);
+        if (item == NULL)
+            PyErr_SetNone(EmptyError);
+        break;
+    }
+    /* Unlock the lock so it's safe to free it: it is still held, unless
+       put() released it after we stopped waiting */
+    _PyThread_lock_acquire_timed(&w.lock, 0, 0);
+    _PyThread_lock_release(&w.lock);
+    _PyThread_lock_fini(&w.lock);
+    return item;
+}
+
+static PyObject *
+simplequeue_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    simplequeueobject *q;
+
+    if (!_PyArg_NoPositional("SimpleQueue", args) ||
+        !_PyArg_NoKeywords("SimpleQueue()", kwds))
+        return NULL;
+    q = (simplequeueobject *)type->tp_alloc(type, 0);
+    if (q == NULL)
+        return NULL;
+    if (_PyThread_lock_init(&q->mutex) < 0) {
+        Py_DECREF(q);
+        PyErr_SetString(PyExc_RuntimeError, "can't allocate lock");
+        return NULL;
+    }
+    return (PyObject *)q;
+}
+
+static int
+simplequeue_traverse(simplequeueobject *q, visitproc visit, void *arg)
+{
+    Py_ssize_t i;
+
+    for (i = 0; i < q->len; i++)
+        Py_VISIT(QUEUE_ITEM(q, i));
+    return 0;
+}
+
+static int
+simplequeue_clear(simplequeueobject *q)
+{
+    PyObject *item;
+
+    for (;;) {
+        QUEUE_LOCK(q);
+        item = q->len > 0 ? queue_pop(q) : NULL;
+        QUEUE_UNLOCK(q);
+        if (item == NULL)
+            break;
+        Py_DECREF(item);
+    }
+    return 0;
+}
+
+static void
+simplequeue_dealloc(simplequeueobject *q)
+{
+    PyObject_GC_UnTrack(q);
+    if (q->weakreflist != NULL)
+        PyObject_ClearWeakRefs((PyObject *)q);
+    simplequeue_clear(q);
+    PyMem_RawFree(q->items);
+    _PyThread_lock_fini(&q->mutex);
+    Py_TYPE(q)->tp_free(q);
+}
+
+PyDoc_STRVAR(put_doc,
+"put(item, block=True, timeout=None)\n\
+\n\
+Put the item on the queue.\n\
+\n\
+The optional 'block' and 'timeout' arguments are ignored, as this method\n\
+never blocks.  They are provided for compatibility with the Queue class.");
+
+static PyObject *
+simplequeue_put(simplequeueobject *q, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"item", "block", "timeout", NULL};
+    PyObject *item, *block = Py_True, *timeout = Py_None;
+    int r;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|OO:put", kwlist,
+                                     &item, &block, &timeout))
+        return NULL;
+    Py_INCREF(item);
+    QUEUE_LOCK(q);
+    r = q->waiters_head != NULL ? 0 : queue_reserve(q, 1);
+    if (r == 0)
+        queue_deliver(q, item, 0);
+    QUEUE_UNLOCK(q);
+    if (r < 0) {
+        Py_DECREF(item);
+        return PyErr_NoMemory();
+    }
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(put_nowait_doc,
+"put_nowait(item)\n\
+\n\
+Put an item into the queue without blocking.\n\
+\n\
+This is exactly equivalent to `put(item)` and is only provided\n\
+for compatibility with the Queue class.");
+
+static PyObject *
+simplequeue_put_nowait(simplequeueobject *q, PyObject *item)
+{
+    int r;
+
+    Py_INCREF(item);
+    QUEUE_LOCK(q);
+    r = q->waiters_head != NULL ? 0 : queue_reserve(q, 1);
+    if (r == 0)
+        queue_deliver(q, item, 0);
+    QUEUE_UNLOCK(q);
+    if (r < 0) {
+        Py_DECREF(item);
+        return PyErr_NoMemory();
+    }
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(put_many_doc,
+"put_many(items)\n\
+\n\
+Put all the items of an iterable on the queue, in order.");
+
+static PyObject *
+simplequeue_put_many(simplequeueobject *q, PyObject *iterable)
+{
+    PyObject *seq, **items;
+    Py_ssize_t i, n;
+    int r;
+
+    seq = PySequence_Fast(iterable, "put_many() argument must be iterable");
+    if (seq == NULL)
+        return NULL;
+    n = PySequence_Fast_GET_SIZE(seq);
+    items = PySequence_Fast_ITEMS(seq);
+    for (i = 0; i < n; i++)
+        Py_INCREF(items[i]);
+    QUEUE_LOCK(q);
+    /* Make room for all of them, although the waiters may take some */
+    r = queue_reserve(q, n);
+    if (r == 0) {
+        for (i = 0; i < n; i++)
+            queue_deliver(q, items[i], 0);
+    }
+    QUEUE_UNLOCK(q);
+    if (r < 0) {
+        for (i = 0; i < n; i++)
+            Py_DECREF(items[i]);
+        Py_DECREF(seq);
+        return PyErr_NoMemory();
+    }
+    Py_DECREF(seq);
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(get_doc,
+"get(block=True, timeout=None)\n\
+\n\
+Remove and return an item from the queue.\n\
+\n\
+If optional args 'block' is true and 'timeout' is None (the default),\n\
+block if necessary until an item is available. If 'timeout' is\n\
+a non-negative number, it blocks at most 'timeout' seconds and raises\n\
+the Empty exception if no item was available within that time.\n\
+Otherwise ('block' is false), return an item if one is immediately\n\
+available, else raise the Empty exception ('timeout' is ignored\n\
+in that case).");
+
+static PyObject *
+simplequeue_get(simplequeueobject *q, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"block", "timeout", NULL};
+    int block = 1;
+    PyObject *timeout_obj = Py_None;
+    _PyTime_t timeout;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|pO:get", kwlist,
+                                     &block, &timeout_obj))
+        return NULL;
+    if (parse_timeout(block, timeout_obj, &timeout) < 0)
+        return NULL;
+    return queue_get(q, timeout);
+}
+
+PyDoc_STRVAR(get_nowait_doc,
+"get_nowait()\n\
+\n\
+Remove and return an item from the queue without blocking.\n\
+\n\
+Only get an item if one is immediately available. Otherwise\n\
+raise the Empty exception.");
+
+static PyObject *
+simplequeue_get_nowait(simplequeueobject *q)
+{
+    return queue_get(q, 0);
+}
+
+PyDoc_STRVAR(get_many_doc,
+"get_many(n, block=True, timeout=None)\n\
+\n\
+Remove and return a list of at most n items from the queue.\n\
+\n\
+The first item is waited for like with get(); the others are only\n\
+taken if they are immediately available.");
+
+static PyObject *
+simplequeue_get_many(simplequeueobject *q, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"n", "block", "timeout", NULL};
+    Py_ssize_t n, i, len = 0;
+    int block = 1;
+    PyObject *timeout_obj = Py_None, *first, *result;
+    PyObject *buffer[64], **items = buffer;
+    _PyTime_t timeout;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "n|pO:get_many", kwlist,
+                                     &n, &block, &timeout_obj))
+        return NULL;
+    if (n < 1) {
+        PyErr_SetString(PyExc_ValueError, "n must be at least 1");
+        return NULL;
+    }
+    if (parse_timeout(block, timeout_obj, &timeout) < 0)
+        return NULL;
+    first = queue_get(q, timeout);
+    if (first == NULL)
+        return NULL;
+
+    /* Take the others out of the buffer in one go, without allocating
+       any Python object while holding the lock */
+    n--;
+    if (n > (Py_ssize_t)Py_ARRAY_LENGTH(buffer)) {
+        Py_ssize_t available;
+        QUEUE_LOCK(q);
+        available = q->len;
+        QUEUE_UNLOCK(q);
+        if (n > available)
+            n = available;
+        if (n > (Py_ssize_t)Py_ARRAY_LENGTH(buffer)) {
+            items = PyMem_Malloc(n * sizeof(PyObject *));
+            if (items == NULL) {
+                items = buffer;
+                n = Py_ARRAY_LENGTH(buffer);
+            }
+        }
+    }
+    QUEUE_LOCK(q);
+    while (len < n && q->len > 0)
+        items[len++] = queue_pop(q);
+    QUEUE_UNLOCK(q);
+
+    result = PyList_New(len + 1);
+    if (result == NULL) {
+        /* The items are lost, like the item of a failed get() */
+        Py_DECREF(first);
+        for (i = 0; i < len; i++)
+            Py_DECREF(items[i]);
+    }
+    else {
+        PyList_SET_ITEM(result, 0, first);
+        for (i = 0; i < len; i++)
+            PyList_SET_ITEM(result, i + 1, items[i]);
+    }
+    if (items != buffer)
+        PyMem_Free(items);
+    return result;
+}
+
+PyDoc_STRVAR(empty_doc,
+"empty()\n\
+\n\
+Return True if the queue is empty, False otherwise (not reliable!).");
+
+static PyObject *
+simplequeue_empty(simplequeueobject *q)
+{
+    return PyBool_FromLong(q->len == 0);
+}
+
+PyDoc_STRVAR(qsize_doc,
+"qsize()\n\
+\n\
+Return the approximate size of the queue (not reliable!).");
+
+static PyObject *
+simplequeue_qsize(simplequeueobject *q)
+{
+    return PyLong_FromSsize_t(q->len);
+}
+
+static PyMethodDef simplequeue_methods[] = {
+    {"put",         (PyCFunction)simplequeue_put,
+     METH_VARARGS | METH_KEYWORDS, put_doc},
+    {"put_nowait",  (PyCFunction)simplequeue_put_nowait,    METH_O,
+     put_nowait_doc},
+    {"put_many",    (PyCFunction)simplequeue_put_many,      METH_O,
+     put_many_doc},
+    {"get",         (PyCFunction)simplequeue_get,
+     METH_VARARGS | METH_KEYWORDS, get_doc},
+    {"get_nowait",  (PyCFunction)simplequeue_get_nowait,    METH_NOARGS,
+     get_nowait_doc},
+    {"get_many",    (PyCFunction)simplequeue_get_many,
+     METH_VARARGS | METH_KEYWORDS, get_many_doc},
+    {"empty",       (PyCFunction)simplequeue_empty,         METH_NOARGS,
+     empty_doc},
+    {"qsize",       (PyCFunction)simplequeue_qsize,         METH_NOARGS,
+     qsize_doc},
+    {NULL,          NULL}   /* sentinel */
+};
+
+PyDoc_STRVAR(simplequeue_doc,
+"SimpleQueue()\n\
+\n\
+Simple, unbounded, reentrant FIFO queue.");
+
+static PyTypeObject SimpleQueue_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_queue.SimpleQueue",               /* tp_name */
+    sizeof(simplequeueobject),          /* tp_basicsize */
+    0,                                  /* tp_itemsize */
+    (destructor)simplequeue_dealloc,    /* tp_dealloc */
+    0,                                  /* tp_print */
+    0,                                  /* tp_getattr */
+    0,                                  /* tp_setattr */
+    0,                                  /* tp_reserved */
+    0,                                  /* tp_repr */
+    0,                                  /* tp_as_number */
+    0,                                  /* tp_as_sequence */
+    0,                                  /* tp_as_mapping */
+    0,                                  /* tp_hash */
+    0,                                  /* tp_call */
+    0,                                  /* tp_str */
+    PyObject_GenericGetAttr,            /* tp_getattro */
+    0,                                  /* tp_setattro */
+    0,                                  /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC,
+                                        /* tp_flags */
+    simplequeue_doc,                    /* tp_doc */
+    (traverseproc)simplequeue_traverse, /* tp_traverse */
+    (inquiry)simplequeue_clear,         /* tp_clear */
+    0,                                  /* tp_richcompare */
+    offsetof(simplequeueobject, weakreflist), /* tp_weaklistoffset */
+    0,                                  /* tp_iter */
+    0,                                  /* tp_iternext */
+    simplequeue_methods,                /* tp_methods */
+    0,                                  /* tp_members */
+    0,                                  /* tp_getset */
+    0,                                  /* tp_base */
+    0,                                  /* tp_dict */
+    0,                                  /* tp_descr_get */
+    0,                                  /* tp_descr_set */
+    0,                                  /* tp_dictoffset */
+    0,                                  /* tp_init */
+    0,                                  /* tp_alloc */
+    simplequeue_new,                    /* tp_new */
+    PyObject_GC_Del,                    /* tp_free */
+};
+
+PyDoc_STRVAR(module_doc,
+"C implementation of the Python queue module.\n\
+This module is an implementation detail, please do not use it directly.");
+
+static struct PyModuleDef _queuemodule = {
+    PyModuleDef_HEAD_INIT,
+    "_queue",
+    module_doc,
+    -1,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL
+};
+
+PyMODINIT_FUNC
+PyInit__queue(void)
+{
+    PyObject *m;
+
+    if (PyType_Ready(&SimpleQueue_Type) < 0)
+        return NULL;
+    m = PyModule_Create(&_queuemodule);
+    if (m == NULL)
+        return NULL;
+
+    if (EmptyError == NULL) {
+        EmptyError = PyErr_NewExceptionWithDoc(
+            "_queue.Empty",
+            "Exception raised by Queue.get(block=0)/get_nowait().",
+            NULL, NULL);
+        if (EmptyError == NULL)
+            return NULL;
+    }
+    Py_INCREF(EmptyError);
+    if (PyModule_AddObject(m, "Empty", EmptyError) < 0)
+        return NULL;
+
+    Py_INCREF(&SimpleQueue_Type);
+    if (PyModule_AddObject(m, "SimpleQueue", (PyObject *)&SimpleQueue_Type) < 0)
+        return NULL;
+    return m;
+}
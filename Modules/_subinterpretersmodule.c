@@ -0,0 +1,191 @@
+/* Running code in sub-interpreters, and passing buffers between them */
+
+#include "Python.h"
+
+#ifndef WITH_THREAD
+#error "Error!  The rest of Python is not compiled with thread support."
+#error "Rerun configure, adding a --with-threads option."
+#error "Then run `make clean' followed by `make'."
+#endif
+
+#include "pythread.h"
+
+/* Quick overview:
+
+   run_string() runs source code in a new interpreter, created on the
+   calling thread and destroyed when the code is done: the threads of the
+   threading module can each run one.  Interpreters share no Python objects,
+   so they communicate through channels (see Include/pychannel.h), which
+   are named by integers and carry buffers without copying them.
+
+   When Python is built without the GIL, interpreters running on different
+   threads run in parallel; otherwise they take turns holding the GIL, like
+   threads do. */
+
+PyDoc_STRVAR(run_string_doc,
+"run_string(source)\n\
+\n\
+Run source code in a new sub-interpreter, on the calling thread, then\n\
+destroy the interpreter.  Raise RuntimeError if the code raised an\n\
+exception, after printing its traceback.");
+
+static PyObject *
+subinterpreters_run_string(PyObject *module, PyObject *args)
+{
+    const char *source;
+    PyThreadState *mainstate, *substate;
+    PyCompilerFlags cflags = {0};
+    int r;
+
+    if (!PyArg_ParseTuple(args, "s:run_string", &source))
+        return NULL;
+
+    mainstate = PyThreadState_Get();
+    PyThreadState_Swap(NULL);
+    substate = Py_NewInterpreter();
+    if (substate == NULL) {
+        /* No thread state was created to hold an exception: raise one
+           once the old thread state is back */
+        PyThreadState_Swap(mainstate);
+        PyErr_SetString(PyExc_RuntimeError,
+                        "sub-interpreter creation failed");
+        return NULL;
+    }
+    r = PyRun_SimpleStringFlags(source, &cflags);
+    Py_EndInterpreter(substate);
+    PyThreadState_Swap(mainstate);
+
+    if (r < 0) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "the code raised an exception in the sub-interpreter");
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(channel_create_doc,
+"channel_create() -> int\n\
+\n\
+Create a channel and return its id.");
+
+static PyObject *
+subinterpreters_channel_create(PyObject *module, PyObject *unused)
+{
+    Py_ssize_t id = _PyChannel_Create();
+
+    if (id < 0)
+        return NULL;
+    return PyLong_FromSsize_t(id);
+}
+
+PyDoc_STRVAR(channel_send_doc,
+"channel_send(id, obj)\n\
+\n\
+Send the buffer of a bytes-like object over a channel.  The buffer isn't\n\
+copied: the receiver gets a read-only view of it, which keeps obj alive.");
+
+static PyObject *
+subinterpreters_channel_send(PyObject *module, PyObject *args)
+{
+    Py_ssize_t id;
+    PyObject *obj;
+
+    if (!PyArg_ParseTuple(args, "nO:channel_send", &id, &obj))
+        return NULL;
+    if (_PyChannel_Send(id, obj) < 0)
+        return NULL;
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(channel_recv_doc,
+"channel_recv(id, timeout=None) -> memoryview\n\
+\n\
+Receive the oldest buffer sent over a channel, as a read-only memoryview.\n\
+Wait for at most timeout seconds, or forever if timeout is None, then\n\
+raise TimeoutError.  Raise EOFError once the channel is closed and all\n\
+the buffers sent over it were received.");
+
+static PyObject *
+subinterpreters_channel_recv(PyObject *module, PyObject *args,
+                             PyObject *kwds)
+{
+    static char *kwlist[] = {"id", "timeout", NULL};
+    Py_ssize_t id;
+    PyObject *timeout_obj = Py_None;
+    _PyTime_t timeout = -1;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "n|O:channel_recv", kwlist,
+                                     &id, &timeout_obj))
+        return NULL;
+    if (timeout_obj != Py_None) {
+        if (_PyTime_FromSecondsObject(&timeout, timeout_obj,
+                                      _PyTime_ROUND_CEILING) < 0)
+            return NULL;
+        if (timeout < 0) {
+            PyErr_SetString(PyExc_ValueError,
+                            "'timeout' must be a non-negative number");
+            return NULL;
+        }
+        if (_PyTime_AsMicroseconds(timeout, _PyTime_ROUND_CEILING)
+                >= PY_TIMEOUT_MAX) {
+            PyErr_SetString(PyExc_OverflowError,
+                            "timeout value is too large");
+            return NULL;
+        }
+    }
+    return _PyChannel_Recv(id, timeout);
+}
+
+PyDoc_STRVAR(channel_close_doc,
+"channel_close(id)\n\
+\n\
+Close a channel: it accepts no more buffers, and receivers get EOFError\n\
+once the buffers already sent are received.");
+
+static PyObject *
+subinterpreters_channel_close(PyObject *module, PyObject *args)
+{
+    Py_ssize_t id;
+
+    if (!PyArg_ParseTuple(args, "n:channel_close", &id))
+        return NULL;
+    if (_PyChannel_Close(id) < 0)
+        return NULL;
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef subinterpreters_methods[] = {
+    {"run_string",      (PyCFunction)subinterpreters_run_string,
+     METH_VARARGS, run_string_doc},
+    {"channel_create",  (PyCFunction)subinterpreters_channel_create,
+     METH_NOARGS, channel_create_doc},
+    {"channel_send",    (PyCFunction)subinterpreters_channel_send,
+     METH_VARARGS, channel_send_doc},
+    {"channel_recv",    (PyCFunction)subinterpreters_channel_recv,
+     METH_VARARGS | METH_KEYWORDS, channel_recv_doc},
+    {"channel_close",   (PyCFunction)subinterpreters_channel_close,
+     METH_VARARGS, channel_close_doc},
+    {NULL, NULL}
+};
+
+PyDoc_STRVAR(module_doc,
+"Low-level interface to sub-interpreters and the channels between them.\n\
+This module is an implementation detail, please do not use it directly.");
+
+static struct PyModuleDef _subinterpretersmodule = {
+    PyModuleDef_HEAD_INIT,
+    "_subinterpreters",
+    module_doc,
+    -1,
+    subinterpreters_methods,
+    NULL,
+    NULL,
+    NULL,
+    NULL
+};
+
+PyMODINIT_FUNC
+PyInit__subinterpreters(void)
+{
+    return PyModule_Create(&_subinterpretersmodule);
+}
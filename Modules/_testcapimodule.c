@@ -248,6 +248,21 @@ test_dict_iteration(PyObject* self)
     return Py_None;
 }
 
+static PyObject *
+dict_get_version(PyObject *self, PyObject *args)
+{
+    PyObject *dict;
+    PY_UINT64_T version;
+
+    if (!PyArg_ParseTuple(args, "O!:dict_get_version", &PyDict_Type, &dict))
+        return NULL;
+
+    version = PyDict_GetVersion(dict);
+
+    Py_BUILD_ASSERT(sizeof(unsigned PY_LONG_LONG) >= sizeof(version));
+    return PyLong_FromUnsignedLongLong((unsigned PY_LONG_LONG)version);
+}
+
 
 /* Issue #4701: Check that PyObject_Hash implicitly calls
  *   PyType_Ready if it hasn't already been called
@@ -2234,6 +2249,30 @@ PyObject *pending_threadfunc(PyObject *self, PyObject *arg)
     Py_INCREF(Py_True);
     return Py_True;
 }
+
+/* The same, with Py_AddPendingCallToThread(): the callback runs in the
+ * thread `thread_id`.
+ */
+PyObject *pending_threadfunc_to_thread(PyObject *self, PyObject *arg)
+{
+    PyObject *callable;
+    long thread_id;
+    int r;
+    if (PyArg_ParseTuple(arg, "lO", &thread_id, &callable) == 0)
+        return NULL;
+
+    Py_INCREF(callable);
+
+    Py_BEGIN_ALLOW_THREADS
+    r = Py_AddPendingCallToThread(thread_id, &_pending_callback, callable);
+    Py_END_ALLOW_THREADS
+
+    if (r<0) {
+        Py_DECREF(callable); /* unsuccessful add, destroy the extra reference */
+        Py_RETURN_FALSE;
+    }
+    Py_RETURN_TRUE;
+}
 #endif
 
 /* Some tests of PyUnicode_FromFormat().  This needs more tests. */
@@ -2968,8 +3007,8 @@ slot_tp_del(PyObject *self)
     PyObject *error_type, *error_value, *error_traceback;
 
     /* Temporarily resurrect the object. */
-    assert(self->ob_refcnt == 0);
-    self->ob_refcnt = 1;
+    assert(Py_REFCNT(self) == 0);
+    _Py_SET_REFCNT(self, 1);
 
     /* Save the current exception, if any. */
     PyErr_Fetch(&error_type, &error_value, &error_traceback);
@@ -2991,17 +3030,18 @@ slot_tp_del(PyObject *self)
     /* Undo the temporary resurrection; can't use DECREF here, it would
      * cause a recursive call.
      */
-    assert(self->ob_refcnt > 0);
-    if (--self->ob_refcnt == 0)
+    assert(Py_REFCNT(self) > 0);
+    _Py_SET_REFCNT(self, Py_REFCNT(self) - 1);
+    if (Py_REFCNT(self) == 0)
         return;         /* this is the normal path out */
 
     /* __del__ resurrected it!  Make it look like the original Py_DECREF
      * never happened.
      */
     {
-        Py_ssize_t refcnt = self->ob_refcnt;
+        Py_ssize_t refcnt = Py_REFCNT(self);
         _Py_NewReference(self);
-        self->ob_refcnt = refcnt;
+        _Py_SET_REFCNT(self, refcnt);
     }
     assert(!PyType_IS_GC(Py_TYPE(self)) ||
            _Py_AS_GC(self)->gc.gc_refs != _PyGC_REFS_UNTRACKED);
@@ -3928,6 +3968,7 @@ static PyMethodDef TestMethods[] = {
     {"test_datetime_capi",  test_datetime_capi,              METH_NOARGS},
     {"test_list_api",           (PyCFunction)test_list_api,      METH_NOARGS},
     {"test_dict_iteration",     (PyCFunction)test_dict_iteration,METH_NOARGS},
+    {"dict_get_version",        dict_get_version,                METH_VARARGS},
     {"test_lazy_hash_inheritance",      (PyCFunction)test_lazy_hash_inheritance,METH_NOARGS},
     {"test_long_api",           (PyCFunction)test_long_api,      METH_NOARGS},
     {"test_xincref_doesnt_leak",(PyCFunction)test_xincref_doesnt_leak,      METH_NOARGS},
@@ -4023,6 +4064,8 @@ static PyMethodDef TestMethods[] = {
 #ifdef WITH_THREAD
     {"_test_thread_state",      test_thread_state,               METH_VARARGS},
     {"_pending_threadfunc",     pending_threadfunc,              METH_VARARGS},
+    {"_pending_threadfunc_to_thread", pending_threadfunc_to_thread,
+     METH_VARARGS},
 #endif
 #ifdef HAVE_GETTIMEOFDAY
     {"profile_int",             profile_int,                     METH_NOARGS},
@@ -23,7 +23,7 @@ _Py_IDENTIFIER(stderr);
 
 typedef struct {
     PyObject_HEAD
-    PyThread_type_lock lock_lock;
+    _PyThread_lock lock_lock;
     PyObject *in_weakreflist;
     char locked; /* for sanity checking */
 } lockobject;
@@ -33,12 +33,10 @@ lock_dealloc(lockobject *self)
 {
     if (self->in_weakreflist != NULL)
         PyObject_ClearWeakRefs((PyObject *) self);
-    if (self->lock_lock != NULL) {
-        /* Unlock the lock so it's safe to free it */
-        if (self->locked)
-            PyThread_release_lock(self->lock_lock);
-        PyThread_free_lock(self->lock_lock);
-    }
+    /* Unlock the lock so it's safe to free it */
+    if (self->locked)
+        _PyThread_lock_release(&self->lock_lock);
+    _PyThread_lock_fini(&self->lock_lock);
     PyObject_Del(self);
 }
 
@@ -49,7 +47,7 @@ lock_dealloc(lockobject *self)
  * timeout.
  */
 static PyLockStatus
-acquire_timed(PyThread_type_lock lock, _PyTime_t timeout)
+acquire_timed(_PyThread_lock *lock, _PyTime_t timeout)
 {
     PyLockStatus r;
     _PyTime_t endtime = 0;
@@ -62,10 +60,10 @@ acquire_timed(PyThread_type_lock lock, _PyTime_t timeout)
         microseconds = _PyTime_AsMicroseconds(timeout, _PyTime_ROUND_CEILING);
 
         /* first a simple non-blocking try without releasing the GIL */
-        r = PyThread_acquire_lock_timed(lock, 0, 0);
+        r = _PyThread_lock_acquire_timed(lock, 0, 0);
         if (r == PY_LOCK_FAILURE && microseconds != 0) {
             Py_BEGIN_ALLOW_THREADS
-            r = PyThread_acquire_lock_timed(lock, microseconds, 1);
+            r = _PyThread_lock_acquire_timed(lock, microseconds, 1);
             Py_END_ALLOW_THREADS
         }
 
@@ -148,7 +146,7 @@ lock_PyThread_acquire_lock(lockobject *self, PyObject *args, PyObject *kwds)
     if (lock_acquire_parse_args(args, kwds, &timeout) < 0)
         return NULL;
 
-    r = acquire_timed(self->lock_lock, timeout);
+    r = acquire_timed(&self->lock_lock, timeout);
     if (r == PY_LOCK_INTR) {
         return NULL;
     }
@@ -178,8 +176,10 @@ lock_PyThread_release_lock(lockobject *self)
         return NULL;
     }
 
-    PyThread_release_lock(self->lock_lock);
+    /* Clear the flag first: once the lock is released, another thread may
+       acquire it and set the flag again */
     self->locked = 0;
+    _PyThread_lock_release(&self->lock_lock);
     Py_INCREF(Py_None);
     return Py_None;
 }
@@ -267,7 +267,7 @@ static PyTypeObject Locktype = {
 
 typedef struct {
     PyObject_HEAD
-    PyThread_type_lock rlock_lock;
+    _PyThread_lock rlock_lock;
     long rlock_owner;
     unsigned long rlock_count;
     PyObject *in_weakreflist;
@@ -278,15 +278,10 @@ rlock_dealloc(rlockobject *self)
 {
     if (self->in_weakreflist != NULL)
         PyObject_ClearWeakRefs((PyObject *) self);
-    /* self->rlock_lock can be NULL if PyThread_allocate_lock() failed
-       in rlock_new() */
-    if (self->rlock_lock != NULL) {
-        /* Unlock the lock so it's safe to free it */
-        if (self->rlock_count > 0)
-            PyThread_release_lock(self->rlock_lock);
-
-        PyThread_free_lock(self->rlock_lock);
-    }
+    /* Unlock the lock so it's safe to free it */
+    if (self->rlock_count > 0)
+        _PyThread_lock_release(&self->rlock_lock);
+    _PyThread_lock_fini(&self->rlock_lock);
     Py_TYPE(self)->tp_free(self);
 }
 
@@ -311,7 +306,7 @@ rlock_acquire(rlockobject *self, PyObject *args, PyObject *kwds)
         self->rlock_count = count;
         Py_RETURN_TRUE;
     }
-    r = acquire_timed(self->rlock_lock, timeout);
+    r = acquire_timed(&self->rlock_lock, timeout);
     if (r == PY_LOCK_ACQUIRED) {
         assert(self->rlock_count == 0);
         self->rlock_owner = tid;
@@ -352,7 +347,7 @@ rlock_release(rlockobject *self)
     }
     if (--self->rlock_count == 0) {
         self->rlock_owner = 0;
-        PyThread_release_lock(self->rlock_lock);
+        _PyThread_lock_release(&self->rlock_lock);
     }
     Py_RETURN_NONE;
 }
@@ -379,9 +374,9 @@ rlock_acquire_restore(rlockobject *self, PyObject *args)
     if (!PyArg_ParseTuple(args, "(kl):_acquire_restore", &count, &owner))
         return NULL;
 
-    if (!PyThread_acquire_lock(self->rlock_lock, 0)) {
+    if (!_PyThread_lock_acquire_timed(&self->rlock_lock, 0, 0)) {
         Py_BEGIN_ALLOW_THREADS
-        r = PyThread_acquire_lock(self->rlock_lock, 1);
+        r = _PyThread_lock_acquire_timed(&self->rlock_lock, -1, 0);
         Py_END_ALLOW_THREADS
     }
     if (!r) {
@@ -415,7 +410,7 @@ rlock_release_save(rlockobject *self)
     count = self->rlock_count;
     self->rlock_count = 0;
     self->rlock_owner = 0;
-    PyThread_release_lock(self->rlock_lock);
+    _PyThread_lock_release(&self->rlock_lock);
     return Py_BuildValue("kl", count, owner);
 }
 
@@ -452,8 +447,7 @@ rlock_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
         self->rlock_owner = 0;
         self->rlock_count = 0;
 
-        self->rlock_lock = PyThread_allocate_lock();
-        if (self->rlock_lock == NULL) {
+        if (_PyThread_lock_init(&self->rlock_lock) < 0) {
             Py_DECREF(self);
             PyErr_SetString(ThreadError, "can't allocate lock");
             return NULL;
@@ -541,10 +535,9 @@ newlockobject(void)
     self = PyObject_New(lockobject, &Locktype);
     if (self == NULL)
         return NULL;
-    self->lock_lock = PyThread_allocate_lock();
     self->locked = 0;
     self->in_weakreflist = NULL;
-    if (self->lock_lock == NULL) {
+    if (_PyThread_lock_init(&self->lock_lock) < 0) {
         Py_DECREF(self);
         PyErr_SetString(ThreadError, "can't allocate lock");
         return NULL;
@@ -558,36 +551,41 @@ newlockobject(void)
 
 /* Quick overview:
 
+   Each thread-local object owns a slot number, and finds what it stores
+   for a thread in that slot of the thread state (see tls_slots in
+   pystate.h), so looking it up is an array access.
+
    We need to be able to reclaim reference cycles as soon as possible
    (both when a thread is being terminated, or a thread-local object
     becomes unreachable from user data).  Constraints:
-   - it must not be possible for thread-state dicts to be involved in
+   - it must not be possible for thread-state slots to be involved in
      reference cycles (otherwise the cyclic GC will refuse to consider
-     objects referenced from a reachable thread-state dict, even though
+     objects referenced from a reachable thread state, even though
      local_dealloc would clear them)
-   - the death of a thread-state dict must still imply destruction of the
+   - the death of a thread state must still imply destruction of the
      corresponding local dicts in all thread-local objects.
 
    Our implementation uses small "localdummy" objects in order to break
    the reference chain. These trivial objects are hashable (using the
    default scheme of identity hashing) and weakrefable.
    Each thread-state holds a separate localdummy for each local object
-   (as a /strong reference/),
+   (as a /strong reference/, in the slot of the local object),
    and each thread-local object holds a dict mapping /weak references/
    of localdummies to local dicts.
 
    Therefore:
-   - only the thread-state dict holds a strong reference to the dummies
+   - only the thread-state slots hold a strong reference to the dummies
    - only the thread-local object holds a strong reference to the local dicts
    - only outside objects (application- or library-level) hold strong
      references to the thread-local objects
-   - as soon as a thread-state dict is destroyed, the weakref callbacks of all
+   - as soon as a thread state is cleared, the weakref callbacks of all
      dummies attached to that thread are called, and destroy the corresponding
      local dicts from thread-local objects
    - as soon as a thread-local object is destroyed, its local dicts are
-     destroyed and its dummies are manually removed from all thread states
+     destroyed and its dummies are manually removed from all thread states,
+     after which its slot number can be reused
    - the GC can do its work correctly when a thread-local object is dangling,
-     without any interference from the thread-state dicts
+     without any interference from the thread-state slots
 
    As an additional optimization, each localdummy holds a borrowed reference
    to the corresponding localdict.  This borrowed reference is only used
@@ -640,7 +638,7 @@ static PyTypeObject localdummytype = {
 
 typedef struct {
     PyObject_HEAD
-    PyObject *key;
+    Py_ssize_t index;           /* Slot number, or -1 once released */
     PyObject *args;
     PyObject *kw;
     PyObject *weakreflist;      /* List of weak references to self */
@@ -659,17 +657,10 @@ static PyObject *_localdummy_destroyed(PyObject *meth_self, PyObject *dummyweakr
 static PyObject *
 _local_create_dummy(localobject *self)
 {
-    PyObject *tdict, *ldict = NULL, *wr = NULL;
+    PyObject *ldict = NULL, *wr = NULL;
     localdummyobject *dummy = NULL;
     int r;
 
-    tdict = PyThreadState_GetDict();
-    if (tdict == NULL) {
-        PyErr_SetString(PyExc_SystemError,
-                        "Couldn't get thread-state dictionary");
-        goto err;
-    }
-
     ldict = PyDict_New();
     if (ldict == NULL)
         goto err;
@@ -687,7 +678,8 @@ _local_create_dummy(localobject *self)
     if (r < 0)
         goto err;
     Py_CLEAR(wr);
-    r = PyDict_SetItem(tdict, self->key, (PyObject *) dummy);
+    r = _PyThreadState_SetTLSSlot(PyThreadState_GET(), self->index,
+                                  (PyObject *) dummy);
     if (r < 0)
         goto err;
     Py_CLEAR(dummy);
@@ -729,13 +721,11 @@ local_new(PyTypeObject *type, PyObject *args, PyObject *kw)
     if (self == NULL)
         return NULL;
 
+    self->index = _PyThreadState_NewTLSSlot();
     Py_XINCREF(args);
     self->args = args;
     Py_XINCREF(kw);
     self->kw = kw;
-    self->key = PyUnicode_FromFormat("thread.local.%p", self);
-    if (self->key == NULL)
-        goto err;
 
     self->dummies = PyDict_New();
     if (self->dummies == NULL)
@@ -773,21 +763,15 @@ local_traverse(localobject *self, visitproc visit, void *arg)
 static int
 local_clear(localobject *self)
 {
-    PyThreadState *tstate;
     Py_CLEAR(self->args);
     Py_CLEAR(self->kw);
     Py_CLEAR(self->dummies);
     Py_CLEAR(self->wr_callback);
-    /* Remove all strong references to dummies from the thread states */
-    if (self->key
-        && (tstate = PyThreadState_Get())
-        && tstate->interp) {
-        for(tstate = PyInterpreterState_ThreadHead(tstate->interp);
-            tstate;
-            tstate = PyThreadState_Next(tstate))
-            if (tstate->dict &&
-                PyDict_GetItem(tstate->dict, self->key))
-                PyDict_DelItem(tstate->dict, self->key);
+    /* Remove all strong references to dummies from the thread states,
+       and give the slot back */
+    if (self->index >= 0) {
+        _PyThreadState_FreeTLSSlot(self->index);
+        self->index = -1;
     }
     return 0;
 }
@@ -803,7 +787,6 @@ local_dealloc(localobject *self)
     PyObject_GC_UnTrack(self);
 
     local_clear(self);
-    Py_XDECREF(self->key);
     Py_TYPE(self)->tp_free((PyObject*)self);
 }
 
@@ -811,16 +794,15 @@ local_dealloc(localobject *self)
 static PyObject *
 _ldict(localobject *self)
 {
-    PyObject *tdict, *ldict, *dummy;
+    PyThreadState *tstate = PyThreadState_GET();
+    PyObject *ldict, *dummy;
 
-    tdict = PyThreadState_GetDict();
-    if (tdict == NULL) {
+    if (self->index < 0) {
         PyErr_SetString(PyExc_SystemError,
-                        "Couldn't get thread-state dictionary");
+                        "thread-local object was already cleared");
         return NULL;
     }
-
-    dummy = PyDict_GetItem(tdict, self->key);
+    dummy = _PyThreadState_GET_TLS_SLOT(tstate, self->index);
     if (dummy == NULL) {
         ldict = _local_create_dummy(self);
         if (ldict == NULL)
@@ -832,7 +814,7 @@ _ldict(localobject *self)
             /* we need to get rid of ldict from thread so
                we create a new one the next time we do an attr
                access */
-            PyDict_DelItem(tdict, self->key);
+            _PyThreadState_SetTLSSlot(tstate, self->index, NULL);
             return NULL;
         }
     }
@@ -1190,8 +1172,8 @@ release_sentinel(void *wr)
         assert(Py_TYPE(obj) == &Locktype);
         lock = (lockobject *) obj;
         if (lock->locked) {
-            PyThread_release_lock(lock->lock_lock);
             lock->locked = 0;
+            _PyThread_lock_release(&lock->lock_lock);
         }
     }
     /* Deallocating a weakref with a NULL callback only calls
@@ -14,19 +14,21 @@ PyDoc_STRVAR(crypt_crypt__doc__,
 "results for a given *word*.");
 
 #define CRYPT_CRYPT_METHODDEF    \
-    {"crypt", (PyCFunction)crypt_crypt, METH_VARARGS, crypt_crypt__doc__},
+    {"crypt", (PyCFunction)crypt_crypt, METH_FASTCALL, crypt_crypt__doc__},
 
 static PyObject *
 crypt_crypt_impl(PyModuleDef *module, const char *word, const char *salt);
 
 static PyObject *
-crypt_crypt(PyModuleDef *module, PyObject *args)
+crypt_crypt(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     const char *word;
     const char *salt;
 
-    if (!PyArg_ParseTuple(args, "ss:crypt",
+    if (!_PyArg_NoStackKeywords("crypt", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "ss:crypt",
         &word, &salt))
         goto exit;
     return_value = crypt_crypt_impl(module, word, salt);
@@ -34,4 +36,4 @@ crypt_crypt(PyModuleDef *module, PyObject *args)
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=22c295c9bce018c4 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=d9bb0ba745674120 input=a9049054013a1b77]*/
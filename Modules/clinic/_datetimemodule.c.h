@@ -14,19 +14,19 @@ PyDoc_STRVAR(datetime_datetime_now__doc__,
 "If no tz is specified, uses local timezone.");
 
 #define DATETIME_DATETIME_NOW_METHODDEF    \
-    {"now", (PyCFunction)datetime_datetime_now, METH_VARARGS|METH_KEYWORDS|METH_CLASS, datetime_datetime_now__doc__},
+    {"now", (PyCFunction)datetime_datetime_now, METH_FASTCALL|METH_CLASS, datetime_datetime_now__doc__},
 
 static PyObject *
 datetime_datetime_now_impl(PyTypeObject *type, PyObject *tz);
 
 static PyObject *
-datetime_datetime_now(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+datetime_datetime_now(PyTypeObject *type, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"tz", NULL};
     PyObject *tz = Py_None;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O:now", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "|O:now", _keywords,
         &tz))
         goto exit;
     return_value = datetime_datetime_now_impl(type, tz);
@@ -34,4 +34,4 @@ datetime_datetime_now(PyTypeObject *type, PyObject *args, PyObject *kwargs)
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=7f45c670d6e4953a input=a9049054013a1b77]*/
+/*[clinic end generated code: output=bbe5b9e06f03c35d input=a9049054013a1b77]*/
@@ -626,19 +626,21 @@ PyDoc_STRVAR(cmath_log__doc__,
 "If the base not specified, returns the natural logarithm (base e) of z.");
 
 #define CMATH_LOG_METHODDEF    \
-    {"log", (PyCFunction)cmath_log, METH_VARARGS, cmath_log__doc__},
+    {"log", (PyCFunction)cmath_log, METH_FASTCALL, cmath_log__doc__},
 
 static PyObject *
 cmath_log_impl(PyModuleDef *module, Py_complex x, PyObject *y_obj);
 
 static PyObject *
-cmath_log(PyModuleDef *module, PyObject *args)
+cmath_log(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     Py_complex x;
     PyObject *y_obj = NULL;
 
-    if (!PyArg_ParseTuple(args, "D|O:log",
+    if (!_PyArg_NoStackKeywords("log", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "D|O:log",
         &x, &y_obj))
         goto exit;
     return_value = cmath_log_impl(module, x, y_obj);
@@ -708,19 +710,21 @@ PyDoc_STRVAR(cmath_rect__doc__,
 "Convert from polar coordinates to rectangular coordinates.");
 
 #define CMATH_RECT_METHODDEF    \
-    {"rect", (PyCFunction)cmath_rect, METH_VARARGS, cmath_rect__doc__},
+    {"rect", (PyCFunction)cmath_rect, METH_FASTCALL, cmath_rect__doc__},
 
 static PyObject *
 cmath_rect_impl(PyModuleDef *module, double r, double phi);
 
 static PyObject *
-cmath_rect(PyModuleDef *module, PyObject *args)
+cmath_rect(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     double r;
     double phi;
 
-    if (!PyArg_ParseTuple(args, "dd:rect",
+    if (!_PyArg_NoStackKeywords("rect", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "dd:rect",
         &r, &phi))
         goto exit;
     return_value = cmath_rect_impl(module, r, phi);
@@ -829,14 +833,14 @@ PyDoc_STRVAR(cmath_isclose__doc__,
 "not close to anything, even itself. inf and -inf are only close to themselves.");
 
 #define CMATH_ISCLOSE_METHODDEF    \
-    {"isclose", (PyCFunction)cmath_isclose, METH_VARARGS|METH_KEYWORDS, cmath_isclose__doc__},
+    {"isclose", (PyCFunction)cmath_isclose, METH_FASTCALL, cmath_isclose__doc__},
 
 static int
 cmath_isclose_impl(PyModuleDef *module, Py_complex a, Py_complex b,
                    double rel_tol, double abs_tol);
 
 static PyObject *
-cmath_isclose(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+cmath_isclose(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"a", "b", "rel_tol", "abs_tol", NULL};
@@ -846,7 +850,7 @@ cmath_isclose(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     double abs_tol = 0.0;
     int _return_value;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "DD|$dd:isclose", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "DD|$dd:isclose", _keywords,
         &a, &b, &rel_tol, &abs_tol))
         goto exit;
     _return_value = cmath_isclose_impl(module, a, b, rel_tol, abs_tol);
@@ -857,4 +861,4 @@ cmath_isclose(PyModuleDef *module, PyObject *args, PyObject *kwargs)
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=229e9c48c9d27362 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=0ba99d2842df14dc input=a9049054013a1b77]*/
@@ -72,19 +72,19 @@ PyDoc_STRVAR(_md5_md5__doc__,
 "Return a new MD5 hash object; optionally initialized with a string.");
 
 #define _MD5_MD5_METHODDEF    \
-    {"md5", (PyCFunction)_md5_md5, METH_VARARGS|METH_KEYWORDS, _md5_md5__doc__},
+    {"md5", (PyCFunction)_md5_md5, METH_FASTCALL, _md5_md5__doc__},
 
 static PyObject *
 _md5_md5_impl(PyModuleDef *module, PyObject *string);
 
 static PyObject *
-_md5_md5(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+_md5_md5(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"string", NULL};
     PyObject *string = NULL;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O:md5", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "|O:md5", _keywords,
         &string))
         goto exit;
     return_value = _md5_md5_impl(module, string);
@@ -92,4 +92,4 @@ _md5_md5(PyModuleDef *module, PyObject *args, PyObject *kwargs)
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=0f803ded701aca54 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=187a2cf275e71e34 input=a9049054013a1b77]*/
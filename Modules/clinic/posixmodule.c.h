@@ -27,14 +27,14 @@ PyDoc_STRVAR(os_stat__doc__,
 "  an open file descriptor.");
 
 #define OS_STAT_METHODDEF    \
-    {"stat", (PyCFunction)os_stat, METH_VARARGS|METH_KEYWORDS, os_stat__doc__},
+    {"stat", (PyCFunction)os_stat, METH_FASTCALL, os_stat__doc__},
 
 static PyObject *
 os_stat_impl(PyModuleDef *module, path_t *path, int dir_fd,
              int follow_symlinks);
 
 static PyObject *
-os_stat(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_stat(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "dir_fd", "follow_symlinks", NULL};
@@ -42,7 +42,7 @@ os_stat(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     int dir_fd = DEFAULT_DIR_FD;
     int follow_symlinks = 1;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&|$O&p:stat", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&|$O&p:stat", _keywords,
         path_converter, &path, FSTATAT_DIR_FD_CONVERTER, &dir_fd, &follow_symlinks))
         goto exit;
     return_value = os_stat_impl(module, &path, dir_fd, follow_symlinks);
@@ -64,20 +64,20 @@ PyDoc_STRVAR(os_lstat__doc__,
 "Equivalent to stat(path, follow_symlinks=False).");
 
 #define OS_LSTAT_METHODDEF    \
-    {"lstat", (PyCFunction)os_lstat, METH_VARARGS|METH_KEYWORDS, os_lstat__doc__},
+    {"lstat", (PyCFunction)os_lstat, METH_FASTCALL, os_lstat__doc__},
 
 static PyObject *
 os_lstat_impl(PyModuleDef *module, path_t *path, int dir_fd);
 
 static PyObject *
-os_lstat(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_lstat(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "dir_fd", NULL};
     path_t path = PATH_T_INITIALIZE("lstat", "path", 0, 0);
     int dir_fd = DEFAULT_DIR_FD;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&|$O&:lstat", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&|$O&:lstat", _keywords,
         path_converter, &path, FSTATAT_DIR_FD_CONVERTER, &dir_fd))
         goto exit;
     return_value = os_lstat_impl(module, &path, dir_fd);
@@ -122,14 +122,14 @@ PyDoc_STRVAR(os_access__doc__,
 "  has the specified access to the path.");
 
 #define OS_ACCESS_METHODDEF    \
-    {"access", (PyCFunction)os_access, METH_VARARGS|METH_KEYWORDS, os_access__doc__},
+    {"access", (PyCFunction)os_access, METH_FASTCALL, os_access__doc__},
 
 static int
 os_access_impl(PyModuleDef *module, path_t *path, int mode, int dir_fd,
                int effective_ids, int follow_symlinks);
 
 static PyObject *
-os_access(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_access(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "mode", "dir_fd", "effective_ids", "follow_symlinks", NULL};
@@ -140,7 +140,7 @@ os_access(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     int follow_symlinks = 1;
     int _return_value;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&i|$O&pp:access", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&i|$O&pp:access", _keywords,
         path_converter, &path, &mode, FACCESSAT_DIR_FD_CONVERTER, &dir_fd, &effective_ids, &follow_symlinks))
         goto exit;
     _return_value = os_access_impl(module, &path, mode, dir_fd, effective_ids, follow_symlinks);
@@ -225,19 +225,19 @@ PyDoc_STRVAR(os_chdir__doc__,
 "  If this functionality is unavailable, using it raises an exception.");
 
 #define OS_CHDIR_METHODDEF    \
-    {"chdir", (PyCFunction)os_chdir, METH_VARARGS|METH_KEYWORDS, os_chdir__doc__},
+    {"chdir", (PyCFunction)os_chdir, METH_FASTCALL, os_chdir__doc__},
 
 static PyObject *
 os_chdir_impl(PyModuleDef *module, path_t *path);
 
 static PyObject *
-os_chdir(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_chdir(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", NULL};
     path_t path = PATH_T_INITIALIZE("chdir", "path", 0, PATH_HAVE_FCHDIR);
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&:chdir", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&:chdir", _keywords,
         path_converter, &path))
         goto exit;
     return_value = os_chdir_impl(module, &path);
@@ -261,19 +261,19 @@ PyDoc_STRVAR(os_fchdir__doc__,
 "Equivalent to os.chdir(fd).");
 
 #define OS_FCHDIR_METHODDEF    \
-    {"fchdir", (PyCFunction)os_fchdir, METH_VARARGS|METH_KEYWORDS, os_fchdir__doc__},
+    {"fchdir", (PyCFunction)os_fchdir, METH_FASTCALL, os_fchdir__doc__},
 
 static PyObject *
 os_fchdir_impl(PyModuleDef *module, int fd);
 
 static PyObject *
-os_fchdir(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_fchdir(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"fd", NULL};
     int fd;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&:fchdir", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&:fchdir", _keywords,
         fildes_converter, &fd))
         goto exit;
     return_value = os_fchdir_impl(module, fd);
@@ -311,14 +311,14 @@ PyDoc_STRVAR(os_chmod__doc__,
 "  If they are unavailable, using them will raise a NotImplementedError.");
 
 #define OS_CHMOD_METHODDEF    \
-    {"chmod", (PyCFunction)os_chmod, METH_VARARGS|METH_KEYWORDS, os_chmod__doc__},
+    {"chmod", (PyCFunction)os_chmod, METH_FASTCALL, os_chmod__doc__},
 
 static PyObject *
 os_chmod_impl(PyModuleDef *module, path_t *path, int mode, int dir_fd,
               int follow_symlinks);
 
 static PyObject *
-os_chmod(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_chmod(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "mode", "dir_fd", "follow_symlinks", NULL};
@@ -327,7 +327,7 @@ os_chmod(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     int dir_fd = DEFAULT_DIR_FD;
     int follow_symlinks = 1;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&i|$O&p:chmod", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&i|$O&p:chmod", _keywords,
         path_converter, &path, &mode, FCHMODAT_DIR_FD_CONVERTER, &dir_fd, &follow_symlinks))
         goto exit;
     return_value = os_chmod_impl(module, &path, mode, dir_fd, follow_symlinks);
@@ -350,20 +350,20 @@ PyDoc_STRVAR(os_fchmod__doc__,
 "Equivalent to os.chmod(fd, mode).");
 
 #define OS_FCHMOD_METHODDEF    \
-    {"fchmod", (PyCFunction)os_fchmod, METH_VARARGS|METH_KEYWORDS, os_fchmod__doc__},
+    {"fchmod", (PyCFunction)os_fchmod, METH_FASTCALL, os_fchmod__doc__},
 
 static PyObject *
 os_fchmod_impl(PyModuleDef *module, int fd, int mode);
 
 static PyObject *
-os_fchmod(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_fchmod(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"fd", "mode", NULL};
     int fd;
     int mode;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "ii:fchmod", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "ii:fchmod", _keywords,
         &fd, &mode))
         goto exit;
     return_value = os_fchmod_impl(module, fd, mode);
@@ -386,20 +386,20 @@ PyDoc_STRVAR(os_lchmod__doc__,
 "Equivalent to chmod(path, mode, follow_symlinks=False).\"");
 
 #define OS_LCHMOD_METHODDEF    \
-    {"lchmod", (PyCFunction)os_lchmod, METH_VARARGS|METH_KEYWORDS, os_lchmod__doc__},
+    {"lchmod", (PyCFunction)os_lchmod, METH_FASTCALL, os_lchmod__doc__},
 
 static PyObject *
 os_lchmod_impl(PyModuleDef *module, path_t *path, int mode);
 
 static PyObject *
-os_lchmod(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_lchmod(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "mode", NULL};
     path_t path = PATH_T_INITIALIZE("lchmod", "path", 0, 0);
     int mode;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&i:lchmod", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&i:lchmod", _keywords,
         path_converter, &path, &mode))
         goto exit;
     return_value = os_lchmod_impl(module, &path, mode);
@@ -428,14 +428,14 @@ PyDoc_STRVAR(os_chflags__doc__,
 "unavailable, using it will raise a NotImplementedError.");
 
 #define OS_CHFLAGS_METHODDEF    \
-    {"chflags", (PyCFunction)os_chflags, METH_VARARGS|METH_KEYWORDS, os_chflags__doc__},
+    {"chflags", (PyCFunction)os_chflags, METH_FASTCALL, os_chflags__doc__},
 
 static PyObject *
 os_chflags_impl(PyModuleDef *module, path_t *path, unsigned long flags,
                 int follow_symlinks);
 
 static PyObject *
-os_chflags(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_chflags(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "flags", "follow_symlinks", NULL};
@@ -443,7 +443,7 @@ os_chflags(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     unsigned long flags;
     int follow_symlinks = 1;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&k|p:chflags", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&k|p:chflags", _keywords,
         path_converter, &path, &flags, &follow_symlinks))
         goto exit;
     return_value = os_chflags_impl(module, &path, flags, follow_symlinks);
@@ -469,20 +469,20 @@ PyDoc_STRVAR(os_lchflags__doc__,
 "Equivalent to chflags(path, flags, follow_symlinks=False).");
 
 #define OS_LCHFLAGS_METHODDEF    \
-    {"lchflags", (PyCFunction)os_lchflags, METH_VARARGS|METH_KEYWORDS, os_lchflags__doc__},
+    {"lchflags", (PyCFunction)os_lchflags, METH_FASTCALL, os_lchflags__doc__},
 
 static PyObject *
 os_lchflags_impl(PyModuleDef *module, path_t *path, unsigned long flags);
 
 static PyObject *
-os_lchflags(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_lchflags(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "flags", NULL};
     path_t path = PATH_T_INITIALIZE("lchflags", "path", 0, 0);
     unsigned long flags;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&k:lchflags", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&k:lchflags", _keywords,
         path_converter, &path, &flags))
         goto exit;
     return_value = os_lchflags_impl(module, &path, flags);
@@ -505,19 +505,19 @@ PyDoc_STRVAR(os_chroot__doc__,
 "Change root directory to path.");
 
 #define OS_CHROOT_METHODDEF    \
-    {"chroot", (PyCFunction)os_chroot, METH_VARARGS|METH_KEYWORDS, os_chroot__doc__},
+    {"chroot", (PyCFunction)os_chroot, METH_FASTCALL, os_chroot__doc__},
 
 static PyObject *
 os_chroot_impl(PyModuleDef *module, path_t *path);
 
 static PyObject *
-os_chroot(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_chroot(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", NULL};
     path_t path = PATH_T_INITIALIZE("chroot", "path", 0, 0);
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&:chroot", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&:chroot", _keywords,
         path_converter, &path))
         goto exit;
     return_value = os_chroot_impl(module, &path);
@@ -540,19 +540,19 @@ PyDoc_STRVAR(os_fsync__doc__,
 "Force write of fd to disk.");
 
 #define OS_FSYNC_METHODDEF    \
-    {"fsync", (PyCFunction)os_fsync, METH_VARARGS|METH_KEYWORDS, os_fsync__doc__},
+    {"fsync", (PyCFunction)os_fsync, METH_FASTCALL, os_fsync__doc__},
 
 static PyObject *
 os_fsync_impl(PyModuleDef *module, int fd);
 
 static PyObject *
-os_fsync(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_fsync(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"fd", NULL};
     int fd;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&:fsync", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&:fsync", _keywords,
         fildes_converter, &fd))
         goto exit;
     return_value = os_fsync_impl(module, fd);
@@ -594,19 +594,19 @@ PyDoc_STRVAR(os_fdatasync__doc__,
 "Force write of fd to disk without forcing update of metadata.");
 
 #define OS_FDATASYNC_METHODDEF    \
-    {"fdatasync", (PyCFunction)os_fdatasync, METH_VARARGS|METH_KEYWORDS, os_fdatasync__doc__},
+    {"fdatasync", (PyCFunction)os_fdatasync, METH_FASTCALL, os_fdatasync__doc__},
 
 static PyObject *
 os_fdatasync_impl(PyModuleDef *module, int fd);
 
 static PyObject *
-os_fdatasync(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_fdatasync(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"fd", NULL};
     int fd;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&:fdatasync", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&:fdatasync", _keywords,
         fildes_converter, &fd))
         goto exit;
     return_value = os_fdatasync_impl(module, fd);
@@ -650,14 +650,14 @@ PyDoc_STRVAR(os_chown__doc__,
 "  If they are unavailable, using them will raise a NotImplementedError.");
 
 #define OS_CHOWN_METHODDEF    \
-    {"chown", (PyCFunction)os_chown, METH_VARARGS|METH_KEYWORDS, os_chown__doc__},
+    {"chown", (PyCFunction)os_chown, METH_FASTCALL, os_chown__doc__},
 
 static PyObject *
 os_chown_impl(PyModuleDef *module, path_t *path, uid_t uid, gid_t gid,
               int dir_fd, int follow_symlinks);
 
 static PyObject *
-os_chown(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_chown(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "uid", "gid", "dir_fd", "follow_symlinks", NULL};
@@ -667,7 +667,7 @@ os_chown(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     int dir_fd = DEFAULT_DIR_FD;
     int follow_symlinks = 1;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&O&O&|$O&p:chown", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&O&O&|$O&p:chown", _keywords,
         path_converter, &path, _Py_Uid_Converter, &uid, _Py_Gid_Converter, &gid, FCHOWNAT_DIR_FD_CONVERTER, &dir_fd, &follow_symlinks))
         goto exit;
     return_value = os_chown_impl(module, &path, uid, gid, dir_fd, follow_symlinks);
@@ -692,13 +692,13 @@ PyDoc_STRVAR(os_fchown__doc__,
 "Equivalent to os.chown(fd, uid, gid).");
 
 #define OS_FCHOWN_METHODDEF    \
-    {"fchown", (PyCFunction)os_fchown, METH_VARARGS|METH_KEYWORDS, os_fchown__doc__},
+    {"fchown", (PyCFunction)os_fchown, METH_FASTCALL, os_fchown__doc__},
 
 static PyObject *
 os_fchown_impl(PyModuleDef *module, int fd, uid_t uid, gid_t gid);
 
 static PyObject *
-os_fchown(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_fchown(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"fd", "uid", "gid", NULL};
@@ -706,7 +706,7 @@ os_fchown(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     uid_t uid;
     gid_t gid;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "iO&O&:fchown", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "iO&O&:fchown", _keywords,
         &fd, _Py_Uid_Converter, &uid, _Py_Gid_Converter, &gid))
         goto exit;
     return_value = os_fchown_impl(module, fd, uid, gid);
@@ -729,13 +729,13 @@ PyDoc_STRVAR(os_lchown__doc__,
 "Equivalent to os.chown(path, uid, gid, follow_symlinks=False).");
 
 #define OS_LCHOWN_METHODDEF    \
-    {"lchown", (PyCFunction)os_lchown, METH_VARARGS|METH_KEYWORDS, os_lchown__doc__},
+    {"lchown", (PyCFunction)os_lchown, METH_FASTCALL, os_lchown__doc__},
 
 static PyObject *
 os_lchown_impl(PyModuleDef *module, path_t *path, uid_t uid, gid_t gid);
 
 static PyObject *
-os_lchown(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_lchown(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "uid", "gid", NULL};
@@ -743,7 +743,7 @@ os_lchown(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     uid_t uid;
     gid_t gid;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&O&O&:lchown", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&O&O&:lchown", _keywords,
         path_converter, &path, _Py_Uid_Converter, &uid, _Py_Gid_Converter, &gid))
         goto exit;
     return_value = os_lchown_impl(module, &path, uid, gid);
@@ -813,14 +813,14 @@ PyDoc_STRVAR(os_link__doc__,
 "  NotImplementedError.");
 
 #define OS_LINK_METHODDEF    \
-    {"link", (PyCFunction)os_link, METH_VARARGS|METH_KEYWORDS, os_link__doc__},
+    {"link", (PyCFunction)os_link, METH_FASTCALL, os_link__doc__},
 
 static PyObject *
 os_link_impl(PyModuleDef *module, path_t *src, path_t *dst, int src_dir_fd,
              int dst_dir_fd, int follow_symlinks);
 
 static PyObject *
-os_link(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_link(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"src", "dst", "src_dir_fd", "dst_dir_fd", "follow_symlinks", NULL};
@@ -830,7 +830,7 @@ os_link(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     int dst_dir_fd = DEFAULT_DIR_FD;
     int follow_symlinks = 1;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&O&|$O&O&p:link", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&O&|$O&O&p:link", _keywords,
         path_converter, &src, path_converter, &dst, dir_fd_converter, &src_dir_fd, dir_fd_converter, &dst_dir_fd, &follow_symlinks))
         goto exit;
     return_value = os_link_impl(module, &src, &dst, src_dir_fd, dst_dir_fd, follow_symlinks);
@@ -864,19 +864,19 @@ PyDoc_STRVAR(os_listdir__doc__,
 "entries \'.\' and \'..\' even if they are present in the directory.");
 
 #define OS_LISTDIR_METHODDEF    \
-    {"listdir", (PyCFunction)os_listdir, METH_VARARGS|METH_KEYWORDS, os_listdir__doc__},
+    {"listdir", (PyCFunction)os_listdir, METH_FASTCALL, os_listdir__doc__},
 
 static PyObject *
 os_listdir_impl(PyModuleDef *module, path_t *path);
 
 static PyObject *
-os_listdir(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_listdir(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", NULL};
     path_t path = PATH_T_INITIALIZE("listdir", "path", 1, PATH_HAVE_FDOPENDIR);
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O&:listdir", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "|O&:listdir", _keywords,
         path_converter, &path))
         goto exit;
     return_value = os_listdir_impl(module, &path);
@@ -991,19 +991,19 @@ PyDoc_STRVAR(os__getvolumepathname__doc__,
 "A helper function for ismount on Win32.");
 
 #define OS__GETVOLUMEPATHNAME_METHODDEF    \
-    {"_getvolumepathname", (PyCFunction)os__getvolumepathname, METH_VARARGS|METH_KEYWORDS, os__getvolumepathname__doc__},
+    {"_getvolumepathname", (PyCFunction)os__getvolumepathname, METH_FASTCALL, os__getvolumepathname__doc__},
 
 static PyObject *
 os__getvolumepathname_impl(PyModuleDef *module, PyObject *path);
 
 static PyObject *
-os__getvolumepathname(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os__getvolumepathname(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", NULL};
     PyObject *path;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "U:_getvolumepathname", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "U:_getvolumepathname", _keywords,
         &path))
         goto exit;
     return_value = os__getvolumepathname_impl(module, path);
@@ -1028,13 +1028,13 @@ PyDoc_STRVAR(os_mkdir__doc__,
 "The mode argument is ignored on Windows.");
 
 #define OS_MKDIR_METHODDEF    \
-    {"mkdir", (PyCFunction)os_mkdir, METH_VARARGS|METH_KEYWORDS, os_mkdir__doc__},
+    {"mkdir", (PyCFunction)os_mkdir, METH_FASTCALL, os_mkdir__doc__},
 
 static PyObject *
 os_mkdir_impl(PyModuleDef *module, path_t *path, int mode, int dir_fd);
 
 static PyObject *
-os_mkdir(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_mkdir(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "mode", "dir_fd", NULL};
@@ -1042,7 +1042,7 @@ os_mkdir(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     int mode = 511;
     int dir_fd = DEFAULT_DIR_FD;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&|i$O&:mkdir", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&|i$O&:mkdir", _keywords,
         path_converter, &path, &mode, MKDIRAT_DIR_FD_CONVERTER, &dir_fd))
         goto exit;
     return_value = os_mkdir_impl(module, &path, mode, dir_fd);
@@ -1093,20 +1093,20 @@ PyDoc_STRVAR(os_getpriority__doc__,
 "Return program scheduling priority.");
 
 #define OS_GETPRIORITY_METHODDEF    \
-    {"getpriority", (PyCFunction)os_getpriority, METH_VARARGS|METH_KEYWORDS, os_getpriority__doc__},
+    {"getpriority", (PyCFunction)os_getpriority, METH_FASTCALL, os_getpriority__doc__},
 
 static PyObject *
 os_getpriority_impl(PyModuleDef *module, int which, int who);
 
 static PyObject *
-os_getpriority(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_getpriority(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"which", "who", NULL};
     int which;
     int who;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "ii:getpriority", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "ii:getpriority", _keywords,
         &which, &who))
         goto exit;
     return_value = os_getpriority_impl(module, which, who);
@@ -1126,13 +1126,13 @@ PyDoc_STRVAR(os_setpriority__doc__,
 "Set program scheduling priority.");
 
 #define OS_SETPRIORITY_METHODDEF    \
-    {"setpriority", (PyCFunction)os_setpriority, METH_VARARGS|METH_KEYWORDS, os_setpriority__doc__},
+    {"setpriority", (PyCFunction)os_setpriority, METH_FASTCALL, os_setpriority__doc__},
 
 static PyObject *
 os_setpriority_impl(PyModuleDef *module, int which, int who, int priority);
 
 static PyObject *
-os_setpriority(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_setpriority(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"which", "who", "priority", NULL};
@@ -1140,7 +1140,7 @@ os_setpriority(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     int who;
     int priority;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "iii:setpriority", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "iii:setpriority", _keywords,
         &which, &who, &priority))
         goto exit;
     return_value = os_setpriority_impl(module, which, who, priority);
@@ -1164,14 +1164,14 @@ PyDoc_STRVAR(os_rename__doc__,
 "  If they are unavailable, using them will raise a NotImplementedError.");
 
 #define OS_RENAME_METHODDEF    \
-    {"rename", (PyCFunction)os_rename, METH_VARARGS|METH_KEYWORDS, os_rename__doc__},
+    {"rename", (PyCFunction)os_rename, METH_FASTCALL, os_rename__doc__},
 
 static PyObject *
 os_rename_impl(PyModuleDef *module, path_t *src, path_t *dst, int src_dir_fd,
                int dst_dir_fd);
 
 static PyObject *
-os_rename(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_rename(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"src", "dst", "src_dir_fd", "dst_dir_fd", NULL};
@@ -1180,7 +1180,7 @@ os_rename(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     int src_dir_fd = DEFAULT_DIR_FD;
     int dst_dir_fd = DEFAULT_DIR_FD;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&O&|$O&O&:rename", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&O&|$O&O&:rename", _keywords,
         path_converter, &src, path_converter, &dst, dir_fd_converter, &src_dir_fd, dir_fd_converter, &dst_dir_fd))
         goto exit;
     return_value = os_rename_impl(module, &src, &dst, src_dir_fd, dst_dir_fd);
@@ -1207,14 +1207,14 @@ PyDoc_STRVAR(os_replace__doc__,
 "  If they are unavailable, using them will raise a NotImplementedError.\"");
 
 #define OS_REPLACE_METHODDEF    \
-    {"replace", (PyCFunction)os_replace, METH_VARARGS|METH_KEYWORDS, os_replace__doc__},
+    {"replace", (PyCFunction)os_replace, METH_FASTCALL, os_replace__doc__},
 
 static PyObject *
 os_replace_impl(PyModuleDef *module, path_t *src, path_t *dst,
                 int src_dir_fd, int dst_dir_fd);
 
 static PyObject *
-os_replace(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_replace(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"src", "dst", "src_dir_fd", "dst_dir_fd", NULL};
@@ -1223,7 +1223,7 @@ os_replace(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     int src_dir_fd = DEFAULT_DIR_FD;
     int dst_dir_fd = DEFAULT_DIR_FD;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&O&|$O&O&:replace", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&O&|$O&O&:replace", _keywords,
         path_converter, &src, path_converter, &dst, dir_fd_converter, &src_dir_fd, dir_fd_converter, &dst_dir_fd))
         goto exit;
     return_value = os_replace_impl(module, &src, &dst, src_dir_fd, dst_dir_fd);
@@ -1249,20 +1249,20 @@ PyDoc_STRVAR(os_rmdir__doc__,
 "  If it is unavailable, using it will raise a NotImplementedError.");
 
 #define OS_RMDIR_METHODDEF    \
-    {"rmdir", (PyCFunction)os_rmdir, METH_VARARGS|METH_KEYWORDS, os_rmdir__doc__},
+    {"rmdir", (PyCFunction)os_rmdir, METH_FASTCALL, os_rmdir__doc__},
 
 static PyObject *
 os_rmdir_impl(PyModuleDef *module, path_t *path, int dir_fd);
 
 static PyObject *
-os_rmdir(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_rmdir(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "dir_fd", NULL};
     path_t path = PATH_T_INITIALIZE("rmdir", "path", 0, 0);
     int dir_fd = DEFAULT_DIR_FD;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&|$O&:rmdir", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&|$O&:rmdir", _keywords,
         path_converter, &path, UNLINKAT_DIR_FD_CONVERTER, &dir_fd))
         goto exit;
     return_value = os_rmdir_impl(module, &path, dir_fd);
@@ -1283,20 +1283,20 @@ PyDoc_STRVAR(os_system__doc__,
 "Execute the command in a subshell.");
 
 #define OS_SYSTEM_METHODDEF    \
-    {"system", (PyCFunction)os_system, METH_VARARGS|METH_KEYWORDS, os_system__doc__},
+    {"system", (PyCFunction)os_system, METH_FASTCALL, os_system__doc__},
 
 static long
 os_system_impl(PyModuleDef *module, Py_UNICODE *command);
 
 static PyObject *
-os_system(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_system(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"command", NULL};
     Py_UNICODE *command;
     long _return_value;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "u:system", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "u:system", _keywords,
         &command))
         goto exit;
     _return_value = os_system_impl(module, command);
@@ -1319,20 +1319,20 @@ PyDoc_STRVAR(os_system__doc__,
 "Execute the command in a subshell.");
 
 #define OS_SYSTEM_METHODDEF    \
-    {"system", (PyCFunction)os_system, METH_VARARGS|METH_KEYWORDS, os_system__doc__},
+    {"system", (PyCFunction)os_system, METH_FASTCALL, os_system__doc__},
 
 static long
 os_system_impl(PyModuleDef *module, PyObject *command);
 
 static PyObject *
-os_system(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_system(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"command", NULL};
     PyObject *command = NULL;
     long _return_value;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&:system", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&:system", _keywords,
         PyUnicode_FSConverter, &command))
         goto exit;
     _return_value = os_system_impl(module, command);
@@ -1387,20 +1387,20 @@ PyDoc_STRVAR(os_unlink__doc__,
 "  If it is unavailable, using it will raise a NotImplementedError.");
 
 #define OS_UNLINK_METHODDEF    \
-    {"unlink", (PyCFunction)os_unlink, METH_VARARGS|METH_KEYWORDS, os_unlink__doc__},
+    {"unlink", (PyCFunction)os_unlink, METH_FASTCALL, os_unlink__doc__},
 
 static PyObject *
 os_unlink_impl(PyModuleDef *module, path_t *path, int dir_fd);
 
 static PyObject *
-os_unlink(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_unlink(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "dir_fd", NULL};
     path_t path = PATH_T_INITIALIZE("unlink", "path", 0, 0);
     int dir_fd = DEFAULT_DIR_FD;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&|$O&:unlink", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&|$O&:unlink", _keywords,
         path_converter, &path, UNLINKAT_DIR_FD_CONVERTER, &dir_fd))
         goto exit;
     return_value = os_unlink_impl(module, &path, dir_fd);
@@ -1424,20 +1424,20 @@ PyDoc_STRVAR(os_remove__doc__,
 "  If it is unavailable, using it will raise a NotImplementedError.");
 
 #define OS_REMOVE_METHODDEF    \
-    {"remove", (PyCFunction)os_remove, METH_VARARGS|METH_KEYWORDS, os_remove__doc__},
+    {"remove", (PyCFunction)os_remove, METH_FASTCALL, os_remove__doc__},
 
 static PyObject *
 os_remove_impl(PyModuleDef *module, path_t *path, int dir_fd);
 
 static PyObject *
-os_remove(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_remove(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "dir_fd", NULL};
     path_t path = PATH_T_INITIALIZE("remove", "path", 0, 0);
     int dir_fd = DEFAULT_DIR_FD;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&|$O&:remove", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&|$O&:remove", _keywords,
         path_converter, &path, UNLINKAT_DIR_FD_CONVERTER, &dir_fd))
         goto exit;
     return_value = os_remove_impl(module, &path, dir_fd);
@@ -1504,14 +1504,14 @@ PyDoc_STRVAR(os_utime__doc__,
 "  If they are unavailable, using them will raise a NotImplementedError.");
 
 #define OS_UTIME_METHODDEF    \
-    {"utime", (PyCFunction)os_utime, METH_VARARGS|METH_KEYWORDS, os_utime__doc__},
+    {"utime", (PyCFunction)os_utime, METH_FASTCALL, os_utime__doc__},
 
 static PyObject *
 os_utime_impl(PyModuleDef *module, path_t *path, PyObject *times,
               PyObject *ns, int dir_fd, int follow_symlinks);
 
 static PyObject *
-os_utime(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_utime(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "times", "ns", "dir_fd", "follow_symlinks", NULL};
@@ -1521,7 +1521,7 @@ os_utime(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     int dir_fd = DEFAULT_DIR_FD;
     int follow_symlinks = 1;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&|O$OO&p:utime", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&|O$OO&p:utime", _keywords,
         path_converter, &path, &times, &ns, FUTIMENSAT_DIR_FD_CONVERTER, &dir_fd, &follow_symlinks))
         goto exit;
     return_value = os_utime_impl(module, &path, times, ns, dir_fd, follow_symlinks);
@@ -1540,19 +1540,19 @@ PyDoc_STRVAR(os__exit__doc__,
 "Exit to the system with specified status, without normal exit processing.");
 
 #define OS__EXIT_METHODDEF    \
-    {"_exit", (PyCFunction)os__exit, METH_VARARGS|METH_KEYWORDS, os__exit__doc__},
+    {"_exit", (PyCFunction)os__exit, METH_FASTCALL, os__exit__doc__},
 
 static PyObject *
 os__exit_impl(PyModuleDef *module, int status);
 
 static PyObject *
-os__exit(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os__exit(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"status", NULL};
     int status;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i:_exit", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "i:_exit", _keywords,
         &status))
         goto exit;
     return_value = os__exit_impl(module, status);
@@ -1575,19 +1575,21 @@ PyDoc_STRVAR(os_execv__doc__,
 "    Tuple or list of strings.");
 
 #define OS_EXECV_METHODDEF    \
-    {"execv", (PyCFunction)os_execv, METH_VARARGS, os_execv__doc__},
+    {"execv", (PyCFunction)os_execv, METH_FASTCALL, os_execv__doc__},
 
 static PyObject *
 os_execv_impl(PyModuleDef *module, PyObject *path, PyObject *argv);
 
 static PyObject *
-os_execv(PyModuleDef *module, PyObject *args)
+os_execv(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     PyObject *path = NULL;
     PyObject *argv;
 
-    if (!PyArg_ParseTuple(args, "O&O:execv",
+    if (!_PyArg_NoStackKeywords("execv", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "O&O:execv",
         PyUnicode_FSConverter, &path, &argv))
         goto exit;
     return_value = os_execv_impl(module, path, argv);
@@ -1617,14 +1619,14 @@ PyDoc_STRVAR(os_execve__doc__,
 "    Dictionary of strings mapping to strings.");
 
 #define OS_EXECVE_METHODDEF    \
-    {"execve", (PyCFunction)os_execve, METH_VARARGS|METH_KEYWORDS, os_execve__doc__},
+    {"execve", (PyCFunction)os_execve, METH_FASTCALL, os_execve__doc__},
 
 static PyObject *
 os_execve_impl(PyModuleDef *module, path_t *path, PyObject *argv,
                PyObject *env);
 
 static PyObject *
-os_execve(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_execve(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "argv", "env", NULL};
@@ -1632,7 +1634,7 @@ os_execve(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     PyObject *argv;
     PyObject *env;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&OO:execve", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&OO:execve", _keywords,
         path_converter, &path, &argv, &env))
         goto exit;
     return_value = os_execve_impl(module, &path, argv, env);
@@ -1662,20 +1664,22 @@ PyDoc_STRVAR(os_spawnv__doc__,
 "    Tuple or list of strings.");
 
 #define OS_SPAWNV_METHODDEF    \
-    {"spawnv", (PyCFunction)os_spawnv, METH_VARARGS, os_spawnv__doc__},
+    {"spawnv", (PyCFunction)os_spawnv, METH_FASTCALL, os_spawnv__doc__},
 
 static PyObject *
 os_spawnv_impl(PyModuleDef *module, int mode, PyObject *path, PyObject *argv);
 
 static PyObject *
-os_spawnv(PyModuleDef *module, PyObject *args)
+os_spawnv(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     int mode;
     PyObject *path = NULL;
     PyObject *argv;
 
-    if (!PyArg_ParseTuple(args, "iO&O:spawnv",
+    if (!_PyArg_NoStackKeywords("spawnv", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "iO&O:spawnv",
         &mode, PyUnicode_FSConverter, &path, &argv))
         goto exit;
     return_value = os_spawnv_impl(module, mode, path, argv);
@@ -1707,14 +1711,14 @@ PyDoc_STRVAR(os_spawnve__doc__,
 "    Dictionary of strings mapping to strings.");
 
 #define OS_SPAWNVE_METHODDEF    \
-    {"spawnve", (PyCFunction)os_spawnve, METH_VARARGS, os_spawnve__doc__},
+    {"spawnve", (PyCFunction)os_spawnve, METH_FASTCALL, os_spawnve__doc__},
 
 static PyObject *
 os_spawnve_impl(PyModuleDef *module, int mode, PyObject *path,
                 PyObject *argv, PyObject *env);
 
 static PyObject *
-os_spawnve(PyModuleDef *module, PyObject *args)
+os_spawnve(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     int mode;
@@ -1722,7 +1726,9 @@ os_spawnve(PyModuleDef *module, PyObject *args)
     PyObject *argv;
     PyObject *env;
 
-    if (!PyArg_ParseTuple(args, "iO&OO:spawnve",
+    if (!_PyArg_NoStackKeywords("spawnve", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "iO&OO:spawnve",
         &mode, PyUnicode_FSConverter, &path, &argv, &env))
         goto exit;
     return_value = os_spawnve_impl(module, mode, path, argv, env);
@@ -1793,19 +1799,19 @@ PyDoc_STRVAR(os_sched_get_priority_max__doc__,
 "Get the maximum scheduling priority for policy.");
 
 #define OS_SCHED_GET_PRIORITY_MAX_METHODDEF    \
-    {"sched_get_priority_max", (PyCFunction)os_sched_get_priority_max, METH_VARARGS|METH_KEYWORDS, os_sched_get_priority_max__doc__},
+    {"sched_get_priority_max", (PyCFunction)os_sched_get_priority_max, METH_FASTCALL, os_sched_get_priority_max__doc__},
 
 static PyObject *
 os_sched_get_priority_max_impl(PyModuleDef *module, int policy);
 
 static PyObject *
-os_sched_get_priority_max(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_sched_get_priority_max(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"policy", NULL};
     int policy;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i:sched_get_priority_max", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "i:sched_get_priority_max", _keywords,
         &policy))
         goto exit;
     return_value = os_sched_get_priority_max_impl(module, policy);
@@ -1825,19 +1831,19 @@ PyDoc_STRVAR(os_sched_get_priority_min__doc__,
 "Get the minimum scheduling priority for policy.");
 
 #define OS_SCHED_GET_PRIORITY_MIN_METHODDEF    \
-    {"sched_get_priority_min", (PyCFunction)os_sched_get_priority_min, METH_VARARGS|METH_KEYWORDS, os_sched_get_priority_min__doc__},
+    {"sched_get_priority_min", (PyCFunction)os_sched_get_priority_min, METH_FASTCALL, os_sched_get_priority_min__doc__},
 
 static PyObject *
 os_sched_get_priority_min_impl(PyModuleDef *module, int policy);
 
 static PyObject *
-os_sched_get_priority_min(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_sched_get_priority_min(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"policy", NULL};
     int policy;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i:sched_get_priority_min", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "i:sched_get_priority_min", _keywords,
         &policy))
         goto exit;
     return_value = os_sched_get_priority_min_impl(module, policy);
@@ -1924,21 +1930,23 @@ PyDoc_STRVAR(os_sched_setscheduler__doc__,
 "param is an instance of sched_param.");
 
 #define OS_SCHED_SETSCHEDULER_METHODDEF    \
-    {"sched_setscheduler", (PyCFunction)os_sched_setscheduler, METH_VARARGS, os_sched_setscheduler__doc__},
+    {"sched_setscheduler", (PyCFunction)os_sched_setscheduler, METH_FASTCALL, os_sched_setscheduler__doc__},
 
 static PyObject *
 os_sched_setscheduler_impl(PyModuleDef *module, pid_t pid, int policy,
                            struct sched_param *param);
 
 static PyObject *
-os_sched_setscheduler(PyModuleDef *module, PyObject *args)
+os_sched_setscheduler(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     pid_t pid;
     int policy;
     struct sched_param param;
 
-    if (!PyArg_ParseTuple(args, "" _Py_PARSE_PID "iO&:sched_setscheduler",
+    if (!_PyArg_NoStackKeywords("sched_setscheduler", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "" _Py_PARSE_PID "iO&:sched_setscheduler",
         &pid, &policy, convert_sched_param, &param))
         goto exit;
     return_value = os_sched_setscheduler_impl(module, pid, policy, &param);
@@ -1994,20 +2002,22 @@ PyDoc_STRVAR(os_sched_setparam__doc__,
 "param should be an instance of sched_param.");
 
 #define OS_SCHED_SETPARAM_METHODDEF    \
-    {"sched_setparam", (PyCFunction)os_sched_setparam, METH_VARARGS, os_sched_setparam__doc__},
+    {"sched_setparam", (PyCFunction)os_sched_setparam, METH_FASTCALL, os_sched_setparam__doc__},
 
 static PyObject *
 os_sched_setparam_impl(PyModuleDef *module, pid_t pid,
                        struct sched_param *param);
 
 static PyObject *
-os_sched_setparam(PyModuleDef *module, PyObject *args)
+os_sched_setparam(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     pid_t pid;
     struct sched_param param;
 
-    if (!PyArg_ParseTuple(args, "" _Py_PARSE_PID "O&:sched_setparam",
+    if (!_PyArg_NoStackKeywords("sched_setparam", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "" _Py_PARSE_PID "O&:sched_setparam",
         &pid, convert_sched_param, &param))
         goto exit;
     return_value = os_sched_setparam_impl(module, pid, &param);
@@ -2087,19 +2097,21 @@ PyDoc_STRVAR(os_sched_setaffinity__doc__,
 "mask should be an iterable of integers identifying CPUs.");
 
 #define OS_SCHED_SETAFFINITY_METHODDEF    \
-    {"sched_setaffinity", (PyCFunction)os_sched_setaffinity, METH_VARARGS, os_sched_setaffinity__doc__},
+    {"sched_setaffinity", (PyCFunction)os_sched_setaffinity, METH_FASTCALL, os_sched_setaffinity__doc__},
 
 static PyObject *
 os_sched_setaffinity_impl(PyModuleDef *module, pid_t pid, PyObject *mask);
 
 static PyObject *
-os_sched_setaffinity(PyModuleDef *module, PyObject *args)
+os_sched_setaffinity(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     pid_t pid;
     PyObject *mask;
 
-    if (!PyArg_ParseTuple(args, "" _Py_PARSE_PID "O:sched_setaffinity",
+    if (!_PyArg_NoStackKeywords("sched_setaffinity", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "" _Py_PARSE_PID "O:sched_setaffinity",
         &pid, &mask))
         goto exit;
     return_value = os_sched_setaffinity_impl(module, pid, mask);
@@ -2309,19 +2321,19 @@ PyDoc_STRVAR(os_getpgid__doc__,
 "Call the system call getpgid(), and return the result.");
 
 #define OS_GETPGID_METHODDEF    \
-    {"getpgid", (PyCFunction)os_getpgid, METH_VARARGS|METH_KEYWORDS, os_getpgid__doc__},
+    {"getpgid", (PyCFunction)os_getpgid, METH_FASTCALL, os_getpgid__doc__},
 
 static PyObject *
 os_getpgid_impl(PyModuleDef *module, pid_t pid);
 
 static PyObject *
-os_getpgid(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_getpgid(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"pid", NULL};
     pid_t pid;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "" _Py_PARSE_PID ":getpgid", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "" _Py_PARSE_PID ":getpgid", _keywords,
         &pid))
         goto exit;
     return_value = os_getpgid_impl(module, pid);
@@ -2454,19 +2466,21 @@ PyDoc_STRVAR(os_kill__doc__,
 "Kill a process with a signal.");
 
 #define OS_KILL_METHODDEF    \
-    {"kill", (PyCFunction)os_kill, METH_VARARGS, os_kill__doc__},
+    {"kill", (PyCFunction)os_kill, METH_FASTCALL, os_kill__doc__},
 
 static PyObject *
 os_kill_impl(PyModuleDef *module, pid_t pid, Py_ssize_t signal);
 
 static PyObject *
-os_kill(PyModuleDef *module, PyObject *args)
+os_kill(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     pid_t pid;
     Py_ssize_t signal;
 
-    if (!PyArg_ParseTuple(args, "" _Py_PARSE_PID "n:kill",
+    if (!_PyArg_NoStackKeywords("kill", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "" _Py_PARSE_PID "n:kill",
         &pid, &signal))
         goto exit;
     return_value = os_kill_impl(module, pid, signal);
@@ -2486,19 +2500,21 @@ PyDoc_STRVAR(os_killpg__doc__,
 "Kill a process group with a signal.");
 
 #define OS_KILLPG_METHODDEF    \
-    {"killpg", (PyCFunction)os_killpg, METH_VARARGS, os_killpg__doc__},
+    {"killpg", (PyCFunction)os_killpg, METH_FASTCALL, os_killpg__doc__},
 
 static PyObject *
 os_killpg_impl(PyModuleDef *module, pid_t pgid, int signal);
 
 static PyObject *
-os_killpg(PyModuleDef *module, PyObject *args)
+os_killpg(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     pid_t pgid;
     int signal;
 
-    if (!PyArg_ParseTuple(args, "" _Py_PARSE_PID "i:killpg",
+    if (!_PyArg_NoStackKeywords("killpg", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "" _Py_PARSE_PID "i:killpg",
         &pgid, &signal))
         goto exit;
     return_value = os_killpg_impl(module, pgid, signal);
@@ -2638,19 +2654,21 @@ PyDoc_STRVAR(os_setreuid__doc__,
 "Set the current process\'s real and effective user ids.");
 
 #define OS_SETREUID_METHODDEF    \
-    {"setreuid", (PyCFunction)os_setreuid, METH_VARARGS, os_setreuid__doc__},
+    {"setreuid", (PyCFunction)os_setreuid, METH_FASTCALL, os_setreuid__doc__},
 
 static PyObject *
 os_setreuid_impl(PyModuleDef *module, uid_t ruid, uid_t euid);
 
 static PyObject *
-os_setreuid(PyModuleDef *module, PyObject *args)
+os_setreuid(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     uid_t ruid;
     uid_t euid;
 
-    if (!PyArg_ParseTuple(args, "O&O&:setreuid",
+    if (!_PyArg_NoStackKeywords("setreuid", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "O&O&:setreuid",
         _Py_Uid_Converter, &ruid, _Py_Uid_Converter, &euid))
         goto exit;
     return_value = os_setreuid_impl(module, ruid, euid);
@@ -2670,19 +2688,21 @@ PyDoc_STRVAR(os_setregid__doc__,
 "Set the current process\'s real and effective group ids.");
 
 #define OS_SETREGID_METHODDEF    \
-    {"setregid", (PyCFunction)os_setregid, METH_VARARGS, os_setregid__doc__},
+    {"setregid", (PyCFunction)os_setregid, METH_FASTCALL, os_setregid__doc__},
 
 static PyObject *
 os_setregid_impl(PyModuleDef *module, gid_t rgid, gid_t egid);
 
 static PyObject *
-os_setregid(PyModuleDef *module, PyObject *args)
+os_setregid(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     gid_t rgid;
     gid_t egid;
 
-    if (!PyArg_ParseTuple(args, "O&O&:setregid",
+    if (!_PyArg_NoStackKeywords("setregid", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "O&O&:setregid",
         _Py_Gid_Converter, &rgid, _Py_Gid_Converter, &egid))
         goto exit;
     return_value = os_setregid_impl(module, rgid, egid);
@@ -2748,19 +2768,19 @@ PyDoc_STRVAR(os_wait3__doc__,
 "  (pid, status, rusage)");
 
 #define OS_WAIT3_METHODDEF    \
-    {"wait3", (PyCFunction)os_wait3, METH_VARARGS|METH_KEYWORDS, os_wait3__doc__},
+    {"wait3", (PyCFunction)os_wait3, METH_FASTCALL, os_wait3__doc__},
 
 static PyObject *
 os_wait3_impl(PyModuleDef *module, int options);
 
 static PyObject *
-os_wait3(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_wait3(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"options", NULL};
     int options;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i:wait3", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "i:wait3", _keywords,
         &options))
         goto exit;
     return_value = os_wait3_impl(module, options);
@@ -2783,20 +2803,20 @@ PyDoc_STRVAR(os_wait4__doc__,
 "  (pid, status, rusage)");
 
 #define OS_WAIT4_METHODDEF    \
-    {"wait4", (PyCFunction)os_wait4, METH_VARARGS|METH_KEYWORDS, os_wait4__doc__},
+    {"wait4", (PyCFunction)os_wait4, METH_FASTCALL, os_wait4__doc__},
 
 static PyObject *
 os_wait4_impl(PyModuleDef *module, pid_t pid, int options);
 
 static PyObject *
-os_wait4(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_wait4(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"pid", "options", NULL};
     pid_t pid;
     int options;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "" _Py_PARSE_PID "i:wait4", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "" _Py_PARSE_PID "i:wait4", _keywords,
         &pid, &options))
         goto exit;
     return_value = os_wait4_impl(module, pid, options);
@@ -2827,20 +2847,22 @@ PyDoc_STRVAR(os_waitid__doc__,
 "no children in a waitable state.");
 
 #define OS_WAITID_METHODDEF    \
-    {"waitid", (PyCFunction)os_waitid, METH_VARARGS, os_waitid__doc__},
+    {"waitid", (PyCFunction)os_waitid, METH_FASTCALL, os_waitid__doc__},
 
 static PyObject *
 os_waitid_impl(PyModuleDef *module, idtype_t idtype, id_t id, int options);
 
 static PyObject *
-os_waitid(PyModuleDef *module, PyObject *args)
+os_waitid(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     idtype_t idtype;
     id_t id;
     int options;
 
-    if (!PyArg_ParseTuple(args, "i" _Py_PARSE_PID "i:waitid",
+    if (!_PyArg_NoStackKeywords("waitid", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "i" _Py_PARSE_PID "i:waitid",
         &idtype, &id, &options))
         goto exit;
     return_value = os_waitid_impl(module, idtype, id, options);
@@ -2865,19 +2887,21 @@ PyDoc_STRVAR(os_waitpid__doc__,
 "The options argument is ignored on Windows.");
 
 #define OS_WAITPID_METHODDEF    \
-    {"waitpid", (PyCFunction)os_waitpid, METH_VARARGS, os_waitpid__doc__},
+    {"waitpid", (PyCFunction)os_waitpid, METH_FASTCALL, os_waitpid__doc__},
 
 static PyObject *
 os_waitpid_impl(PyModuleDef *module, pid_t pid, int options);
 
 static PyObject *
-os_waitpid(PyModuleDef *module, PyObject *args)
+os_waitpid(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     pid_t pid;
     int options;
 
-    if (!PyArg_ParseTuple(args, "" _Py_PARSE_PID "i:waitpid",
+    if (!_PyArg_NoStackKeywords("waitpid", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "" _Py_PARSE_PID "i:waitpid",
         &pid, &options))
         goto exit;
     return_value = os_waitpid_impl(module, pid, options);
@@ -2902,19 +2926,21 @@ PyDoc_STRVAR(os_waitpid__doc__,
 "The options argument is ignored on Windows.");
 
 #define OS_WAITPID_METHODDEF    \
-    {"waitpid", (PyCFunction)os_waitpid, METH_VARARGS, os_waitpid__doc__},
+    {"waitpid", (PyCFunction)os_waitpid, METH_FASTCALL, os_waitpid__doc__},
 
 static PyObject *
 os_waitpid_impl(PyModuleDef *module, Py_intptr_t pid, int options);
 
 static PyObject *
-os_waitpid(PyModuleDef *module, PyObject *args)
+os_waitpid(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     Py_intptr_t pid;
     int options;
 
-    if (!PyArg_ParseTuple(args, "" _Py_PARSE_INTPTR "i:waitpid",
+    if (!_PyArg_NoStackKeywords("waitpid", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "" _Py_PARSE_INTPTR "i:waitpid",
         &pid, &options))
         goto exit;
     return_value = os_waitpid_impl(module, pid, options);
@@ -2969,14 +2995,14 @@ PyDoc_STRVAR(os_symlink__doc__,
 "  If it is unavailable, using it will raise a NotImplementedError.");
 
 #define OS_SYMLINK_METHODDEF    \
-    {"symlink", (PyCFunction)os_symlink, METH_VARARGS|METH_KEYWORDS, os_symlink__doc__},
+    {"symlink", (PyCFunction)os_symlink, METH_FASTCALL, os_symlink__doc__},
 
 static PyObject *
 os_symlink_impl(PyModuleDef *module, path_t *src, path_t *dst,
                 int target_is_directory, int dir_fd);
 
 static PyObject *
-os_symlink(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_symlink(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"src", "dst", "target_is_directory", "dir_fd", NULL};
@@ -2985,7 +3011,7 @@ os_symlink(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     int target_is_directory = 0;
     int dir_fd = DEFAULT_DIR_FD;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&O&|p$O&:symlink", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&O&|p$O&:symlink", _keywords,
         path_converter, &src, path_converter, &dst, &target_is_directory, SYMLINKAT_DIR_FD_CONVERTER, &dir_fd))
         goto exit;
     return_value = os_symlink_impl(module, &src, &dst, target_is_directory, dir_fd);
@@ -3088,19 +3114,21 @@ PyDoc_STRVAR(os_setpgid__doc__,
 "Call the system call setpgid(pid, pgrp).");
 
 #define OS_SETPGID_METHODDEF    \
-    {"setpgid", (PyCFunction)os_setpgid, METH_VARARGS, os_setpgid__doc__},
+    {"setpgid", (PyCFunction)os_setpgid, METH_FASTCALL, os_setpgid__doc__},
 
 static PyObject *
 os_setpgid_impl(PyModuleDef *module, pid_t pid, pid_t pgrp);
 
 static PyObject *
-os_setpgid(PyModuleDef *module, PyObject *args)
+os_setpgid(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     pid_t pid;
     pid_t pgrp;
 
-    if (!PyArg_ParseTuple(args, "" _Py_PARSE_PID "" _Py_PARSE_PID ":setpgid",
+    if (!_PyArg_NoStackKeywords("setpgid", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "" _Py_PARSE_PID "" _Py_PARSE_PID ":setpgid",
         &pid, &pgrp))
         goto exit;
     return_value = os_setpgid_impl(module, pid, pgrp);
@@ -3150,19 +3178,21 @@ PyDoc_STRVAR(os_tcsetpgrp__doc__,
 "Set the process group associated with the terminal specified by fd.");
 
 #define OS_TCSETPGRP_METHODDEF    \
-    {"tcsetpgrp", (PyCFunction)os_tcsetpgrp, METH_VARARGS, os_tcsetpgrp__doc__},
+    {"tcsetpgrp", (PyCFunction)os_tcsetpgrp, METH_FASTCALL, os_tcsetpgrp__doc__},
 
 static PyObject *
 os_tcsetpgrp_impl(PyModuleDef *module, int fd, pid_t pgid);
 
 static PyObject *
-os_tcsetpgrp(PyModuleDef *module, PyObject *args)
+os_tcsetpgrp(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     int fd;
     pid_t pgid;
 
-    if (!PyArg_ParseTuple(args, "i" _Py_PARSE_PID ":tcsetpgrp",
+    if (!_PyArg_NoStackKeywords("tcsetpgrp", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "i" _Py_PARSE_PID ":tcsetpgrp",
         &fd, &pgid))
         goto exit;
     return_value = os_tcsetpgrp_impl(module, fd, pgid);
@@ -3185,14 +3215,14 @@ PyDoc_STRVAR(os_open__doc__,
 "  If it is unavailable, using it will raise a NotImplementedError.");
 
 #define OS_OPEN_METHODDEF    \
-    {"open", (PyCFunction)os_open, METH_VARARGS|METH_KEYWORDS, os_open__doc__},
+    {"open", (PyCFunction)os_open, METH_FASTCALL, os_open__doc__},
 
 static int
 os_open_impl(PyModuleDef *module, path_t *path, int flags, int mode,
              int dir_fd);
 
 static PyObject *
-os_open(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_open(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "flags", "mode", "dir_fd", NULL};
@@ -3202,7 +3232,7 @@ os_open(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     int dir_fd = DEFAULT_DIR_FD;
     int _return_value;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&i|i$O&:open", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&i|i$O&:open", _keywords,
         path_converter, &path, &flags, &mode, OPENAT_DIR_FD_CONVERTER, &dir_fd))
         goto exit;
     _return_value = os_open_impl(module, &path, flags, mode, dir_fd);
@@ -3224,19 +3254,19 @@ PyDoc_STRVAR(os_close__doc__,
 "Close a file descriptor.");
 
 #define OS_CLOSE_METHODDEF    \
-    {"close", (PyCFunction)os_close, METH_VARARGS|METH_KEYWORDS, os_close__doc__},
+    {"close", (PyCFunction)os_close, METH_FASTCALL, os_close__doc__},
 
 static PyObject *
 os_close_impl(PyModuleDef *module, int fd);
 
 static PyObject *
-os_close(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_close(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"fd", NULL};
     int fd;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i:close", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "i:close", _keywords,
         &fd))
         goto exit;
     return_value = os_close_impl(module, fd);
@@ -3252,19 +3282,21 @@ PyDoc_STRVAR(os_closerange__doc__,
 "Closes all file descriptors in [fd_low, fd_high), ignoring errors.");
 
 #define OS_CLOSERANGE_METHODDEF    \
-    {"closerange", (PyCFunction)os_closerange, METH_VARARGS, os_closerange__doc__},
+    {"closerange", (PyCFunction)os_closerange, METH_FASTCALL, os_closerange__doc__},
 
 static PyObject *
 os_closerange_impl(PyModuleDef *module, int fd_low, int fd_high);
 
 static PyObject *
-os_closerange(PyModuleDef *module, PyObject *args)
+os_closerange(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     int fd_low;
     int fd_high;
 
-    if (!PyArg_ParseTuple(args, "ii:closerange",
+    if (!_PyArg_NoStackKeywords("closerange", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "ii:closerange",
         &fd_low, &fd_high))
         goto exit;
     return_value = os_closerange_impl(module, fd_low, fd_high);
@@ -3310,13 +3342,13 @@ PyDoc_STRVAR(os_dup2__doc__,
 "Duplicate file descriptor.");
 
 #define OS_DUP2_METHODDEF    \
-    {"dup2", (PyCFunction)os_dup2, METH_VARARGS|METH_KEYWORDS, os_dup2__doc__},
+    {"dup2", (PyCFunction)os_dup2, METH_FASTCALL, os_dup2__doc__},
 
 static PyObject *
 os_dup2_impl(PyModuleDef *module, int fd, int fd2, int inheritable);
 
 static PyObject *
-os_dup2(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_dup2(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"fd", "fd2", "inheritable", NULL};
@@ -3324,7 +3356,7 @@ os_dup2(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     int fd2;
     int inheritable = 1;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "ii|p:dup2", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "ii|p:dup2", _keywords,
         &fd, &fd2, &inheritable))
         goto exit;
     return_value = os_dup2_impl(module, fd, fd2, inheritable);
@@ -3349,20 +3381,22 @@ PyDoc_STRVAR(os_lockf__doc__,
 "    The number of bytes to lock, starting at the current position.");
 
 #define OS_LOCKF_METHODDEF    \
-    {"lockf", (PyCFunction)os_lockf, METH_VARARGS, os_lockf__doc__},
+    {"lockf", (PyCFunction)os_lockf, METH_FASTCALL, os_lockf__doc__},
 
 static PyObject *
 os_lockf_impl(PyModuleDef *module, int fd, int command, Py_off_t length);
 
 static PyObject *
-os_lockf(PyModuleDef *module, PyObject *args)
+os_lockf(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     int fd;
     int command;
     Py_off_t length;
 
-    if (!PyArg_ParseTuple(args, "iiO&:lockf",
+    if (!_PyArg_NoStackKeywords("lockf", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "iiO&:lockf",
         &fd, &command, Py_off_t_converter, &length))
         goto exit;
     return_value = os_lockf_impl(module, fd, command, length);
@@ -3383,13 +3417,13 @@ PyDoc_STRVAR(os_lseek__doc__,
 "relative to the beginning of the file.");
 
 #define OS_LSEEK_METHODDEF    \
-    {"lseek", (PyCFunction)os_lseek, METH_VARARGS, os_lseek__doc__},
+    {"lseek", (PyCFunction)os_lseek, METH_FASTCALL, os_lseek__doc__},
 
 static Py_off_t
 os_lseek_impl(PyModuleDef *module, int fd, Py_off_t position, int how);
 
 static PyObject *
-os_lseek(PyModuleDef *module, PyObject *args)
+os_lseek(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     int fd;
@@ -3397,7 +3431,9 @@ os_lseek(PyModuleDef *module, PyObject *args)
     int how;
     Py_off_t _return_value;
 
-    if (!PyArg_ParseTuple(args, "iO&i:lseek",
+    if (!_PyArg_NoStackKeywords("lseek", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "iO&i:lseek",
         &fd, Py_off_t_converter, &position, &how))
         goto exit;
     _return_value = os_lseek_impl(module, fd, position, how);
@@ -3416,19 +3452,21 @@ PyDoc_STRVAR(os_read__doc__,
 "Read from a file descriptor.  Returns a bytes object.");
 
 #define OS_READ_METHODDEF    \
-    {"read", (PyCFunction)os_read, METH_VARARGS, os_read__doc__},
+    {"read", (PyCFunction)os_read, METH_FASTCALL, os_read__doc__},
 
 static PyObject *
 os_read_impl(PyModuleDef *module, int fd, Py_ssize_t length);
 
 static PyObject *
-os_read(PyModuleDef *module, PyObject *args)
+os_read(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     int fd;
     Py_ssize_t length;
 
-    if (!PyArg_ParseTuple(args, "in:read",
+    if (!_PyArg_NoStackKeywords("read", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "in:read",
         &fd, &length))
         goto exit;
     return_value = os_read_impl(module, fd, length);
@@ -3454,20 +3492,22 @@ PyDoc_STRVAR(os_readv__doc__,
 "which may be less than the total capacity of all the buffers.");
 
 #define OS_READV_METHODDEF    \
-    {"readv", (PyCFunction)os_readv, METH_VARARGS, os_readv__doc__},
+    {"readv", (PyCFunction)os_readv, METH_FASTCALL, os_readv__doc__},
 
 static Py_ssize_t
 os_readv_impl(PyModuleDef *module, int fd, PyObject *buffers);
 
 static PyObject *
-os_readv(PyModuleDef *module, PyObject *args)
+os_readv(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     int fd;
     PyObject *buffers;
     Py_ssize_t _return_value;
 
-    if (!PyArg_ParseTuple(args, "iO:readv",
+    if (!_PyArg_NoStackKeywords("readv", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "iO:readv",
         &fd, &buffers))
         goto exit;
     _return_value = os_readv_impl(module, fd, buffers);
@@ -3493,20 +3533,22 @@ PyDoc_STRVAR(os_pread__doc__,
 "the beginning of the file.  The file offset remains unchanged.");
 
 #define OS_PREAD_METHODDEF    \
-    {"pread", (PyCFunction)os_pread, METH_VARARGS, os_pread__doc__},
+    {"pread", (PyCFunction)os_pread, METH_FASTCALL, os_pread__doc__},
 
 static PyObject *
 os_pread_impl(PyModuleDef *module, int fd, int length, Py_off_t offset);
 
 static PyObject *
-os_pread(PyModuleDef *module, PyObject *args)
+os_pread(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     int fd;
     int length;
     Py_off_t offset;
 
-    if (!PyArg_ParseTuple(args, "iiO&:pread",
+    if (!_PyArg_NoStackKeywords("pread", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "iiO&:pread",
         &fd, &length, Py_off_t_converter, &offset))
         goto exit;
     return_value = os_pread_impl(module, fd, length, offset);
@@ -3524,20 +3566,22 @@ PyDoc_STRVAR(os_write__doc__,
 "Write a bytes object to a file descriptor.");
 
 #define OS_WRITE_METHODDEF    \
-    {"write", (PyCFunction)os_write, METH_VARARGS, os_write__doc__},
+    {"write", (PyCFunction)os_write, METH_FASTCALL, os_write__doc__},
 
 static Py_ssize_t
 os_write_impl(PyModuleDef *module, int fd, Py_buffer *data);
 
 static PyObject *
-os_write(PyModuleDef *module, PyObject *args)
+os_write(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     int fd;
     Py_buffer data = {NULL, NULL};
     Py_ssize_t _return_value;
 
-    if (!PyArg_ParseTuple(args, "iy*:write",
+    if (!_PyArg_NoStackKeywords("write", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "iy*:write",
         &fd, &data))
         goto exit;
     _return_value = os_write_impl(module, fd, &data);
@@ -3563,19 +3607,19 @@ PyDoc_STRVAR(os_fstat__doc__,
 "Equivalent to os.stat(fd).");
 
 #define OS_FSTAT_METHODDEF    \
-    {"fstat", (PyCFunction)os_fstat, METH_VARARGS|METH_KEYWORDS, os_fstat__doc__},
+    {"fstat", (PyCFunction)os_fstat, METH_FASTCALL, os_fstat__doc__},
 
 static PyObject *
 os_fstat_impl(PyModuleDef *module, int fd);
 
 static PyObject *
-os_fstat(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_fstat(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"fd", NULL};
     int fd;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i:fstat", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "i:fstat", _keywords,
         &fd))
         goto exit;
     return_value = os_fstat_impl(module, fd);
@@ -3690,20 +3734,22 @@ PyDoc_STRVAR(os_writev__doc__,
 "buffers must be a sequence of bytes-like objects.");
 
 #define OS_WRITEV_METHODDEF    \
-    {"writev", (PyCFunction)os_writev, METH_VARARGS, os_writev__doc__},
+    {"writev", (PyCFunction)os_writev, METH_FASTCALL, os_writev__doc__},
 
 static Py_ssize_t
 os_writev_impl(PyModuleDef *module, int fd, PyObject *buffers);
 
 static PyObject *
-os_writev(PyModuleDef *module, PyObject *args)
+os_writev(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     int fd;
     PyObject *buffers;
     Py_ssize_t _return_value;
 
-    if (!PyArg_ParseTuple(args, "iO:writev",
+    if (!_PyArg_NoStackKeywords("writev", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "iO:writev",
         &fd, &buffers))
         goto exit;
     _return_value = os_writev_impl(module, fd, buffers);
@@ -3730,14 +3776,14 @@ PyDoc_STRVAR(os_pwrite__doc__,
 "current file offset.");
 
 #define OS_PWRITE_METHODDEF    \
-    {"pwrite", (PyCFunction)os_pwrite, METH_VARARGS, os_pwrite__doc__},
+    {"pwrite", (PyCFunction)os_pwrite, METH_FASTCALL, os_pwrite__doc__},
 
 static Py_ssize_t
 os_pwrite_impl(PyModuleDef *module, int fd, Py_buffer *buffer,
                Py_off_t offset);
 
 static PyObject *
-os_pwrite(PyModuleDef *module, PyObject *args)
+os_pwrite(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     int fd;
@@ -3745,7 +3791,9 @@ os_pwrite(PyModuleDef *module, PyObject *args)
     Py_off_t offset;
     Py_ssize_t _return_value;
 
-    if (!PyArg_ParseTuple(args, "iy*O&:pwrite",
+    if (!_PyArg_NoStackKeywords("pwrite", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "iy*O&:pwrite",
         &fd, &buffer, Py_off_t_converter, &offset))
         goto exit;
     _return_value = os_pwrite_impl(module, fd, &buffer, offset);
@@ -3777,13 +3825,13 @@ PyDoc_STRVAR(os_mkfifo__doc__,
 "  If it is unavailable, using it will raise a NotImplementedError.");
 
 #define OS_MKFIFO_METHODDEF    \
-    {"mkfifo", (PyCFunction)os_mkfifo, METH_VARARGS|METH_KEYWORDS, os_mkfifo__doc__},
+    {"mkfifo", (PyCFunction)os_mkfifo, METH_FASTCALL, os_mkfifo__doc__},
 
 static PyObject *
 os_mkfifo_impl(PyModuleDef *module, path_t *path, int mode, int dir_fd);
 
 static PyObject *
-os_mkfifo(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_mkfifo(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "mode", "dir_fd", NULL};
@@ -3791,7 +3839,7 @@ os_mkfifo(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     int mode = 438;
     int dir_fd = DEFAULT_DIR_FD;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&|i$O&:mkfifo", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&|i$O&:mkfifo", _keywords,
         path_converter, &path, &mode, MKFIFOAT_DIR_FD_CONVERTER, &dir_fd))
         goto exit;
     return_value = os_mkfifo_impl(module, &path, mode, dir_fd);
@@ -3826,14 +3874,14 @@ PyDoc_STRVAR(os_mknod__doc__,
 "  If it is unavailable, using it will raise a NotImplementedError.");
 
 #define OS_MKNOD_METHODDEF    \
-    {"mknod", (PyCFunction)os_mknod, METH_VARARGS|METH_KEYWORDS, os_mknod__doc__},
+    {"mknod", (PyCFunction)os_mknod, METH_FASTCALL, os_mknod__doc__},
 
 static PyObject *
 os_mknod_impl(PyModuleDef *module, path_t *path, int mode, dev_t device,
               int dir_fd);
 
 static PyObject *
-os_mknod(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_mknod(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "mode", "device", "dir_fd", NULL};
@@ -3842,7 +3890,7 @@ os_mknod(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     dev_t device = 0;
     int dir_fd = DEFAULT_DIR_FD;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&|iO&$O&:mknod", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&|iO&$O&:mknod", _keywords,
         path_converter, &path, &mode, _Py_Dev_Converter, &device, MKNODAT_DIR_FD_CONVERTER, &dir_fd))
         goto exit;
     return_value = os_mknod_impl(module, &path, mode, device, dir_fd);
@@ -3933,20 +3981,22 @@ PyDoc_STRVAR(os_makedev__doc__,
 "Composes a raw device number from the major and minor device numbers.");
 
 #define OS_MAKEDEV_METHODDEF    \
-    {"makedev", (PyCFunction)os_makedev, METH_VARARGS, os_makedev__doc__},
+    {"makedev", (PyCFunction)os_makedev, METH_FASTCALL, os_makedev__doc__},
 
 static dev_t
 os_makedev_impl(PyModuleDef *module, int major, int minor);
 
 static PyObject *
-os_makedev(PyModuleDef *module, PyObject *args)
+os_makedev(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     int major;
     int minor;
     dev_t _return_value;
 
-    if (!PyArg_ParseTuple(args, "ii:makedev",
+    if (!_PyArg_NoStackKeywords("makedev", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "ii:makedev",
         &major, &minor))
         goto exit;
     _return_value = os_makedev_impl(module, major, minor);
@@ -3969,19 +4019,21 @@ PyDoc_STRVAR(os_ftruncate__doc__,
 "Truncate a file, specified by file descriptor, to a specific length.");
 
 #define OS_FTRUNCATE_METHODDEF    \
-    {"ftruncate", (PyCFunction)os_ftruncate, METH_VARARGS, os_ftruncate__doc__},
+    {"ftruncate", (PyCFunction)os_ftruncate, METH_FASTCALL, os_ftruncate__doc__},
 
 static PyObject *
 os_ftruncate_impl(PyModuleDef *module, int fd, Py_off_t length);
 
 static PyObject *
-os_ftruncate(PyModuleDef *module, PyObject *args)
+os_ftruncate(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     int fd;
     Py_off_t length;
 
-    if (!PyArg_ParseTuple(args, "iO&:ftruncate",
+    if (!_PyArg_NoStackKeywords("ftruncate", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "iO&:ftruncate",
         &fd, Py_off_t_converter, &length))
         goto exit;
     return_value = os_ftruncate_impl(module, fd, length);
@@ -4004,20 +4056,20 @@ PyDoc_STRVAR(os_truncate__doc__,
 "  If this functionality is unavailable, using it raises an exception.");
 
 #define OS_TRUNCATE_METHODDEF    \
-    {"truncate", (PyCFunction)os_truncate, METH_VARARGS|METH_KEYWORDS, os_truncate__doc__},
+    {"truncate", (PyCFunction)os_truncate, METH_FASTCALL, os_truncate__doc__},
 
 static PyObject *
 os_truncate_impl(PyModuleDef *module, path_t *path, Py_off_t length);
 
 static PyObject *
-os_truncate(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_truncate(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "length", NULL};
     path_t path = PATH_T_INITIALIZE("truncate", "path", 0, PATH_HAVE_FTRUNCATE);
     Py_off_t length;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&O&:truncate", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&O&:truncate", _keywords,
         path_converter, &path, Py_off_t_converter, &length))
         goto exit;
     return_value = os_truncate_impl(module, &path, length);
@@ -4043,21 +4095,23 @@ PyDoc_STRVAR(os_posix_fallocate__doc__,
 "starting at offset bytes from the beginning and continuing for length bytes.");
 
 #define OS_POSIX_FALLOCATE_METHODDEF    \
-    {"posix_fallocate", (PyCFunction)os_posix_fallocate, METH_VARARGS, os_posix_fallocate__doc__},
+    {"posix_fallocate", (PyCFunction)os_posix_fallocate, METH_FASTCALL, os_posix_fallocate__doc__},
 
 static PyObject *
 os_posix_fallocate_impl(PyModuleDef *module, int fd, Py_off_t offset,
                         Py_off_t length);
 
 static PyObject *
-os_posix_fallocate(PyModuleDef *module, PyObject *args)
+os_posix_fallocate(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     int fd;
     Py_off_t offset;
     Py_off_t length;
 
-    if (!PyArg_ParseTuple(args, "iO&O&:posix_fallocate",
+    if (!_PyArg_NoStackKeywords("posix_fallocate", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "iO&O&:posix_fallocate",
         &fd, Py_off_t_converter, &offset, Py_off_t_converter, &length))
         goto exit;
     return_value = os_posix_fallocate_impl(module, fd, offset, length);
@@ -4085,14 +4139,14 @@ PyDoc_STRVAR(os_posix_fadvise__doc__,
 "POSIX_FADV_DONTNEED.");
 
 #define OS_POSIX_FADVISE_METHODDEF    \
-    {"posix_fadvise", (PyCFunction)os_posix_fadvise, METH_VARARGS, os_posix_fadvise__doc__},
+    {"posix_fadvise", (PyCFunction)os_posix_fadvise, METH_FASTCALL, os_posix_fadvise__doc__},
 
 static PyObject *
 os_posix_fadvise_impl(PyModuleDef *module, int fd, Py_off_t offset,
                       Py_off_t length, int advice);
 
 static PyObject *
-os_posix_fadvise(PyModuleDef *module, PyObject *args)
+os_posix_fadvise(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     int fd;
@@ -4100,7 +4154,9 @@ os_posix_fadvise(PyModuleDef *module, PyObject *args)
     Py_off_t length;
     int advice;
 
-    if (!PyArg_ParseTuple(args, "iO&O&i:posix_fadvise",
+    if (!_PyArg_NoStackKeywords("posix_fadvise", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "iO&O&i:posix_fadvise",
         &fd, Py_off_t_converter, &offset, Py_off_t_converter, &length, &advice))
         goto exit;
     return_value = os_posix_fadvise_impl(module, fd, offset, length, advice);
@@ -4120,19 +4176,21 @@ PyDoc_STRVAR(os_putenv__doc__,
 "Change or add an environment variable.");
 
 #define OS_PUTENV_METHODDEF    \
-    {"putenv", (PyCFunction)os_putenv, METH_VARARGS, os_putenv__doc__},
+    {"putenv", (PyCFunction)os_putenv, METH_FASTCALL, os_putenv__doc__},
 
 static PyObject *
 os_putenv_impl(PyModuleDef *module, PyObject *name, PyObject *value);
 
 static PyObject *
-os_putenv(PyModuleDef *module, PyObject *args)
+os_putenv(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     PyObject *name;
     PyObject *value;
 
-    if (!PyArg_ParseTuple(args, "UU:putenv",
+    if (!_PyArg_NoStackKeywords("putenv", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "UU:putenv",
         &name, &value))
         goto exit;
     return_value = os_putenv_impl(module, name, value);
@@ -4152,19 +4210,21 @@ PyDoc_STRVAR(os_putenv__doc__,
 "Change or add an environment variable.");
 
 #define OS_PUTENV_METHODDEF    \
-    {"putenv", (PyCFunction)os_putenv, METH_VARARGS, os_putenv__doc__},
+    {"putenv", (PyCFunction)os_putenv, METH_FASTCALL, os_putenv__doc__},
 
 static PyObject *
 os_putenv_impl(PyModuleDef *module, PyObject *name, PyObject *value);
 
 static PyObject *
-os_putenv(PyModuleDef *module, PyObject *args)
+os_putenv(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     PyObject *name = NULL;
     PyObject *value = NULL;
 
-    if (!PyArg_ParseTuple(args, "O&O&:putenv",
+    if (!_PyArg_NoStackKeywords("putenv", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "O&O&:putenv",
         PyUnicode_FSConverter, &name, PyUnicode_FSConverter, &value))
         goto exit;
     return_value = os_putenv_impl(module, name, value);
@@ -4285,20 +4345,20 @@ PyDoc_STRVAR(os_WIFCONTINUED__doc__,
 "job control stop.");
 
 #define OS_WIFCONTINUED_METHODDEF    \
-    {"WIFCONTINUED", (PyCFunction)os_WIFCONTINUED, METH_VARARGS|METH_KEYWORDS, os_WIFCONTINUED__doc__},
+    {"WIFCONTINUED", (PyCFunction)os_WIFCONTINUED, METH_FASTCALL, os_WIFCONTINUED__doc__},
 
 static int
 os_WIFCONTINUED_impl(PyModuleDef *module, int status);
 
 static PyObject *
-os_WIFCONTINUED(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_WIFCONTINUED(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"status", NULL};
     int status;
     int _return_value;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i:WIFCONTINUED", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "i:WIFCONTINUED", _keywords,
         &status))
         goto exit;
     _return_value = os_WIFCONTINUED_impl(module, status);
@@ -4321,20 +4381,20 @@ PyDoc_STRVAR(os_WIFSTOPPED__doc__,
 "Return True if the process returning status was stopped.");
 
 #define OS_WIFSTOPPED_METHODDEF    \
-    {"WIFSTOPPED", (PyCFunction)os_WIFSTOPPED, METH_VARARGS|METH_KEYWORDS, os_WIFSTOPPED__doc__},
+    {"WIFSTOPPED", (PyCFunction)os_WIFSTOPPED, METH_FASTCALL, os_WIFSTOPPED__doc__},
 
 static int
 os_WIFSTOPPED_impl(PyModuleDef *module, int status);
 
 static PyObject *
-os_WIFSTOPPED(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_WIFSTOPPED(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"status", NULL};
     int status;
     int _return_value;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i:WIFSTOPPED", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "i:WIFSTOPPED", _keywords,
         &status))
         goto exit;
     _return_value = os_WIFSTOPPED_impl(module, status);
@@ -4357,20 +4417,20 @@ PyDoc_STRVAR(os_WIFSIGNALED__doc__,
 "Return True if the process returning status was terminated by a signal.");
 
 #define OS_WIFSIGNALED_METHODDEF    \
-    {"WIFSIGNALED", (PyCFunction)os_WIFSIGNALED, METH_VARARGS|METH_KEYWORDS, os_WIFSIGNALED__doc__},
+    {"WIFSIGNALED", (PyCFunction)os_WIFSIGNALED, METH_FASTCALL, os_WIFSIGNALED__doc__},
 
 static int
 os_WIFSIGNALED_impl(PyModuleDef *module, int status);
 
 static PyObject *
-os_WIFSIGNALED(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_WIFSIGNALED(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"status", NULL};
     int status;
     int _return_value;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i:WIFSIGNALED", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "i:WIFSIGNALED", _keywords,
         &status))
         goto exit;
     _return_value = os_WIFSIGNALED_impl(module, status);
@@ -4393,20 +4453,20 @@ PyDoc_STRVAR(os_WIFEXITED__doc__,
 "Return True if the process returning status exited via the exit() system call.");
 
 #define OS_WIFEXITED_METHODDEF    \
-    {"WIFEXITED", (PyCFunction)os_WIFEXITED, METH_VARARGS|METH_KEYWORDS, os_WIFEXITED__doc__},
+    {"WIFEXITED", (PyCFunction)os_WIFEXITED, METH_FASTCALL, os_WIFEXITED__doc__},
 
 static int
 os_WIFEXITED_impl(PyModuleDef *module, int status);
 
 static PyObject *
-os_WIFEXITED(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_WIFEXITED(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"status", NULL};
     int status;
     int _return_value;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i:WIFEXITED", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "i:WIFEXITED", _keywords,
         &status))
         goto exit;
     _return_value = os_WIFEXITED_impl(module, status);
@@ -4429,20 +4489,20 @@ PyDoc_STRVAR(os_WEXITSTATUS__doc__,
 "Return the process return code from status.");
 
 #define OS_WEXITSTATUS_METHODDEF    \
-    {"WEXITSTATUS", (PyCFunction)os_WEXITSTATUS, METH_VARARGS|METH_KEYWORDS, os_WEXITSTATUS__doc__},
+    {"WEXITSTATUS", (PyCFunction)os_WEXITSTATUS, METH_FASTCALL, os_WEXITSTATUS__doc__},
 
 static int
 os_WEXITSTATUS_impl(PyModuleDef *module, int status);
 
 static PyObject *
-os_WEXITSTATUS(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_WEXITSTATUS(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"status", NULL};
     int status;
     int _return_value;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i:WEXITSTATUS", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "i:WEXITSTATUS", _keywords,
         &status))
         goto exit;
     _return_value = os_WEXITSTATUS_impl(module, status);
@@ -4465,20 +4525,20 @@ PyDoc_STRVAR(os_WTERMSIG__doc__,
 "Return the signal that terminated the process that provided the status value.");
 
 #define OS_WTERMSIG_METHODDEF    \
-    {"WTERMSIG", (PyCFunction)os_WTERMSIG, METH_VARARGS|METH_KEYWORDS, os_WTERMSIG__doc__},
+    {"WTERMSIG", (PyCFunction)os_WTERMSIG, METH_FASTCALL, os_WTERMSIG__doc__},
 
 static int
 os_WTERMSIG_impl(PyModuleDef *module, int status);
 
 static PyObject *
-os_WTERMSIG(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_WTERMSIG(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"status", NULL};
     int status;
     int _return_value;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i:WTERMSIG", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "i:WTERMSIG", _keywords,
         &status))
         goto exit;
     _return_value = os_WTERMSIG_impl(module, status);
@@ -4501,20 +4561,20 @@ PyDoc_STRVAR(os_WSTOPSIG__doc__,
 "Return the signal that stopped the process that provided the status value.");
 
 #define OS_WSTOPSIG_METHODDEF    \
-    {"WSTOPSIG", (PyCFunction)os_WSTOPSIG, METH_VARARGS|METH_KEYWORDS, os_WSTOPSIG__doc__},
+    {"WSTOPSIG", (PyCFunction)os_WSTOPSIG, METH_FASTCALL, os_WSTOPSIG__doc__},
 
 static int
 os_WSTOPSIG_impl(PyModuleDef *module, int status);
 
 static PyObject *
-os_WSTOPSIG(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_WSTOPSIG(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"status", NULL};
     int status;
     int _return_value;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i:WSTOPSIG", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "i:WSTOPSIG", _keywords,
         &status))
         goto exit;
     _return_value = os_WSTOPSIG_impl(module, status);
@@ -4573,19 +4633,19 @@ PyDoc_STRVAR(os_statvfs__doc__,
 "  If this functionality is unavailable, using it raises an exception.");
 
 #define OS_STATVFS_METHODDEF    \
-    {"statvfs", (PyCFunction)os_statvfs, METH_VARARGS|METH_KEYWORDS, os_statvfs__doc__},
+    {"statvfs", (PyCFunction)os_statvfs, METH_FASTCALL, os_statvfs__doc__},
 
 static PyObject *
 os_statvfs_impl(PyModuleDef *module, path_t *path);
 
 static PyObject *
-os_statvfs(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_statvfs(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", NULL};
     path_t path = PATH_T_INITIALIZE("statvfs", "path", 0, PATH_HAVE_FSTATVFS);
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&:statvfs", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&:statvfs", _keywords,
         path_converter, &path))
         goto exit;
     return_value = os_statvfs_impl(module, &path);
@@ -4608,19 +4668,19 @@ PyDoc_STRVAR(os__getdiskusage__doc__,
 "Return disk usage statistics about the given path as a (total, free) tuple.");
 
 #define OS__GETDISKUSAGE_METHODDEF    \
-    {"_getdiskusage", (PyCFunction)os__getdiskusage, METH_VARARGS|METH_KEYWORDS, os__getdiskusage__doc__},
+    {"_getdiskusage", (PyCFunction)os__getdiskusage, METH_FASTCALL, os__getdiskusage__doc__},
 
 static PyObject *
 os__getdiskusage_impl(PyModuleDef *module, Py_UNICODE *path);
 
 static PyObject *
-os__getdiskusage(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os__getdiskusage(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", NULL};
     Py_UNICODE *path;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "u:_getdiskusage", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "u:_getdiskusage", _keywords,
         &path))
         goto exit;
     return_value = os__getdiskusage_impl(module, path);
@@ -4642,20 +4702,22 @@ PyDoc_STRVAR(os_fpathconf__doc__,
 "If there is no limit, return -1.");
 
 #define OS_FPATHCONF_METHODDEF    \
-    {"fpathconf", (PyCFunction)os_fpathconf, METH_VARARGS, os_fpathconf__doc__},
+    {"fpathconf", (PyCFunction)os_fpathconf, METH_FASTCALL, os_fpathconf__doc__},
 
 static long
 os_fpathconf_impl(PyModuleDef *module, int fd, int name);
 
 static PyObject *
-os_fpathconf(PyModuleDef *module, PyObject *args)
+os_fpathconf(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     int fd;
     int name;
     long _return_value;
 
-    if (!PyArg_ParseTuple(args, "iO&:fpathconf",
+    if (!_PyArg_NoStackKeywords("fpathconf", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "iO&:fpathconf",
         &fd, conv_path_confname, &name))
         goto exit;
     _return_value = os_fpathconf_impl(module, fd, name);
@@ -4682,13 +4744,13 @@ PyDoc_STRVAR(os_pathconf__doc__,
 "  If this functionality is unavailable, using it raises an exception.");
 
 #define OS_PATHCONF_METHODDEF    \
-    {"pathconf", (PyCFunction)os_pathconf, METH_VARARGS|METH_KEYWORDS, os_pathconf__doc__},
+    {"pathconf", (PyCFunction)os_pathconf, METH_FASTCALL, os_pathconf__doc__},
 
 static long
 os_pathconf_impl(PyModuleDef *module, path_t *path, int name);
 
 static PyObject *
-os_pathconf(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_pathconf(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "name", NULL};
@@ -4696,7 +4758,7 @@ os_pathconf(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     int name;
     long _return_value;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&O&:pathconf", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&O&:pathconf", _keywords,
         path_converter, &path, conv_path_confname, &name))
         goto exit;
     _return_value = os_pathconf_impl(module, &path, name);
@@ -4834,19 +4896,19 @@ PyDoc_STRVAR(os_device_encoding__doc__,
 "If the device is not a terminal, return None.");
 
 #define OS_DEVICE_ENCODING_METHODDEF    \
-    {"device_encoding", (PyCFunction)os_device_encoding, METH_VARARGS|METH_KEYWORDS, os_device_encoding__doc__},
+    {"device_encoding", (PyCFunction)os_device_encoding, METH_FASTCALL, os_device_encoding__doc__},
 
 static PyObject *
 os_device_encoding_impl(PyModuleDef *module, int fd);
 
 static PyObject *
-os_device_encoding(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_device_encoding(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"fd", NULL};
     int fd;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i:device_encoding", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "i:device_encoding", _keywords,
         &fd))
         goto exit;
     return_value = os_device_encoding_impl(module, fd);
@@ -4864,20 +4926,22 @@ PyDoc_STRVAR(os_setresuid__doc__,
 "Set the current process\'s real, effective, and saved user ids.");
 
 #define OS_SETRESUID_METHODDEF    \
-    {"setresuid", (PyCFunction)os_setresuid, METH_VARARGS, os_setresuid__doc__},
+    {"setresuid", (PyCFunction)os_setresuid, METH_FASTCALL, os_setresuid__doc__},
 
 static PyObject *
 os_setresuid_impl(PyModuleDef *module, uid_t ruid, uid_t euid, uid_t suid);
 
 static PyObject *
-os_setresuid(PyModuleDef *module, PyObject *args)
+os_setresuid(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     uid_t ruid;
     uid_t euid;
     uid_t suid;
 
-    if (!PyArg_ParseTuple(args, "O&O&O&:setresuid",
+    if (!_PyArg_NoStackKeywords("setresuid", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "O&O&O&:setresuid",
         _Py_Uid_Converter, &ruid, _Py_Uid_Converter, &euid, _Py_Uid_Converter, &suid))
         goto exit;
     return_value = os_setresuid_impl(module, ruid, euid, suid);
@@ -4897,20 +4961,22 @@ PyDoc_STRVAR(os_setresgid__doc__,
 "Set the current process\'s real, effective, and saved group ids.");
 
 #define OS_SETRESGID_METHODDEF    \
-    {"setresgid", (PyCFunction)os_setresgid, METH_VARARGS, os_setresgid__doc__},
+    {"setresgid", (PyCFunction)os_setresgid, METH_FASTCALL, os_setresgid__doc__},
 
 static PyObject *
 os_setresgid_impl(PyModuleDef *module, gid_t rgid, gid_t egid, gid_t sgid);
 
 static PyObject *
-os_setresgid(PyModuleDef *module, PyObject *args)
+os_setresgid(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     gid_t rgid;
     gid_t egid;
     gid_t sgid;
 
-    if (!PyArg_ParseTuple(args, "O&O&O&:setresgid",
+    if (!_PyArg_NoStackKeywords("setresgid", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "O&O&O&:setresgid",
         _Py_Gid_Converter, &rgid, _Py_Gid_Converter, &egid, _Py_Gid_Converter, &sgid))
         goto exit;
     return_value = os_setresgid_impl(module, rgid, egid, sgid);
@@ -4979,14 +5045,14 @@ PyDoc_STRVAR(os_getxattr__doc__,
 "  the link points to.");
 
 #define OS_GETXATTR_METHODDEF    \
-    {"getxattr", (PyCFunction)os_getxattr, METH_VARARGS|METH_KEYWORDS, os_getxattr__doc__},
+    {"getxattr", (PyCFunction)os_getxattr, METH_FASTCALL, os_getxattr__doc__},
 
 static PyObject *
 os_getxattr_impl(PyModuleDef *module, path_t *path, path_t *attribute,
                  int follow_symlinks);
 
 static PyObject *
-os_getxattr(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_getxattr(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "attribute", "follow_symlinks", NULL};
@@ -4994,7 +5060,7 @@ os_getxattr(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     path_t attribute = PATH_T_INITIALIZE("getxattr", "attribute", 0, 0);
     int follow_symlinks = 1;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&O&|$p:getxattr", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&O&|$p:getxattr", _keywords,
         path_converter, &path, path_converter, &attribute, &follow_symlinks))
         goto exit;
     return_value = os_getxattr_impl(module, &path, &attribute, follow_symlinks);
@@ -5025,14 +5091,14 @@ PyDoc_STRVAR(os_setxattr__doc__,
 "  the link points to.");
 
 #define OS_SETXATTR_METHODDEF    \
-    {"setxattr", (PyCFunction)os_setxattr, METH_VARARGS|METH_KEYWORDS, os_setxattr__doc__},
+    {"setxattr", (PyCFunction)os_setxattr, METH_FASTCALL, os_setxattr__doc__},
 
 static PyObject *
 os_setxattr_impl(PyModuleDef *module, path_t *path, path_t *attribute,
                  Py_buffer *value, int flags, int follow_symlinks);
 
 static PyObject *
-os_setxattr(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_setxattr(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "attribute", "value", "flags", "follow_symlinks", NULL};
@@ -5042,7 +5108,7 @@ os_setxattr(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     int flags = 0;
     int follow_symlinks = 1;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&O&y*|i$p:setxattr", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&O&y*|i$p:setxattr", _keywords,
         path_converter, &path, path_converter, &attribute, &value, &flags, &follow_symlinks))
         goto exit;
     return_value = os_setxattr_impl(module, &path, &attribute, &value, flags, follow_symlinks);
@@ -5075,14 +5141,14 @@ PyDoc_STRVAR(os_removexattr__doc__,
 "  the link points to.");
 
 #define OS_REMOVEXATTR_METHODDEF    \
-    {"removexattr", (PyCFunction)os_removexattr, METH_VARARGS|METH_KEYWORDS, os_removexattr__doc__},
+    {"removexattr", (PyCFunction)os_removexattr, METH_FASTCALL, os_removexattr__doc__},
 
 static PyObject *
 os_removexattr_impl(PyModuleDef *module, path_t *path, path_t *attribute,
                     int follow_symlinks);
 
 static PyObject *
-os_removexattr(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_removexattr(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "attribute", "follow_symlinks", NULL};
@@ -5090,7 +5156,7 @@ os_removexattr(PyModuleDef *module, PyObject *args, PyObject *kwargs)
     path_t attribute = PATH_T_INITIALIZE("removexattr", "attribute", 0, 0);
     int follow_symlinks = 1;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&O&|$p:removexattr", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "O&O&|$p:removexattr", _keywords,
         path_converter, &path, path_converter, &attribute, &follow_symlinks))
         goto exit;
     return_value = os_removexattr_impl(module, &path, &attribute, follow_symlinks);
@@ -5121,20 +5187,20 @@ PyDoc_STRVAR(os_listxattr__doc__,
 "  the link points to.");
 
 #define OS_LISTXATTR_METHODDEF    \
-    {"listxattr", (PyCFunction)os_listxattr, METH_VARARGS|METH_KEYWORDS, os_listxattr__doc__},
+    {"listxattr", (PyCFunction)os_listxattr, METH_FASTCALL, os_listxattr__doc__},
 
 static PyObject *
 os_listxattr_impl(PyModuleDef *module, path_t *path, int follow_symlinks);
 
 static PyObject *
-os_listxattr(PyModuleDef *module, PyObject *args, PyObject *kwargs)
+os_listxattr(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     static char *_keywords[] = {"path", "follow_symlinks", NULL};
     path_t path = PATH_T_INITIALIZE("listxattr", "path", 1, 1);
     int follow_symlinks = 1;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O&$p:listxattr", _keywords,
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, "|O&$p:listxattr", _keywords,
         path_converter, &path, &follow_symlinks))
         goto exit;
     return_value = os_listxattr_impl(module, &path, follow_symlinks);
@@ -5233,19 +5299,21 @@ PyDoc_STRVAR(os_set_inheritable__doc__,
 "Set the inheritable flag of the specified file descriptor.");
 
 #define OS_SET_INHERITABLE_METHODDEF    \
-    {"set_inheritable", (PyCFunction)os_set_inheritable, METH_VARARGS, os_set_inheritable__doc__},
+    {"set_inheritable", (PyCFunction)os_set_inheritable, METH_FASTCALL, os_set_inheritable__doc__},
 
 static PyObject *
 os_set_inheritable_impl(PyModuleDef *module, int fd, int inheritable);
 
 static PyObject *
-os_set_inheritable(PyModuleDef *module, PyObject *args)
+os_set_inheritable(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     int fd;
     int inheritable;
 
-    if (!PyArg_ParseTuple(args, "ii:set_inheritable",
+    if (!_PyArg_NoStackKeywords("set_inheritable", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "ii:set_inheritable",
         &fd, &inheritable))
         goto exit;
     return_value = os_set_inheritable_impl(module, fd, inheritable);
@@ -5297,20 +5365,22 @@ PyDoc_STRVAR(os_set_handle_inheritable__doc__,
 "Set the inheritable flag of the specified handle.");
 
 #define OS_SET_HANDLE_INHERITABLE_METHODDEF    \
-    {"set_handle_inheritable", (PyCFunction)os_set_handle_inheritable, METH_VARARGS, os_set_handle_inheritable__doc__},
+    {"set_handle_inheritable", (PyCFunction)os_set_handle_inheritable, METH_FASTCALL, os_set_handle_inheritable__doc__},
 
 static PyObject *
 os_set_handle_inheritable_impl(PyModuleDef *module, Py_intptr_t handle,
                                int inheritable);
 
 static PyObject *
-os_set_handle_inheritable(PyModuleDef *module, PyObject *args)
+os_set_handle_inheritable(PyModuleDef *module, PyObject **args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
     Py_intptr_t handle;
     int inheritable;
 
-    if (!PyArg_ParseTuple(args, "" _Py_PARSE_INTPTR "p:set_handle_inheritable",
+    if (!_PyArg_NoStackKeywords("set_handle_inheritable", kwnames))
+        goto exit;
+    if (!_PyArg_ParseStack(args, nargs, "" _Py_PARSE_INTPTR "p:set_handle_inheritable",
         &handle, &inheritable))
         goto exit;
     return_value = os_set_handle_inheritable_impl(module, handle, inheritable);
@@ -5792,4 +5862,4 @@ exit:
 #ifndef OS_SET_HANDLE_INHERITABLE_METHODDEF
     #define OS_SET_HANDLE_INHERITABLE_METHODDEF
 #endif /* !defined(OS_SET_HANDLE_INHERITABLE_METHODDEF) */
-/*[clinic end generated code: output=a5c9bef9ad11a20b input=a9049054013a1b77]*/
+/*[clinic end generated code: output=23a2d67c7085a912 input=a9049054013a1b77]*/
@@ -60,6 +60,32 @@ static int enabled = 1; /* automatic collection enabled? */
 /* true if we are currently running the collector */
 static int collecting = 0;
 
+#ifdef WITHOUT_GIL
+/* Without the GIL, gc_lock protects the generation lists against threads
+   tracking and untracking objects concurrently, as well as the allocation
+   count and the `collecting` flag.  The collector itself doesn't hold it:
+   it stops the world instead (see _PyEval_StopTheWorld()), so that no other
+   thread can touch the objects being examined.
+
+   This is a plain spinlock rather than a _PyLock: a thread waiting for a
+   _PyLock may detach from the interpreter, and a thread deallocating an
+   object must not let a collection run before it has untracked it. */
+#ifdef HAVE_SCHED_H
+#include <sched.h>
+#define GC_LOCK_YIELD() sched_yield()
+#else
+#define GC_LOCK_YIELD()
+#endif
+static int gc_lock = 0;
+#define GC_LOCK() \
+    while (__atomic_exchange_n(&gc_lock, 1, __ATOMIC_ACQUIRE)) \
+        GC_LOCK_YIELD()
+#define GC_UNLOCK() __atomic_store_n(&gc_lock, 0, __ATOMIC_RELEASE)
+#else
+#define GC_LOCK()
+#define GC_UNLOCK()
+#endif
+
 /* list of uncollectable objects */
 static PyObject *garbage = NULL;
 
@@ -158,6 +184,83 @@ static Py_ssize_t long_lived_pending = 0;
    the algorithm was refined in response to issue #14775.
 */
 
+/*
+   NOTE: about incremental collection of the oldest generation.
+
+   A full collection examines every tracked object in one go, so its pause
+   grows with the heap.  When a pause target is set with
+   gc.set_pause_target(), automatic collections of the oldest generation
+   are split into increments instead.  Each increment collects the younger
+   generations together with a slice of the oldest one, sized so that the
+   collection should take about the pause target.
+
+   Collecting any subset of the tracked objects is safe: references from
+   outside the subset keep its objects alive, exactly as references from
+   older generations keep young objects alive.  Each increment is a complete
+   collection of its own subset, run with the world stopped, so the mutator
+   never sees a half-examined increment and no write barrier is needed.
+
+   To find garbage cycles, an increment must hold whole cycles.  So the
+   slice is not just the head of the oldest generation:  fill_increment()
+   takes a "seed" from the head of the oldest generation and pulls in,
+   transitively, every object of the oldest generation it refers to,
+   before taking the next seed.  Objects surviving an increment move to
+   the gc_visited list and are marked with the visited bit of gc_refs.
+   Visited objects are not pulled in again, so the types, module dicts and
+   other hubs that almost every object refers to are only scanned once
+   per pass.  When the oldest generation is empty, the pass is over:
+   gc_visited becomes the oldest generation again, and the meaning of the
+   visited bit is flipped so that no object needs to be touched.
+
+   The mutator keeps promoting objects to the oldest generation during a
+   pass.  For passes to end, an increment examines at least twice as many
+   objects as were promoted since the previous increment, even if that
+   takes longer than the pause target.
+
+   A garbage structure larger than an increment cannot be collected that
+   way.  If an increment had to stop before the closure of its seeds was
+   complete, a full collection follows the end of the pass, as long as
+   the number of objects promoted since the last full collection passes
+   the 25% ratio described above.  So incremental mode never runs more
+   full collections than the default mode.
+
+   Explicit collections (gc.collect() and PyGC_Collect()) are always full.
+*/
+
+/* Pause target of incremental collections in nanoseconds, 0 if automatic
+   collections of the oldest generation are full collections. */
+static _PyTime_t pause_target = 0;
+
+/* Objects of the oldest generation that survived an increment of the
+   current pass */
+static PyGC_Head gc_visited = {{&gc_visited, &gc_visited, 0}};
+
+/* Value of the _PyGC_REFS_MASK_VISITED bit of visited objects.  It is
+   flipped at the end of each pass. */
+static Py_ssize_t visited_mask = 0;
+
+/* Number of objects surviving the increments of the current pass */
+static Py_ssize_t pass_survivors = 0;
+
+/* Number of objects promoted to the oldest generation since the last
+   increment, and since the last full collection */
+static Py_ssize_t promoted_since_increment = 0;
+static Py_ssize_t promoted_since_full = 0;
+
+/* Set if an increment of the current pass was truncated, and a full
+   collection is needed at the end of the pass */
+static int increment_truncated = 0;
+static int full_collection_needed = 0;
+
+/* Objects examined per nanosecond, measured during the last increment */
+static double increment_speed = 0.0;
+
+/* Increments never examine fewer objects than this */
+#define MIN_INCREMENT_SIZE 10000
+
+#define GC_IS_VISITED(g) \
+    (((g)->gc.gc_refs & _PyGC_REFS_MASK_VISITED) == visited_mask)
+
 /* set for debugging information */
 #define DEBUG_STATS             (1<<0) /* print collection statistics */
 #define DEBUG_COLLECTABLE       (1<<1) /* print collectable objects */
@@ -243,8 +346,7 @@ gc_list_is_empty(PyGC_Head *list)
     return (list->gc.gc_next == list);
 }
 
-#if 0
-/* This became unused after gc_list_move() was introduced. */
+#ifdef WITHOUT_GIL
 /* Append `node` to `list`. */
 static void
 gc_list_append(PyGC_Head *node, PyGC_Head *list)
@@ -329,6 +431,23 @@ append_objects(PyObject *py_list, PyGC_Head *gc_list)
     return 0;
 }
 
+/* Set or clear the visited bit of all objects in a GC list, and return the
+ * size of the list.
+ */
+static Py_ssize_t
+gc_list_set_visited(PyGC_Head *list, int visited)
+{
+    PyGC_Head *gc;
+    Py_ssize_t mask = visited ? visited_mask
+                              : visited_mask ^ _PyGC_REFS_MASK_VISITED;
+    Py_ssize_t n = 0;
+    for (gc = list->gc.gc_next; gc != list; gc = gc->gc.gc_next) {
+        gc->gc.gc_refs = (gc->gc.gc_refs & ~_PyGC_REFS_MASK_VISITED) | mask;
+        n++;
+    }
+    return n;
+}
+
 /*** end of list stuff ***/
 
 
@@ -506,6 +625,85 @@ move_unreachable(PyGC_Head *young, PyGC_Head *unreachable)
     }
 }
 
+struct increment_state {
+    PyGC_Head *increment;
+    /* number of objects which can still be moved to the increment */
+    Py_ssize_t room;
+};
+
+/* A traversal callback for fill_increment. */
+static int
+visit_pending(PyObject *op, struct increment_state *state)
+{
+    if (PyObject_IS_GC(op)) {
+        PyGC_Head *gc = AS_GC(op);
+        /* Objects already in the increment have positive gc_refs, and
+         * all tracked objects outside it are GC_REACHABLE:  pull in those
+         * which weren't scanned during this pass yet.
+         */
+        if (_PyGCHead_REFS(gc) == GC_REACHABLE && !GC_IS_VISITED(gc)) {
+            if (state->room == 0) {
+                increment_truncated = 1;
+                return 0;
+            }
+            gc_list_move(gc, state->increment);
+            _PyGCHead_SET_REFS(gc, Py_REFCNT(op));
+            assert(_PyGCHead_REFS(gc) != 0);
+            state->room--;
+        }
+    }
+    return 0;
+}
+
+/* Move up to `budget` objects of the oldest generation to the increment,
+ * which already holds the younger generations.  Like update_refs(), set
+ * gc_refs = ob_refcnt for every object moved.  See the note about
+ * incremental collection at the top of the file.
+ */
+static void
+fill_increment(PyGC_Head *increment, Py_ssize_t budget)
+{
+    PyGC_Head *pending = GEN_HEAD(NUM_GENERATIONS - 1);
+    /* the closure of the younger generations isn't pulled in:  start
+       scanning after them */
+    PyGC_Head *gc = increment->gc.gc_prev;
+    struct increment_state state;
+
+    state.increment = increment;
+    state.room = budget;
+    for (;;) {
+        PyGC_Head *next = gc->gc.gc_next;
+        if (next == increment) {
+            /* The closure of the previous seeds is complete */
+            if (state.room == 0 || gc_list_is_empty(pending))
+                break;
+            next = pending->gc.gc_next;
+            gc_list_move(next, increment);
+            _PyGCHead_SET_REFS(next, Py_REFCNT(FROM_GC(next)));
+            assert(_PyGCHead_REFS(next) != 0);
+            state.room--;
+        }
+        gc = next;
+        (void) Py_TYPE(FROM_GC(gc))->tp_traverse(FROM_GC(gc),
+                                                 (visitproc)visit_pending,
+                                                 (void *)&state);
+    }
+}
+
+/* Size of the next increment */
+static Py_ssize_t
+increment_budget(void)
+{
+    double budget = increment_speed * (double)pause_target;
+    if (budget < MIN_INCREMENT_SIZE)
+        budget = MIN_INCREMENT_SIZE;
+    if (budget < 2.0 * promoted_since_increment)
+        budget = 2.0 * promoted_since_increment;
+    if (budget > (double)PY_SSIZE_T_MAX)
+        return PY_SSIZE_T_MAX;
+    return (Py_ssize_t)budget;
+}
+
 /* Try to untrack all currently tracked dictionaries */
 static void
 untrack_dicts(PyGC_Head *head)
@@ -895,16 +1093,20 @@ clear_freelists(void)
 }
 
 /* This is the main function.  Read this to understand how the
- * collection process works. */
+ * collection process works.  If `incremental` is true, generation must be
+ * the oldest one, and only an increment of it is collected.
+ */
 static Py_ssize_t
 collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
-        int nofail)
+        int nofail, int incremental)
 {
     int i;
     Py_ssize_t m = 0; /* # objects collected */
     Py_ssize_t n = 0; /* # unreachable objects that couldn't be collected */
     PyGC_Head *young; /* the generation we are examining */
     PyGC_Head *old; /* next older generation */
+    PyGC_Head increment; /* the objects examined by an incremental collection */
+    Py_ssize_t examined = 0; /* # objects surviving an increment */
     PyGC_Head unreachable; /* non-problematic unreachable trash */
     PyGC_Head finalizers;  /* objects with, & reachable from, __del__ */
     PyGC_Head *gc;
@@ -912,17 +1114,26 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
 
     struct gc_generation_stats *stats = &generation_stats[generation];
 
+    assert(!incremental || generation == NUM_GENERATIONS-1);
+
     if (debug & DEBUG_STATS) {
-        PySys_WriteStderr("gc: collecting generation %d...\n",
-                          generation);
+        if (incremental)
+            PySys_WriteStderr("gc: collecting an increment of "
+                              "generation %d...\n", generation);
+        else
+            PySys_WriteStderr("gc: collecting generation %d...\n",
+                              generation);
         PySys_WriteStderr("gc: objects in each generation:");
-        for (i = 0; i < NUM_GENERATIONS; i++)
+        for (i = 0; i < NUM_GENERATIONS-1; i++)
             PySys_FormatStderr(" %zd",
                               gc_list_size(GEN_HEAD(i)));
-        t1 = _PyTime_GetMonotonicClock();
-
+        PySys_FormatStderr(" %zd",
+                           gc_list_size(GEN_HEAD(NUM_GENERATIONS-1))
+                           + gc_list_size(&gc_visited));
         PySys_WriteStderr("\n");
     }
+    if ((debug & DEBUG_STATS) || incremental)
+        t1 = _PyTime_GetMonotonicClock();
 
     /* update collection and allocation counters */
     if (generation+1 < NUM_GENERATIONS)
@@ -930,24 +1141,49 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
     for (i = 0; i <= generation; i++)
         generations[i].count = 0;
 
-    /* merge younger generations with one we are currently collecting */
-    for (i = 0; i < generation; i++) {
-        gc_list_merge(GEN_HEAD(i), GEN_HEAD(generation));
+    if (incremental) {
+        /* the increment is made of the younger generations and a slice of
+           the oldest one */
+        gc_list_init(&increment);
+        for (i = 0; i < generation; i++) {
+            gc_list_merge(GEN_HEAD(i), &increment);
+        }
+        young = &increment;
+        old = &gc_visited;
+        update_refs(young);
+        fill_increment(young, increment_budget());
+        promoted_since_increment = 0;
     }
+    else {
+        if (generation == NUM_GENERATIONS-1) {
+            /* a full collection ends the current incremental pass */
+            gc_list_merge(&gc_visited, GEN_HEAD(generation));
+            pass_survivors = 0;
+            promoted_since_increment = 0;
+            promoted_since_full = 0;
+            increment_truncated = 0;
+            full_collection_needed = 0;
+        }
 
-    /* handy references */
-    young = GEN_HEAD(generation);
-    if (generation < NUM_GENERATIONS-1)
-        old = GEN_HEAD(generation+1);
-    else
-        old = young;
+        /* merge younger generations with one we are currently collecting */
+        for (i = 0; i < generation; i++) {
+            gc_list_merge(GEN_HEAD(i), GEN_HEAD(generation));
+        }
 
-    /* Using ob_refcnt and gc_refs, calculate which objects in the
-     * container set are reachable from outside the set (i.e., have a
-     * refcount greater than 0 when all the references within the
-     * set are taken into account).
-     */
-    update_refs(young);
+        /* handy references */
+        young = GEN_HEAD(generation);
+        if (generation < NUM_GENERATIONS-1)
+            old = GEN_HEAD(generation+1);
+        else
+            old = young;
+
+        /* Using ob_refcnt and gc_refs, calculate which objects in the
+         * container set are reachable from outside the set (i.e., have a
+         * refcount greater than 0 when all the references within the
+         * set are taken into account).
+         */
+        update_refs(young);
+    }
     subtract_refs(young);
 
     /* Leave everything reachable from outside young in young, and move
@@ -960,9 +1196,24 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
     move_unreachable(young, &unreachable);
 
     /* Move reachable objects to next generation. */
-    if (young != old) {
+    if (incremental) {
+        /* The surviving slice of the oldest generation is examined once
+           per pass, like in a full collection */
+        untrack_dicts(young);
+        examined = gc_list_set_visited(young, 1);
+        pass_survivors += examined;
+        gc_list_merge(young, old);
+    }
+    else if (young != old) {
         if (generation == NUM_GENERATIONS - 2) {
-            long_lived_pending += gc_list_size(young);
+            if (pause_target > 0) {
+                Py_ssize_t promoted = gc_list_set_visited(young, 0);
+                long_lived_pending += promoted;
+                promoted_since_increment += promoted;
+                promoted_since_full += promoted;
+            }
+            else
+                long_lived_pending += gc_list_size(young);
         }
         gc_list_merge(young, old);
     }
@@ -971,7 +1222,10 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
            dict build-up. See issue #14775. */
         untrack_dicts(young);
         long_lived_pending = 0;
-        long_lived_total = gc_list_size(young);
+        if (pause_target > 0)
+            long_lived_total = gc_list_set_visited(young, 0);
+        else
+            long_lived_total = gc_list_size(young);
     }
 
     /* All objects in unreachable are trash, but objects reachable from
@@ -1042,6 +1296,24 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
      */
     (void)handle_legacy_finalizers(&finalizers, old);
 
+    if (incremental) {
+        _PyTime_t elapsed = _PyTime_GetMonotonicClock() - t1;
+        if (elapsed > 0)
+            increment_speed = (double)(examined + m + n) / elapsed;
+
+        if (gc_list_is_empty(GEN_HEAD(generation))) {
+            /* End of the pass:  all visited objects become pending */
+            gc_list_merge(&gc_visited, GEN_HEAD(generation));
+            visited_mask ^= _PyGC_REFS_MASK_VISITED;
+            long_lived_pending = 0;
+            long_lived_total = pass_survivors;
+            pass_survivors = 0;
+            full_collection_needed = (increment_truncated &&
+                promoted_since_full >= long_lived_total / 4);
+            increment_truncated = 0;
+        }
+    }
+
     /* Clear free list only during the collection of the highest
      * generation */
     if (generation == NUM_GENERATIONS-1) {
@@ -1112,15 +1384,31 @@ invoke_gc_callback(const char *phase, int generation,
  * progress callbacks.
  */
 static Py_ssize_t
-collect_with_callback(int generation)
+collect_with_callback(int generation, int incremental)
 {
     Py_ssize_t result, collected, uncollectable;
     invoke_gc_callback("start", generation, 0, 0);
-    result = collect(generation, &collected, &uncollectable, 0);
+    _PyEval_StopTheWorld();
+    result = collect(generation, &collected, &uncollectable, 0, incremental);
+    _PyEval_StartTheWorld();
     invoke_gc_callback("stop", generation, collected, uncollectable);
     return result;
 }
 
+/* Set the `collecting` flag.  Return 0 if a collection is already running,
+   in which case the caller must not start another one. */
+static int
+start_collecting(void)
+{
+    int res;
+
+    GC_LOCK();
+    res = !collecting;
+    collecting = 1;
+    GC_UNLOCK();
+    return res;
+}
+
 static Py_ssize_t
 collect_generations(void)
 {
@@ -1136,10 +1424,17 @@ collect_generations(void)
                of tracked objects. See comments at the beginning
                of this file, and issue #4074.
             */
+            if (i == NUM_GENERATIONS - 1 && pause_target > 0
+                && !full_collection_needed) {
+                /* Increments are bounded:  no need to wait */
+                n = collect_with_callback(i, 1);
+                break;
+            }
             if (i == NUM_GENERATIONS - 1
-                && long_lived_pending < long_lived_total / 4)
+                && long_lived_pending < long_lived_total / 4
+                && !full_collection_needed)
                 continue;
-            n = collect_with_callback(i);
+            n = collect_with_callback(i, 0);
             break;
         }
     }
@@ -1206,11 +1501,10 @@ gc_collect(PyObject *self, PyObject *args, PyObject *kws)
         return NULL;
     }
 
-    if (collecting)
+    if (!start_collecting())
         n = 0; /* already collecting, don't do anything */
     else {
-        collecting = 1;
-        n = collect_with_callback(genarg);
+        n = collect_with_callback(genarg, 0);
         collecting = 0;
     }
 
@@ -1290,6 +1584,45 @@ gc_get_thresh(PyObject *self, PyObject *noargs)
                          generations[2].threshold);
 }
 
+PyDoc_STRVAR(gc_set_pause_target__doc__,
+"set_pause_target(ms) -> None\n"
+"\n"
+"Collect the oldest generation incrementally, in increments which should\n"
+"take about ms milliseconds each.  Zero disables incremental collection.\n");
+
+static PyObject *
+gc_set_pause_target(PyObject *self, PyObject *args)
+{
+    double ms;
+
+    if (!PyArg_ParseTuple(args, "d:set_pause_target", &ms))
+        return NULL;
+    if (!(ms >= 0.0)) {
+        PyErr_SetString(PyExc_ValueError,
+                        "pause target must be a non-negative number");
+        return NULL;
+    }
+    if (ms * 1e6 > (double)_PyTime_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "pause target is too large");
+        return NULL;
+    }
+    pause_target = (_PyTime_t)(ms * 1e6);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+PyDoc_STRVAR(gc_get_pause_target__doc__,
+"get_pause_target() -> ms\n"
+"\n"
+"Return the pause target of incremental collections in milliseconds.\n");
+
+static PyObject *
+gc_get_pause_target(PyObject *self, PyObject *noargs)
+{
+    return PyFloat_FromDouble(pause_target / 1e6);
+}
+
 PyDoc_STRVAR(gc_get_count__doc__,
 "get_count() -> (count0, count1, count2)\n"
 "\n"
@@ -1344,12 +1677,20 @@ gc_get_referrers(PyObject *self, PyObject *args)
     PyObject *result = PyList_New(0);
     if (!result) return NULL;
 
+    _PyEval_StopTheWorld();
     for (i = 0; i < NUM_GENERATIONS; i++) {
         if (!(gc_referrers_for(args, GEN_HEAD(i), result))) {
+            _PyEval_StartTheWorld();
             Py_DECREF(result);
             return NULL;
         }
     }
+    if (!(gc_referrers_for(args, &gc_visited, result))) {
+        _PyEval_StartTheWorld();
+        Py_DECREF(result);
+        return NULL;
+    }
+    _PyEval_StartTheWorld();
     return result;
 }
 
@@ -1405,12 +1746,20 @@ gc_get_objects(PyObject *self, PyObject *noargs)
     result = PyList_New(0);
     if (result == NULL)
         return NULL;
+    _PyEval_StopTheWorld();
     for (i = 0; i < NUM_GENERATIONS; i++) {
         if (append_objects(result, GEN_HEAD(i))) {
+            _PyEval_StartTheWorld();
             Py_DECREF(result);
             return NULL;
         }
     }
+    if (append_objects(result, &gc_visited)) {
+        _PyEval_StartTheWorld();
+        Py_DECREF(result);
+        return NULL;
+    }
+    _PyEval_StartTheWorld();
     return result;
 }
 
@@ -1494,6 +1843,8 @@ PyDoc_STRVAR(gc__doc__,
 "get_debug() -- Get debugging flags.\n"
 "set_threshold() -- Set the collection thresholds.\n"
 "get_threshold() -- Return the current the collection thresholds.\n"
+"set_pause_target() -- Collect the oldest generation incrementally.\n"
+"get_pause_target() -- Return the pause target of incremental collections.\n"
 "get_objects() -- Return a list of all objects tracked by the collector.\n"
 "is_tracked() -- Returns true if a given object is tracked.\n"
 "get_referrers() -- Return the list of objects that refer to an object.\n"
@@ -1508,6 +1859,10 @@ static PyMethodDef GcMethods[] = {
     {"get_count",          gc_get_count,  METH_NOARGS,  gc_get_count__doc__},
     {"set_threshold",  gc_set_thresh, METH_VARARGS, gc_set_thresh__doc__},
     {"get_threshold",  gc_get_thresh, METH_NOARGS,  gc_get_thresh__doc__},
+    {"set_pause_target", gc_set_pause_target, METH_VARARGS,
+        gc_set_pause_target__doc__},
+    {"get_pause_target", gc_get_pause_target, METH_NOARGS,
+        gc_get_pause_target__doc__},
     {"collect",            (PyCFunction)gc_collect,
         METH_VARARGS | METH_KEYWORDS,           gc_collect__doc__},
     {"get_objects",    gc_get_objects,METH_NOARGS,  gc_get_objects__doc__},
@@ -1576,11 +1931,10 @@ PyGC_Collect(void)
 {
     Py_ssize_t n;
 
-    if (collecting)
+    if (!start_collecting())
         n = 0; /* already collecting, don't do anything */
     else {
-        collecting = 1;
-        n = collect_with_callback(NUM_GENERATIONS - 1);
+        n = collect_with_callback(NUM_GENERATIONS - 1, 0);
         collecting = 0;
     }
 
@@ -1598,11 +1952,12 @@ _PyGC_CollectNoFail(void)
        during interpreter shutdown (and then never finish it).
        See http://bugs.python.org/issue8713#msg195178 for an example.
        */
-    if (collecting)
+    if (!start_collecting())
         n = 0;
     else {
-        collecting = 1;
-        n = collect(NUM_GENERATIONS - 1, NULL, NULL, 1);
+        _PyEval_StopTheWorld();
+        n = collect(NUM_GENERATIONS - 1, NULL, NULL, 1, 0);
+        _PyEval_StartTheWorld();
         collecting = 0;
     }
     return n;
@@ -1668,7 +2023,18 @@ _PyGC_Dump(PyGC_Head *g)
 void
 PyObject_GC_Track(void *op)
 {
+#ifdef WITHOUT_GIL
+    /* _PyObject_GC_TRACK() is an alias of this function in this build */
+    PyGC_Head *g = AS_GC(op);
+    GC_LOCK();
+    if (_PyGCHead_REFS(g) != _PyGC_REFS_UNTRACKED)
+        Py_FatalError("GC object already tracked");
+    _PyGCHead_SET_REFS(g, _PyGC_REFS_REACHABLE);
+    gc_list_append(g, GEN_HEAD(0));
+    GC_UNLOCK();
+#else
     _PyObject_GC_TRACK(op);
+#endif
 }
 
 void
@@ -1677,8 +2043,18 @@ PyObject_GC_UnTrack(void *op)
     /* Obscure:  the Py_TRASHCAN mechanism requires that we be able to
      * call PyObject_GC_UnTrack twice on an object.
      */
+#ifdef WITHOUT_GIL
+    GC_LOCK();
+    if (IS_TRACKED(op)) {
+        PyGC_Head *g = AS_GC(op);
+        _PyGCHead_SET_REFS(g, _PyGC_REFS_UNTRACKED);
+        gc_list_remove(g);
+    }
+    GC_UNLOCK();
+#else
     if (IS_TRACKED(op))
         _PyObject_GC_UNTRACK(op);
+#endif
 }
 
 static PyObject *
@@ -1698,6 +2074,7 @@ _PyObject_GC_Alloc(int use_calloc, size_t basicsize)
         return PyErr_NoMemory();
     g->gc.gc_refs = 0;
     _PyGCHead_SET_REFS(g, GC_UNTRACKED);
+    GC_LOCK();
     generations[0].count++; /* number of allocated GC objects */
     if (generations[0].count > generations[0].threshold &&
         enabled &&
@@ -1705,9 +2082,12 @@ _PyObject_GC_Alloc(int use_calloc, size_t basicsize)
         !collecting &&
         !PyErr_Occurred()) {
         collecting = 1;
+        GC_UNLOCK();
         collect_generations();
         collecting = 0;
     }
+    else
+        GC_UNLOCK();
     op = FROM_GC(g);
     return op;
 }
@@ -1769,10 +2149,12 @@ void
 PyObject_GC_Del(void *op)
 {
     PyGC_Head *g = AS_GC(op);
+    GC_LOCK();
     if (IS_TRACKED(op))
         gc_list_remove(g);
     if (generations[0].count > 0) {
         generations[0].count--;
     }
+    GC_UNLOCK();
     PyObject_FREE(g);
 }
@@ -5346,12 +5346,14 @@ os_fork1_impl(PyModuleDef *module)
     pid_t pid;
     int result = 0;
     _PyImport_AcquireLock();
+    _PyEval_StopTheWorld();
     pid = fork1();
     if (pid == 0) {
         /* child: this clobbers and resets the import lock. */
         PyOS_AfterFork();
     } else {
         /* parent: release the import lock. */
+        _PyEval_StartTheWorld();
         result = _PyImport_ReleaseLock();
     }
     if (pid == -1)
@@ -5383,12 +5385,14 @@ os_fork_impl(PyModuleDef *module)
     pid_t pid;
     int result = 0;
     _PyImport_AcquireLock();
+    _PyEval_StopTheWorld();
     pid = fork();
     if (pid == 0) {
         /* child: this clobbers and resets the import lock. */
         PyOS_AfterFork();
     } else {
         /* parent: release the import lock. */
+        _PyEval_StartTheWorld();
         result = _PyImport_ReleaseLock();
     }
     if (pid == -1)
@@ -5984,12 +5988,14 @@ os_forkpty_impl(PyModuleDef *module)
     pid_t pid;
 
     _PyImport_AcquireLock();
+    _PyEval_StopTheWorld();
     pid = forkpty(&master_fd, NULL, NULL, NULL);
     if (pid == 0) {
         /* child: this clobbers and resets the import lock. */
         PyOS_AfterFork();
     } else {
         /* parent: release the import lock. */
+        _PyEval_StartTheWorld();
         result = _PyImport_ReleaseLock();
     }
     if (pid == -1)
@@ -1644,6 +1644,10 @@ _clear_pending_signals(void)
 void
 PyOS_AfterFork(void)
 {
+#ifdef WITHOUT_GIL
+    /* The threads which owned the other obmalloc heaps are gone */
+    _PyObject_AfterForkHeaps();
+#endif
     /* Clear the signal flags after forking so that they aren't handled
      * in both processes if they came in just before the fork() but before
      * the interpreter had an opportunity to call the handlers.  issue9535. */
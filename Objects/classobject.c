@@ -8,8 +8,8 @@
 /* Free list for method objects to safe malloc/free overhead
  * The im_self element is used to chain the elements.
  */
-static PyMethodObject *free_list;
-static int numfree = 0;
+static _Py_PER_THREAD PyMethodObject *free_list;
+static _Py_PER_THREAD int numfree = 0;
 #ifndef PyMethod_MAXFREELIST
 #define PyMethod_MAXFREELIST 256
 #endif
@@ -1,5 +1,6 @@
 #include "Python.h"
 #include "code.h"
+#include "opcode.h"
 #include "structmember.h"
 
 #define NAME_CHARS \
@@ -152,6 +153,10 @@ PyCode_New(int argcount, int kwonlyargcount,
     co->co_lnotab = lnotab;
     co->co_zombieframe = NULL;
     co->co_weakreflist = NULL;
+    co->co_opcache_map = NULL;
+    co->co_opcache = NULL;
+    co->co_opcache_flag = 0;
+    co->co_opcache_size = 0;
     return co;
 }
 
@@ -358,6 +363,49 @@ code_new(PyTypeObject *type, PyObject *args, PyObject *kw)
     return co;
 }
 
+/* Give an inline cache entry to the first 255 LOAD_GLOBAL, LOAD_ATTR and
+   LOAD_METHOD instructions of co.  The entries start out empty, the
+   interpreter loop fills them. */
+int
+_PyCode_InitOpcache(PyCodeObject *co)
+{
+    Py_ssize_t i, ninstr;
+    unsigned char *code;
+    int nentries = 0;
+
+    assert(co->co_opcache_map == NULL);
+    ninstr = PyBytes_GET_SIZE(co->co_code) / 2;
+    co->co_opcache_map = (unsigned char *)PyMem_Calloc(ninstr, 1);
+    if (co->co_opcache_map == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    code = (unsigned char *)PyBytes_AS_STRING(co->co_code);
+    for (i = 0; i < ninstr && nentries < 255; i++) {
+        int opcode = code[2*i];
+        if (opcode == LOAD_GLOBAL || opcode == LOAD_ATTR ||
+            opcode == LOAD_METHOD)
+            co->co_opcache_map[i] = (unsigned char)++nentries;
+    }
+
+    if (nentries == 0) {
+        /* Nothing to cache */
+        PyMem_FREE(co->co_opcache_map);
+        co->co_opcache_map = NULL;
+        return 0;
+    }
+    co->co_opcache = (_PyOpcache *)PyMem_Calloc(nentries, sizeof(_PyOpcache));
+    if (co->co_opcache == NULL) {
+        PyMem_FREE(co->co_opcache_map);
+        co->co_opcache_map = NULL;
+        PyErr_NoMemory();
+        return -1;
+    }
+    co->co_opcache_size = (unsigned char)nentries;
+    return 0;
+}
+
 static void
 code_dealloc(PyCodeObject *co)
 {
@@ -374,6 +422,10 @@ code_dealloc(PyCodeObject *co)
         PyMem_FREE(co->co_cell2arg);
     if (co->co_zombieframe != NULL)
         PyObject_GC_Del(co->co_zombieframe);
+    if (co->co_opcache_map != NULL)
+        PyMem_FREE(co->co_opcache_map);
+    if (co->co_opcache != NULL)
+        PyMem_FREE(co->co_opcache);
     if (co->co_weakreflist != NULL)
         PyObject_ClearWeakRefs((PyObject*)co);
     PyObject_DEL(co);
@@ -387,6 +439,10 @@ code_sizeof(PyCodeObject *co, void *unused)
     res = _PyObject_SIZE(Py_TYPE(co));
     if (co->co_cell2arg != NULL && co->co_cellvars != NULL)
         res += PyTuple_GET_SIZE(co->co_cellvars) * sizeof(unsigned char);
+    if (co->co_opcache_map != NULL) {
+        res += PyBytes_GET_SIZE(co->co_code) / 2;
+        res += co->co_opcache_size * sizeof(_PyOpcache);
+    }
     return PyLong_FromSsize_t(res);
 }
 
@@ -18,8 +18,8 @@
 #ifndef PyFloat_MAXFREELIST
 #define PyFloat_MAXFREELIST    100
 #endif
-static int numfree = 0;
-static PyFloatObject *free_list = NULL;
+static _Py_PER_THREAD int numfree = 0;
+static _Py_PER_THREAD PyFloatObject *free_list = NULL;
 
 double
 PyFloat_GetMax(void)
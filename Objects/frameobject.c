@@ -402,11 +402,44 @@ static PyGetSetDef frame_getsetlist[] = {
    frames could provoke free_list into growing without bound.
 */
 
-static PyFrameObject *free_list = NULL;
-static int numfree = 0;         /* number of frames currently in free_list */
+static _Py_PER_THREAD PyFrameObject *free_list = NULL;
+static _Py_PER_THREAD int numfree = 0;  /* number of frames currently in free_list */
 /* max value for numfree */
 #define PyFrame_MAXFREELIST 200
 
+/* Without the GIL, several threads may run the same code object at once,
+   so the zombie frame is taken and given back atomically. */
+static PyFrameObject *
+take_zombie_frame(PyCodeObject *co)
+{
+#ifdef WITHOUT_GIL
+    return (PyFrameObject *)__atomic_exchange_n(&co->co_zombieframe, NULL,
+                                                __ATOMIC_ACQ_REL);
+#else
+    PyFrameObject *f = (PyFrameObject *)co->co_zombieframe;
+    co->co_zombieframe = NULL;
+    return f;
+#endif
+}
+
+/* Make f the zombie frame of co, unless it already has one.  Return 1 if f
+   was kept. */
+static int
+put_zombie_frame(PyCodeObject *co, PyFrameObject *f)
+{
+#ifdef WITHOUT_GIL
+    void *expected = NULL;
+    return __atomic_compare_exchange_n(&co->co_zombieframe, &expected,
+                                       (void *)f, 0, __ATOMIC_ACQ_REL,
+                                       __ATOMIC_RELAXED);
+#else
+    if (co->co_zombieframe != NULL)
+        return 0;
+    co->co_zombieframe = f;
+    return 1;
+#endif
+}
+
 static void
 frame_dealloc(PyFrameObject *f)
 {
@@ -436,8 +469,8 @@ frame_dealloc(PyFrameObject *f)
     Py_CLEAR(f->f_exc_traceback);
 
     co = f->f_code;
-    if (co->co_zombieframe == NULL)
-        co->co_zombieframe = f;
+    if (put_zombie_frame(co, f))
+        ; /* f is now the zombie frame of co */
     else if (numfree < PyFrame_MAXFREELIST) {
         ++numfree;
         f->f_back = free_list;
@@ -647,9 +680,8 @@ PyFrame_New(PyThreadState *tstate, PyCodeObject *code, PyObject *globals,
         assert(builtins != NULL);
         Py_INCREF(builtins);
     }
-    if (code->co_zombieframe != NULL) {
-        f = code->co_zombieframe;
-        code->co_zombieframe = NULL;
+    f = take_zombie_frame(code);
+    if (f != NULL) {
         _Py_NewReference((PyObject *)f);
         assert(f->f_code == code);
     }
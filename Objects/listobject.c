@@ -95,8 +95,56 @@ show_alloc(void)
 #ifndef PyList_MAXFREELIST
 #define PyList_MAXFREELIST 80
 #endif
-static PyListObject *free_list[PyList_MAXFREELIST];
-static int numfree = 0;
+static _Py_PER_THREAD PyListObject *free_list[PyList_MAXFREELIST];
+static _Py_PER_THREAD int numfree = 0;
+
+/* Return a new reference to a[i], or NULL without setting an exception if
+   i is out of range.  Used by loops which call back into Python for each
+   item and so can't keep the list locked between iterations. */
+static PyObject *
+list_item_or_null(PyListObject *a, Py_ssize_t i)
+{
+    PyObject *item = NULL;
+
+    _PyObject_LOCK(a);
+    if (i >= 0 && i < Py_SIZE(a)) {
+        item = a->ob_item[i];
+        Py_INCREF(item);
+    }
+    _PyObject_UNLOCK(a);
+    return item;
+}
+
+#ifdef WITHOUT_GIL
+/* Lock two lists in a consistent (address) order, so that two threads
+   locking the same pair can't deadlock. */
+static void
+list_lock_pair(PyListObject *a, PyListObject *b)
+{
+    if (a > b) {
+        PyListObject *tmp = a;
+        a = b;
+        b = tmp;
+    }
+    _PyObject_LOCK(a);
+    _PyObject_LOCK(b);
+}
+
+static void
+list_unlock_pair(PyListObject *a, PyListObject *b)
+{
+    _PyObject_UNLOCK(a);
+    _PyObject_UNLOCK(b);
+}
+
+#define listextend_unlock(self, b) \
+    (PyList_CheckExact(b) ? list_unlock_pair((self), (PyListObject *)(b)) \
+                          : _PyObject_UNLOCK(self))
+#else
+#define list_lock_pair(a, b) ((void)0)
+#define list_unlock_pair(a, b) ((void)0)
+#define listextend_unlock(self, b) ((void)0)
+#endif
 
 int
 PyList_ClearFreeList(void)
@@ -175,6 +223,7 @@ PyList_New(Py_ssize_t size)
     }
     Py_SIZE(op) = size;
     op->allocated = size;
+    _PyObject_LOCK_INIT(op);
     _PyObject_GC_TRACK(op);
     return (PyObject *) op;
 }
@@ -195,11 +244,17 @@ static PyObject *indexerr = NULL;
 PyObject *
 PyList_GetItem(PyObject *op, Py_ssize_t i)
 {
+    PyObject *item = NULL;
+
     if (!PyList_Check(op)) {
         PyErr_BadInternalCall();
         return NULL;
     }
-    if (i < 0 || i >= Py_SIZE(op)) {
+    _PyObject_LOCK((PyListObject *)op);
+    if (i >= 0 && i < Py_SIZE(op))
+        item = ((PyListObject *)op) -> ob_item[i];
+    _PyObject_UNLOCK((PyListObject *)op);
+    if (item == NULL) {
         if (indexerr == NULL) {
             indexerr = PyUnicode_FromString(
                 "list index out of range");
@@ -209,27 +264,32 @@ PyList_GetItem(PyObject *op, Py_ssize_t i)
         PyErr_SetObject(PyExc_IndexError, indexerr);
         return NULL;
     }
-    return ((PyListObject *)op) -> ob_item[i];
+    return item;
 }
 
 int
 PyList_SetItem(PyObject *op, Py_ssize_t i,
                PyObject *newitem)
 {
-    PyObject **p;
+    PyObject **p, *olditem;
     if (!PyList_Check(op)) {
         Py_XDECREF(newitem);
         PyErr_BadInternalCall();
         return -1;
     }
+    _PyObject_LOCK((PyListObject *)op);
     if (i < 0 || i >= Py_SIZE(op)) {
+        _PyObject_UNLOCK((PyListObject *)op);
         Py_XDECREF(newitem);
         PyErr_SetString(PyExc_IndexError,
                         "list assignment index out of range");
         return -1;
     }
     p = ((PyListObject *)op) -> ob_item + i;
-    Py_XSETREF(*p, newitem);
+    olditem = *p;
+    *p = newitem;
+    _PyObject_UNLOCK((PyListObject *)op);
+    Py_XDECREF(olditem);
     return 0;
 }
 
@@ -269,11 +329,16 @@ ins1(PyListObject *self, Py_ssize_t where, PyObject *v)
 int
 PyList_Insert(PyObject *op, Py_ssize_t where, PyObject *newitem)
 {
+    int res;
+
     if (!PyList_Check(op)) {
         PyErr_BadInternalCall();
         return -1;
     }
-    return ins1((PyListObject *)op, where, newitem);
+    _PyObject_LOCK((PyListObject *)op);
+    res = ins1((PyListObject *)op, where, newitem);
+    _PyObject_UNLOCK((PyListObject *)op);
+    return res;
 }
 
 static int
@@ -299,8 +364,14 @@ app1(PyListObject *self, PyObject *v)
 int
 PyList_Append(PyObject *op, PyObject *newitem)
 {
-    if (PyList_Check(op) && (newitem != NULL))
-        return app1((PyListObject *)op, newitem);
+    int res;
+
+    if (PyList_Check(op) && (newitem != NULL)) {
+        _PyObject_LOCK((PyListObject *)op);
+        res = app1((PyListObject *)op, newitem);
+        _PyObject_UNLOCK((PyListObject *)op);
+        return res;
+    }
     PyErr_BadInternalCall();
     return -1;
 }
@@ -335,7 +406,7 @@ static PyObject *
 list_repr(PyListObject *v)
 {
     Py_ssize_t i;
-    PyObject *s;
+    PyObject *s, *item;
     _PyUnicodeWriter writer;
 
     if (Py_SIZE(v) == 0) {
@@ -365,7 +436,14 @@ list_repr(PyListObject *v)
 
         if (Py_EnterRecursiveCall(" while getting the repr of a list"))
             goto error;
-        s = PyObject_Repr(v->ob_item[i]);
+        item = list_item_or_null(v, i);
+        if (item == NULL) {
+            /* Another thread shrank the list */
+            Py_LeaveRecursiveCall();
+            break;
+        }
+        s = PyObject_Repr(item);
+        Py_DECREF(item);
         Py_LeaveRecursiveCall();
         if (s == NULL)
             goto error;
@@ -401,17 +479,35 @@ list_contains(PyListObject *a, PyObject *el)
 {
     Py_ssize_t i;
     int cmp;
+    PyObject *item;
 
-    for (i = 0, cmp = 0 ; cmp == 0 && i < Py_SIZE(a); ++i)
-        cmp = PyObject_RichCompareBool(el, PyList_GET_ITEM(a, i),
-                                           Py_EQ);
+    for (i = 0, cmp = 0 ; cmp == 0 && i < Py_SIZE(a); ++i) {
+        _PyObject_LOCK(a);
+        if (i >= Py_SIZE(a)) {
+            _PyObject_UNLOCK(a);
+            break;
+        }
+        item = PyList_GET_ITEM(a, i);
+        Py_INCREF(item);
+        _PyObject_UNLOCK(a);
+        cmp = PyObject_RichCompareBool(el, item, Py_EQ);
+        Py_DECREF(item);
+    }
     return cmp;
 }
 
 static PyObject *
 list_item(PyListObject *a, Py_ssize_t i)
 {
-    if (i < 0 || i >= Py_SIZE(a)) {
+    PyObject *item = NULL;
+
+    _PyObject_LOCK(a);
+    if (i >= 0 && i < Py_SIZE(a)) {
+        item = a->ob_item[i];
+        Py_INCREF(item);
+    }
+    _PyObject_UNLOCK(a);
+    if (item == NULL) {
         if (indexerr == NULL) {
             indexerr = PyUnicode_FromString(
                 "list index out of range");
@@ -421,8 +517,7 @@ list_item(PyListObject *a, Py_ssize_t i)
         PyErr_SetObject(PyExc_IndexError, indexerr);
         return NULL;
     }
-    Py_INCREF(a->ob_item[i]);
-    return a->ob_item[i];
+    return item;
 }
 
 static PyObject *
@@ -431,6 +526,7 @@ list_slice(PyListObject *a, Py_ssize_t ilow, Py_ssize_t ihigh)
     PyListObject *np;
     PyObject **src, **dest;
     Py_ssize_t i, len;
+    _PyObject_LOCK(a);
     if (ilow < 0)
         ilow = 0;
     else if (ilow > Py_SIZE(a))
@@ -441,8 +537,10 @@ list_slice(PyListObject *a, Py_ssize_t ilow, Py_ssize_t ihigh)
         ihigh = Py_SIZE(a);
     len = ihigh - ilow;
     np = (PyListObject *) PyList_New(len);
-    if (np == NULL)
+    if (np == NULL) {
+        _PyObject_UNLOCK(a);
         return NULL;
+    }
 
     src = a->ob_item + ilow;
     dest = np->ob_item;
@@ -451,6 +549,7 @@ list_slice(PyListObject *a, Py_ssize_t ilow, Py_ssize_t ihigh)
         Py_INCREF(v);
         dest[i] = v;
     }
+    _PyObject_UNLOCK(a);
     return (PyObject *)np;
 }
 
@@ -478,11 +577,15 @@ list_concat(PyListObject *a, PyObject *bb)
         return NULL;
     }
 #define b ((PyListObject *)bb)
+    list_lock_pair(a, b);
     size = Py_SIZE(a) + Py_SIZE(b);
-    if (size < 0)
+    if (size < 0) {
+        list_unlock_pair(a, b);
         return PyErr_NoMemory();
+    }
     np = (PyListObject *) PyList_New(size);
     if (np == NULL) {
+        list_unlock_pair(a, b);
         return NULL;
     }
     src = a->ob_item;
@@ -499,6 +602,7 @@ list_concat(PyListObject *a, PyObject *bb)
         Py_INCREF(v);
         dest[i] = v;
     }
+    list_unlock_pair(a, b);
     return (PyObject *)np;
 #undef b
 }
@@ -513,14 +617,21 @@ list_repeat(PyListObject *a, Py_ssize_t n)
     PyObject *elem;
     if (n < 0)
         n = 0;
-    if (n > 0 && Py_SIZE(a) > PY_SSIZE_T_MAX / n)
+    _PyObject_LOCK(a);
+    if (n > 0 && Py_SIZE(a) > PY_SSIZE_T_MAX / n) {
+        _PyObject_UNLOCK(a);
         return PyErr_NoMemory();
+    }
     size = Py_SIZE(a) * n;
-    if (size == 0)
+    if (size == 0) {
+        _PyObject_UNLOCK(a);
         return PyList_New(0);
+    }
     np = (PyListObject *) PyList_New(size);
-    if (np == NULL)
+    if (np == NULL) {
+        _PyObject_UNLOCK(a);
         return NULL;
+    }
 
     items = np->ob_item;
     if (Py_SIZE(a) == 1) {
@@ -529,6 +640,7 @@ list_repeat(PyListObject *a, Py_ssize_t n)
             items[i] = elem;
             Py_INCREF(elem);
         }
+        _PyObject_UNLOCK(a);
         return (PyObject *) np;
     }
     p = np->ob_item;
@@ -540,6 +652,7 @@ list_repeat(PyListObject *a, Py_ssize_t n)
             p++;
         }
     }
+    _PyObject_UNLOCK(a);
     return (PyObject *) np;
 }
 
@@ -547,14 +660,19 @@ static int
 list_clear(PyListObject *a)
 {
     Py_ssize_t i;
-    PyObject **item = a->ob_item;
+    PyObject **item;
+    _PyObject_LOCK(a);
+    item = a->ob_item;
+    i = Py_SIZE(a);
     if (item != NULL) {
         /* Because XDECREF can recursively invoke operations on
            this list, we make it empty first. */
-        i = Py_SIZE(a);
         Py_SIZE(a) = 0;
         a->ob_item = NULL;
         a->allocated = 0;
+    }
+    _PyObject_UNLOCK(a);
+    if (item != NULL) {
         while (--i >= 0) {
             Py_XDECREF(item[i]);
         }
@@ -611,6 +729,7 @@ list_ass_slice(PyListObject *a, Py_ssize_t ilow, Py_ssize_t ihigh, PyObject *v)
         n = PySequence_Fast_GET_SIZE(v_as_SF);
         vitem = PySequence_Fast_ITEMS(v_as_SF);
     }
+    _PyObject_LOCK(a);
     if (ilow < 0)
         ilow = 0;
     else if (ilow > Py_SIZE(a))
@@ -625,6 +744,7 @@ list_ass_slice(PyListObject *a, Py_ssize_t ilow, Py_ssize_t ihigh, PyObject *v)
     assert(norig >= 0);
     d = n - norig;
     if (Py_SIZE(a) + d == 0) {
+        _PyObject_UNLOCK(a);
         Py_XDECREF(v_as_SF);
         return list_clear(a);
     }
@@ -634,6 +754,7 @@ list_ass_slice(PyListObject *a, Py_ssize_t ilow, Py_ssize_t ihigh, PyObject *v)
     if (s > sizeof(recycle_on_stack)) {
         recycle = (PyObject **)PyMem_MALLOC(s);
         if (recycle == NULL) {
+            _PyObject_UNLOCK(a);
             PyErr_NoMemory();
             goto Error;
         }
@@ -647,14 +768,17 @@ list_ass_slice(PyListObject *a, Py_ssize_t ilow, Py_ssize_t ihigh, PyObject *v)
         if (list_resize(a, Py_SIZE(a) + d) < 0) {
             memmove(&item[ihigh], &item[ihigh+d], tail);
             memcpy(&item[ilow], recycle, s);
+            _PyObject_UNLOCK(a);
             goto Error;
         }
         item = a->ob_item;
     }
     else if (d > 0) { /* Insert d items */
         k = Py_SIZE(a);
-        if (list_resize(a, k+d) < 0)
+        if (list_resize(a, k+d) < 0) {
+            _PyObject_UNLOCK(a);
             goto Error;
+        }
         item = a->ob_item;
         memmove(&item[ihigh+d], &item[ihigh],
             (k - ihigh)*sizeof(PyObject *));
@@ -664,6 +788,7 @@ list_ass_slice(PyListObject *a, Py_ssize_t ilow, Py_ssize_t ihigh, PyObject *v)
         Py_XINCREF(w);
         item[ilow] = w;
     }
+    _PyObject_UNLOCK(a);
     for (k = norig - 1; k >= 0; --k)
         Py_XDECREF(recycle[k]);
     result = 0;
@@ -692,24 +817,30 @@ list_inplace_repeat(PyListObject *self, Py_ssize_t n)
     Py_ssize_t size, i, j, p;
 
 
+    _PyObject_LOCK(self);
     size = PyList_GET_SIZE(self);
     if (size == 0 || n == 1) {
+        _PyObject_UNLOCK(self);
         Py_INCREF(self);
         return (PyObject *)self;
     }
 
     if (n < 1) {
+        _PyObject_UNLOCK(self);
         (void)list_clear(self);
         Py_INCREF(self);
         return (PyObject *)self;
     }
 
     if (size > PY_SSIZE_T_MAX / n) {
+        _PyObject_UNLOCK(self);
         return PyErr_NoMemory();
     }
 
-    if (list_resize(self, size*n) < 0)
+    if (list_resize(self, size*n) < 0) {
+        _PyObject_UNLOCK(self);
         return NULL;
+    }
 
     p = size;
     items = self->ob_item;
@@ -720,6 +851,7 @@ list_inplace_repeat(PyListObject *self, Py_ssize_t n)
             items[p++] = o;
         }
     }
+    _PyObject_UNLOCK(self);
     Py_INCREF(self);
     return (PyObject *)self;
 }
@@ -727,15 +859,26 @@ list_inplace_repeat(PyListObject *self, Py_ssize_t n)
 static int
 list_ass_item(PyListObject *a, Py_ssize_t i, PyObject *v)
 {
+    PyObject *olditem;
+    int res;
+
+    _PyObject_LOCK(a);
     if (i < 0 || i >= Py_SIZE(a)) {
+        _PyObject_UNLOCK(a);
         PyErr_SetString(PyExc_IndexError,
                         "list assignment index out of range");
         return -1;
     }
-    if (v == NULL)
-        return list_ass_slice(a, i, i+1, v);
+    if (v == NULL) {
+        res = list_ass_slice(a, i, i+1, v);
+        _PyObject_UNLOCK(a);
+        return res;
+    }
     Py_INCREF(v);
-    Py_SETREF(a->ob_item[i], v);
+    olditem = a->ob_item[i];
+    a->ob_item[i] = v;
+    _PyObject_UNLOCK(a);
+    Py_DECREF(olditem);
     return 0;
 }
 
@@ -744,9 +887,13 @@ listinsert(PyListObject *self, PyObject *args)
 {
     Py_ssize_t i;
     PyObject *v;
+    int res;
     if (!PyArg_ParseTuple(args, "nO:insert", &i, &v))
         return NULL;
-    if (ins1(self, i, v) == 0)
+    _PyObject_LOCK(self);
+    res = ins1(self, i, v);
+    _PyObject_UNLOCK(self);
+    if (res == 0)
         Py_RETURN_NONE;
     return NULL;
 }
@@ -767,7 +914,12 @@ listcopy(PyListObject *self)
 static PyObject *
 listappend(PyListObject *self, PyObject *v)
 {
-    if (app1(self, v) == 0)
+    int res;
+
+    _PyObject_LOCK(self);
+    res = app1(self, v);
+    _PyObject_UNLOCK(self);
+    if (res == 0)
         Py_RETURN_NONE;
     return NULL;
 }
@@ -791,14 +943,20 @@ listextend(PyListObject *self, PyObject *b)
         b = PySequence_Fast(b, "argument must be iterable");
         if (!b)
             return NULL;
+        if (PyList_CheckExact(b))
+            list_lock_pair(self, (PyListObject *)b);
+        else
+            _PyObject_LOCK(self);
         n = PySequence_Fast_GET_SIZE(b);
         if (n == 0) {
             /* short circuit when b is empty */
+            listextend_unlock(self, b);
             Py_DECREF(b);
             Py_RETURN_NONE;
         }
         m = Py_SIZE(self);
         if (list_resize(self, m + n) < 0) {
+            listextend_unlock(self, b);
             Py_DECREF(b);
             return NULL;
         }
@@ -815,6 +973,7 @@ listextend(PyListObject *self, PyObject *b)
             Py_INCREF(o);
             dest[i] = o;
         }
+        listextend_unlock(self, b);
         Py_DECREF(b);
         Py_RETURN_NONE;
     }
@@ -830,15 +989,19 @@ listextend(PyListObject *self, PyObject *b)
         Py_DECREF(it);
         return NULL;
     }
+    _PyObject_LOCK(self);
     m = Py_SIZE(self);
     mn = m + n;
     if (mn >= m) {
         /* Make room. */
-        if (list_resize(self, mn) < 0)
+        if (list_resize(self, mn) < 0) {
+            _PyObject_UNLOCK(self);
             goto error;
+        }
         /* Make the list sane again. */
         Py_SIZE(self) = m;
     }
+    _PyObject_UNLOCK(self);
     /* Else m + n overflowed; on the chance that n lied, and there really
      * is enough room, ignore it.  If n was telling the truth, we'll
      * eventually run out of memory during the loop.
@@ -856,13 +1019,16 @@ listextend(PyListObject *self, PyObject *b)
             }
             break;
         }
+        _PyObject_LOCK(self);
         if (Py_SIZE(self) < self->allocated) {
             /* steals ref */
             PyList_SET_ITEM(self, Py_SIZE(self), item);
             ++Py_SIZE(self);
+            _PyObject_UNLOCK(self);
         }
         else {
             int status = app1(self, item);
+            _PyObject_UNLOCK(self);
             Py_DECREF(item);  /* append creates a new ref */
             if (status < 0)
                 goto error;
@@ -870,10 +1036,14 @@ listextend(PyListObject *self, PyObject *b)
     }
 
     /* Cut back result list if initial guess was too large. */
+    _PyObject_LOCK(self);
     if (Py_SIZE(self) < self->allocated) {
-        if (list_resize(self, Py_SIZE(self)) < 0)
+        if (list_resize(self, Py_SIZE(self)) < 0) {
+            _PyObject_UNLOCK(self);
             goto error;
+        }
     }
+    _PyObject_UNLOCK(self);
 
     Py_DECREF(it);
     Py_RETURN_NONE;
@@ -912,20 +1082,24 @@ listpop(PyListObject *self, PyObject *args)
     if (!PyArg_ParseTuple(args, "|n:pop", &i))
         return NULL;
 
+    _PyObject_LOCK(self);
     if (Py_SIZE(self) == 0) {
         /* Special-case most common failure cause */
+        _PyObject_UNLOCK(self);
         PyErr_SetString(PyExc_IndexError, "pop from empty list");
         return NULL;
     }
     if (i < 0)
         i += Py_SIZE(self);
     if (i < 0 || i >= Py_SIZE(self)) {
+        _PyObject_UNLOCK(self);
         PyErr_SetString(PyExc_IndexError, "pop index out of range");
         return NULL;
     }
     v = self->ob_item[i];
     if (i == Py_SIZE(self) - 1) {
         status = list_resize(self, Py_SIZE(self) - 1);
+        _PyObject_UNLOCK(self);
         if (status >= 0)
             return v; /* and v now owns the reference the list had */
         else
@@ -933,6 +1107,7 @@ listpop(PyListObject *self, PyObject *args)
     }
     Py_INCREF(v);
     status = list_ass_slice(self, i, i+1, (PyObject *)NULL);
+    _PyObject_UNLOCK(self);
     if (status < 0) {
         Py_DECREF(v);
         return NULL;
@@ -1937,12 +2112,14 @@ listsort(PyListObject *self, PyObject *args, PyObject *kwds)
      * sorting (allowing mutations during sorting is a core-dump
      * factory, since ob_item may change).
      */
+    _PyObject_LOCK(self);
     saved_ob_size = Py_SIZE(self);
     saved_ob_item = self->ob_item;
     saved_allocated = self->allocated;
     Py_SIZE(self) = 0;
     self->ob_item = NULL;
     self->allocated = -1; /* any operation will reset it to >= 0 */
+    _PyObject_UNLOCK(self);
 
     if (keyfunc == NULL) {
         keys = NULL;
@@ -2058,11 +2235,13 @@ fail:
     merge_freemem(&ms);
 
 keyfunc_fail:
+    _PyObject_LOCK(self);
     final_ob_item = self->ob_item;
     i = Py_SIZE(self);
     Py_SIZE(self) = saved_ob_size;
     self->ob_item = saved_ob_item;
     self->allocated = saved_allocated;
+    _PyObject_UNLOCK(self);
     if (final_ob_item != NULL) {
         /* we cannot use list_clear() for this because it does not
            guarantee that the list is really empty when it returns */
@@ -2094,8 +2273,10 @@ PyList_Sort(PyObject *v)
 static PyObject *
 listreverse(PyListObject *self)
 {
+    _PyObject_LOCK(self);
     if (Py_SIZE(self) > 1)
         reverse_slice(self->ob_item, self->ob_item + Py_SIZE(self));
+    _PyObject_UNLOCK(self);
     Py_RETURN_NONE;
 }
 
@@ -2108,8 +2289,10 @@ PyList_Reverse(PyObject *v)
         PyErr_BadInternalCall();
         return -1;
     }
+    _PyObject_LOCK(self);
     if (Py_SIZE(self) > 1)
         reverse_slice(self->ob_item, self->ob_item + Py_SIZE(self));
+    _PyObject_UNLOCK(self);
     return 0;
 }
 
@@ -2123,10 +2306,13 @@ PyList_AsTuple(PyObject *v)
         PyErr_BadInternalCall();
         return NULL;
     }
+    _PyObject_LOCK((PyListObject *)v);
     n = Py_SIZE(v);
     w = PyTuple_New(n);
-    if (w == NULL)
+    if (w == NULL) {
+        _PyObject_UNLOCK((PyListObject *)v);
         return NULL;
+    }
     p = ((PyTupleObject *)w)->ob_item;
     q = ((PyListObject *)v)->ob_item;
     while (--n >= 0) {
@@ -2135,6 +2321,7 @@ PyList_AsTuple(PyObject *v)
         p++;
         q++;
     }
+    _PyObject_UNLOCK((PyListObject *)v);
     return w;
 }
 
@@ -2159,7 +2346,12 @@ listindex(PyListObject *self, PyObject *args)
             stop = 0;
     }
     for (i = start; i < stop && i < Py_SIZE(self); i++) {
-        int cmp = PyObject_RichCompareBool(self->ob_item[i], v, Py_EQ);
+        int cmp;
+        PyObject *item = list_item_or_null(self, i);
+        if (item == NULL)
+            break;
+        cmp = PyObject_RichCompareBool(item, v, Py_EQ);
+        Py_DECREF(item);
         if (cmp > 0)
             return PyLong_FromSsize_t(i);
         else if (cmp < 0)
@@ -2176,7 +2368,12 @@ listcount(PyListObject *self, PyObject *v)
     Py_ssize_t i;
 
     for (i = 0; i < Py_SIZE(self); i++) {
-        int cmp = PyObject_RichCompareBool(self->ob_item[i], v, Py_EQ);
+        int cmp;
+        PyObject *item = list_item_or_null(self, i);
+        if (item == NULL)
+            break;
+        cmp = PyObject_RichCompareBool(item, v, Py_EQ);
+        Py_DECREF(item);
         if (cmp > 0)
             count++;
         else if (cmp < 0)
@@ -2191,7 +2388,12 @@ listremove(PyListObject *self, PyObject *v)
     Py_ssize_t i;
 
     for (i = 0; i < Py_SIZE(self); i++) {
-        int cmp = PyObject_RichCompareBool(self->ob_item[i], v, Py_EQ);
+        int cmp;
+        PyObject *item = list_item_or_null(self, i);
+        if (item == NULL)
+            break;
+        cmp = PyObject_RichCompareBool(item, v, Py_EQ);
+        Py_DECREF(item);
         if (cmp > 0) {
             if (list_ass_slice(self, i, i+1,
                                (PyObject *)NULL) == 0)
@@ -2219,6 +2421,7 @@ static PyObject *
 list_richcompare(PyObject *v, PyObject *w, int op)
 {
     PyListObject *vl, *wl;
+    PyObject *vitem = NULL, *witem = NULL, *result;
     Py_ssize_t i;
 
     if (!PyList_Check(v) || !PyList_Check(w))
@@ -2239,16 +2442,25 @@ list_richcompare(PyObject *v, PyObject *w, int op)
     }
 
     /* Search for the first index where items are different */
-    for (i = 0; i < Py_SIZE(vl) && i < Py_SIZE(wl); i++) {
-        int k = PyObject_RichCompareBool(vl->ob_item[i],
-                                         wl->ob_item[i], Py_EQ);
-        if (k < 0)
+    for (i = 0; ; i++) {
+        int k;
+        vitem = list_item_or_null(vl, i);
+        witem = list_item_or_null(wl, i);
+        if (vitem == NULL || witem == NULL)
+            break;
+        k = PyObject_RichCompareBool(vitem, witem, Py_EQ);
+        if (k < 0) {
+            Py_DECREF(vitem);
+            Py_DECREF(witem);
             return NULL;
+        }
         if (!k)
             break;
+        Py_DECREF(vitem);
+        Py_DECREF(witem);
     }
 
-    if (i >= Py_SIZE(vl) || i >= Py_SIZE(wl)) {
+    if (vitem == NULL || witem == NULL) {
         /* No more items to compare -- compare sizes */
         Py_ssize_t vs = Py_SIZE(vl);
         Py_ssize_t ws = Py_SIZE(wl);
@@ -2261,8 +2473,10 @@ list_richcompare(PyObject *v, PyObject *w, int op)
         case Py_NE: cmp = vs != ws; break;
         case Py_GT: cmp = vs >  ws; break;
         case Py_GE: cmp = vs >= ws; break;
-        default: return NULL; /* cannot happen */
+        default: cmp = 0; /* cannot happen */
         }
+        Py_XDECREF(vitem);
+        Py_XDECREF(witem);
         if (cmp)
             res = Py_True;
         else
@@ -2272,17 +2486,17 @@ list_richcompare(PyObject *v, PyObject *w, int op)
     }
 
     /* We have an item that differs -- shortcuts for EQ/NE */
-    if (op == Py_EQ) {
-        Py_INCREF(Py_False);
-        return Py_False;
-    }
-    if (op == Py_NE) {
-        Py_INCREF(Py_True);
-        return Py_True;
+    if (op == Py_EQ || op == Py_NE) {
+        Py_DECREF(vitem);
+        Py_DECREF(witem);
+        return PyBool_FromLong(op == Py_NE);
     }
 
     /* Compare the final item again using the proper operator */
-    return PyObject_RichCompare(vl->ob_item[i], wl->ob_item[i], op);
+    result = PyObject_RichCompare(vitem, witem, op);
+    Py_DECREF(vitem);
+    Py_DECREF(witem);
+    return result;
 }
 
 static int
@@ -2408,11 +2622,12 @@ list_subscript(PyListObject* self, PyObject* item)
     }
     else if (PySlice_Check(item)) {
         Py_ssize_t start, stop, step, slicelength, cur, i;
+        Py_ssize_t size = Py_SIZE(self);
         PyObject* result;
         PyObject* it;
         PyObject **src, **dest;
 
-        if (PySlice_GetIndicesEx(item, Py_SIZE(self),
+        if (PySlice_GetIndicesEx(item, size,
                          &start, &stop, &step, &slicelength) < 0) {
             return NULL;
         }
@@ -2427,6 +2642,17 @@ list_subscript(PyListObject* self, PyObject* item)
             result = PyList_New(slicelength);
             if (!result) return NULL;
 
+            _PyObject_LOCK(self);
+            if (Py_SIZE(self) != size) {
+                /* Another thread resized the list since the indices
+                   were computed */
+                _PyObject_UNLOCK(self);
+                Py_SIZE(result) = 0;
+                Py_DECREF(result);
+                PyErr_SetString(PyExc_RuntimeError,
+                                "list changed size during slicing");
+                return NULL;
+            }
             src = self->ob_item;
             dest = ((PyListObject *)result)->ob_item;
             for (cur = start, i = 0; i < slicelength;
@@ -2435,6 +2661,7 @@ list_subscript(PyListObject* self, PyObject* item)
                 Py_INCREF(it);
                 dest[i] = it;
             }
+            _PyObject_UNLOCK(self);
 
             return result;
         }
@@ -2460,8 +2687,9 @@ list_ass_subscript(PyListObject* self, PyObject* item, PyObject* value)
     }
     else if (PySlice_Check(item)) {
         Py_ssize_t start, stop, step, slicelength;
+        Py_ssize_t size = Py_SIZE(self);
 
-        if (PySlice_GetIndicesEx(item, Py_SIZE(self),
+        if (PySlice_GetIndicesEx(item, size,
                          &start, &stop, &step, &slicelength) < 0) {
             return -1;
         }
@@ -2501,6 +2729,15 @@ list_ass_subscript(PyListObject* self, PyObject* item, PyObject* value)
                 return -1;
             }
 
+            _PyObject_LOCK(self);
+            if (Py_SIZE(self) != size) {
+                _PyObject_UNLOCK(self);
+                PyMem_FREE(garbage);
+                PyErr_SetString(PyExc_RuntimeError,
+                                "list changed size during assignment");
+                return -1;
+            }
+
             /* drawing pictures might help understand these for
                loops. Basically, we memmove the parts of the
                list that are *not* part of the slice: step-1
@@ -2532,6 +2769,7 @@ list_ass_subscript(PyListObject* self, PyObject* item, PyObject* value)
 
             Py_SIZE(self) -= slicelength;
             res = list_resize(self, Py_SIZE(self));
+            _PyObject_UNLOCK(self);
 
             for (i = 0; i < slicelength; i++) {
                 Py_DECREF(garbage[i]);
@@ -2583,6 +2821,15 @@ list_ass_subscript(PyListObject* self, PyObject* item, PyObject* value)
                 return -1;
             }
 
+            _PyObject_LOCK(self);
+            if (Py_SIZE(self) != size) {
+                _PyObject_UNLOCK(self);
+                PyMem_FREE(garbage);
+                Py_DECREF(seq);
+                PyErr_SetString(PyExc_RuntimeError,
+                                "list changed size during assignment");
+                return -1;
+            }
             selfitems = self->ob_item;
             seqitems = PySequence_Fast_ITEMS(seq);
             for (cur = start, i = 0; i < slicelength;
@@ -2592,6 +2839,7 @@ list_ass_subscript(PyListObject* self, PyObject* item, PyObject* value)
                 Py_INCREF(ins);
                 selfitems[cur] = ins;
             }
+            _PyObject_UNLOCK(self);
 
             for (i = 0; i < slicelength; i++) {
                 Py_DECREF(garbage[i]);
@@ -2769,10 +3017,9 @@ listiter_next(listiterobject *it)
         return NULL;
     assert(PyList_Check(seq));
 
-    if (it->it_index < PyList_GET_SIZE(seq)) {
-        item = PyList_GET_ITEM(seq, it->it_index);
+    item = list_item_or_null(seq, it->it_index);
+    if (item != NULL) {
         ++it->it_index;
-        Py_INCREF(item);
         return item;
     }
 
@@ -2917,10 +3164,9 @@ listreviter_next(listreviterobject *it)
     assert(PyList_Check(seq));
 
     index = it->it_index;
-    if (index>=0 && index < PyList_GET_SIZE(seq)) {
-        item = PyList_GET_ITEM(seq, index);
+    item = list_item_or_null(seq, index);
+    if (item != NULL) {
         it->it_index--;
-        Py_INCREF(item);
         return item;
     }
     it->it_index = -1;
@@ -5429,7 +5429,7 @@ _PyLong_Init(void)
             /* _Py_NewReference sets the ref count to 1 but
              * the ref count might be larger. Set the refcnt
              * to the original refcnt + 1 */
-            Py_REFCNT(op) = refcnt + 1;
+            _Py_SET_REFCNT(op, refcnt + 1);
             assert(Py_SIZE(op) == size);
             assert(v->ob_digit[0] == (digit)abs(ival));
         }
@@ -5438,6 +5438,10 @@ _PyLong_Init(void)
         }
         Py_SIZE(v) = size;
         v->ob_digit[0] = (digit)abs(ival);
+#ifdef WITHOUT_GIL
+        /* Every thread uses the small ints: don't count their references */
+        _Py_SetImmortal((PyObject *)v);
+#endif
     }
 #endif
     /* initialize int_info */
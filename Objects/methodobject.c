@@ -7,8 +7,8 @@
 /* Free list for method objects to safe malloc/free overhead
  * The m_self element is used to chain the objects.
  */
-static PyCFunctionObject *free_list = NULL;
-static int numfree = 0;
+static _Py_PER_THREAD PyCFunctionObject *free_list = NULL;
+static _Py_PER_THREAD int numfree = 0;
 #ifndef PyCFunction_MAXFREELIST
 #define PyCFunction_MAXFREELIST 256
 #endif
@@ -77,6 +77,48 @@ PyCFunction_GetFlags(PyObject *op)
     return PyCFunction_GET_FLAGS(op);
 }
 
+/* Call a METH_FASTCALL function with an argument tuple and a keyword
+   dict: the positional arguments are passed in place, and the keyword
+   arguments are copied after them only if there are any. */
+static PyObject *
+call_fast_with_dict(PyCFunctionObject *f, PyObject *self, PyObject *args,
+                    PyObject *kwds)
+{
+    _PyCFunctionFast meth = (_PyCFunctionFast)f->m_ml->ml_meth;
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    Py_ssize_t nkwargs, i, pos;
+    PyObject **stack, *kwnames, *key, *value, *res;
+
+    nkwargs = kwds == NULL ? 0 : PyDict_Size(kwds);
+    if (nkwargs == 0)
+        return (*meth)(self, &PyTuple_GET_ITEM(args, 0), nargs, NULL);
+
+    if ((size_t)nargs + nkwargs > PY_SSIZE_T_MAX / sizeof(PyObject *))
+        return PyErr_NoMemory();
+    stack = PyMem_Malloc((nargs + nkwargs) * sizeof(PyObject *));
+    if (stack == NULL)
+        return PyErr_NoMemory();
+    kwnames = PyTuple_New(nkwargs);
+    if (kwnames == NULL) {
+        PyMem_Free(stack);
+        return NULL;
+    }
+    for (i = 0; i < nargs; i++)
+        stack[i] = PyTuple_GET_ITEM(args, i);
+    /* The values are borrowed from kwds, which the callee can't see */
+    i = pos = 0;
+    while (PyDict_Next(kwds, &pos, &key, &value)) {
+        Py_INCREF(key);
+        PyTuple_SET_ITEM(kwnames, i, key);
+        stack[nargs + i] = value;
+        i++;
+    }
+    res = (*meth)(self, stack, nargs, kwnames);
+    Py_DECREF(kwnames);
+    PyMem_Free(stack);
+    return res;
+}
+
 PyObject *
 PyCFunction_Call(PyObject *func, PyObject *args, PyObject *kwds)
 {
@@ -97,6 +139,9 @@ PyCFunction_Call(PyObject *func, PyObject *args, PyObject *kwds)
     if (flags == (METH_VARARGS | METH_KEYWORDS)) {
         res = (*(PyCFunctionWithKeywords)meth)(self, args, kwds);
     }
+    else if (flags == METH_FASTCALL) {
+        res = call_fast_with_dict(f, self, args, kwds);
+    }
     else {
         if (kwds != NULL && PyDict_Size(kwds) != 0) {
             PyErr_Format(PyExc_TypeError, "%.200s() takes no keyword arguments",
@@ -22,15 +22,12 @@ _Py_GetRefTotal(void)
 {
     PyObject *o;
     Py_ssize_t total = _Py_RefTotal;
-    /* ignore the references to the dummy object of the dicts and sets
+    /* ignore the references to the dummy object of the sets
        because they are not reliable and not useful (now that the
        hash table code is well-tested) */
-    o = _PyDict_Dummy();
-    if (o != NULL)
-        total -= o->ob_refcnt;
     o = _PySet_Dummy;
     if (o != NULL)
-        total -= o->ob_refcnt;
+        total -= Py_REFCNT(o);
     return total;
 }
 
@@ -62,6 +59,26 @@ _PyDebug_PrintTotalRefs(void) {
  */
 static PyObject refchain = {&refchain, &refchain};
 
+/* Without the GIL, refchain_lock protects the links of the list against
+   threads creating and destroying objects concurrently.  Like the gc lock,
+   it is a plain spinlock: it is only ever held for a few pointer updates. */
+#ifdef WITHOUT_GIL
+#ifdef HAVE_SCHED_H
+#include <sched.h>
+#define REFCHAIN_LOCK_YIELD() sched_yield()
+#else
+#define REFCHAIN_LOCK_YIELD()
+#endif
+static int refchain_lock = 0;
+#define REFCHAIN_LOCK() \
+    while (__atomic_exchange_n(&refchain_lock, 1, __ATOMIC_ACQUIRE)) \
+        REFCHAIN_LOCK_YIELD()
+#define REFCHAIN_UNLOCK() __atomic_store_n(&refchain_lock, 0, __ATOMIC_RELEASE)
+#else
+#define REFCHAIN_LOCK()
+#define REFCHAIN_UNLOCK()
+#endif
+
 /* Insert op at the front of the list of all objects.  If force is true,
  * op is added even if _ob_prev and _ob_next are non-NULL already.  If
  * force is false amd _ob_prev or _ob_next are non-NULL, do nothing.
@@ -85,10 +102,12 @@ _Py_AddToAllObjects(PyObject *op, int force)
     }
 #endif
     if (force || op->_ob_prev == NULL) {
+        REFCHAIN_LOCK();
         op->_ob_next = refchain._ob_next;
         op->_ob_prev = &refchain;
         refchain._ob_next->_ob_prev = op;
         refchain._ob_next = op;
+        REFCHAIN_UNLOCK();
     }
 }
 #endif  /* Py_TRACE_REFS */
@@ -215,7 +234,7 @@ _Py_NegativeRefcount(const char *fname, int lineno, PyObject *op)
     PyOS_snprintf(buf, sizeof(buf),
                   "%s:%i object at %p has negative ref count "
                   "%" PY_FORMAT_SIZE_T "d",
-                  fname, lineno, op, op->ob_refcnt);
+                  fname, lineno, op, Py_REFCNT(op));
     Py_FatalError(buf);
 }
 
@@ -233,6 +252,109 @@ Py_DecRef(PyObject *o)
     Py_XDECREF(o);
 }
 
+#ifdef WITHOUT_GIL
+/* Slow paths of biased reference counting; see Include/object.h. */
+
+void
+_Py_SetRefCnt(PyObject *op, Py_ssize_t refcnt)
+{
+    /* Apply the difference rather than overwriting either part, so that
+       concurrent changes made by other threads aren't lost */
+    Py_ssize_t delta = refcnt - _Py_RefCnt(op);
+
+    if (_Py_IsImmortal(op))
+        return;
+    if (_Py_IsOwnedByCurrentThread(op))
+        op->ob_refcnt += delta;
+    else
+        __atomic_add_fetch(&op->ob_ref_shared, delta * _Py_REF_SHARED_ONE,
+                           __ATOMIC_RELAXED);
+}
+
+/* Drop a reference through the shared count */
+void
+_Py_DecRefShared(PyObject *op)
+{
+    Py_ssize_t shared, new_shared;
+    int queue;
+
+    shared = __atomic_load_n(&op->ob_ref_shared, __ATOMIC_RELAXED);
+    do {
+        /* If the shared count would become negative, the reference we
+           drop was counted by the owner.  Keep it, and give the object to
+           the owner instead, which drops it when merging the counts. */
+        queue = (shared == 0);
+        if (queue)
+            new_shared = _Py_REF_QUEUED;
+        else
+            new_shared = shared - _Py_REF_SHARED_ONE;
+    } while (!__atomic_compare_exchange_n(&op->ob_ref_shared, &shared,
+                                          new_shared, 0, __ATOMIC_ACQ_REL,
+                                          __ATOMIC_RELAXED));
+
+    if (queue)
+        _PyThreadState_QueueRefCntMerge(op);
+    else if (new_shared == _Py_REF_MERGED)
+        _Py_Dealloc(op);
+}
+
+/* Called by the owner when ob_refcnt drops to zero */
+void
+_Py_MergeZeroRefCnt(PyObject *op)
+{
+    Py_ssize_t shared, new_shared;
+
+    shared = __atomic_load_n(&op->ob_ref_shared, __ATOMIC_ACQUIRE);
+    if (shared == 0) {
+        /* No other thread ever took a reference */
+        _Py_Dealloc(op);
+        return;
+    }
+
+    /* Give the object up: from now on every thread uses the shared count,
+       which holds the true reference count */
+    __atomic_store_n(&op->ob_owner, 0, __ATOMIC_RELAXED);
+    do {
+        new_shared = (shared & ~_Py_REF_FLAGS_MASK) | _Py_REF_MERGED;
+    } while (!__atomic_compare_exchange_n(&op->ob_ref_shared, &shared,
+                                          new_shared, 0, __ATOMIC_ACQ_REL,
+                                          __ATOMIC_RELAXED));
+    if (new_shared == _Py_REF_MERGED)
+        _Py_Dealloc(op);
+}
+
+/* Fold ob_refcnt into the shared count, add `extra` to it and return the
+   resulting reference count.  Only the owner may call this, or another
+   thread when the owner is gone or stopped. */
+Py_ssize_t
+_Py_ExplicitMergeRefCnt(PyObject *op, Py_ssize_t extra)
+{
+    Py_ssize_t shared, new_shared, refcnt;
+
+    /* The object may have been made immortal after it was queued */
+    if (_Py_IsImmortal(op))
+        return _Py_IMMORTAL_REFCNT;
+    shared = __atomic_load_n(&op->ob_ref_shared, __ATOMIC_RELAXED);
+    do {
+        refcnt = op->ob_refcnt + (shared >> _Py_REF_SHARED_SHIFT) + extra;
+        new_shared = refcnt * _Py_REF_SHARED_ONE | _Py_REF_MERGED;
+    } while (!__atomic_compare_exchange_n(&op->ob_ref_shared, &shared,
+                                          new_shared, 0, __ATOMIC_ACQ_REL,
+                                          __ATOMIC_RELAXED));
+    op->ob_refcnt = 0;
+    __atomic_store_n(&op->ob_owner, 0, __ATOMIC_RELAXED);
+    return refcnt;
+}
+
+void
+_Py_SetImmortal(PyObject *op)
+{
+    __atomic_store_n(&op->ob_owner, 0, __ATOMIC_RELAXED);
+    op->ob_refcnt = _Py_IMMORTAL_REFCNT;
+    __atomic_store_n(&op->ob_ref_shared, 0, __ATOMIC_RELEASE);
+}
+#endif /* WITHOUT_GIL */
+
 PyObject *
 PyObject_Init(PyObject *op, PyTypeObject *tp)
 {
@@ -302,27 +424,28 @@ PyObject_CallFinalizerFromDealloc(PyObject *self)
     Py_ssize_t refcnt;
 
     /* Temporarily resurrect the object. */
-    if (self->ob_refcnt != 0) {
+    if (Py_REFCNT(self) != 0) {
         Py_FatalError("PyObject_CallFinalizerFromDealloc called on "
                       "object with a non-zero refcount");
     }
-    self->ob_refcnt = 1;
+    _Py_SET_REFCNT(self, 1);
 
     PyObject_CallFinalizer(self);
 
     /* Undo the temporary resurrection; can't use DECREF here, it would
      * cause a recursive call.
      */
-    assert(self->ob_refcnt > 0);
-    if (--self->ob_refcnt == 0)
+    assert(Py_REFCNT(self) > 0);
+    refcnt = Py_REFCNT(self) - 1;
+    _Py_SET_REFCNT(self, refcnt);
+    if (refcnt == 0)
         return 0;         /* this is the normal path out */
 
     /* tp_finalize resurrected it!  Make it look like the original Py_DECREF
      * never happened.
      */
-    refcnt = self->ob_refcnt;
     _Py_NewReference(self);
-    self->ob_refcnt = refcnt;
+    _Py_SET_REFCNT(self, refcnt);
 
     if (PyType_IS_GC(Py_TYPE(self))) {
         assert(_PyGC_REFS(self) != _PyGC_REFS_UNTRACKED);
@@ -362,12 +485,12 @@ PyObject_Print(PyObject *op, FILE *fp, int flags)
         Py_END_ALLOW_THREADS
     }
     else {
-        if (op->ob_refcnt <= 0)
+        if (Py_REFCNT(op) <= 0)
             /* XXX(twouters) cast refcount to long until %zd is
                universally available */
             Py_BEGIN_ALLOW_THREADS
             fprintf(fp, "<refcnt %ld at %p>",
-                (long)op->ob_refcnt, op);
+                (long)Py_REFCNT(op), op);
             Py_END_ALLOW_THREADS
         else {
             PyObject *s;
@@ -449,7 +572,7 @@ _PyObject_Dump(PyObject* op)
             "refcount: %ld\n"
             "address : %p\n",
             Py_TYPE(op)==NULL ? "NULL" : Py_TYPE(op)->tp_name,
-            (long)op->ob_refcnt,
+            (long)Py_REFCNT(op),
             op);
     }
 }
@@ -939,7 +1062,7 @@ PyObject_SetAttr(PyObject *v, PyObject *name, PyObject *value)
         return err;
     }
     Py_DECREF(name);
-    assert(name->ob_refcnt >= 1);
+    assert(Py_REFCNT(name) >= 1);
     if (tp->tp_getattr == NULL && tp->tp_getattro == NULL)
         PyErr_Format(PyExc_TypeError,
                      "'%.100s' object has no attributes "
@@ -1118,6 +1241,87 @@ PyObject_GenericGetAttr(PyObject *obj, PyObject *name)
     return _PyObject_GenericGetAttrWithDict(obj, name, NULL);
 }
 
+/* Look up the attribute name of obj for a method call (LOAD_METHOD).
+
+   If the attribute is a Python function found in the type of obj, and not
+   hidden by the instance dict, store a new reference to the function itself
+   in *method and return 1: the caller calls it with obj as first argument,
+   which avoids creating a bound method object.  Otherwise, store the value
+   of the attribute, or NULL with an exception set, in *method and return 0.
+*/
+int
+_PyObject_GetMethod(PyObject *obj, PyObject *name, PyObject **method)
+{
+    PyTypeObject *tp = Py_TYPE(obj);
+    PyObject *descr;
+    descrgetfunc f = NULL;
+    PyObject **dictptr, *dict, *attr;
+    int meth_found = 0;
+
+    assert(*method == NULL);
+
+    if (tp->tp_getattro != PyObject_GenericGetAttr || !PyUnicode_Check(name)) {
+        *method = PyObject_GetAttr(obj, name);
+        return 0;
+    }
+
+    if (tp->tp_dict == NULL) {
+        if (PyType_Ready(tp) < 0)
+            return 0;
+    }
+
+    descr = _PyType_Lookup(tp, name);
+    if (descr != NULL) {
+        Py_INCREF(descr);
+        if (PyFunction_Check(descr)) {
+            meth_found = 1;
+        }
+        else {
+            f = descr->ob_type->tp_descr_get;
+            if (f != NULL && PyDescr_IsData(descr)) {
+                *method = f(descr, obj, (PyObject *)tp);
+                Py_DECREF(descr);
+                return 0;
+            }
+        }
+    }
+
+    dictptr = _PyObject_GetDictPtr(obj);
+    if (dictptr != NULL && (dict = *dictptr) != NULL) {
+        Py_INCREF(dict);
+        attr = PyDict_GetItem(dict, name);
+        if (attr != NULL) {
+            Py_INCREF(attr);
+            *method = attr;
+            Py_DECREF(dict);
+            Py_XDECREF(descr);
+            return 0;
+        }
+        Py_DECREF(dict);
+    }
+
+    if (meth_found) {
+        *method = descr;
+        return 1;
+    }
+
+    if (f != NULL) {
+        *method = f(descr, obj, (PyObject *)tp);
+        Py_DECREF(descr);
+        return 0;
+    }
+
+    if (descr != NULL) {
+        *method = descr;
+        return 0;
+    }
+
+    PyErr_Format(PyExc_AttributeError,
+                 "'%.50s' object has no attribute '%U'",
+                 tp->tp_name, name);
+    return 0;
+}
+
 int
 _PyObject_GenericSetAttrWithDict(PyObject *obj, PyObject *name,
                                  PyObject *value, PyObject *dict)
@@ -1456,7 +1660,7 @@ PyTypeObject _PyNone_Type = {
 
 PyObject _Py_NoneStruct = {
   _PyObject_EXTRA_INIT
-  1, &_PyNone_Type
+  _Py_STATIC_REFCNT, &_PyNone_Type
 };
 
 /* NotImplemented is an object that can be used to signal that an
@@ -1541,7 +1745,7 @@ PyTypeObject _PyNotImplemented_Type = {
 
 PyObject _Py_NotImplementedStruct = {
     _PyObject_EXTRA_INIT
-    1, &_PyNotImplemented_Type
+    _Py_STATIC_REFCNT, &_PyNotImplemented_Type
 };
 
 void
@@ -1720,6 +1924,11 @@ _Py_ReadyTypes(void)
 
     if (PyType_Ready(&_PyCoroWrapper_Type) < 0)
         Py_FatalError("Can't initialize coroutine wrapper type");
+
+#ifdef WITH_THREAD
+    if (PyType_Ready(&_PyChannelBuffer_Type) < 0)
+        Py_FatalError("Can't initialize channel buffer type");
+#endif
 }
 
 
@@ -1729,7 +1938,7 @@ void
 _Py_NewReference(PyObject *op)
 {
     _Py_INC_REFTOTAL;
-    op->ob_refcnt = 1;
+    _Py_INIT_REFCNT(op);
     _Py_AddToAllObjects(op, 1);
     _Py_INC_TPALLOCS(op);
 }
@@ -1740,10 +1949,12 @@ _Py_ForgetReference(PyObject *op)
 #ifdef SLOW_UNREF_CHECK
     PyObject *p;
 #endif
-    if (op->ob_refcnt < 0)
+    if (Py_REFCNT(op) < 0)
         Py_FatalError("UNREF negative refcnt");
+    REFCHAIN_LOCK();
     if (op == &refchain ||
         op->_ob_prev->_ob_next != op || op->_ob_next->_ob_prev != op) {
+        REFCHAIN_UNLOCK();
         fprintf(stderr, "* ob\n");
         _PyObject_Dump(op);
         fprintf(stderr, "* op->_ob_prev->_ob_next\n");
@@ -1757,12 +1968,15 @@ _Py_ForgetReference(PyObject *op)
         if (p == op)
             break;
     }
-    if (p == &refchain) /* Not found */
+    if (p == &refchain) { /* Not found */
+        REFCHAIN_UNLOCK();
         Py_FatalError("UNREF unknown object");
+    }
 #endif
     op->_ob_next->_ob_prev = op->_ob_prev;
     op->_ob_prev->_ob_next = op->_ob_next;
     op->_ob_next = op->_ob_prev = NULL;
+    REFCHAIN_UNLOCK();
     _Py_INC_TPFREES(op);
 }
 
@@ -1783,7 +1997,7 @@ _Py_PrintReferences(FILE *fp)
     PyObject *op;
     fprintf(fp, "Remaining objects:\n");
     for (op = refchain._ob_next; op != &refchain; op = op->_ob_next) {
-        fprintf(fp, "%p [%" PY_FORMAT_SIZE_T "d] ", op, op->ob_refcnt);
+        fprintf(fp, "%p [%" PY_FORMAT_SIZE_T "d] ", op, Py_REFCNT(op));
         if (PyObject_Print(op, fp, 0) != 0)
             PyErr_Clear();
         putc('\n', fp);
@@ -1800,7 +2014,7 @@ _Py_PrintReferenceAddresses(FILE *fp)
     fprintf(fp, "Remaining object addresses:\n");
     for (op = refchain._ob_next; op != &refchain; op = op->_ob_next)
         fprintf(fp, "%p [%" PY_FORMAT_SIZE_T "d] %s\n", op,
-            op->ob_refcnt, Py_TYPE(op)->tp_name);
+            Py_REFCNT(op), Py_TYPE(op)->tp_name);
 }
 
 PyObject *
@@ -1945,7 +2159,7 @@ _PyTrash_deposit_object(PyObject *op)
 {
     assert(PyObject_IS_GC(op));
     assert(_PyGC_REFS(op) == _PyGC_REFS_UNTRACKED);
-    assert(op->ob_refcnt == 0);
+    assert(Py_REFCNT(op) == 0);
     _Py_AS_GC(op)->gc.gc_prev = (PyGC_Head *)_PyTrash_delete_later;
     _PyTrash_delete_later = op;
 }
@@ -1957,7 +2171,7 @@ _PyTrash_thread_deposit_object(PyObject *op)
     PyThreadState *tstate = PyThreadState_GET();
     assert(PyObject_IS_GC(op));
     assert(_PyGC_REFS(op) == _PyGC_REFS_UNTRACKED);
-    assert(op->ob_refcnt == 0);
+    assert(Py_REFCNT(op) == 0);
     _Py_AS_GC(op)->gc.gc_prev = (PyGC_Head *) tstate->trash_delete_later;
     tstate->trash_delete_later = op;
 }
@@ -1981,7 +2195,7 @@ _PyTrash_destroy_chain(void)
          * assorted non-release builds calling Py_DECREF again ends
          * up distorting allocation statistics.
          */
-        assert(op->ob_refcnt == 0);
+        assert(Py_REFCNT(op) == 0);
         ++_PyTrash_delete_nesting;
         (*dealloc)(op);
         --_PyTrash_delete_nesting;
@@ -2006,7 +2220,7 @@ _PyTrash_thread_destroy_chain(void)
          * assorted non-release builds calling Py_DECREF again ends
          * up distorting allocation statistics.
          */
-        assert(op->ob_refcnt == 0);
+        assert(Py_REFCNT(op) == 0);
         ++tstate->trash_delete_nesting;
         (*dealloc)(op);
         --tstate->trash_delete_nesting;
@@ -126,7 +126,7 @@ set_lookkey(PySetObject *so, PyObject *key, Py_hash_t hash)
 static int set_table_resize(PySetObject *, Py_ssize_t);
 
 static int
-set_add_entry(PySetObject *so, PyObject *key, Py_hash_t hash)
+set_add_entry_unlocked(PySetObject *so, PyObject *key, Py_hash_t hash)
 {
     setentry *table;
     setentry *freeslot;
@@ -247,6 +247,17 @@ set_add_entry(PySetObject *so, PyObject *key, Py_hash_t hash)
     return -1;
 }
 
+static int
+set_add_entry(PySetObject *so, PyObject *key, Py_hash_t hash)
+{
+    int res;
+
+    _PyObject_LOCK(so);
+    res = set_add_entry_unlocked(so, key, hash);
+    _PyObject_UNLOCK(so);
+    return res;
+}
+
 /*
 Internal routine used by set_table_resize() to insert an item which is
 known to be absent from the set.  This routine also assumes that
@@ -383,11 +394,14 @@ static int
 set_contains_entry(PySetObject *so, PyObject *key, Py_hash_t hash)
 {
     setentry *entry;
+    int res = -1;
 
+    _PyObject_LOCK(so);
     entry = set_lookkey(so, key, hash);
     if (entry != NULL)
-        return entry->key != NULL;
-    return -1;
+        res = entry->key != NULL;
+    _PyObject_UNLOCK(so);
+    return res;
 }
 
 #define DISCARD_NOTFOUND 0
@@ -399,15 +413,21 @@ set_discard_entry(PySetObject *so, PyObject *key, Py_hash_t hash)
     setentry *entry;
     PyObject *old_key;
 
+    _PyObject_LOCK(so);
     entry = set_lookkey(so, key, hash);
-    if (entry == NULL)
+    if (entry == NULL) {
+        _PyObject_UNLOCK(so);
         return -1;
-    if (entry->key == NULL)
+    }
+    if (entry->key == NULL) {
+        _PyObject_UNLOCK(so);
         return DISCARD_NOTFOUND;
+    }
     old_key = entry->key;
     entry->key = dummy;
     entry->hash = -1;
     so->used--;
+    _PyObject_UNLOCK(so);
     Py_DECREF(old_key);
     return DISCARD_FOUND;
 }
@@ -469,13 +489,18 @@ static int
 set_clear_internal(PySetObject *so)
 {
     setentry *entry;
-    setentry *table = so->table;
-    Py_ssize_t fill = so->fill;
-    Py_ssize_t used = so->used;
-    int table_is_malloced = table != so->smalltable;
+    setentry *table;
+    Py_ssize_t fill;
+    Py_ssize_t used;
+    int table_is_malloced;
     setentry small_copy[PySet_MINSIZE];
 
     assert (PyAnySet_Check(so));
+    _PyObject_LOCK(so);
+    table = so->table;
+    fill = so->fill;
+    used = so->used;
+    table_is_malloced = table != so->smalltable;
     assert(table != NULL);
 
     /* This is delicate.  During the process of clearing the set,
@@ -497,6 +522,7 @@ set_clear_internal(PySetObject *so)
         set_empty_to_minsize(so);
     }
     /* else it's a small table that's already empty */
+    _PyObject_UNLOCK(so);
 
     /* Now we can finally clear things.  If C had refcounts, we could
      * assert that the refcount on table is 1 now, i.e. that this function
@@ -625,14 +651,39 @@ set_len(PyObject *so)
     return ((PySetObject *)so)->used;
 }
 
+#ifdef WITHOUT_GIL
+/* Lock two sets in a consistent (address) order, so that two threads
+   locking the same pair can't deadlock. */
+static void
+set_lock_pair(PySetObject *a, PySetObject *b)
+{
+    if (a > b) {
+        PySetObject *tmp = a;
+        a = b;
+        b = tmp;
+    }
+    _PyObject_LOCK(a);
+    _PyObject_LOCK(b);
+}
+
+static void
+set_unlock_pair(PySetObject *a, PySetObject *b)
+{
+    _PyObject_UNLOCK(a);
+    _PyObject_UNLOCK(b);
+}
+#else
+#define set_lock_pair(a, b) ((void)0)
+#define set_unlock_pair(a, b) ((void)0)
+#endif
+
+static int set_merge_locked(PySetObject *so, PySetObject *other);
+
 static int
 set_merge(PySetObject *so, PyObject *otherset)
 {
     PySetObject *other;
-    PyObject *key;
-    Py_ssize_t i;
-    setentry *so_entry;
-    setentry *other_entry;
+    int res;
 
     assert (PyAnySet_Check(so));
     assert (PyAnySet_Check(otherset));
@@ -641,6 +692,20 @@ set_merge(PySetObject *so, PyObject *otherset)
     if (other == so || other->used == 0)
         /* a.update(a) or a.update(set()); nothing to do */
         return 0;
+    set_lock_pair(so, other);
+    res = set_merge_locked(so, other);
+    set_unlock_pair(so, other);
+    return res;
+}
+
+static int
+set_merge_locked(PySetObject *so, PySetObject *other)
+{
+    PyObject *key;
+    Py_ssize_t i;
+    setentry *so_entry;
+    setentry *other_entry;
+
     /* Do one big resize at the start, rather than
      * incrementally resizing as we insert new keys.  Expect
      * that there will be no (or few) overlapping keys.
@@ -690,7 +755,7 @@ set_merge(PySetObject *so, PyObject *otherset)
         other_entry = &other->table[i];
         key = other_entry->key;
         if (key != NULL && key != dummy) {
-            if (set_add_entry(so, key, other_entry->hash))
+            if (set_add_entry_unlocked(so, key, other_entry->hash))
                 return -1;
         }
     }
@@ -701,15 +766,18 @@ static PyObject *
 set_pop(PySetObject *so)
 {
     /* Make sure the search finger is in bounds */
-    Py_ssize_t i = so->finger & so->mask;
+    Py_ssize_t i;
     setentry *entry;
     PyObject *key;
 
     assert (PyAnySet_Check(so));
+    _PyObject_LOCK(so);
     if (so->used == 0) {
+        _PyObject_UNLOCK(so);
         PyErr_SetString(PyExc_KeyError, "pop from an empty set");
         return NULL;
     }
+    i = so->finger & so->mask;
 
     while ((entry = &so->table[i])->key == NULL || entry->key==dummy) {
         i++;
@@ -721,6 +789,7 @@ set_pop(PySetObject *so)
     entry->hash = -1;
     so->used--;
     so->finger = i + 1;         /* next place to start */
+    _PyObject_UNLOCK(so);
     return key;
 }
 
@@ -894,7 +963,9 @@ static PyObject *setiter_iternext(setiterobject *si)
         return NULL;
     assert (PyAnySet_Check(so));
 
+    _PyObject_LOCK(so);
     if (si->si_used != so->used) {
+        _PyObject_UNLOCK(so);
         PyErr_SetString(PyExc_RuntimeError,
                         "Set changed size during iteration");
         si->si_used = -1; /* Make this state sticky */
@@ -908,11 +979,14 @@ static PyObject *setiter_iternext(setiterobject *si)
     while (i <= mask && (entry[i].key == NULL || entry[i].key == dummy))
         i++;
     si->si_pos = i+1;
-    if (i > mask)
+    if (i > mask) {
+        _PyObject_UNLOCK(so);
         goto fail;
+    }
     si->len--;
     key = entry[i].key;
     Py_INCREF(key);
+    _PyObject_UNLOCK(so);
     return key;
 
 fail:
@@ -989,10 +1063,14 @@ set_update_internal(PySetObject *so, PyObject *other)
         */
         if (dictsize < 0)
             return -1;
+        _PyObject_LOCK(so);
         if ((so->fill + dictsize)*3 >= so->mask*2) {
-            if (set_table_resize(so, so->used + dictsize) != 0)
+            if (set_table_resize(so, so->used + dictsize) != 0) {
+                _PyObject_UNLOCK(so);
                 return -1;
+            }
         }
+        _PyObject_UNLOCK(so);
         while (_PyDict_Next(other, &pos, &key, &value, &hash)) {
             if (set_add_entry(so, key, hash))
                 return -1;
@@ -1056,6 +1134,7 @@ make_new_set(PyTypeObject *type, PyObject *iterable)
     so->hash = -1;
     so->finger = 0;
     so->weakreflist = NULL;
+    _PyObject_LOCK_INIT(so);
 
     if (iterable != NULL) {
         if (set_update_internal(so, iterable)) {
@@ -1140,6 +1219,7 @@ set_swap_bodies(PySetObject *a, PySetObject *b)
     setentry tab[PySet_MINSIZE];
     Py_hash_t h;
 
+    set_lock_pair(a, b);
     t = a->fill;     a->fill   = b->fill;        b->fill  = t;
     t = a->used;     a->used   = b->used;        b->used  = t;
     t = a->mask;     a->mask   = b->mask;        b->mask  = t;
@@ -1165,6 +1245,7 @@ set_swap_bodies(PySetObject *a, PySetObject *b)
         a->hash = -1;
         b->hash = -1;
     }
+    set_unlock_pair(a, b);
 }
 
 static PyObject *
@@ -1476,6 +1557,8 @@ PyDoc_STRVAR(isdisjoint_doc,
 static int
 set_difference_update_internal(PySetObject *so, PyObject *other)
 {
+    int res;
+
     if ((PyObject *)so == other)
         return set_clear_internal(so);
 
@@ -1505,9 +1588,13 @@ set_difference_update_internal(PySetObject *so, PyObject *other)
             return -1;
     }
     /* If more than 1/4th are dummies, then resize them away. */
+    _PyObject_LOCK(so);
     if ((size_t)(so->fill - so->used) <= (size_t)so->mask / 4)
-        return 0;
-    return set_table_resize(so, so->used);
+        res = 0;
+    else
+        res = set_table_resize(so, so->used);
+    _PyObject_UNLOCK(so);
+    return res;
 }
 
 static PyObject *
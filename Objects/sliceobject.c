@@ -87,7 +87,7 @@ PyTypeObject PyEllipsis_Type = {
 
 PyObject _Py_EllipsisObject = {
     _PyObject_EXTRA_INIT
-    1, &PyEllipsis_Type
+    _Py_STATIC_REFCNT, &PyEllipsis_Type
 };
 
 
@@ -96,7 +96,7 @@ PyObject _Py_EllipsisObject = {
 /* Using a cache is very effective since typically only a single slice is
  * created and then deleted again
  */
-static PySliceObject *slice_cache = NULL;
+static _Py_PER_THREAD PySliceObject *slice_cache = NULL;
 void PySlice_Fini(void)
 {
     PySliceObject *obj = slice_cache;
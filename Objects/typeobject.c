@@ -33,9 +33,18 @@ struct method_cache_entry {
     PyObject *value;            /* borrowed */
 };
 
-static struct method_cache_entry method_cache[1 << MCACHE_SIZE_EXP];
+/* In the --without-gil build, each thread has its own method cache, while
+   version tags are still handed out from a shared counter. */
+static _Py_PER_THREAD struct method_cache_entry method_cache[1 << MCACHE_SIZE_EXP];
 static unsigned int next_version_tag = 0;
 
+#ifdef WITHOUT_GIL
+#define NEXT_VERSION_TAG() \
+    __atomic_fetch_add(&next_version_tag, 1, __ATOMIC_RELAXED)
+#else
+#define NEXT_VERSION_TAG() (next_version_tag++)
+#endif
+
 #define MCACHE_STATS 0
 
 #if MCACHE_STATS
@@ -191,7 +200,11 @@ PyType_ClearCache(void)
         Py_CLEAR(method_cache[i].name);
         method_cache[i].value = NULL;
     }
+    /* Without the GIL, the caches of other threads may still hold entries
+       tagged with the current version tags: never reuse them. */
+#ifndef WITHOUT_GIL
     next_version_tag = 0;
+#endif
     /* mark all version tags as invalid */
     PyType_Modified(&PyBaseObject_Type);
     return cur_version_tag;
@@ -305,7 +318,7 @@ assign_version_tag(PyTypeObject *type)
     if (!PyType_HasFeature(type, Py_TPFLAGS_READY))
         return 0;
 
-    type->tp_version_tag = next_version_tag++;
+    type->tp_version_tag = NEXT_VERSION_TAG();
     /* for stress-testing: next_version_tag &= 0xFF; */
 
     if (type->tp_version_tag == 0) {
@@ -1095,7 +1108,7 @@ subtype_dealloc(PyObject *self)
         }
         if (type->tp_del) {
             type->tp_del(self);
-            if (self->ob_refcnt > 0)
+            if (Py_REFCNT(self) > 0)
                 return;
         }
 
@@ -1163,7 +1176,7 @@ subtype_dealloc(PyObject *self)
 
     if (type->tp_del) {
         type->tp_del(self);
-        if (self->ob_refcnt > 0) {
+        if (Py_REFCNT(self) > 0) {
             /* Resurrected */
             goto endlabel;
         }
@@ -2902,7 +2915,9 @@ _PyType_Lookup(PyTypeObject *type, PyObject *name)
         else
             method_cache_misses++;
 #endif
-        Py_SETREF(method_cache[h].name, name);
+        /* Under WITHOUT_GIL the cache is per thread, and the cache of a
+           newly started thread still holds NULL names */
+        Py_XSETREF(method_cache[h].name, name);
     }
     return res;
 }
@@ -1759,7 +1759,7 @@ unicode_dealloc(PyObject *unicode)
 
     case SSTATE_INTERNED_MORTAL:
         /* revive dead object temporarily for DelItem */
-        Py_REFCNT(unicode) = 3;
+        _Py_SET_REFCNT(unicode, 3);
         if (PyDict_DelItem(interned, unicode) != 0)
             Py_FatalError(
                 "deletion of interned string failed");
@@ -15053,10 +15053,17 @@ PyUnicode_InternInPlace(PyObject **p)
         return;
     }
     PyThreadState_GET()->recursion_critical = 0;
+#ifdef WITHOUT_GIL
+    /* Interned strings are shared by every thread: make them immortal
+       rather than having threads fight over their reference counts */
+    _Py_SetImmortal(s);
+    _PyUnicode_STATE(s).interned = SSTATE_INTERNED_IMMORTAL;
+#else
     /* The two references in interned are not counted by refcnt.
        The deallocator will take care of this */
-    Py_REFCNT(s) -= 2;
+    _Py_SET_REFCNT(s, Py_REFCNT(s) - 2);
     _PyUnicode_STATE(s).interned = SSTATE_INTERNED_MORTAL;
+#endif
 }
 
 void
@@ -15114,11 +15121,11 @@ _Py_ReleaseInternedUnicodeStrings(void)
             /* XXX Shouldn't happen */
             break;
         case SSTATE_INTERNED_IMMORTAL:
-            Py_REFCNT(s) += 1;
+            _Py_SET_REFCNT(s, Py_REFCNT(s) + 1);
             immortal_size += PyUnicode_GET_LENGTH(s);
             break;
         case SSTATE_INTERNED_MORTAL:
-            Py_REFCNT(s) += 2;
+            _Py_SET_REFCNT(s, Py_REFCNT(s) + 2);
             mortal_size += PyUnicode_GET_LENGTH(s);
             break;
         default:
@@ -38,6 +38,9 @@ extern PyObject* PyInit_itertools(void);
 extern PyObject* PyInit__collections(void);
 extern PyObject* PyInit__heapq(void);
 extern PyObject* PyInit__bisect(void);
+extern PyObject* PyInit__executor(void);
+extern PyObject* PyInit__queue(void);
+extern PyObject* PyInit__subinterpreters(void);
 extern PyObject* PyInit__symtable(void);
 extern PyObject* PyInit_mmap(void);
 extern PyObject* PyInit__csv(void);
@@ -113,6 +116,9 @@ struct _inittab _PyImport_Inittab[] = {
     {"_random", PyInit__random},
     {"_bisect", PyInit__bisect},
     {"_heapq", PyInit__heapq},
+    {"_executor", PyInit__executor},
+    {"_queue", PyInit__queue},
+    {"_subinterpreters", PyInit__subinterpreters},
     {"_lsprof", PyInit__lsprof},
     {"itertools", PyInit_itertools},
     {"_collections", PyInit__collections},
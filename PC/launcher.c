@@ -1089,7 +1089,7 @@ static PYC_MAGIC magic_values[] = {
     { 3190, 3230, L"3.3" },
     { 3250, 3310, L"3.4" },
     { 3320, 3350, L"3.5" },
-    { 3360, 3370, L"3.6" },
+    { 3360, 3371, L"3.6" },
     { 0 }
 };
 
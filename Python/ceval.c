@@ -222,21 +222,242 @@ PyEval_GetCallStats(PyObject *self)
 #endif
 
 
+/* Inline caches of LOAD_GLOBAL, LOAD_ATTR and LOAD_METHOD
+
+   Once a code object has run OPCACHE_MIN_RUNS times, _PyCode_InitOpcache()
+   gives its LOAD_GLOBAL, LOAD_ATTR and LOAD_METHOD instructions a _PyOpcache
+   entry each.
+
+   A LOAD_GLOBAL entry holds the value found by the last lookup, which stays
+   valid as long as neither the globals nor the builtins were modified since:
+   every change to a dict gives it a new, globally unique, ma_version_tag.
+
+   A LOAD_ATTR entry records where the attribute was found in objects of a
+   given type: in the instance dict (at a given index), or in the MRO of the
+   type, as a data descriptor or as anything else.  This stays true as long
+   as the type keeps its tp_version_tag, which changes whenever the type or
+   one of its bases is modified.  LOAD_METHOD entries work the same way, and
+   can also record Python functions found in the MRO of the type, which are
+   called without a bound method.  Sites that keep missing,
+   for instance because they see objects of many types, stop using their
+   entry after OPCACHE_MAX_MISSES misses.
+
+   The entries hold borrowed references: the version tags change before the
+   objects can be released.  Frames running the same code in other threads
+   would race on the entries and on these borrowed references, so the caches
+   are only used with the GIL. */
+#ifndef WITHOUT_GIL
+#define USE_OPCACHE 1
+#endif
+
+#ifdef USE_OPCACHE
+#define OPCACHE_MIN_RUNS 1024
+#define OPCACHE_MAX_MISSES 20
+
+/* Kinds of LOAD_ATTR entries */
+#define LA_INSTANCE 1       /* value in the instance dict at index hint */
+#define LA_DATA_DESCR 2     /* data descriptor of the type */
+#define LA_TYPE 3           /* other attribute of the type */
+#define LA_METHOD 4         /* function of the type, for LOAD_METHOD */
+
+/* Entry of the instruction being executed, or NULL */
+#define OPCACHE_GET() \
+    (co->co_opcache_map == NULL ? NULL : \
+     opcache_entry(co, next_instr - first_instr - 1))
+
+static _PyOpcache *
+opcache_entry(PyCodeObject *co, Py_ssize_t instr)
+{
+    unsigned char ix = co->co_opcache_map[instr];
+    return ix == 0 ? NULL : &co->co_opcache[ix - 1];
+}
+
+static int
+opcache_cacheable_type(PyTypeObject *tp)
+{
+    /* module_getattro() only differs from PyObject_GenericGetAttr() when
+       the attribute is missing */
+    return (tp->tp_getattro == PyObject_GenericGetAttr ||
+            tp->tp_getattro == PyModule_Type.tp_getattro);
+}
+
+/* Look up name in owner using the LOAD_ATTR entry oc.  Return 0 on a miss;
+   otherwise return 1 and store the attribute, or NULL with an exception set,
+   in *res. */
+static int
+opcache_load_attr(_PyOpcache *oc, PyObject *owner, PyObject *name,
+                  PyObject **res)
+{
+    _PyOpcache_LoadAttr *la = &oc->u.la;
+    PyTypeObject *tp = Py_TYPE(owner);
+    PyObject *dict = NULL, *descr, *value;
+    descrgetfunc f;
+    Py_ssize_t ix;
+
+    if (la->tp_version != tp->tp_version_tag ||
+        !PyType_HasFeature(tp, Py_TPFLAGS_VALID_VERSION_TAG))
+        return 0;
+    if (tp->tp_dictoffset > 0)
+        dict = *(PyObject **)((char *)owner + tp->tp_dictoffset);
+
+    if (la->kind == LA_INSTANCE) {
+        if (dict == NULL)
+            return 0;
+        ix = _PyDict_GetItemHint((PyDictObject *)dict, name, la->hint, &value);
+        if (ix < 0)
+            return 0;
+        la->hint = ix;
+        Py_INCREF(value);
+        *res = value;
+        return 1;
+    }
+
+    descr = la->descr;
+    f = Py_TYPE(descr)->tp_descr_get;
+    if (la->kind == LA_DATA_DESCR) {
+        if (f == NULL || !PyDescr_IsData(descr))
+            return 0;
+    }
+    else {
+        if (PyDescr_IsData(descr))
+            return 0;
+        /* The instance dict takes precedence */
+        if (dict != NULL &&
+            _PyDict_GetItemHint((PyDictObject *)dict, name, -1, &value) != -1)
+            return 0;
+        if (f == NULL) {
+            Py_INCREF(descr);
+            *res = descr;
+            return 1;
+        }
+    }
+    Py_INCREF(descr);
+    *res = f(descr, owner, (PyObject *)tp);
+    Py_DECREF(descr);
+    return 1;
+}
+
+/* Fill the LOAD_ATTR entry oc after a successful lookup of name in owner */
+static void
+opcache_fill_load_attr(_PyOpcache *oc, PyObject *owner, PyObject *name)
+{
+    _PyOpcache_LoadAttr *la = &oc->u.la;
+    PyTypeObject *tp = Py_TYPE(owner);
+    PyObject *descr, *dict, *value;
+    Py_ssize_t ix;
+
+    oc->optimized = 0;
+    if (oc->misses >= OPCACHE_MAX_MISSES)
+        return;
+    oc->misses++;
+    if (!opcache_cacheable_type(tp) || !PyUnicode_CheckExact(name) ||
+        tp->tp_dictoffset < 0)
+        return;
+    /* _PyType_Lookup() assigns a version tag to the type if it can */
+    descr = _PyType_Lookup(tp, name);
+    if (!PyType_HasFeature(tp, Py_TPFLAGS_VALID_VERSION_TAG))
+        return;
+
+    if (descr != NULL && Py_TYPE(descr)->tp_descr_get != NULL &&
+        PyDescr_IsData(descr)) {
+        la->kind = LA_DATA_DESCR;
+    }
+    else if (descr != NULL) {
+        la->kind = LA_TYPE;
+    }
+    else {
+        if (tp->tp_dictoffset == 0)
+            return;
+        dict = *(PyObject **)((char *)owner + tp->tp_dictoffset);
+        if (dict == NULL)
+            return;
+        ix = _PyDict_GetItemHint((PyDictObject *)dict, name, -1, &value);
+        if (ix < 0)
+            return;
+        la->kind = LA_INSTANCE;
+        la->hint = ix;
+    }
+    la->tp_version = tp->tp_version_tag;
+    la->descr = descr;
+    oc->optimized = 1;
+}
+
+/* Look up the method name of owner using the LOAD_METHOD entry oc.  Return
+   a borrowed reference to the function, or NULL on a miss. */
+static PyObject *
+opcache_load_method(_PyOpcache *oc, PyObject *owner, PyObject *name)
+{
+    _PyOpcache_LoadAttr *la = &oc->u.la;
+    PyTypeObject *tp = Py_TYPE(owner);
+    PyObject *dict, *value;
+
+    if (la->tp_version != tp->tp_version_tag ||
+        !PyType_HasFeature(tp, Py_TPFLAGS_VALID_VERSION_TAG))
+        return NULL;
+    if (tp->tp_dictoffset > 0) {
+        /* The instance dict takes precedence */
+        dict = *(PyObject **)((char *)owner + tp->tp_dictoffset);
+        if (dict != NULL &&
+            _PyDict_GetItemHint((PyDictObject *)dict, name, -1, &value) != -1)
+            return NULL;
+    }
+    return la->descr;
+}
+
+/* Fill the LOAD_METHOD entry oc after _PyObject_GetMethod() found the
+   function meth in the type of owner */
+static void
+opcache_fill_load_method(_PyOpcache *oc, PyObject *owner, PyObject *meth)
+{
+    _PyOpcache_LoadAttr *la = &oc->u.la;
+    PyTypeObject *tp = Py_TYPE(owner);
+
+    oc->optimized = 0;
+    if (oc->misses >= OPCACHE_MAX_MISSES)
+        return;
+    oc->misses++;
+    /* _PyObject_GetMethod() only returns functions of the type of objects
+       using PyObject_GenericGetAttr(), with a lookup which assigned a
+       version tag to the type if it could */
+    if (!PyType_HasFeature(tp, Py_TPFLAGS_VALID_VERSION_TAG) ||
+        tp->tp_dictoffset < 0)
+        return;
+    la->kind = LA_METHOD;
+    la->tp_version = tp->tp_version_tag;
+    la->descr = meth;
+    oc->optimized = 1;
+}
+#endif /* USE_OPCACHE */
+
 #ifdef WITH_THREAD
 #define GIL_REQUEST _Py_atomic_load_relaxed(&gil_drop_request)
 #else
 #define GIL_REQUEST 0
 #endif
 
+#define EVAL_BREAKER_VALUE() \
+    (GIL_REQUEST | \
+     _Py_atomic_load_relaxed(&pendingcalls_to_do))
+
+#ifdef WITHOUT_GIL
+/* Other threads may set a request between the loads and the store, and
+   they can't count on the eval loop releasing the GIL eventually: if
+   eval_breaker was cleared, check the requests again. */
+#define COMPUTE_EVAL_BREAKER() \
+    do { \
+        int _breaker = EVAL_BREAKER_VALUE() != 0; \
+        _Py_atomic_store_relaxed(&eval_breaker, _breaker); \
+        if (_breaker) \
+            break; \
+        __atomic_thread_fence(__ATOMIC_SEQ_CST); \
+    } while (EVAL_BREAKER_VALUE() != 0)
+#else
 /* This can set eval_breaker to 0 even though gil_drop_request became
    1.  We believe this is all right because the eval loop will release
    the GIL eventually anyway. */
 #define COMPUTE_EVAL_BREAKER() \
-    _Py_atomic_store_relaxed( \
-        &eval_breaker, \
-        GIL_REQUEST | \
-        _Py_atomic_load_relaxed(&pendingcalls_to_do) | \
-        pending_async_exc)
+    _Py_atomic_store_relaxed(&eval_breaker, EVAL_BREAKER_VALUE())
+#endif
 
 #ifdef WITH_THREAD
 
@@ -267,14 +488,31 @@ PyEval_GetCallStats(PyObject *self)
         COMPUTE_EVAL_BREAKER(); \
     } while (0)
 
-#define SIGNAL_ASYNC_EXC() \
+/* Requests for a single thread break only that thread out of the fast
+   path, through tstate->eval_breaker: an asynchronous exception
+   (tstate->async_exc), calls queued with Py_AddPendingCallToThread()
+   (tstate->pendingcalls_to_do) and, without the GIL, reference counts to
+   merge (tstate->refcnt_merge_len).  Any thread can make a request: it
+   sets the request, then eval_breaker.  Only the thread itself resets
+   its eval_breaker, before it looks at the requests, so that none of them
+   is missed. */
+#define THREAD_EVAL_BREAKER(tstate) \
+    __atomic_load_n(&(tstate)->eval_breaker, __ATOMIC_RELAXED)
+
+#define SIGNAL_THREAD(tstate) \
     do { \
-        pending_async_exc = 1; \
-        _Py_atomic_store_relaxed(&eval_breaker, 1); \
+        __atomic_thread_fence(__ATOMIC_SEQ_CST); \
+        __atomic_store_n(&(tstate)->eval_breaker, 1, __ATOMIC_RELAXED); \
+    } while (0)
+
+#define RESET_THREAD_EVAL_BREAKER(tstate) \
+    do { \
+        __atomic_store_n(&(tstate)->eval_breaker, 0, __ATOMIC_RELAXED); \
+        __atomic_thread_fence(__ATOMIC_SEQ_CST); \
     } while (0)
 
-#define UNSIGNAL_ASYNC_EXC() \
-    do { pending_async_exc = 0; COMPUTE_EVAL_BREAKER(); } while (0)
+#define EVAL_BREAKER(tstate) \
+    (_Py_atomic_load_relaxed(&eval_breaker) | THREAD_EVAL_BREAKER(tstate))
 
 
 #ifdef WITH_THREAD
@@ -287,15 +525,13 @@ PyEval_GetCallStats(PyObject *self)
 static PyThread_type_lock pending_lock = 0; /* for pending calls */
 static long main_thread = 0;
 /* This single variable consolidates all requests to break out of the fast path
-   in the eval loop. */
+   in the eval loop which concern every thread.  The requests for a single
+   thread are in its tstate->eval_breaker. */
 static _Py_atomic_int eval_breaker = {0};
 /* Request for dropping the GIL */
 static _Py_atomic_int gil_drop_request = {0};
-/* Request for running pending calls. */
+/* Request for running the pending calls of the main thread. */
 static _Py_atomic_int pendingcalls_to_do = {0};
-/* Request for looking at the `async_exc` field of the current thread state.
-   Guarded by the GIL. */
-static int pending_async_exc = 0;
 
 #include "ceval_gil.h"
 
@@ -311,7 +547,7 @@ PyEval_InitThreads(void)
     if (gil_created())
         return;
     create_gil();
-    take_gil(PyThreadState_GET());
+    take_gil(PyThreadState_GET(), GIL_NORMAL);
     main_thread = PyThread_get_thread_ident();
     if (!pending_lock)
         pending_lock = PyThread_allocate_lock();
@@ -332,7 +568,7 @@ PyEval_AcquireLock(void)
     PyThreadState *tstate = PyThreadState_GET();
     if (tstate == NULL)
         Py_FatalError("PyEval_AcquireLock: current thread state is NULL");
-    take_gil(tstate);
+    take_gil(tstate, GIL_NORMAL);
 }
 
 void
@@ -353,7 +589,7 @@ PyEval_AcquireThread(PyThreadState *tstate)
         Py_FatalError("PyEval_AcquireThread: NULL new thread state");
     /* Check someone has called PyEval_InitThreads() to create the lock */
     assert(gil_created());
-    take_gil(tstate);
+    take_gil(tstate, GIL_NORMAL);
     if (PyThreadState_Swap(tstate) != NULL)
         Py_FatalError(
             "PyEval_AcquireThread: non-NULL old thread state");
@@ -385,7 +621,7 @@ PyEval_ReInitThreads(void)
         return;
     recreate_gil();
     pending_lock = PyThread_allocate_lock();
-    take_gil(current_tstate);
+    take_gil(current_tstate, GIL_NORMAL);
     main_thread = PyThread_get_thread_ident();
 
     /* Update the threading module with the new state.
@@ -408,18 +644,35 @@ PyEval_ReInitThreads(void)
     _PyThreadState_DeleteExcept(current_tstate);
 }
 
+#ifdef WITHOUT_GIL
+void
+_PyEval_SignalRefCntMerge(PyThreadState *tstate)
+{
+    SIGNAL_THREAD(tstate);
+}
+#endif
+
 #else
 static _Py_atomic_int eval_breaker = {0};
-static int pending_async_exc = 0;
+
+void
+_PyEval_StopTheWorld(void)
+{
+}
+
+void
+_PyEval_StartTheWorld(void)
+{
+}
 #endif /* WITH_THREAD */
 
-/* This function is used to signal that async exceptions are waiting to be
-   raised, therefore it is also useful in non-threaded builds. */
+/* This function is used to signal that an async exception is waiting to be
+   raised in tstate, therefore it is also useful in non-threaded builds. */
 
 void
-_PyEval_SignalAsyncExc(void)
+_PyEval_SignalAsyncExc(PyThreadState *tstate)
 {
-    SIGNAL_ASYNC_EXC();
+    SIGNAL_THREAD(tstate);
 }
 
 /* Functions save_thread and restore_thread are always defined so
@@ -447,7 +700,7 @@ PyEval_RestoreThread(PyThreadState *tstate)
 #ifdef WITH_THREAD
     if (gil_created()) {
         int err = errno;
-        take_gil(tstate);
+        take_gil(tstate, GIL_PRIORITY);
         /* _Py_Finalizing is protected by the GIL */
         if (_Py_Finalizing && tstate != _Py_Finalizing) {
             drop_gil(tstate);
@@ -478,13 +731,118 @@ PyEval_RestoreThread(PyThreadState *tstate)
 #ifdef WITH_THREAD
    Any thread can schedule pending calls, but only the main thread
    will execute them.
-   There is no facility to schedule calls to a particular thread, but
-   that should be easy to change, should that ever be required.  In
-   that case, the static variables here should go into the python
-   threadstate.
 #endif
+   Py_AddPendingCallToThread() schedules a call in a particular thread
+   instead.  Those calls are queued in the thread state, and only break
+   that thread out of the fast path of the eval loop.  It can't be used
+   from signal handlers.
 */
 
+struct pending_call {
+    int (*func)(void *);
+    void *arg;
+};
+
+#ifdef WITH_THREAD
+#define THREAD_PENDING_LOCK(lock) \
+    do { \
+        if ((lock) != NULL) \
+            PyThread_acquire_lock((lock), WAIT_LOCK); \
+    } while (0)
+#define THREAD_PENDING_UNLOCK(lock) \
+    do { \
+        if ((lock) != NULL) \
+            PyThread_release_lock(lock); \
+    } while (0)
+#else
+#define THREAD_PENDING_LOCK(lock)
+#define THREAD_PENDING_UNLOCK(lock)
+#endif
+
+/* Queue a call in the ring of tstate, for _PyThreadState_ForThread().
+   Return 1 on success, -1 if the ring is full. */
+static int
+add_thread_pending_call(PyThreadState *tstate, void *arg)
+{
+    struct pending_call *call = (struct pending_call *)arg;
+    int i, j, result;
+#ifdef WITH_THREAD
+    PyThread_type_lock lock = pending_lock;
+#endif
+
+    THREAD_PENDING_LOCK(lock);
+    i = tstate->pendinglast;
+    j = (i + 1) % _Py_THREAD_NPENDINGCALLS;
+    if (j == tstate->pendingfirst) {
+        result = -1; /* Queue full */
+    } else {
+        tstate->pendingcalls[i].func = call->func;
+        tstate->pendingcalls[i].arg = call->arg;
+        tstate->pendinglast = j;
+        __atomic_store_n(&tstate->pendingcalls_to_do, 1, __ATOMIC_RELAXED);
+        result = 1;
+    }
+    THREAD_PENDING_UNLOCK(lock);
+    if (result == 1)
+        SIGNAL_THREAD(tstate);
+    return result;
+}
+
+int
+Py_AddPendingCallToThread(long thread_id, int (*func)(void *), void *arg)
+{
+    struct pending_call call;
+
+    call.func = func;
+    call.arg = arg;
+    if (_PyThreadState_ForThread(thread_id, add_thread_pending_call,
+                                 &call) != 1)
+        return -1;
+    return 0;
+}
+
+/* Perform the calls queued in the ring of tstate, the current thread
+   state */
+static int
+make_thread_pending_calls(PyThreadState *tstate)
+{
+    int i;
+    int r = 0;
+
+    /* perform a bounded number of calls, in case of recursion */
+    for (i = 0; i < _Py_THREAD_NPENDINGCALLS; i++) {
+        int j;
+        int (*func)(void *) = NULL;
+        void *arg = NULL;
+#ifdef WITH_THREAD
+        PyThread_type_lock lock = pending_lock;
+#endif
+
+        /* pop one item off the queue while holding the lock */
+        THREAD_PENDING_LOCK(lock);
+        j = tstate->pendingfirst;
+        if (j != tstate->pendinglast) {
+            func = tstate->pendingcalls[j].func;
+            arg = tstate->pendingcalls[j].arg;
+            tstate->pendingfirst = (j + 1) % _Py_THREAD_NPENDINGCALLS;
+        }
+        if (tstate->pendingfirst == tstate->pendinglast)
+            __atomic_store_n(&tstate->pendingcalls_to_do, 0,
+                             __ATOMIC_RELAXED);
+        THREAD_PENDING_UNLOCK(lock);
+        /* having released the lock, perform the callback */
+        if (func == NULL)
+            break;
+        r = func(arg);
+        if (r)
+            break;
+    }
+    /* Come back later for the calls left, if any */
+    if (__atomic_load_n(&tstate->pendingcalls_to_do, __ATOMIC_RELAXED))
+        SIGNAL_THREAD(tstate);
+    return r;
+}
+
 #ifdef WITH_THREAD
 
 /* The WITH_THREAD implementation is thread-safe.  It allows
@@ -549,6 +907,8 @@ Py_MakePendingCalls(void)
     int i;
     int r = 0;
 
+    PyThreadState *tstate;
+
     if (!pending_lock) {
         /* initial allocation of the lock */
         pending_lock = PyThread_allocate_lock();
@@ -556,7 +916,14 @@ Py_MakePendingCalls(void)
             return -1;
     }
 
-    /* only service pending calls on main thread */
+    /* service the calls queued for this thread in any thread */
+    tstate = _PyThreadState_UncheckedGet();
+    if (tstate != NULL &&
+        __atomic_load_n(&tstate->pendingcalls_to_do, __ATOMIC_RELAXED) &&
+        make_thread_pending_calls(tstate) < 0)
+        return -1;
+
+    /* only service the other pending calls on main thread */
     if (main_thread && PyThread_get_thread_ident() != main_thread)
         return 0;
     /* don't perform recursive pending calls */
@@ -658,6 +1025,12 @@ int
 Py_MakePendingCalls(void)
 {
     static int busy = 0;
+    PyThreadState *tstate = _PyThreadState_UncheckedGet();
+
+    if (tstate != NULL &&
+        __atomic_load_n(&tstate->pendingcalls_to_do, __ATOMIC_RELAXED) &&
+        make_thread_pending_calls(tstate) < 0)
+        return -1;
     if (busy)
         return 0;
     busy = 1;
@@ -892,7 +1265,7 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
 
 #define DISPATCH() \
     { \
-        if (!_Py_atomic_load_relaxed(&eval_breaker)) {      \
+        if (!EVAL_BREAKER(tstate)) {                        \
                     FAST_DISPATCH(); \
         } \
         continue; \
@@ -1163,6 +1536,15 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
     }
 
     co = f->f_code;
+#ifdef USE_OPCACHE
+    if (co->co_opcache_flag < OPCACHE_MIN_RUNS) {
+        co->co_opcache_flag++;
+        if (co->co_opcache_flag == OPCACHE_MIN_RUNS) {
+            if (_PyCode_InitOpcache(co) < 0)
+                goto exit_eval_frame;
+        }
+    }
+#endif
     names = co->co_names;
     consts = co->co_consts;
     fastlocals = f->f_localsplus;
@@ -1254,7 +1636,7 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
            async I/O handler); see Py_AddPendingCall() and
            Py_MakePendingCalls() above. */
 
-        if (_Py_atomic_load_relaxed(&eval_breaker)) {
+        if (EVAL_BREAKER(tstate)) {
             if (OPCODE(*next_instr) == SETUP_FINALLY) {
                 /* Make the last opcode before
                    a try: finally: block uninterruptible. */
@@ -1263,10 +1645,18 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
 #ifdef WITH_TSC
             ticked = 1;
 #endif
-            if (_Py_atomic_load_relaxed(&pendingcalls_to_do)) {
+            if (THREAD_EVAL_BREAKER(tstate))
+                RESET_THREAD_EVAL_BREAKER(tstate);
+            if (_Py_atomic_load_relaxed(&pendingcalls_to_do) ||
+                __atomic_load_n(&tstate->pendingcalls_to_do,
+                                __ATOMIC_RELAXED)) {
                 if (Py_MakePendingCalls() < 0)
                     goto error;
             }
+#ifdef WITHOUT_GIL
+            if (__atomic_load_n(&tstate->refcnt_merge_len, __ATOMIC_RELAXED))
+                _PyThreadState_MergeRefCnts(tstate);
+#endif
 #ifdef WITH_THREAD
             if (_Py_atomic_load_relaxed(&gil_drop_request)) {
                 /* Give another thread a chance */
@@ -1276,7 +1666,7 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
 
                 /* Other threads may run now */
 
-                take_gil(tstate);
+                take_gil(tstate, GIL_NORMAL);
 
                 /* Check if we should make a quick exit. */
                 if (_Py_Finalizing && _Py_Finalizing != tstate) {
@@ -1288,14 +1678,16 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
                     Py_FatalError("ceval: orphan tstate");
             }
 #endif
-            /* Check for asynchronous exceptions. */
+            /* Check for asynchronous exceptions.  Other threads can
+               replace or clear them meanwhile. */
             if (tstate->async_exc != NULL) {
-                PyObject *exc = tstate->async_exc;
-                tstate->async_exc = NULL;
-                UNSIGNAL_ASYNC_EXC();
-                PyErr_SetNone(exc);
-                Py_DECREF(exc);
-                goto error;
+                PyObject *exc = __atomic_exchange_n(&tstate->async_exc, NULL,
+                                                    __ATOMIC_SEQ_CST);
+                if (exc != NULL) {
+                    PyErr_SetNone(exc);
+                    Py_DECREF(exc);
+                    goto error;
+                }
             }
         }
 
@@ -2366,6 +2758,23 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             if (PyDict_CheckExact(f->f_globals)
                 && PyDict_CheckExact(f->f_builtins))
             {
+#ifdef USE_OPCACHE
+                _PyOpcache *oc = OPCACHE_GET();
+                PY_UINT64_T globals_ver =
+                    ((PyDictObject *)f->f_globals)->ma_version_tag;
+                PY_UINT64_T builtins_ver =
+                    ((PyDictObject *)f->f_builtins)->ma_version_tag;
+
+                if (oc != NULL && oc->optimized
+                    && oc->u.lg.globals_ver == globals_ver
+                    && oc->u.lg.builtins_ver == builtins_ver)
+                {
+                    v = oc->u.lg.ptr;
+                    Py_INCREF(v);
+                    PUSH(v);
+                    DISPATCH();
+                }
+#endif
                 v = _PyDict_LoadGlobal((PyDictObject *)f->f_globals,
                                        (PyDictObject *)f->f_builtins,
                                        name);
@@ -2378,6 +2787,21 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
                     }
                     goto error;
                 }
+#ifdef USE_OPCACHE
+                /* The lookup may have run code (comparing keys) which
+                   modified the namespaces */
+                if (oc != NULL
+                    && ((PyDictObject *)f->f_globals)->ma_version_tag
+                       == globals_ver
+                    && ((PyDictObject *)f->f_builtins)->ma_version_tag
+                       == builtins_ver)
+                {
+                    oc->optimized = 1;
+                    oc->u.lg.ptr = v;
+                    oc->u.lg.globals_ver = globals_ver;
+                    oc->u.lg.builtins_ver = builtins_ver;
+                }
+#endif
                 Py_INCREF(v);
             }
             else {
@@ -2711,7 +3135,24 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
         TARGET(LOAD_ATTR) {
             PyObject *name = GETITEM(names, oparg);
             PyObject *owner = TOP();
-            PyObject *res = PyObject_GetAttr(owner, name);
+            PyObject *res;
+#ifdef USE_OPCACHE
+            _PyOpcache *oc = OPCACHE_GET();
+            if (oc != NULL && oc->optimized
+                && opcache_load_attr(oc, owner, name, &res))
+            {
+                Py_DECREF(owner);
+                SET_TOP(res);
+                if (res == NULL)
+                    goto error;
+                DISPATCH();
+            }
+#endif
+            res = PyObject_GetAttr(owner, name);
+#ifdef USE_OPCACHE
+            if (oc != NULL && res != NULL)
+                opcache_fill_load_attr(oc, owner, name);
+#endif
             Py_DECREF(owner);
             SET_TOP(res);
             if (res == NULL)
@@ -2719,6 +3160,70 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             DISPATCH();
         }
 
+        TARGET(LOAD_METHOD) {
+            /* Designed to work in tandem with CALL_METHOD. */
+            PyObject *name = GETITEM(names, oparg);
+            PyObject *obj = TOP();
+            PyObject *meth = NULL;
+            int meth_found;
+#ifdef USE_OPCACHE
+            _PyOpcache *oc = OPCACHE_GET();
+            if (oc != NULL && oc->optimized) {
+                if (oc->u.la.kind == LA_METHOD) {
+                    meth = opcache_load_method(oc, obj, name);
+                    if (meth != NULL) {
+                        Py_INCREF(meth);
+                        SET_TOP(meth);
+                        PUSH(obj);  /* self */
+                        DISPATCH();
+                    }
+                }
+                else if (opcache_load_attr(oc, obj, name, &meth)) {
+                    if (meth == NULL)
+                        goto error;
+                    SET_TOP(NULL);
+                    Py_DECREF(obj);
+                    PUSH(meth);
+                    DISPATCH();
+                }
+            }
+#endif
+            meth_found = _PyObject_GetMethod(obj, name, &meth);
+            if (meth == NULL) {
+                /* Most likely the attribute wasn't found */
+                goto error;
+            }
+#ifdef USE_OPCACHE
+            if (oc != NULL) {
+                if (meth_found)
+                    opcache_fill_load_method(oc, obj, meth);
+                else
+                    opcache_fill_load_attr(oc, obj, name);
+            }
+#endif
+            if (meth_found) {
+                /* meth is a function of the type and obj is self: skip
+                   the bound method object.
+
+                   meth | self | arg1 | ... | argN
+                */
+                SET_TOP(meth);
+                PUSH(obj);  /* self */
+            }
+            else {
+                /* meth is a regular attribute, or something returned by the
+                   descriptor protocol: a NULL below it tells CALL_METHOD
+                   that this is not a method call.
+
+                   NULL | meth | arg1 | ... | argN
+                */
+                SET_TOP(NULL);
+                Py_DECREF(obj);
+                PUSH(meth);
+            }
+            DISPATCH();
+        }
+
         TARGET(COMPARE_OP) {
             PyObject *right = POP();
             PyObject *left = TOP();
@@ -3212,6 +3717,44 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             DISPATCH();
         }
 
+        TARGET(CALL_METHOD) {
+            /* Designed to work in tandem with LOAD_METHOD. */
+            PyObject **sp, *res;
+            PCALL(PCALL_ALL);
+            sp = stack_pointer;
+            if (PEEK(oparg + 2) == NULL) {
+                /* Not a method call:
+
+                   ... | NULL | callable | arg1 | ... | argN
+
+                   call_function() pops the callable and the arguments, the
+                   NULL is popped afterwards. */
+#ifdef WITH_TSC
+                res = call_function(&sp, oparg, &intr0, &intr1);
+#else
+                res = call_function(&sp, oparg);
+#endif
+                stack_pointer = sp;
+                (void)POP();
+            }
+            else {
+                /* A method call, self is passed as first argument:
+
+                   ... | method | self | arg1 | ... | argN
+                */
+#ifdef WITH_TSC
+                res = call_function(&sp, oparg + 1, &intr0, &intr1);
+#else
+                res = call_function(&sp, oparg + 1);
+#endif
+                stack_pointer = sp;
+            }
+            PUSH(res);
+            if (res == NULL)
+                goto error;
+            DISPATCH();
+        }
+
         TARGET(CALL_FUNCTION_VAR)
         TARGET(CALL_FUNCTION_KW)
         TARGET(CALL_FUNCTION_VAR_KW) {
@@ -4682,6 +5225,28 @@ if (tstate->use_tracing && tstate->c_profilefunc) { \
     x = call; \
     }
 
+/* Move the nk keyword arguments of a call, pushed as (name, value) pairs
+   at kwstack, to the layout expected by METH_FASTCALL functions: the
+   values right after the positional arguments, and the names in a new
+   tuple, which is returned.  The stack then ends after the values.  Return
+   NULL, leaving the stack untouched, on error. */
+static PyObject *
+stack_keywords(PyObject ***pp_stack, PyObject **kwstack, int nk)
+{
+    PyObject *kwnames = PyTuple_New(nk);
+    int i;
+
+    if (kwnames == NULL)
+        return NULL;
+    for (i = 0; i < nk; i++) {
+        /* The name steals the reference of the stack */
+        PyTuple_SET_ITEM(kwnames, i, kwstack[2*i]);
+        kwstack[i] = kwstack[2*i + 1];
+    }
+    *pp_stack = kwstack + nk;
+    return kwnames;
+}
+
 static PyObject *
 call_function(PyObject ***pp_stack, int oparg
 #ifdef WITH_TSC
@@ -4699,12 +5264,34 @@ call_function(PyObject ***pp_stack, int oparg
     /* Always dispatch PyCFunction first, because these are
        presumed to be the most frequent callable object.
     */
-    if (PyCFunction_Check(func) && nk == 0) {
+    if (PyCFunction_Check(func) &&
+        (nk == 0 || PyCFunction_GET_FLAGS(func) & METH_FASTCALL)) {
         int flags = PyCFunction_GET_FLAGS(func);
         PyThreadState *tstate = PyThreadState_GET();
 
         PCALL(PCALL_CFUNCTION);
-        if (flags & (METH_NOARGS | METH_O)) {
+        if (flags & METH_FASTCALL) {
+            _PyCFunctionFast meth =
+                (_PyCFunctionFast)PyCFunction_GET_FUNCTION(func);
+            PyObject *self = PyCFunction_GET_SELF(func);
+            PyObject **args = pfunc + 1;
+            PyObject *kwnames = NULL;
+
+            if (nk > 0)
+                kwnames = stack_keywords(pp_stack, args + na, nk);
+            if (nk == 0 || kwnames != NULL) {
+                READ_TIMESTAMP(*pintr0);
+                C_TRACE(x, (*meth)(self, args, na, kwnames));
+                READ_TIMESTAMP(*pintr1);
+                Py_XDECREF(kwnames);
+
+                x = _Py_CheckFunctionResult(func, x, NULL);
+            }
+            else {
+                x = NULL;
+            }
+        }
+        else if (flags & (METH_NOARGS | METH_O)) {
             PyCFunction meth = PyCFunction_GET_FUNCTION(func);
             PyObject *self = PyCFunction_GET_SELF(func);
             if (flags & METH_NOARGS && na == 0) {
@@ -57,6 +57,27 @@ static unsigned long gil_interval = DEFAULT_INTERVAL;
      run and end up being the first to re-acquire it, making the "timeslices"
      much longer than expected.
      (Note: this mechanism is enabled with FORCE_SWITCHING above)
+
+   - The scheduling described above is the "interval" policy.  With the
+     "fair" policy (see sys.setgilpolicy()), waiting threads queue up in
+     FIFO order and drop_gil() hands the GIL directly to the head of the
+     queue, so that no thread can take it out of turn.  Threads coming back
+     from a blocking call (PyEval_RestoreThread(), i.e.
+     Py_END_ALLOW_THREADS) go in a separate queue which is served first,
+     and they set gil_drop_request as soon as they start waiting instead of
+     after `interval` microseconds.  An I/O-bound thread then only waits
+     for the current opcode of a CPU-bound thread to finish, rather than
+     for a full switch interval (the "convoy effect").
+
+     Each waiter sleeps on its own condition variable, so a handoff wakes
+     exactly one thread.
+
+   - Contention statistics are collected in gil_stats under gil_mutex,
+     which take_gil() and drop_gil() hold anyway: the number of
+     acquisitions and forced drops, the time spent waiting for and holding
+     the GIL, and log2 histograms of those times.  Each thread state also
+     keeps its own totals.  Reading the clock twice per switch is the only
+     extra cost.  See sys._gil_stats().
 */
 
 #include "condvar.h"
@@ -88,6 +109,9 @@ static unsigned long gil_interval = DEFAULT_INTERVAL;
 #define COND_SIGNAL(cond) \
     if (PyCOND_SIGNAL(&(cond))) { \
         Py_FatalError("PyCOND_SIGNAL(" #cond ") failed"); };
+#define COND_BROADCAST(cond) \
+    if (PyCOND_BROADCAST(&(cond))) { \
+        Py_FatalError("PyCOND_BROADCAST(" #cond ") failed"); };
 #define COND_WAIT(cond, mut) \
     if (PyCOND_WAIT(&(cond), &(mut))) { \
         Py_FatalError("PyCOND_WAIT(" #cond ") failed"); };
@@ -126,6 +150,54 @@ static COND_T switch_cond;
 static MUTEX_T switch_mutex;
 #endif
 
+static int gil_policy = _Py_GIL_POLICY_INTERVAL;
+
+/* Protected by gil_mutex */
+static _PyGILStats gil_stats;
+
+/* Whether take_gil() is called by a thread which comes back from a
+   blocking call, rather than one which was asked to drop the GIL */
+#define GIL_NORMAL      0
+#define GIL_PRIORITY    1
+
+/* A thread waiting for the GIL under the fair policy.  It lives on the
+   waiter's stack and is linked in one of the gil_queues. */
+struct gil_waiter {
+    PyThreadState *tstate;
+    struct gil_waiter *next;
+    int granted;    /* set by drop_gil() when it hands the GIL over */
+    COND_T cond;
+};
+
+/* FIFO queues of the waiting threads, indexed by GIL_NORMAL and
+   GIL_PRIORITY.  Protected by gil_mutex. */
+static struct {
+    struct gil_waiter *head;
+    struct gil_waiter *tail;
+} gil_queues[2];
+
+#ifdef WITHOUT_GIL
+/*
+   Without the GIL, take_gil() and drop_gil() no longer exclude other threads:
+   they only record whether the calling thread is "attached", i.e. allowed to
+   touch Python objects.  Threads detach at the same places where they would
+   release the GIL (blocking I/O, Py_BEGIN_ALLOW_THREADS...).
+
+   A thread may "stop the world" (for instance to run the cyclic garbage
+   collector): it sets gil_drop_request, which makes every other attached
+   thread detach at its next check of eval_breaker, and waits until it is the
+   only one left.  While the world is stopped, take_gil() blocks every other
+   thread; the stopper wakes them up with _PyEval_StartTheWorld().
+
+   gil_attached, world_stopper and world_stop_depth are protected by
+   gil_mutex.  The stopper waits on switch_cond, the other threads on
+   gil_cond.
+*/
+static int gil_attached = 0;
+static PyThreadState *world_stopper = NULL;
+static int world_stop_depth = 0;
+#endif
+
 
 static int gil_created(void)
 {
@@ -142,6 +214,15 @@ static void create_gil(void)
 #ifdef FORCE_SWITCHING
     COND_INIT(switch_cond);
 #endif
+#ifdef WITHOUT_GIL
+    /* After a fork, the child may have inherited a stopped world */
+    gil_attached = 0;
+    world_stopper = NULL;
+    world_stop_depth = 0;
+    RESET_GIL_DROP_REQUEST();
+#endif
+    /* After a fork, the waiters of the parent no longer exist */
+    memset(gil_queues, 0, sizeof(gil_queues));
     _Py_atomic_store_relaxed(&gil_last_holder, 0);
     _Py_ANNOTATE_RWLOCK_CREATE(&gil_locked);
     _Py_atomic_store_explicit(&gil_locked, 0, _Py_memory_order_release);
@@ -169,8 +250,102 @@ static void recreate_gil(void)
     create_gil();
 }
 
+/* Index of the histogram bucket of a duration: bucket 0 counts durations
+   below 1 microsecond, bucket i durations in [2**(i-1), 2**i)
+   microseconds, and the last bucket everything longer. */
+static int
+gil_stats_bucket(_PyTime_t duration)
+{
+    _PyTime_t us = duration / 1000;
+    int i = 0;
+    while (us > 0 && i < _Py_GIL_STATS_BUCKETS - 1) {
+        us >>= 1;
+        i++;
+    }
+    return i;
+}
+
+/* Account for tstate taking the GIL.  wait_start is the time at which it
+   started waiting, or 0 if it didn't have to wait.  Called with gil_mutex
+   held. */
+static void
+gil_stats_acquired(PyThreadState *tstate, _PyTime_t wait_start)
+{
+    _PyTime_t now = _PyTime_GetMonotonicClock();
+    _PyTime_t wait = 0;
+
+    gil_stats.acquisitions++;
+    tstate->gil_acquire_count++;
+    if (wait_start != 0) {
+        wait = now - wait_start;
+        gil_stats.contended++;
+        gil_stats.wait_time += wait;
+        if (wait > gil_stats.max_wait)
+            gil_stats.max_wait = wait;
+        tstate->gil_wait_count++;
+        tstate->gil_wait_time += wait;
+    }
+    gil_stats.wait_histogram[gil_stats_bucket(wait)]++;
+    tstate->gil_taken_at = now;
+}
+
+/* Account for tstate dropping the GIL at time `now`.  Called with gil_mutex
+   held, before gil_drop_request is reset. */
+static void
+gil_stats_released(PyThreadState *tstate, _PyTime_t now)
+{
+    _PyTime_t hold;
+
+    if (_Py_atomic_load_relaxed(&gil_drop_request))
+        gil_stats.forced_drops++;
+    /* tstate can be NULL, or not the thread state which took the GIL if
+       PyThreadState_Swap() was used */
+    if (tstate == NULL || tstate->gil_taken_at == 0)
+        return;
+    hold = now - tstate->gil_taken_at;
+    tstate->gil_taken_at = 0;
+    tstate->gil_hold_time += hold;
+    gil_stats.hold_time += hold;
+    if (hold > gil_stats.max_hold)
+        gil_stats.max_hold = hold;
+    gil_stats.hold_histogram[gil_stats_bucket(hold)]++;
+}
+
+#ifndef WITHOUT_GIL
+
+static void
+gil_enqueue(struct gil_waiter *waiter, int priority)
+{
+    waiter->next = NULL;
+    if (gil_queues[priority].tail != NULL)
+        gil_queues[priority].tail->next = waiter;
+    else
+        gil_queues[priority].head = waiter;
+    gil_queues[priority].tail = waiter;
+}
+
+/* Remove and return the next thread to be given the GIL, or NULL */
+static struct gil_waiter *
+gil_dequeue(void)
+{
+    int priority;
+    for (priority = GIL_PRIORITY; priority >= GIL_NORMAL; priority--) {
+        struct gil_waiter *waiter = gil_queues[priority].head;
+        if (waiter != NULL) {
+            gil_queues[priority].head = waiter->next;
+            if (gil_queues[priority].head == NULL)
+                gil_queues[priority].tail = NULL;
+            return waiter;
+        }
+    }
+    return NULL;
+}
+
 static void drop_gil(PyThreadState *tstate)
 {
+    struct gil_waiter *waiter;
+    _PyTime_t now = _PyTime_GetMonotonicClock();
+
     if (!_Py_atomic_load_relaxed(&gil_locked))
         Py_FatalError("drop_gil: GIL is not locked");
     /* tstate is allowed to be NULL (early interpreter init) */
@@ -182,7 +357,21 @@ static void drop_gil(PyThreadState *tstate)
     }
 
     MUTEX_LOCK(gil_mutex);
+    gil_stats_released(tstate, now);
     _Py_ANNOTATE_RWLOCK_RELEASED(&gil_locked, /*is_write=*/1);
+    waiter = gil_dequeue();
+    if (waiter != NULL) {
+        /* Fair policy: hand the GIL over.  gil_locked stays set, so no
+           other thread can take it in the meantime, and no forced switch
+           is needed since another thread is scheduled for sure. */
+        _Py_atomic_store_relaxed(&gil_last_holder,
+                                 (Py_uintptr_t)waiter->tstate);
+        ++gil_switch_number;
+        waiter->granted = 1;
+        COND_SIGNAL(waiter->cond);
+        MUTEX_UNLOCK(gil_mutex);
+        return;
+    }
     _Py_atomic_store_relaxed(&gil_locked, 0);
     COND_SIGNAL(gil_cond);
     MUTEX_UNLOCK(gil_mutex);
@@ -204,9 +393,51 @@ static void drop_gil(PyThreadState *tstate)
 #endif
 }
 
-static void take_gil(PyThreadState *tstate)
+/* Wait in the queue of the fair policy until drop_gil() hands the GIL
+   over.  Called with gil_mutex held. */
+static void
+take_gil_fair(PyThreadState *tstate, int priority)
+{
+    struct gil_waiter waiter;
+
+    waiter.tstate = tstate;
+    waiter.granted = 0;
+    COND_INIT(waiter.cond);
+    gil_enqueue(&waiter, priority);
+    if (priority == GIL_PRIORITY)
+        SET_GIL_DROP_REQUEST();
+
+    while (!waiter.granted) {
+        int timed_out = 0;
+        unsigned long saved_switchnum;
+
+        saved_switchnum = gil_switch_number;
+        COND_TIMED_WAIT(waiter.cond, gil_mutex, INTERVAL, timed_out);
+        /* Like in the interval policy, but only the next thread to be
+           served asks for the GIL */
+        if (timed_out && !waiter.granted &&
+            gil_switch_number == saved_switchnum &&
+            (gil_queues[GIL_PRIORITY].head == &waiter ||
+             (gil_queues[GIL_PRIORITY].head == NULL &&
+              gil_queues[GIL_NORMAL].head == &waiter))) {
+            SET_GIL_DROP_REQUEST();
+        }
+    }
+    COND_FINI(waiter.cond);
+    _Py_ANNOTATE_RWLOCK_ACQUIRED(&gil_locked, /*is_write=*/1);
+
+    /* Threads coming back from I/O keep priority over the others */
+    if (gil_queues[GIL_PRIORITY].head != NULL)
+        SET_GIL_DROP_REQUEST();
+    else if (_Py_atomic_load_relaxed(&gil_drop_request))
+        RESET_GIL_DROP_REQUEST();
+}
+
+static void take_gil(PyThreadState *tstate, int priority)
 {
     int err;
+    _PyTime_t wait_start = 0;
+
     if (tstate == NULL)
         Py_FatalError("take_gil: NULL tstate");
 
@@ -216,10 +447,16 @@ static void take_gil(PyThreadState *tstate)
     if (!_Py_atomic_load_relaxed(&gil_locked))
         goto _ready;
 
+    wait_start = _PyTime_GetMonotonicClock();
     while (_Py_atomic_load_relaxed(&gil_locked)) {
         int timed_out = 0;
         unsigned long saved_switchnum;
 
+        if (gil_policy == _Py_GIL_POLICY_FAIR) {
+            take_gil_fair(tstate, priority);
+            goto _handed_over;
+        }
+
         saved_switchnum = gil_switch_number;
         COND_TIMED_WAIT(gil_cond, gil_mutex, INTERVAL, timed_out);
         /* If we timed out and no switch occurred in the meantime, it is time
@@ -251,14 +488,112 @@ _ready:
     if (_Py_atomic_load_relaxed(&gil_drop_request)) {
         RESET_GIL_DROP_REQUEST();
     }
-    if (tstate->async_exc != NULL) {
-        _PyEval_SignalAsyncExc();
+_handed_over:
+    gil_stats_acquired(tstate, wait_start);
+    MUTEX_UNLOCK(gil_mutex);
+    errno = err;
+}
+
+void _PyEval_StopTheWorld(void)
+{
+    /* The GIL holder is the only thread running Python code already */
+}
+
+void _PyEval_StartTheWorld(void)
+{
+}
+
+#else /* WITHOUT_GIL */
+
+static void drop_gil(PyThreadState *tstate)
+{
+    _PyTime_t now = _PyTime_GetMonotonicClock();
+
+    /* tstate is allowed to be NULL (early interpreter init) */
+    if (tstate != NULL)
+        _Py_atomic_store_relaxed(&gil_last_holder, (Py_uintptr_t)tstate);
+
+    MUTEX_LOCK(gil_mutex);
+    if (gil_attached <= 0)
+        Py_FatalError("drop_gil: thread is not attached");
+    gil_stats_released(tstate, now);
+    gil_attached--;
+    if (world_stopper != NULL) {
+        /* Tell the stopper one less thread is running */
+        COND_SIGNAL(switch_cond);
     }
+    MUTEX_UNLOCK(gil_mutex);
+}
 
+static void take_gil(PyThreadState *tstate, int priority)
+{
+    int err;
+    _PyTime_t wait_start = 0;
+
+    if (tstate == NULL)
+        Py_FatalError("take_gil: NULL tstate");
+
+    err = errno;
+    MUTEX_LOCK(gil_mutex);
+    if (world_stopper != NULL && world_stopper != tstate) {
+        wait_start = _PyTime_GetMonotonicClock();
+        while (world_stopper != NULL && world_stopper != tstate)
+            COND_WAIT(gil_cond, gil_mutex);
+    }
+    gil_stats_acquired(tstate, wait_start);
+    gil_attached++;
+    if (tstate != (PyThreadState*)_Py_atomic_load_relaxed(&gil_last_holder)) {
+        _Py_atomic_store_relaxed(&gil_last_holder, (Py_uintptr_t)tstate);
+        ++gil_switch_number;
+    }
     MUTEX_UNLOCK(gil_mutex);
     errno = err;
 }
 
+void _PyEval_StopTheWorld(void)
+{
+    PyThreadState *tstate = PyThreadState_GET();
+
+    if (!gil_created() || tstate == NULL)
+        return;
+    MUTEX_LOCK(gil_mutex);
+    if (world_stopper == tstate) {
+        world_stop_depth++;
+        MUTEX_UNLOCK(gil_mutex);
+        return;
+    }
+    while (world_stopper != NULL) {
+        /* Another thread got there first: let it finish */
+        gil_attached--;
+        COND_SIGNAL(switch_cond);
+        while (world_stopper != NULL)
+            COND_WAIT(gil_cond, gil_mutex);
+        gil_attached++;
+    }
+    world_stopper = tstate;
+    world_stop_depth = 1;
+    SET_GIL_DROP_REQUEST();
+    while (gil_attached > 1)
+        COND_WAIT(switch_cond, gil_mutex);
+    MUTEX_UNLOCK(gil_mutex);
+}
+
+void _PyEval_StartTheWorld(void)
+{
+    if (!gil_created() || PyThreadState_GET() == NULL)
+        return;
+    MUTEX_LOCK(gil_mutex);
+    assert(world_stopper == PyThreadState_GET());
+    if (--world_stop_depth == 0) {
+        world_stopper = NULL;
+        RESET_GIL_DROP_REQUEST();
+        COND_BROADCAST(gil_cond);
+    }
+    MUTEX_UNLOCK(gil_mutex);
+}
+
+#endif /* WITHOUT_GIL */
+
 void _PyEval_SetSwitchInterval(unsigned long microseconds)
 {
     gil_interval = microseconds;
@@ -268,3 +603,29 @@ unsigned long _PyEval_GetSwitchInterval()
 {
     return gil_interval;
 }
+
+/* The new policy applies to the threads which start waiting for the GIL
+   afterwards; threads which are already queued are served first.  Without
+   the GIL, the policy is recorded but has no effect. */
+void _PyEval_SetGILPolicy(int policy)
+{
+    assert(policy == _Py_GIL_POLICY_INTERVAL || policy == _Py_GIL_POLICY_FAIR);
+    gil_policy = policy;
+}
+
+int _PyEval_GetGILPolicy(void)
+{
+    return gil_policy;
+}
+
+void _PyEval_GetGILStats(_PyGILStats *stats)
+{
+    if (!gil_created()) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+    MUTEX_LOCK(gil_mutex);
+    *stats = gil_stats;
+    stats->switches = gil_switch_number;
+    MUTEX_UNLOCK(gil_mutex);
+}
@@ -982,6 +982,8 @@ PyCompile_OpcodeStackEffect(int opcode, int oparg)
             return 1 - 2*oparg;
         case LOAD_ATTR:
             return 0;
+        case LOAD_METHOD:
+            return 1;
         case COMPARE_OP:
             return -1;
         case IMPORT_NAME:
@@ -1028,6 +1030,8 @@ PyCompile_OpcodeStackEffect(int opcode, int oparg)
             return -NARGS(oparg)-1;
         case CALL_FUNCTION_VAR_KW:
             return -NARGS(oparg)-2;
+        case CALL_METHOD:
+            return -oparg-1;
         case MAKE_FUNCTION:
             return -1 -NARGS(oparg) - ((oparg >> 16) & 0xffff);
         case MAKE_CLOSURE:
@@ -3182,9 +3186,44 @@ compiler_compare(struct compiler *c, expr_ty e)
     return 1;
 }
 
+/* Compile obj.meth(args) with only positional arguments to LOAD_METHOD and
+   CALL_METHOD, which don't create a bound method object.  Return -1 if the
+   call has another shape. */
+static int
+maybe_optimize_method_call(struct compiler *c, expr_ty e)
+{
+    Py_ssize_t argsl, i;
+    expr_ty meth = e->v.Call.func;
+    asdl_seq *args = e->v.Call.args;
+
+    if (meth->kind != Attribute_kind || meth->v.Attribute.ctx != Load ||
+        asdl_seq_LEN(e->v.Call.keywords))
+        return -1;
+
+    /* CALL_METHOD passes self as an additional positional argument, which
+       must still fit in the low byte of the oparg of CALL_FUNCTION */
+    argsl = asdl_seq_LEN(args);
+    if (argsl >= 255)
+        return -1;
+    for (i = 0; i < argsl; i++) {
+        expr_ty elt = asdl_seq_GET(args, i);
+        if (elt->kind == Starred_kind)
+            return -1;
+    }
+
+    VISIT(c, expr, meth->v.Attribute.value);
+    ADDOP_NAME(c, LOAD_METHOD, meth->v.Attribute.attr, names);
+    VISIT_SEQ(c, expr, args);
+    ADDOP_I(c, CALL_METHOD, argsl);
+    return 1;
+}
+
 static int
 compiler_call(struct compiler *c, expr_ty e)
 {
+    int ret = maybe_optimize_method_call(c, e);
+    if (ret >= 0)
+        return ret;
     VISIT(c, expr, e->v.Call.func);
     return compiler_call_helper(c, 0,
                                 e->v.Call.args,
@@ -28,6 +28,11 @@ PyAPI_FUNC(PyObject *) _Py_BuildValue_SizeT(const char *, ...);
 PyAPI_FUNC(int) _PyArg_VaParse_SizeT(PyObject *, const char *, va_list);
 PyAPI_FUNC(int) _PyArg_VaParseTupleAndKeywords_SizeT(PyObject *, PyObject *,
                                               const char *, char **, va_list);
+PyAPI_FUNC(int) _PyArg_ParseStack_SizeT(PyObject **, Py_ssize_t,
+                                        const char *, ...);
+PyAPI_FUNC(int) _PyArg_ParseStackAndKeywords_SizeT(PyObject **, Py_ssize_t,
+                                                   PyObject *, const char *,
+                                                   char **, ...);
 #endif
 
 #define FLAG_COMPAT 1
@@ -54,6 +59,8 @@ typedef struct {
 #define STATIC_FREELIST_ENTRIES 8
 
 /* Forward */
+static int vgetargs1_impl(PyObject *, PyObject **, Py_ssize_t,
+                          const char *, va_list *, int);
 static int vgetargs1(PyObject *, const char *, va_list *, int);
 static void seterror(Py_ssize_t, const char *, int *, const char *, const char *);
 static const char *convertitem(PyObject *, const char **, va_list *, int, int *,
@@ -65,7 +72,7 @@ static const char *convertsimple(PyObject *, const char **, va_list *, int,
 static Py_ssize_t convertbuffer(PyObject *, void **p, const char **);
 static int getbuffer(PyObject *, Py_buffer *, const char**);
 
-static int vgetargskeywords(PyObject *, PyObject *,
+static int vgetargskeywords(PyObject **, Py_ssize_t, PyObject *, PyObject *,
                             const char *, char **, va_list *, int);
 static const char *skipitem(const char **, va_list *, int);
 
@@ -139,6 +146,31 @@ _PyArg_VaParse_SizeT(PyObject *args, const char *format, va_list va)
     return vgetargs1(args, format, &lva, FLAG_SIZE_T);
 }
 
+int
+_PyArg_ParseStack(PyObject **args, Py_ssize_t nargs, const char *format, ...)
+{
+    int retval;
+    va_list va;
+
+    va_start(va, format);
+    retval = vgetargs1_impl(NULL, args, nargs, format, &va, 0);
+    va_end(va);
+    return retval;
+}
+
+int
+_PyArg_ParseStack_SizeT(PyObject **args, Py_ssize_t nargs,
+                        const char *format, ...)
+{
+    int retval;
+    va_list va;
+
+    va_start(va, format);
+    retval = vgetargs1_impl(NULL, args, nargs, format, &va, FLAG_SIZE_T);
+    va_end(va);
+    return retval;
+}
+
 
 /* Handle cleanup of allocated memory in case of exception */
 
@@ -195,8 +227,11 @@ cleanreturn(int retval, freelist_t *freelist)
 }
 
 
+/* Parse the nargs arguments of the stack array, or compat_args with
+   FLAG_COMPAT (see PyArg_Parse()) */
 static int
-vgetargs1(PyObject *args, const char *format, va_list *p_va, int flags)
+vgetargs1_impl(PyObject *compat_args, PyObject **stack, Py_ssize_t nargs,
+               const char *format, va_list *p_va, int flags)
 {
     char msgbuf[256];
     int levels[32];
@@ -207,7 +242,7 @@ vgetargs1(PyObject *args, const char *format, va_list *p_va, int flags)
     int level = 0;
     int endfmt = 0;
     const char *formatsave = format;
-    Py_ssize_t i, len;
+    Py_ssize_t i;
     const char *msg;
     int compat = flags & FLAG_COMPAT;
     freelistentry_t static_entries[STATIC_FREELIST_ENTRIES];
@@ -217,7 +252,7 @@ vgetargs1(PyObject *args, const char *format, va_list *p_va, int flags)
     freelist.first_available = 0;
     freelist.entries_malloced = 0;
 
-    assert(compat || (args != (PyObject*)NULL));
+    assert(nargs == 0 || stack != NULL);
     flags = flags & ~FLAG_COMPAT;
 
     while (endfmt == 0) {
@@ -281,7 +316,7 @@ vgetargs1(PyObject *args, const char *format, va_list *p_va, int flags)
 
     if (compat) {
         if (max == 0) {
-            if (args == NULL)
+            if (compat_args == NULL)
                 return 1;
             PyErr_Format(PyExc_TypeError,
                          "%.200s%s takes no arguments",
@@ -290,14 +325,14 @@ vgetargs1(PyObject *args, const char *format, va_list *p_va, int flags)
             return cleanreturn(0, &freelist);
         }
         else if (min == 1 && max == 1) {
-            if (args == NULL) {
+            if (compat_args == NULL) {
                 PyErr_Format(PyExc_TypeError,
                              "%.200s%s takes at least one argument",
                              fname==NULL ? "function" : fname,
                              fname==NULL ? "" : "()");
                 return cleanreturn(0, &freelist);
             }
-            msg = convertitem(args, &format, p_va, flags, levels,
+            msg = convertitem(compat_args, &format, p_va, flags, levels,
                               msgbuf, sizeof(msgbuf), &freelist);
             if (msg == NULL)
                 return cleanreturn(1, &freelist);
@@ -311,34 +346,26 @@ vgetargs1(PyObject *args, const char *format, va_list *p_va, int flags)
         }
     }
 
-    if (!PyTuple_Check(args)) {
-        PyErr_SetString(PyExc_SystemError,
-            "new style getargs format but argument is not a tuple");
-        return cleanreturn(0, &freelist);
-    }
-
-    len = PyTuple_GET_SIZE(args);
-
-    if (len < min || max < len) {
+    if (nargs < min || max < nargs) {
         if (message == NULL)
             PyErr_Format(PyExc_TypeError,
                          "%.150s%s takes %s %d argument%s (%ld given)",
                          fname==NULL ? "function" : fname,
                          fname==NULL ? "" : "()",
                          min==max ? "exactly"
-                         : len < min ? "at least" : "at most",
-                         len < min ? min : max,
-                         (len < min ? min : max) == 1 ? "" : "s",
-                         Py_SAFE_DOWNCAST(len, Py_ssize_t, long));
+                         : nargs < min ? "at least" : "at most",
+                         nargs < min ? min : max,
+                         (nargs < min ? min : max) == 1 ? "" : "s",
+                         Py_SAFE_DOWNCAST(nargs, Py_ssize_t, long));
         else
             PyErr_SetString(PyExc_TypeError, message);
         return cleanreturn(0, &freelist);
     }
 
-    for (i = 0; i < len; i++) {
+    for (i = 0; i < nargs; i++) {
         if (*format == '|')
             format++;
-        msg = convertitem(PyTuple_GET_ITEM(args, i), &format, p_va,
+        msg = convertitem(stack[i], &format, p_va,
                           flags, levels, msgbuf,
                           sizeof(msgbuf), &freelist);
         if (msg) {
@@ -358,6 +385,20 @@ vgetargs1(PyObject *args, const char *format, va_list *p_va, int flags)
     return cleanreturn(1, &freelist);
 }
 
+static int
+vgetargs1(PyObject *args, const char *format, va_list *p_va, int flags)
+{
+    if (flags & FLAG_COMPAT)
+        return vgetargs1_impl(args, NULL, 0, format, p_va, flags);
+    assert(args != NULL);
+    if (!PyTuple_Check(args)) {
+        PyErr_SetString(PyExc_SystemError,
+            "new style getargs format but argument is not a tuple");
+        return 0;
+    }
+    return vgetargs1_impl(NULL, &PyTuple_GET_ITEM(args, 0),
+                          PyTuple_GET_SIZE(args), format, p_va, flags);
+}
 
 
 static void
@@ -1337,7 +1378,9 @@ PyArg_ParseTupleAndKeywords(PyObject *args,
     }
 
     va_start(va, kwlist);
-    retval = vgetargskeywords(args, keywords, format, kwlist, &va, 0);
+    retval = vgetargskeywords(&PyTuple_GET_ITEM(args, 0),
+                              PyTuple_GET_SIZE(args), keywords, NULL,
+                              format, kwlist, &va, 0);
     va_end(va);
     return retval;
 }
@@ -1361,8 +1404,9 @@ _PyArg_ParseTupleAndKeywords_SizeT(PyObject *args,
     }
 
     va_start(va, kwlist);
-    retval = vgetargskeywords(args, keywords, format,
-                              kwlist, &va, FLAG_SIZE_T);
+    retval = vgetargskeywords(&PyTuple_GET_ITEM(args, 0),
+                              PyTuple_GET_SIZE(args), keywords, NULL,
+                              format, kwlist, &va, FLAG_SIZE_T);
     va_end(va);
     return retval;
 }
@@ -1388,7 +1432,9 @@ PyArg_VaParseTupleAndKeywords(PyObject *args,
 
         Py_VA_COPY(lva, va);
 
-    retval = vgetargskeywords(args, keywords, format, kwlist, &lva, 0);
+    retval = vgetargskeywords(&PyTuple_GET_ITEM(args, 0),
+                              PyTuple_GET_SIZE(args), keywords, NULL,
+                              format, kwlist, &lva, 0);
     return retval;
 }
 
@@ -1412,8 +1458,57 @@ _PyArg_VaParseTupleAndKeywords_SizeT(PyObject *args,
 
         Py_VA_COPY(lva, va);
 
-    retval = vgetargskeywords(args, keywords, format,
-                              kwlist, &lva, FLAG_SIZE_T);
+    retval = vgetargskeywords(&PyTuple_GET_ITEM(args, 0),
+                              PyTuple_GET_SIZE(args), keywords, NULL,
+                              format, kwlist, &lva, FLAG_SIZE_T);
+    return retval;
+}
+
+int
+_PyArg_ParseStackAndKeywords(PyObject **args, Py_ssize_t nargs,
+                             PyObject *kwnames, const char *format,
+                             char **kwlist, ...)
+{
+    int retval;
+    va_list va;
+
+    if ((nargs > 0 && args == NULL) ||
+        (kwnames != NULL && !PyTuple_Check(kwnames)) ||
+        format == NULL ||
+        kwlist == NULL)
+    {
+        PyErr_BadInternalCall();
+        return 0;
+    }
+
+    va_start(va, kwlist);
+    retval = vgetargskeywords(args, nargs, NULL, kwnames,
+                              format, kwlist, &va, 0);
+    va_end(va);
+    return retval;
+}
+
+int
+_PyArg_ParseStackAndKeywords_SizeT(PyObject **args, Py_ssize_t nargs,
+                                   PyObject *kwnames, const char *format,
+                                   char **kwlist, ...)
+{
+    int retval;
+    va_list va;
+
+    if ((nargs > 0 && args == NULL) ||
+        (kwnames != NULL && !PyTuple_Check(kwnames)) ||
+        format == NULL ||
+        kwlist == NULL)
+    {
+        PyErr_BadInternalCall();
+        return 0;
+    }
+
+    va_start(va, kwlist);
+    retval = vgetargskeywords(args, nargs, NULL, kwnames,
+                              format, kwlist, &va, FLAG_SIZE_T);
+    va_end(va);
     return retval;
 }
 
@@ -1434,8 +1529,30 @@ PyArg_ValidateKeywordArguments(PyObject *kwargs)
 
 #define IS_END_OF_FORMAT(c) (c == '\0' || c == ';' || c == ':')
 
+/* Return the value of the keyword argument named key, which follows the
+   positional arguments on the stack, or NULL (without setting an
+   exception) if there is none. */
+static PyObject *
+find_keyword(PyObject *kwnames, PyObject **kwstack, const char *key)
+{
+    Py_ssize_t i, nkwargs = PyTuple_GET_SIZE(kwnames);
+
+    for (i = 0; i < nkwargs; i++) {
+        PyObject *kwname = PyTuple_GET_ITEM(kwnames, i);
+
+        if (PyUnicode_Check(kwname) &&
+            !PyUnicode_CompareWithASCIIString(kwname, key))
+            return kwstack[i];
+    }
+    return NULL;
+}
+
+/* Parse the nargs positional arguments of the stack array, and the
+   keyword arguments: either the keywords dict, or the values following
+   the positional arguments on the stack, named by the kwnames tuple. */
 static int
-vgetargskeywords(PyObject *args, PyObject *keywords, const char *format,
+vgetargskeywords(PyObject **stack, Py_ssize_t nargs, PyObject *keywords,
+                 PyObject *kwnames, const char *format,
                  char **kwlist, va_list *p_va, int flags)
 {
     char msgbuf[512];
@@ -1444,7 +1561,7 @@ vgetargskeywords(PyObject *args, PyObject *keywords, const char *format,
     int min = INT_MAX;
     int max = INT_MAX;
     int i, len;
-    Py_ssize_t nargs, nkeywords;
+    Py_ssize_t nkeywords;
     PyObject *current_arg;
     freelistentry_t static_entries[STATIC_FREELIST_ENTRIES];
     freelist_t freelist;
@@ -1453,8 +1570,10 @@ vgetargskeywords(PyObject *args, PyObject *keywords, const char *format,
     freelist.first_available = 0;
     freelist.entries_malloced = 0;
 
-    assert(args != NULL && PyTuple_Check(args));
+    assert(nargs == 0 || stack != NULL);
     assert(keywords == NULL || PyDict_Check(keywords));
+    assert(kwnames == NULL || PyTuple_Check(kwnames));
+    assert(keywords == NULL || kwnames == NULL);
     assert(format != NULL);
     assert(kwlist != NULL);
     assert(p_va != NULL);
@@ -1484,8 +1603,12 @@ vgetargskeywords(PyObject *args, PyObject *keywords, const char *format,
         freelist.entries_malloced = 1;
     }
 
-    nargs = PyTuple_GET_SIZE(args);
-    nkeywords = (keywords == NULL) ? 0 : PyDict_Size(keywords);
+    if (keywords != NULL)
+        nkeywords = PyDict_Size(keywords);
+    else if (kwnames != NULL)
+        nkeywords = PyTuple_GET_SIZE(kwnames);
+    else
+        nkeywords = 0;
     if (nargs + nkeywords > len) {
         PyErr_Format(PyExc_TypeError,
                      "%s%s takes at most %d argument%s (%zd given)",
@@ -1543,7 +1666,10 @@ vgetargskeywords(PyObject *args, PyObject *keywords, const char *format,
         }
         current_arg = NULL;
         if (nkeywords) {
-            current_arg = PyDict_GetItemString(keywords, keyword);
+            if (keywords != NULL)
+                current_arg = PyDict_GetItemString(keywords, keyword);
+            else
+                current_arg = find_keyword(kwnames, stack + nargs, keyword);
         }
         if (current_arg) {
             --nkeywords;
@@ -1559,7 +1685,7 @@ vgetargskeywords(PyObject *args, PyObject *keywords, const char *format,
         else if (nkeywords && PyErr_Occurred())
             return cleanreturn(0, &freelist);
         else if (i < nargs)
-            current_arg = PyTuple_GET_ITEM(args, i);
+            current_arg = stack[i];
 
         if (current_arg) {
             msg = convertitem(current_arg, &format, p_va, flags,
@@ -1605,8 +1731,17 @@ vgetargskeywords(PyObject *args, PyObject *keywords, const char *format,
     if (nkeywords > 0) {
         PyObject *key, *value;
         Py_ssize_t pos = 0;
-        while (PyDict_Next(keywords, &pos, &key, &value)) {
+        for (;;) {
             int match = 0;
+            if (keywords != NULL) {
+                if (!PyDict_Next(keywords, &pos, &key, &value))
+                    break;
+            }
+            else {
+                if (pos == PyTuple_GET_SIZE(kwnames))
+                    break;
+                key = PyTuple_GET_ITEM(kwnames, pos++);
+            }
             if (!PyUnicode_Check(key)) {
                 PyErr_SetString(PyExc_TypeError,
                                 "keywords must be strings");
@@ -1754,49 +1889,62 @@ err:
 }
 
 
-int
-PyArg_UnpackTuple(PyObject *args, const char *name, Py_ssize_t min, Py_ssize_t max, ...)
+static int
+unpack_stack(PyObject **args, Py_ssize_t nargs, const char *name,
+             Py_ssize_t min, Py_ssize_t max, va_list vargs)
 {
-    Py_ssize_t i, l;
+    Py_ssize_t i;
     PyObject **o;
-    va_list vargs;
 
     assert(min >= 0);
     assert(min <= max);
-    if (!PyTuple_Check(args)) {
-        PyErr_SetString(PyExc_SystemError,
-            "PyArg_UnpackTuple() argument list is not a tuple");
-        return 0;
-    }
-    l = PyTuple_GET_SIZE(args);
-    if (l < min) {
+    if (nargs < min) {
         if (name != NULL)
             PyErr_Format(
                 PyExc_TypeError,
                 "%s expected %s%zd arguments, got %zd",
-                name, (min == max ? "" : "at least "), min, l);
+                name, (min == max ? "" : "at least "), min, nargs);
         else
             PyErr_Format(
                 PyExc_TypeError,
                 "unpacked tuple should have %s%zd elements,"
                 " but has %zd",
-                (min == max ? "" : "at least "), min, l);
+                (min == max ? "" : "at least "), min, nargs);
         return 0;
     }
-    if (l == 0)
+    if (nargs == 0)
         return 1;
-    if (l > max) {
+    if (nargs > max) {
         if (name != NULL)
             PyErr_Format(
                 PyExc_TypeError,
                 "%s expected %s%zd arguments, got %zd",
-                name, (min == max ? "" : "at most "), max, l);
+                name, (min == max ? "" : "at most "), max, nargs);
         else
             PyErr_Format(
                 PyExc_TypeError,
                 "unpacked tuple should have %s%zd elements,"
                 " but has %zd",
-                (min == max ? "" : "at most "), max, l);
+                (min == max ? "" : "at most "), max, nargs);
+        return 0;
+    }
+
+    for (i = 0; i < nargs; i++) {
+        o = va_arg(vargs, PyObject **);
+        *o = args[i];
+    }
+    return 1;
+}
+
+int
+PyArg_UnpackTuple(PyObject *args, const char *name, Py_ssize_t min, Py_ssize_t max, ...)
+{
+    int retval;
+    va_list vargs;
+
+    if (!PyTuple_Check(args)) {
+        PyErr_SetString(PyExc_SystemError,
+            "PyArg_UnpackTuple() argument list is not a tuple");
         return 0;
     }
 
@@ -1805,12 +1953,27 @@ PyArg_UnpackTuple(PyObject *args, const char *name, Py_ssize_t min, Py_ssize_t m
 #else
     va_start(vargs);
 #endif
-    for (i = 0; i < l; i++) {
-        o = va_arg(vargs, PyObject **);
-        *o = PyTuple_GET_ITEM(args, i);
-    }
+    retval = unpack_stack(&PyTuple_GET_ITEM(args, 0), PyTuple_GET_SIZE(args),
+                          name, min, max, vargs);
     va_end(vargs);
-    return 1;
+    return retval;
+}
+
+int
+_PyArg_UnpackStack(PyObject **args, Py_ssize_t nargs, const char *name,
+                   Py_ssize_t min, Py_ssize_t max, ...)
+{
+    int retval;
+    va_list vargs;
+
+#ifdef HAVE_STDARG_PROTOTYPES
+    va_start(vargs, max);
+#else
+    va_start(vargs);
+#endif
+    retval = unpack_stack(args, nargs, name, min, max, vargs);
+    va_end(vargs);
+    return retval;
 }
 
 
@@ -1837,6 +2000,24 @@ _PyArg_NoKeywords(const char *funcname, PyObject *kw)
 }
 
 
+int
+_PyArg_NoStackKeywords(const char *funcname, PyObject *kwnames)
+{
+    if (kwnames == NULL)
+        return 1;
+    if (!PyTuple_CheckExact(kwnames)) {
+        PyErr_BadInternalCall();
+        return 0;
+    }
+    if (PyTuple_GET_SIZE(kwnames) == 0)
+        return 1;
+
+    PyErr_Format(PyExc_TypeError, "%.200s() takes no keyword arguments",
+                 funcname);
+    return 0;
+}
+
+
 int
 _PyArg_NoPositional(const char *funcname, PyObject *args)
 {
@@ -8,8 +8,8 @@ const unsigned char _Py_M__importlib_external[] = {
     90,7,100,16,100,17,132,0,90,8,100,18,100,19,132,0,
     90,9,100,20,100,21,132,0,90,10,100,22,100,23,100,24,
     132,1,90,11,101,12,101,11,106,13,131,1,90,14,100,25,
-    106,15,100,26,100,27,131,2,100,28,23,0,90,16,101,17,
-    106,18,101,16,100,27,131,2,90,19,100,29,90,20,100,30,
+    160,15,100,26,100,27,161,2,100,28,23,0,90,16,101,17,
+    160,18,101,16,100,27,161,2,90,19,100,29,90,20,100,30,
     90,21,100,31,103,1,90,22,100,32,103,1,90,23,101,23,
     4,0,90,24,90,25,100,33,100,34,100,33,100,35,100,36,
     144,1,132,1,90,26,100,37,100,38,132,0,90,27,100,39,
@@ -57,8 +57,8 @@ const unsigned char _Py_M__importlib_external[] = {
     114,115,105,111,110,32,111,102,32,116,104,105,115,32,109,111,
     100,117,108,101,46,10,10,218,3,119,105,110,218,6,99,121,
     103,119,105,110,218,6,100,97,114,119,105,110,99,0,0,0,
-    0,0,0,0,0,1,0,0,0,2,0,0,0,67,0,0,
-    0,115,34,0,0,0,116,0,106,1,106,2,116,3,131,1,
+    0,0,0,0,0,1,0,0,0,3,0,0,0,67,0,0,
+    0,115,34,0,0,0,116,0,106,1,160,2,116,3,161,1,
     114,22,100,1,100,2,132,0,125,0,110,8,100,3,100,2,
     132,0,125,0,124,0,83,0,41,4,78,99,0,0,0,0,
     0,0,0,0,0,0,0,0,2,0,0,0,83,0,0,0,
@@ -92,8 +92,8 @@ const unsigned char _Py_M__importlib_external[] = {
     109,97,107,101,95,114,101,108,97,120,95,99,97,115,101,28,
     0,0,0,115,8,0,0,0,0,1,12,1,10,4,8,3,
     114,11,0,0,0,99,1,0,0,0,0,0,0,0,1,0,
-    0,0,3,0,0,0,67,0,0,0,115,20,0,0,0,116,
-    0,124,0,131,1,100,1,64,0,106,1,100,2,100,3,131,
+    0,0,4,0,0,0,67,0,0,0,115,20,0,0,0,116,
+    0,124,0,131,1,100,1,64,0,160,1,100,2,100,3,161,
     2,83,0,41,4,122,42,67,111,110,118,101,114,116,32,97,
     32,51,50,45,98,105,116,32,105,110,116,101,103,101,114,32,
     116,111,32,108,105,116,116,108,101,45,101,110,100,105,97,110,
@@ -103,8 +103,8 @@ const unsigned char _Py_M__importlib_external[] = {
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,218,7,
     95,119,95,108,111,110,103,40,0,0,0,115,2,0,0,0,
     0,2,114,17,0,0,0,99,1,0,0,0,0,0,0,0,
-    1,0,0,0,3,0,0,0,67,0,0,0,115,12,0,0,
-    0,116,0,106,1,124,0,100,1,131,2,83,0,41,2,122,
+    1,0,0,0,4,0,0,0,67,0,0,0,115,12,0,0,
+    0,116,0,160,1,124,0,100,1,161,2,83,0,41,2,122,
     47,67,111,110,118,101,114,116,32,52,32,98,121,116,101,115,
     32,105,110,32,108,105,116,116,108,101,45,101,110,100,105,97,
     110,32,116,111,32,97,110,32,105,110,116,101,103,101,114,46,
@@ -113,14 +113,14 @@ const unsigned char _Py_M__importlib_external[] = {
     98,121,116,101,115,114,4,0,0,0,114,4,0,0,0,114,
     5,0,0,0,218,7,95,114,95,108,111,110,103,45,0,0,
     0,115,2,0,0,0,0,2,114,19,0,0,0,99,0,0,
-    0,0,0,0,0,0,1,0,0,0,3,0,0,0,71,0,
-    0,0,115,20,0,0,0,116,0,106,1,100,1,100,2,132,
-    0,124,0,68,0,131,1,131,1,83,0,41,3,122,31,82,
+    0,0,0,0,0,0,1,0,0,0,4,0,0,0,71,0,
+    0,0,115,20,0,0,0,116,0,160,1,100,1,100,2,132,
+    0,124,0,68,0,131,1,161,1,83,0,41,3,122,31,82,
     101,112,108,97,99,101,109,101,110,116,32,102,111,114,32,111,
     115,46,112,97,116,104,46,106,111,105,110,40,41,46,99,1,
-    0,0,0,0,0,0,0,2,0,0,0,4,0,0,0,83,
+    0,0,0,0,0,0,0,2,0,0,0,5,0,0,0,83,
     0,0,0,115,26,0,0,0,103,0,124,0,93,18,125,1,
-    124,1,114,4,124,1,106,0,116,1,131,1,145,2,113,4,
+    124,1,114,4,124,1,160,0,116,1,161,1,145,2,113,4,
     83,0,114,4,0,0,0,41,2,218,6,114,115,116,114,105,
     112,218,15,112,97,116,104,95,115,101,112,97,114,97,116,111,
     114,115,41,2,218,2,46,48,218,4,112,97,114,116,114,4,
@@ -135,7 +135,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,115,4,0,0,0,0,2,10,1,114,28,0,0,
     0,99,1,0,0,0,0,0,0,0,5,0,0,0,5,0,
     0,0,67,0,0,0,115,98,0,0,0,116,0,116,1,131,
-    1,100,1,107,2,114,36,124,0,106,2,116,3,131,1,92,
+    1,100,1,107,2,114,36,124,0,160,2,116,3,161,1,92,
     3,125,1,125,2,125,3,124,1,124,3,102,2,83,0,120,
     52,116,4,124,0,131,1,68,0,93,40,125,4,124,4,116,
     1,107,6,114,46,124,0,106,5,124,4,100,2,100,1,144,
@@ -153,8 +153,8 @@ const unsigned char _Py_M__importlib_external[] = {
     112,97,116,104,95,115,112,108,105,116,56,0,0,0,115,16,
     0,0,0,0,2,12,1,16,1,8,1,14,1,8,1,20,
     1,12,1,114,38,0,0,0,99,1,0,0,0,0,0,0,
-    0,1,0,0,0,2,0,0,0,67,0,0,0,115,10,0,
-    0,0,116,0,106,1,124,0,131,1,83,0,41,1,122,126,
+    0,1,0,0,0,3,0,0,0,67,0,0,0,115,10,0,
+    0,0,116,0,160,1,124,0,161,1,83,0,41,1,122,126,
     83,116,97,116,32,116,104,101,32,112,97,116,104,46,10,10,
     32,32,32,32,77,97,100,101,32,97,32,115,101,112,97,114,
     97,116,101,32,102,117,110,99,116,105,111,110,32,116,111,32,
@@ -192,7 +192,7 @@ const unsigned char _Py_M__importlib_external[] = {
     115,102,105,108,101,87,0,0,0,115,2,0,0,0,0,2,
     114,44,0,0,0,99,1,0,0,0,0,0,0,0,1,0,
     0,0,3,0,0,0,67,0,0,0,115,22,0,0,0,124,
-    0,115,12,116,0,106,1,131,0,125,0,116,2,124,0,100,
+    0,115,12,116,0,160,1,161,0,125,0,116,2,124,0,100,
     1,131,2,83,0,41,2,122,30,82,101,112,108,97,99,101,
     109,101,110,116,32,102,111,114,32,111,115,46,112,97,116,104,
     46,105,115,100,105,114,46,105,0,64,0,0,41,3,114,3,
@@ -202,15 +202,15 @@ const unsigned char _Py_M__importlib_external[] = {
     100,105,114,92,0,0,0,115,6,0,0,0,0,2,4,1,
     8,1,114,46,0,0,0,105,182,1,0,0,99,3,0,0,
     0,0,0,0,0,6,0,0,0,17,0,0,0,67,0,0,
-    0,115,162,0,0,0,100,1,106,0,124,0,116,1,124,0,
-    131,1,131,2,125,3,116,2,106,3,124,3,116,2,106,4,
+    0,115,162,0,0,0,100,1,160,0,124,0,116,1,124,0,
+    131,1,161,2,125,3,116,2,160,3,124,3,116,2,106,4,
     116,2,106,5,66,0,116,2,106,6,66,0,124,2,100,2,
-    64,0,131,3,125,4,121,50,116,7,106,8,124,4,100,3,
-    131,2,143,16,125,5,124,5,106,9,124,1,131,1,1,0,
-    87,0,100,4,81,0,82,0,88,0,116,2,106,10,124,3,
-    124,0,131,2,1,0,87,0,110,58,4,0,116,11,107,10,
-    114,156,1,0,1,0,1,0,121,14,116,2,106,12,124,3,
-    131,1,1,0,87,0,110,20,4,0,116,11,107,10,114,148,
+    64,0,161,3,125,4,121,50,116,7,160,8,124,4,100,3,
+    161,2,143,16,125,5,124,5,160,9,124,1,161,1,1,0,
+    87,0,100,4,81,0,82,0,88,0,116,2,160,10,124,3,
+    124,0,161,2,1,0,87,0,110,58,4,0,116,11,107,10,
+    114,156,1,0,1,0,1,0,121,14,116,2,160,12,124,3,
+    161,1,1,0,87,0,110,20,4,0,116,11,107,10,114,148,
     1,0,1,0,1,0,89,0,110,2,88,0,130,0,89,0,
     110,2,88,0,100,4,83,0,41,5,122,162,66,101,115,116,
     45,101,102,102,111,114,116,32,102,117,110,99,116,105,111,110,
@@ -236,26 +236,26 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,218,13,95,119,114,105,116,101,95,97,116,111,109,105,
     99,99,0,0,0,115,26,0,0,0,0,5,16,1,6,1,
     26,1,2,3,14,1,20,1,16,1,14,1,2,1,14,1,
-    14,1,6,1,114,55,0,0,0,105,42,13,0,0,233,2,
+    14,1,6,1,114,55,0,0,0,105,43,13,0,0,233,2,
     0,0,0,114,13,0,0,0,115,2,0,0,0,13,10,90,
     11,95,95,112,121,99,97,99,104,101,95,95,122,4,111,112,
     116,45,122,3,46,112,121,122,4,46,112,121,99,78,218,12,
     111,112,116,105,109,105,122,97,116,105,111,110,99,2,0,0,
     0,1,0,0,0,11,0,0,0,6,0,0,0,67,0,0,
     0,115,234,0,0,0,124,1,100,1,107,9,114,52,116,0,
-    106,1,100,2,116,2,131,2,1,0,124,2,100,1,107,9,
+    160,1,100,2,116,2,161,2,1,0,124,2,100,1,107,9,
     114,40,100,3,125,3,116,3,124,3,131,1,130,1,124,1,
     114,48,100,4,110,2,100,5,125,2,116,4,124,0,131,1,
-    92,2,125,4,125,5,124,5,106,5,100,6,131,1,92,3,
+    92,2,125,4,125,5,124,5,160,5,100,6,161,1,92,3,
     125,6,125,7,125,8,116,6,106,7,106,8,125,9,124,9,
     100,1,107,8,114,104,116,9,100,7,131,1,130,1,100,4,
-    106,10,124,6,114,116,124,6,110,2,124,8,124,7,124,9,
-    103,3,131,1,125,10,124,2,100,1,107,8,114,162,116,6,
+    160,10,124,6,114,116,124,6,110,2,124,8,124,7,124,9,
+    103,3,161,1,125,10,124,2,100,1,107,8,114,162,116,6,
     106,11,106,12,100,8,107,2,114,154,100,4,125,2,110,8,
     116,6,106,11,106,12,125,2,116,13,124,2,131,1,125,2,
-    124,2,100,4,107,3,114,214,124,2,106,14,131,0,115,200,
-    116,15,100,9,106,16,124,2,131,1,131,1,130,1,100,10,
-    106,16,124,10,116,17,124,2,131,3,125,10,116,18,124,4,
+    124,2,100,4,107,3,114,214,124,2,160,14,161,0,115,200,
+    116,15,100,9,160,16,124,2,161,1,131,1,130,1,100,10,
+    160,16,124,10,116,17,124,2,161,3,125,10,116,18,124,4,
     116,19,124,10,116,20,100,8,25,0,23,0,131,3,83,0,
     41,11,97,254,2,0,0,71,105,118,101,110,32,116,104,101,
     32,112,97,116,104,32,116,111,32,97,32,46,112,121,32,102,
@@ -339,7 +339,7 @@ const unsigned char _Py_M__importlib_external[] = {
     103,90,15,97,108,109,111,115,116,95,102,105,108,101,110,97,
     109,101,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
     0,218,17,99,97,99,104,101,95,102,114,111,109,95,115,111,
-    117,114,99,101,249,0,0,0,115,46,0,0,0,0,18,8,
+    117,114,99,101,250,0,0,0,115,46,0,0,0,0,18,8,
     1,6,1,6,1,8,1,4,1,8,1,12,1,12,1,16,
     1,8,1,8,1,8,1,24,1,8,1,12,1,6,2,8,
     1,8,1,8,1,8,1,14,1,14,1,114,79,0,0,0,
@@ -348,15 +348,15 @@ const unsigned char _Py_M__importlib_external[] = {
     100,1,107,8,114,20,116,3,100,2,131,1,130,1,116,4,
     124,0,131,1,92,2,125,1,125,2,116,4,124,1,131,1,
     92,2,125,1,125,3,124,3,116,5,107,3,114,68,116,6,
-    100,3,106,7,116,5,124,0,131,2,131,1,130,1,124,2,
-    106,8,100,4,131,1,125,4,124,4,100,11,107,7,114,102,
-    116,6,100,7,106,7,124,2,131,1,131,1,130,1,110,86,
-    124,4,100,6,107,2,114,188,124,2,106,9,100,4,100,5,
-    131,2,100,12,25,0,125,5,124,5,106,10,116,11,131,1,
-    115,150,116,6,100,8,106,7,116,11,131,1,131,1,130,1,
+    100,3,160,7,116,5,124,0,161,2,131,1,130,1,124,2,
+    160,8,100,4,161,1,125,4,124,4,100,11,107,7,114,102,
+    116,6,100,7,160,7,124,2,161,1,131,1,130,1,110,86,
+    124,4,100,6,107,2,114,188,124,2,160,9,100,4,100,5,
+    161,2,100,12,25,0,125,5,124,5,160,10,116,11,161,1,
+    115,150,116,6,100,8,160,7,116,11,161,1,131,1,130,1,
     124,5,116,12,116,11,131,1,100,1,133,2,25,0,125,6,
-    124,6,106,13,131,0,115,188,116,6,100,9,106,7,124,5,
-    131,1,131,1,130,1,124,2,106,14,100,4,131,1,100,10,
+    124,6,160,13,161,0,115,188,116,6,100,9,160,7,124,5,
+    161,1,131,1,130,1,124,2,160,14,100,4,161,1,100,10,
     25,0,125,7,116,15,124,1,124,7,116,16,100,10,25,0,
     23,0,131,2,83,0,41,13,97,110,1,0,0,71,105,118,
     101,110,32,116,104,101,32,112,97,116,104,32,116,111,32,97,
@@ -412,15 +412,15 @@ const unsigned char _Py_M__importlib_external[] = {
     101,108,90,13,98,97,115,101,95,102,105,108,101,110,97,109,
     101,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
     218,17,115,111,117,114,99,101,95,102,114,111,109,95,99,97,
-    99,104,101,37,1,0,0,115,44,0,0,0,0,9,12,1,
+    99,104,101,38,1,0,0,115,44,0,0,0,0,9,12,1,
     8,1,12,1,12,1,8,1,6,1,10,1,10,1,8,1,
     6,1,10,1,8,1,16,1,10,1,6,1,8,1,16,1,
     8,1,6,1,8,1,14,1,114,85,0,0,0,99,1,0,
     0,0,0,0,0,0,5,0,0,0,12,0,0,0,67,0,
     0,0,115,128,0,0,0,116,0,124,0,131,1,100,1,107,
-    2,114,16,100,2,83,0,124,0,106,1,100,3,131,1,92,
-    3,125,1,125,2,125,3,124,1,12,0,115,58,124,3,106,
-    2,131,0,100,7,100,8,133,2,25,0,100,6,107,3,114,
+    2,114,16,100,2,83,0,124,0,160,1,100,3,161,1,92,
+    3,125,1,125,2,125,3,124,1,12,0,115,58,124,3,160,
+    2,161,0,100,7,100,8,133,2,25,0,100,6,107,3,114,
     62,124,0,83,0,121,12,116,3,124,0,131,1,125,4,87,
     0,110,36,4,0,116,4,116,5,102,2,107,10,114,110,1,
     0,1,0,1,0,124,0,100,2,100,9,133,2,25,0,125,
@@ -447,21 +447,21 @@ const unsigned char _Py_M__importlib_external[] = {
     0,90,9,101,120,116,101,110,115,105,111,110,218,11,115,111,
     117,114,99,101,95,112,97,116,104,114,4,0,0,0,114,4,
     0,0,0,114,5,0,0,0,218,15,95,103,101,116,95,115,
-    111,117,114,99,101,102,105,108,101,70,1,0,0,115,20,0,
+    111,117,114,99,101,102,105,108,101,71,1,0,0,115,20,0,
     0,0,0,7,12,1,4,1,16,1,26,1,4,1,2,1,
     12,1,18,1,18,1,114,91,0,0,0,99,1,0,0,0,
     0,0,0,0,1,0,0,0,11,0,0,0,67,0,0,0,
-    115,74,0,0,0,124,0,106,0,116,1,116,2,131,1,131,
+    115,74,0,0,0,124,0,160,0,116,1,116,2,131,1,161,
     1,114,46,121,8,116,3,124,0,131,1,83,0,4,0,116,
     4,107,10,114,42,1,0,1,0,1,0,89,0,113,70,88,
-    0,110,24,124,0,106,0,116,1,116,5,131,1,131,1,114,
+    0,110,24,124,0,160,0,116,1,116,5,131,1,161,1,114,
     66,124,0,83,0,110,4,100,0,83,0,100,0,83,0,41,
     1,78,41,6,218,8,101,110,100,115,119,105,116,104,218,5,
     116,117,112,108,101,114,84,0,0,0,114,79,0,0,0,114,
     66,0,0,0,114,74,0,0,0,41,1,218,8,102,105,108,
     101,110,97,109,101,114,4,0,0,0,114,4,0,0,0,114,
     5,0,0,0,218,11,95,103,101,116,95,99,97,99,104,101,
-    100,89,1,0,0,115,16,0,0,0,0,1,14,1,2,1,
+    100,90,1,0,0,115,16,0,0,0,0,1,14,1,2,1,
     8,1,14,1,8,1,14,1,6,2,114,95,0,0,0,99,
     1,0,0,0,0,0,0,0,2,0,0,0,11,0,0,0,
     67,0,0,0,115,52,0,0,0,121,14,116,0,124,0,131,
@@ -475,7 +475,7 @@ const unsigned char _Py_M__importlib_external[] = {
     114,39,0,0,0,114,41,0,0,0,114,40,0,0,0,41,
     2,114,35,0,0,0,114,42,0,0,0,114,4,0,0,0,
     114,4,0,0,0,114,5,0,0,0,218,10,95,99,97,108,
-    99,95,109,111,100,101,101,1,0,0,115,12,0,0,0,0,
+    99,95,109,111,100,101,102,1,0,0,115,12,0,0,0,0,
     2,2,1,14,1,14,1,10,3,8,1,114,97,0,0,0,
     99,1,0,0,0,0,0,0,0,3,0,0,0,11,0,0,
     0,3,0,0,0,115,68,0,0,0,100,1,135,0,102,1,
@@ -512,7 +512,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,218,4,97,114,103,115,90,6,107,119,97,114,103,
     115,41,1,218,6,109,101,116,104,111,100,114,4,0,0,0,
     114,5,0,0,0,218,19,95,99,104,101,99,107,95,110,97,
-    109,101,95,119,114,97,112,112,101,114,121,1,0,0,115,12,
+    109,101,95,119,114,97,112,112,101,114,122,1,0,0,115,12,
     0,0,0,0,1,8,1,8,1,10,1,4,1,20,1,122,
     40,95,99,104,101,99,107,95,110,97,109,101,46,60,108,111,
     99,97,108,115,62,46,95,99,104,101,99,107,95,110,97,109,
@@ -521,7 +521,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,120,40,100,5,68,0,93,32,125,2,116,0,124,
     1,124,2,131,2,114,6,116,1,124,0,124,2,116,2,124,
     1,124,2,131,2,131,3,1,0,113,6,87,0,124,0,106,
-    3,106,4,124,1,106,3,131,1,1,0,100,0,83,0,41,
+    3,160,4,124,1,106,3,161,1,1,0,100,0,83,0,41,
     6,78,218,10,95,95,109,111,100,117,108,101,95,95,218,8,
     95,95,110,97,109,101,95,95,218,12,95,95,113,117,97,108,
     110,97,109,101,95,95,218,7,95,95,100,111,99,95,95,41,
@@ -533,21 +533,21 @@ const unsigned char _Py_M__importlib_external[] = {
     105,99,116,95,95,218,6,117,112,100,97,116,101,41,3,90,
     3,110,101,119,90,3,111,108,100,114,52,0,0,0,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,218,5,95,
-    119,114,97,112,132,1,0,0,115,8,0,0,0,0,1,10,
+    119,114,97,112,133,1,0,0,115,8,0,0,0,0,1,10,
     1,10,1,22,1,122,26,95,99,104,101,99,107,95,110,97,
     109,101,46,60,108,111,99,97,108,115,62,46,95,119,114,97,
     112,41,3,218,10,95,98,111,111,116,115,116,114,97,112,114,
     113,0,0,0,218,9,78,97,109,101,69,114,114,111,114,41,
     3,114,102,0,0,0,114,103,0,0,0,114,113,0,0,0,
     114,4,0,0,0,41,1,114,102,0,0,0,114,5,0,0,
-    0,218,11,95,99,104,101,99,107,95,110,97,109,101,113,1,
+    0,218,11,95,99,104,101,99,107,95,110,97,109,101,114,1,
     0,0,115,14,0,0,0,0,8,14,7,2,1,10,1,14,
     2,14,5,10,1,114,116,0,0,0,99,2,0,0,0,0,
-    0,0,0,5,0,0,0,4,0,0,0,67,0,0,0,115,
-    60,0,0,0,124,0,106,0,124,1,131,1,92,2,125,2,
+    0,0,0,5,0,0,0,6,0,0,0,67,0,0,0,115,
+    60,0,0,0,124,0,160,0,124,1,161,1,92,2,125,2,
     125,3,124,2,100,1,107,8,114,56,116,1,124,3,131,1,
-    114,56,100,2,125,4,116,2,106,3,124,4,106,4,124,3,
-    100,3,25,0,131,1,116,5,131,2,1,0,124,2,83,0,
+    114,56,100,2,125,4,116,2,160,3,124,4,160,4,124,3,
+    100,3,25,0,161,1,116,5,161,2,1,0,124,2,83,0,
     41,4,122,155,84,114,121,32,116,111,32,102,105,110,100,32,
     97,32,108,111,97,100,101,114,32,102,111,114,32,116,104,101,
     32,115,112,101,99,105,102,105,101,100,32,109,111,100,117,108,
@@ -568,33 +568,33 @@ const unsigned char _Py_M__importlib_external[] = {
     108,108,110,97,109,101,218,6,108,111,97,100,101,114,218,8,
     112,111,114,116,105,111,110,115,218,3,109,115,103,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,218,17,95,102,
-    105,110,100,95,109,111,100,117,108,101,95,115,104,105,109,141,
+    105,110,100,95,109,111,100,117,108,101,95,115,104,105,109,142,
     1,0,0,115,10,0,0,0,0,10,14,1,16,1,4,1,
     22,1,114,123,0,0,0,99,4,0,0,0,0,0,0,0,
-    11,0,0,0,19,0,0,0,67,0,0,0,115,128,1,0,
+    11,0,0,0,20,0,0,0,67,0,0,0,115,128,1,0,
     0,105,0,125,4,124,2,100,1,107,9,114,22,124,2,124,
     4,100,2,60,0,110,4,100,3,125,2,124,3,100,1,107,
     9,114,42,124,3,124,4,100,4,60,0,124,0,100,1,100,
     5,133,2,25,0,125,5,124,0,100,5,100,6,133,2,25,
     0,125,6,124,0,100,6,100,7,133,2,25,0,125,7,124,
-    5,116,0,107,3,114,122,100,8,106,1,124,2,124,5,131,
-    2,125,8,116,2,106,3,100,9,124,8,131,2,1,0,116,
+    5,116,0,107,3,114,122,100,8,160,1,124,2,124,5,161,
+    2,125,8,116,2,160,3,100,9,124,8,161,2,1,0,116,
     4,124,8,124,4,141,1,130,1,110,86,116,5,124,6,131,
-    1,100,5,107,3,114,166,100,10,106,1,124,2,131,1,125,
-    8,116,2,106,3,100,9,124,8,131,2,1,0,116,6,124,
+    1,100,5,107,3,114,166,100,10,160,1,124,2,161,1,125,
+    8,116,2,160,3,100,9,124,8,161,2,1,0,116,6,124,
     8,131,1,130,1,110,42,116,5,124,7,131,1,100,5,107,
-    3,114,208,100,11,106,1,124,2,131,1,125,8,116,2,106,
-    3,100,9,124,8,131,2,1,0,116,6,124,8,131,1,130,
+    3,114,208,100,11,160,1,124,2,161,1,125,8,116,2,160,
+    3,100,9,124,8,161,2,1,0,116,6,124,8,131,1,130,
     1,124,1,100,1,107,9,144,1,114,116,121,16,116,7,124,
     1,100,12,25,0,131,1,125,9,87,0,110,20,4,0,116,
     8,107,10,114,254,1,0,1,0,1,0,89,0,110,48,88,
     0,116,9,124,6,131,1,124,9,107,3,144,1,114,46,100,
-    13,106,1,124,2,131,1,125,8,116,2,106,3,100,9,124,
-    8,131,2,1,0,116,4,124,8,124,4,141,1,130,1,121,
+    13,160,1,124,2,161,1,125,8,116,2,160,3,100,9,124,
+    8,161,2,1,0,116,4,124,8,124,4,141,1,130,1,121,
     16,124,1,100,14,25,0,100,15,64,0,125,10,87,0,110,
     22,4,0,116,8,107,10,144,1,114,84,1,0,1,0,1,
     0,89,0,110,32,88,0,116,9,124,7,131,1,124,10,107,
-    3,144,1,114,116,116,4,100,13,106,1,124,2,131,1,124,
+    3,144,1,114,116,116,4,100,13,160,1,124,2,161,1,124,
     4,141,1,130,1,124,0,100,7,100,1,133,2,25,0,83,
     0,41,16,97,122,1,0,0,86,97,108,105,100,97,116,101,
     32,116,104,101,32,104,101,97,100,101,114,32,111,102,32,116,
@@ -648,18 +648,18 @@ const unsigned char _Py_M__importlib_external[] = {
     109,101,218,11,115,111,117,114,99,101,95,115,105,122,101,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,218,25,
     95,118,97,108,105,100,97,116,101,95,98,121,116,101,99,111,
-    100,101,95,104,101,97,100,101,114,158,1,0,0,115,76,0,
+    100,101,95,104,101,97,100,101,114,159,1,0,0,115,76,0,
     0,0,0,11,4,1,8,1,10,3,4,1,8,1,8,1,
     12,1,12,1,12,1,8,1,12,1,12,1,12,1,12,1,
     10,1,12,1,10,1,12,1,10,1,12,1,8,1,10,1,
     2,1,16,1,14,1,6,2,14,1,10,1,12,1,10,1,
     2,1,16,1,16,1,6,2,14,1,10,1,6,1,114,135,
     0,0,0,99,4,0,0,0,0,0,0,0,5,0,0,0,
-    6,0,0,0,67,0,0,0,115,86,0,0,0,116,0,106,
-    1,124,0,131,1,125,4,116,2,124,4,116,3,131,2,114,
-    58,116,4,106,5,100,1,124,2,131,2,1,0,124,3,100,
-    2,107,9,114,52,116,6,106,7,124,4,124,3,131,2,1,
-    0,124,4,83,0,110,24,116,8,100,3,106,9,124,2,131,
+    6,0,0,0,67,0,0,0,115,86,0,0,0,116,0,160,
+    1,124,0,161,1,125,4,116,2,124,4,116,3,131,2,114,
+    58,116,4,160,5,100,1,124,2,161,2,1,0,124,3,100,
+    2,107,9,114,52,116,6,160,7,124,4,124,3,161,2,1,
+    0,124,4,83,0,110,24,116,8,100,3,160,9,124,2,161,
     1,100,4,124,1,100,5,124,2,144,2,131,1,130,1,100,
     2,83,0,41,6,122,60,67,111,109,112,105,108,101,32,98,
     121,116,101,99,111,100,101,32,97,115,32,114,101,116,117,114,
@@ -678,13 +678,13 @@ const unsigned char _Py_M__importlib_external[] = {
     114,89,0,0,0,114,90,0,0,0,218,4,99,111,100,101,
     114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,218,
     17,95,99,111,109,112,105,108,101,95,98,121,116,101,99,111,
-    100,101,213,1,0,0,115,16,0,0,0,0,2,10,1,10,
+    100,101,214,1,0,0,115,16,0,0,0,0,2,10,1,10,
     1,12,1,8,1,12,1,6,2,12,1,114,141,0,0,0,
     114,59,0,0,0,99,3,0,0,0,0,0,0,0,4,0,
-    0,0,3,0,0,0,67,0,0,0,115,56,0,0,0,116,
-    0,116,1,131,1,125,3,124,3,106,2,116,3,124,1,131,
-    1,131,1,1,0,124,3,106,2,116,3,124,2,131,1,131,
-    1,1,0,124,3,106,2,116,4,106,5,124,0,131,1,131,
+    0,0,5,0,0,0,67,0,0,0,115,56,0,0,0,116,
+    0,116,1,131,1,125,3,124,3,160,2,116,3,124,1,131,
+    1,161,1,1,0,124,3,160,2,116,3,124,2,131,1,161,
+    1,1,0,124,3,160,2,116,4,160,5,124,0,161,1,161,
     1,1,0,124,3,83,0,41,1,122,80,67,111,109,112,105,
     108,101,32,97,32,99,111,100,101,32,111,98,106,101,99,116,
     32,105,110,116,111,32,98,121,116,101,99,111,100,101,32,102,
@@ -696,14 +696,14 @@ const unsigned char _Py_M__importlib_external[] = {
     5,100,117,109,112,115,41,4,114,140,0,0,0,114,126,0,
     0,0,114,134,0,0,0,114,53,0,0,0,114,4,0,0,
     0,114,4,0,0,0,114,5,0,0,0,218,17,95,99,111,
-    100,101,95,116,111,95,98,121,116,101,99,111,100,101,225,1,
+    100,101,95,116,111,95,98,121,116,101,99,111,100,101,226,1,
     0,0,115,10,0,0,0,0,3,8,1,14,1,14,1,16,
     1,114,144,0,0,0,99,1,0,0,0,0,0,0,0,5,
-    0,0,0,4,0,0,0,67,0,0,0,115,62,0,0,0,
-    100,1,100,2,108,0,125,1,116,1,106,2,124,0,131,1,
-    106,3,125,2,124,1,106,4,124,2,131,1,125,3,116,1,
-    106,5,100,2,100,3,131,2,125,4,124,4,106,6,124,0,
-    106,6,124,3,100,1,25,0,131,1,131,1,83,0,41,4,
+    0,0,0,6,0,0,0,67,0,0,0,115,62,0,0,0,
+    100,1,100,2,108,0,125,1,116,1,160,2,124,0,161,1,
+    106,3,125,2,124,1,160,4,124,2,161,1,125,3,116,1,
+    160,5,100,2,100,3,161,2,125,4,124,4,160,6,124,0,
+    160,6,124,3,100,1,25,0,161,1,161,1,83,0,41,4,
     122,121,68,101,99,111,100,101,32,98,121,116,101,115,32,114,
     101,112,114,101,115,101,110,116,105,110,103,32,115,111,117,114,
     99,101,32,99,111,100,101,32,97,110,100,32,114,101,116,117,
@@ -723,29 +723,29 @@ const unsigned char _Py_M__importlib_external[] = {
     97,100,108,105,110,101,218,8,101,110,99,111,100,105,110,103,
     90,15,110,101,119,108,105,110,101,95,100,101,99,111,100,101,
     114,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
-    218,13,100,101,99,111,100,101,95,115,111,117,114,99,101,235,
+    218,13,100,101,99,111,100,101,95,115,111,117,114,99,101,236,
     1,0,0,115,10,0,0,0,0,5,8,1,12,1,10,1,
     12,1,114,149,0,0,0,114,120,0,0,0,218,26,115,117,
     98,109,111,100,117,108,101,95,115,101,97,114,99,104,95,108,
     111,99,97,116,105,111,110,115,99,2,0,0,0,2,0,0,
     0,9,0,0,0,19,0,0,0,67,0,0,0,115,8,1,
     0,0,124,1,100,1,107,8,114,58,100,2,125,1,116,0,
-    124,2,100,3,131,2,114,58,121,14,124,2,106,1,124,0,
-    131,1,125,1,87,0,110,20,4,0,116,2,107,10,114,56,
+    124,2,100,3,131,2,114,58,121,14,124,2,160,1,124,0,
+    161,1,125,1,87,0,110,20,4,0,116,2,107,10,114,56,
     1,0,1,0,1,0,89,0,110,2,88,0,116,3,106,4,
     124,0,124,2,100,4,124,1,144,1,131,2,125,4,100,5,
     124,4,95,5,124,2,100,1,107,8,114,146,120,54,116,6,
-    131,0,68,0,93,40,92,2,125,5,125,6,124,1,106,7,
-    116,8,124,6,131,1,131,1,114,98,124,5,124,0,124,1,
+    131,0,68,0,93,40,92,2,125,5,125,6,124,1,160,7,
+    116,8,124,6,131,1,161,1,114,98,124,5,124,0,124,1,
     131,2,125,2,124,2,124,4,95,9,80,0,113,98,87,0,
     100,1,83,0,124,3,116,10,107,8,114,212,116,0,124,2,
-    100,6,131,2,114,218,121,14,124,2,106,11,124,0,131,1,
+    100,6,131,2,114,218,121,14,124,2,160,11,124,0,161,1,
     125,7,87,0,110,20,4,0,116,2,107,10,114,198,1,0,
     1,0,1,0,89,0,113,218,88,0,124,7,114,218,103,0,
     124,4,95,12,110,6,124,3,124,4,95,12,124,4,106,12,
     103,0,107,2,144,1,114,4,124,1,144,1,114,4,116,13,
-    124,1,131,1,100,7,25,0,125,8,124,4,106,12,106,14,
-    124,8,131,1,1,0,124,4,83,0,41,8,97,61,1,0,
+    124,1,131,1,100,7,25,0,125,8,124,4,106,12,160,14,
+    124,8,161,1,1,0,124,4,83,0,41,8,97,61,1,0,
     0,82,101,116,117,114,110,32,97,32,109,111,100,117,108,101,
     32,115,112,101,99,32,98,97,115,101,100,32,111,110,32,97,
     32,102,105,108,101,32,108,111,99,97,116,105,111,110,46,10,
@@ -784,7 +784,7 @@ const unsigned char _Py_M__importlib_external[] = {
     7,100,105,114,110,97,109,101,114,4,0,0,0,114,4,0,
     0,0,114,5,0,0,0,218,23,115,112,101,99,95,102,114,
     111,109,95,102,105,108,101,95,108,111,99,97,116,105,111,110,
-    252,1,0,0,115,60,0,0,0,0,12,8,4,4,1,10,
+    253,1,0,0,115,60,0,0,0,0,12,8,4,4,1,10,
     2,2,1,14,1,14,1,6,8,18,1,6,3,8,1,16,
     1,14,1,10,1,6,1,6,2,4,3,8,2,10,1,2,
     1,14,1,14,1,6,2,4,1,8,2,6,1,12,1,6,
@@ -810,27 +810,27 @@ const unsigned char _Py_M__importlib_external[] = {
     114,115,105,111,110,125,92,77,111,100,117,108,101,115,92,123,
     102,117,108,108,110,97,109,101,125,92,68,101,98,117,103,70,
     99,2,0,0,0,0,0,0,0,2,0,0,0,11,0,0,
-    0,67,0,0,0,115,50,0,0,0,121,14,116,0,106,1,
-    116,0,106,2,124,1,131,2,83,0,4,0,116,3,107,10,
-    114,44,1,0,1,0,1,0,116,0,106,1,116,0,106,4,
-    124,1,131,2,83,0,88,0,100,0,83,0,41,1,78,41,
+    0,67,0,0,0,115,50,0,0,0,121,14,116,0,160,1,
+    116,0,106,2,124,1,161,2,83,0,4,0,116,3,107,10,
+    114,44,1,0,1,0,1,0,116,0,160,1,116,0,106,4,
+    124,1,161,2,83,0,88,0,100,0,83,0,41,1,78,41,
     5,218,7,95,119,105,110,114,101,103,90,7,79,112,101,110,
     75,101,121,90,17,72,75,69,89,95,67,85,82,82,69,78,
     84,95,85,83,69,82,114,40,0,0,0,90,18,72,75,69,
     89,95,76,79,67,65,76,95,77,65,67,72,73,78,69,41,
     2,218,3,99,108,115,218,3,107,101,121,114,4,0,0,0,
     114,4,0,0,0,114,5,0,0,0,218,14,95,111,112,101,
-    110,95,114,101,103,105,115,116,114,121,74,2,0,0,115,8,
+    110,95,114,101,103,105,115,116,114,121,75,2,0,0,115,8,
     0,0,0,0,2,2,1,14,1,14,1,122,36,87,105,110,
     100,111,119,115,82,101,103,105,115,116,114,121,70,105,110,100,
     101,114,46,95,111,112,101,110,95,114,101,103,105,115,116,114,
-    121,99,2,0,0,0,0,0,0,0,6,0,0,0,16,0,
+    121,99,2,0,0,0,0,0,0,0,6,0,0,0,17,0,
     0,0,67,0,0,0,115,116,0,0,0,124,0,106,0,114,
     14,124,0,106,1,125,2,110,6,124,0,106,2,125,2,124,
     2,106,3,100,1,124,1,100,2,100,3,116,4,106,5,100,
     0,100,4,133,2,25,0,22,0,144,2,131,0,125,3,121,
-    38,124,0,106,6,124,3,131,1,143,18,125,4,116,7,106,
-    8,124,4,100,5,131,2,125,5,87,0,100,0,81,0,82,
+    38,124,0,160,6,124,3,161,1,143,18,125,4,116,7,160,
+    8,124,4,100,5,161,2,125,5,87,0,100,0,81,0,82,
     0,88,0,87,0,110,20,4,0,116,9,107,10,114,110,1,
     0,1,0,1,0,100,0,83,0,88,0,124,5,83,0,41,
     6,78,114,119,0,0,0,90,11,115,121,115,95,118,101,114,
@@ -846,18 +846,18 @@ const unsigned char _Py_M__importlib_external[] = {
     107,101,121,114,165,0,0,0,90,4,104,107,101,121,218,8,
     102,105,108,101,112,97,116,104,114,4,0,0,0,114,4,0,
     0,0,114,5,0,0,0,218,16,95,115,101,97,114,99,104,
-    95,114,101,103,105,115,116,114,121,81,2,0,0,115,22,0,
+    95,114,101,103,105,115,116,114,121,82,2,0,0,115,22,0,
     0,0,0,2,6,1,8,2,6,1,10,1,22,1,2,1,
     12,1,26,1,14,1,6,1,122,38,87,105,110,100,111,119,
     115,82,101,103,105,115,116,114,121,70,105,110,100,101,114,46,
     95,115,101,97,114,99,104,95,114,101,103,105,115,116,114,121,
     78,99,4,0,0,0,0,0,0,0,8,0,0,0,14,0,
-    0,0,67,0,0,0,115,122,0,0,0,124,0,106,0,124,
-    1,131,1,125,4,124,4,100,0,107,8,114,22,100,0,83,
+    0,0,67,0,0,0,115,122,0,0,0,124,0,160,0,124,
+    1,161,1,125,4,124,4,100,0,107,8,114,22,100,0,83,
     0,121,12,116,1,124,4,131,1,1,0,87,0,110,20,4,
     0,116,2,107,10,114,54,1,0,1,0,1,0,100,0,83,
     0,88,0,120,60,116,3,131,0,68,0,93,50,92,2,125,
-    5,125,6,124,4,106,4,116,5,124,6,131,1,131,1,114,
+    5,125,6,124,4,160,4,116,5,124,6,131,1,161,1,114,
     64,116,6,106,7,124,1,124,5,124,1,124,4,131,2,100,
     1,124,4,144,1,131,2,125,7,124,7,83,0,113,64,87,
     0,100,0,83,0,41,2,78,114,152,0,0,0,41,8,114,
@@ -868,14 +868,14 @@ const unsigned char _Py_M__importlib_external[] = {
     114,35,0,0,0,218,6,116,97,114,103,101,116,114,171,0,
     0,0,114,120,0,0,0,114,160,0,0,0,114,158,0,0,
     0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
-    218,9,102,105,110,100,95,115,112,101,99,96,2,0,0,115,
+    218,9,102,105,110,100,95,115,112,101,99,97,2,0,0,115,
     26,0,0,0,0,2,10,1,8,1,4,1,2,1,12,1,
     14,1,6,1,16,1,14,1,6,1,10,1,8,1,122,31,
     87,105,110,100,111,119,115,82,101,103,105,115,116,114,121,70,
     105,110,100,101,114,46,102,105,110,100,95,115,112,101,99,99,
-    3,0,0,0,0,0,0,0,4,0,0,0,3,0,0,0,
-    67,0,0,0,115,36,0,0,0,124,0,106,0,124,1,124,
-    2,131,2,125,3,124,3,100,1,107,9,114,28,124,3,106,
+    3,0,0,0,0,0,0,0,4,0,0,0,4,0,0,0,
+    67,0,0,0,115,36,0,0,0,124,0,160,0,124,1,124,
+    2,161,2,125,3,124,3,100,1,107,9,114,28,124,3,106,
     1,83,0,110,4,100,1,83,0,100,1,83,0,41,2,122,
     108,70,105,110,100,32,109,111,100,117,108,101,32,110,97,109,
     101,100,32,105,110,32,116,104,101,32,114,101,103,105,115,116,
@@ -887,7 +887,7 @@ const unsigned char _Py_M__importlib_external[] = {
     114,175,0,0,0,114,120,0,0,0,41,4,114,164,0,0,
     0,114,119,0,0,0,114,35,0,0,0,114,158,0,0,0,
     114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,218,
-    11,102,105,110,100,95,109,111,100,117,108,101,112,2,0,0,
+    11,102,105,110,100,95,109,111,100,117,108,101,113,2,0,0,
     115,8,0,0,0,0,7,12,1,8,1,8,2,122,33,87,
     105,110,100,111,119,115,82,101,103,105,115,116,114,121,70,105,
     110,100,101,114,46,102,105,110,100,95,109,111,100,117,108,101,
@@ -896,7 +896,7 @@ const unsigned char _Py_M__importlib_external[] = {
     114,167,0,0,0,218,11,99,108,97,115,115,109,101,116,104,
     111,100,114,166,0,0,0,114,172,0,0,0,114,175,0,0,
     0,114,176,0,0,0,114,4,0,0,0,114,4,0,0,0,
-    114,4,0,0,0,114,5,0,0,0,114,162,0,0,0,62,
+    114,4,0,0,0,114,5,0,0,0,114,162,0,0,0,63,
     2,0,0,115,20,0,0,0,8,2,4,3,4,3,4,2,
     4,2,12,7,12,15,2,1,14,15,2,1,114,162,0,0,
     0,99,0,0,0,0,0,0,0,0,0,0,0,0,2,0,
@@ -910,11 +910,11 @@ const unsigned char _Py_M__importlib_external[] = {
     121,32,98,111,116,104,32,83,111,117,114,99,101,76,111,97,
     100,101,114,32,97,110,100,10,32,32,32,32,83,111,117,114,
     99,101,108,101,115,115,70,105,108,101,76,111,97,100,101,114,
-    46,99,2,0,0,0,0,0,0,0,5,0,0,0,3,0,
-    0,0,67,0,0,0,115,64,0,0,0,116,0,124,0,106,
-    1,124,1,131,1,131,1,100,1,25,0,125,2,124,2,106,
-    2,100,2,100,1,131,2,100,3,25,0,125,3,124,1,106,
-    3,100,2,131,1,100,4,25,0,125,4,124,3,100,5,107,
+    46,99,2,0,0,0,0,0,0,0,5,0,0,0,4,0,
+    0,0,67,0,0,0,115,64,0,0,0,116,0,124,0,160,
+    1,124,1,161,1,131,1,100,1,25,0,125,2,124,2,160,
+    2,100,2,100,1,161,2,100,3,25,0,125,3,124,1,160,
+    3,100,2,161,1,100,4,25,0,125,4,124,3,100,5,107,
     2,111,62,124,4,100,5,107,3,83,0,41,6,122,141,67,
     111,110,99,114,101,116,101,32,105,109,112,108,101,109,101,110,
     116,97,116,105,111,110,32,111,102,32,73,110,115,112,101,99,
@@ -931,7 +931,7 @@ const unsigned char _Py_M__importlib_external[] = {
     41,5,114,100,0,0,0,114,119,0,0,0,114,94,0,0,
     0,90,13,102,105,108,101,110,97,109,101,95,98,97,115,101,
     90,9,116,97,105,108,95,110,97,109,101,114,4,0,0,0,
-    114,4,0,0,0,114,5,0,0,0,114,153,0,0,0,131,
+    114,4,0,0,0,114,5,0,0,0,114,153,0,0,0,132,
     2,0,0,115,8,0,0,0,0,3,18,1,16,1,14,1,
     122,24,95,76,111,97,100,101,114,66,97,115,105,99,115,46,
     105,115,95,112,97,99,107,97,103,101,99,2,0,0,0,0,
@@ -942,14 +942,14 @@ const unsigned char _Py_M__importlib_external[] = {
     97,116,105,111,110,46,78,114,4,0,0,0,41,2,114,100,
     0,0,0,114,158,0,0,0,114,4,0,0,0,114,4,0,
     0,0,114,5,0,0,0,218,13,99,114,101,97,116,101,95,
-    109,111,100,117,108,101,139,2,0,0,115,0,0,0,0,122,
+    109,111,100,117,108,101,140,2,0,0,115,0,0,0,0,122,
     27,95,76,111,97,100,101,114,66,97,115,105,99,115,46,99,
     114,101,97,116,101,95,109,111,100,117,108,101,99,2,0,0,
-    0,0,0,0,0,3,0,0,0,4,0,0,0,67,0,0,
-    0,115,56,0,0,0,124,0,106,0,124,1,106,1,131,1,
-    125,2,124,2,100,1,107,8,114,36,116,2,100,2,106,3,
-    124,1,106,1,131,1,131,1,130,1,116,4,106,5,116,6,
-    124,2,124,1,106,7,131,3,1,0,100,1,83,0,41,3,
+    0,0,0,0,0,3,0,0,0,5,0,0,0,67,0,0,
+    0,115,56,0,0,0,124,0,160,0,124,1,106,1,161,1,
+    125,2,124,2,100,1,107,8,114,36,116,2,100,2,160,3,
+    124,1,106,1,161,1,131,1,130,1,116,4,160,5,116,6,
+    124,2,124,1,106,7,161,3,1,0,100,1,83,0,41,3,
     122,19,69,120,101,99,117,116,101,32,116,104,101,32,109,111,
     100,117,108,101,46,78,122,52,99,97,110,110,111,116,32,108,
     111,97,100,32,109,111,100,117,108,101,32,123,33,114,125,32,
@@ -962,25 +962,25 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,41,3,114,100,0,0,0,218,6,109,111,100,117,108,
     101,114,140,0,0,0,114,4,0,0,0,114,4,0,0,0,
     114,5,0,0,0,218,11,101,120,101,99,95,109,111,100,117,
-    108,101,142,2,0,0,115,10,0,0,0,0,2,12,1,8,
+    108,101,143,2,0,0,115,10,0,0,0,0,2,12,1,8,
     1,6,1,10,1,122,25,95,76,111,97,100,101,114,66,97,
     115,105,99,115,46,101,120,101,99,95,109,111,100,117,108,101,
-    99,2,0,0,0,0,0,0,0,2,0,0,0,3,0,0,
-    0,67,0,0,0,115,12,0,0,0,116,0,106,1,124,0,
-    124,1,131,2,83,0,41,1,122,26,84,104,105,115,32,109,
+    99,2,0,0,0,0,0,0,0,2,0,0,0,4,0,0,
+    0,67,0,0,0,115,12,0,0,0,116,0,160,1,124,0,
+    124,1,161,2,83,0,41,1,122,26,84,104,105,115,32,109,
     111,100,117,108,101,32,105,115,32,100,101,112,114,101,99,97,
     116,101,100,46,41,2,114,114,0,0,0,218,17,95,108,111,
     97,100,95,109,111,100,117,108,101,95,115,104,105,109,41,2,
     114,100,0,0,0,114,119,0,0,0,114,4,0,0,0,114,
     4,0,0,0,114,5,0,0,0,218,11,108,111,97,100,95,
-    109,111,100,117,108,101,150,2,0,0,115,2,0,0,0,0,
+    109,111,100,117,108,101,151,2,0,0,115,2,0,0,0,0,
     2,122,25,95,76,111,97,100,101,114,66,97,115,105,99,115,
     46,108,111,97,100,95,109,111,100,117,108,101,78,41,8,114,
     105,0,0,0,114,104,0,0,0,114,106,0,0,0,114,107,
     0,0,0,114,153,0,0,0,114,180,0,0,0,114,185,0,
     0,0,114,187,0,0,0,114,4,0,0,0,114,4,0,0,
     0,114,4,0,0,0,114,5,0,0,0,114,178,0,0,0,
-    126,2,0,0,115,10,0,0,0,8,3,4,2,8,8,8,
+    127,2,0,0,115,10,0,0,0,8,3,4,2,8,8,8,
     3,8,8,114,178,0,0,0,99,0,0,0,0,0,0,0,
     0,0,0,0,0,4,0,0,0,64,0,0,0,115,74,0,
     0,0,101,0,90,1,100,0,90,2,100,1,100,2,132,0,
@@ -1005,11 +1005,11 @@ const unsigned char _Py_M__importlib_external[] = {
     32,32,32,32,78,41,1,218,7,73,79,69,114,114,111,114,
     41,2,114,100,0,0,0,114,35,0,0,0,114,4,0,0,
     0,114,4,0,0,0,114,5,0,0,0,218,10,112,97,116,
-    104,95,109,116,105,109,101,157,2,0,0,115,2,0,0,0,
+    104,95,109,116,105,109,101,158,2,0,0,115,2,0,0,0,
     0,6,122,23,83,111,117,114,99,101,76,111,97,100,101,114,
     46,112,97,116,104,95,109,116,105,109,101,99,2,0,0,0,
-    0,0,0,0,2,0,0,0,3,0,0,0,67,0,0,0,
-    115,14,0,0,0,100,1,124,0,106,0,124,1,131,1,105,
+    0,0,0,0,2,0,0,0,4,0,0,0,67,0,0,0,
+    115,14,0,0,0,100,1,124,0,160,0,124,1,161,1,105,
     1,83,0,41,2,97,170,1,0,0,79,112,116,105,111,110,
     97,108,32,109,101,116,104,111,100,32,114,101,116,117,114,110,
     105,110,103,32,97,32,109,101,116,97,100,97,116,97,32,100,
@@ -1040,11 +1040,11 @@ const unsigned char _Py_M__importlib_external[] = {
     32,32,32,32,114,126,0,0,0,41,1,114,190,0,0,0,
     41,2,114,100,0,0,0,114,35,0,0,0,114,4,0,0,
     0,114,4,0,0,0,114,5,0,0,0,218,10,112,97,116,
-    104,95,115,116,97,116,115,165,2,0,0,115,2,0,0,0,
+    104,95,115,116,97,116,115,166,2,0,0,115,2,0,0,0,
     0,11,122,23,83,111,117,114,99,101,76,111,97,100,101,114,
     46,112,97,116,104,95,115,116,97,116,115,99,4,0,0,0,
-    0,0,0,0,4,0,0,0,3,0,0,0,67,0,0,0,
-    115,12,0,0,0,124,0,106,0,124,2,124,3,131,2,83,
+    0,0,0,0,4,0,0,0,4,0,0,0,67,0,0,0,
+    115,12,0,0,0,124,0,160,0,124,2,124,3,161,2,83,
     0,41,1,122,228,79,112,116,105,111,110,97,108,32,109,101,
     116,104,111,100,32,119,104,105,99,104,32,119,114,105,116,101,
     115,32,100,97,116,97,32,40,98,121,116,101,115,41,32,116,
@@ -1064,7 +1064,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,90,10,99,97,99,104,101,95,112,97,116,104,114,53,0,
     0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
     0,218,15,95,99,97,99,104,101,95,98,121,116,101,99,111,
-    100,101,178,2,0,0,115,2,0,0,0,0,8,122,28,83,
+    100,101,179,2,0,0,115,2,0,0,0,0,8,122,28,83,
     111,117,114,99,101,76,111,97,100,101,114,46,95,99,97,99,
     104,101,95,98,121,116,101,99,111,100,101,99,3,0,0,0,
     0,0,0,0,3,0,0,0,1,0,0,0,67,0,0,0,
@@ -1080,12 +1080,12 @@ const unsigned char _Py_M__importlib_external[] = {
     111,100,101,32,102,105,108,101,115,46,10,32,32,32,32,32,
     32,32,32,78,114,4,0,0,0,41,3,114,100,0,0,0,
     114,35,0,0,0,114,53,0,0,0,114,4,0,0,0,114,
-    4,0,0,0,114,5,0,0,0,114,192,0,0,0,188,2,
+    4,0,0,0,114,5,0,0,0,114,192,0,0,0,189,2,
     0,0,115,0,0,0,0,122,21,83,111,117,114,99,101,76,
     111,97,100,101,114,46,115,101,116,95,100,97,116,97,99,2,
     0,0,0,0,0,0,0,5,0,0,0,16,0,0,0,67,
-    0,0,0,115,84,0,0,0,124,0,106,0,124,1,131,1,
-    125,2,121,14,124,0,106,1,124,2,131,1,125,3,87,0,
+    0,0,0,115,84,0,0,0,124,0,160,0,124,1,161,1,
+    125,2,121,14,124,0,160,1,124,2,161,1,125,3,87,0,
     110,50,4,0,116,2,107,10,114,74,1,0,125,4,1,0,
     122,22,116,3,100,1,100,2,124,1,144,1,131,1,124,4,
     130,2,87,0,89,0,100,3,100,3,125,4,126,4,88,0,
@@ -1101,7 +1101,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,41,5,114,100,0,0,0,114,119,0,0,0,114,
     35,0,0,0,114,147,0,0,0,218,3,101,120,99,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,218,10,103,
-    101,116,95,115,111,117,114,99,101,195,2,0,0,115,14,0,
+    101,116,95,115,111,117,114,99,101,196,2,0,0,115,14,0,
     0,0,0,2,10,1,2,1,14,1,16,1,6,1,28,1,
     122,23,83,111,117,114,99,101,76,111,97,100,101,114,46,103,
     101,116,95,115,111,117,114,99,101,218,9,95,111,112,116,105,
@@ -1123,32 +1123,32 @@ const unsigned char _Py_M__importlib_external[] = {
     101,41,4,114,100,0,0,0,114,53,0,0,0,114,35,0,
     0,0,114,197,0,0,0,114,4,0,0,0,114,4,0,0,
     0,114,5,0,0,0,218,14,115,111,117,114,99,101,95,116,
-    111,95,99,111,100,101,205,2,0,0,115,4,0,0,0,0,
+    111,95,99,111,100,101,206,2,0,0,115,4,0,0,0,0,
     5,14,1,122,27,83,111,117,114,99,101,76,111,97,100,101,
     114,46,115,111,117,114,99,101,95,116,111,95,99,111,100,101,
     99,2,0,0,0,0,0,0,0,10,0,0,0,43,0,0,
-    0,67,0,0,0,115,106,1,0,0,124,0,106,0,124,1,
-    131,1,125,2,100,1,125,3,121,12,116,1,124,2,131,1,
+    0,67,0,0,0,115,106,1,0,0,124,0,160,0,124,1,
+    161,1,125,2,100,1,125,3,121,12,116,1,124,2,131,1,
     125,4,87,0,110,24,4,0,116,2,107,10,114,50,1,0,
     1,0,1,0,100,1,125,4,89,0,110,174,88,0,121,14,
-    124,0,106,3,124,2,131,1,125,5,87,0,110,20,4,0,
+    124,0,160,3,124,2,161,1,125,5,87,0,110,20,4,0,
     116,4,107,10,114,86,1,0,1,0,1,0,89,0,110,138,
     88,0,116,5,124,5,100,2,25,0,131,1,125,3,121,14,
-    124,0,106,6,124,4,131,1,125,6,87,0,110,20,4,0,
+    124,0,160,6,124,4,161,1,125,6,87,0,110,20,4,0,
     116,7,107,10,114,134,1,0,1,0,1,0,89,0,110,90,
     88,0,121,26,116,8,124,6,100,3,124,5,100,4,124,1,
     100,5,124,4,144,3,131,1,125,7,87,0,110,24,4,0,
     116,9,116,10,102,2,107,10,114,186,1,0,1,0,1,0,
-    89,0,110,38,88,0,116,11,106,12,100,6,124,4,124,2,
-    131,3,1,0,116,13,124,7,100,4,124,1,100,7,124,4,
-    100,8,124,2,144,3,131,1,83,0,124,0,106,6,124,2,
-    131,1,125,8,124,0,106,14,124,8,124,2,131,2,125,9,
-    116,11,106,12,100,9,124,2,131,2,1,0,116,15,106,16,
+    89,0,110,38,88,0,116,11,160,12,100,6,124,4,124,2,
+    161,3,1,0,116,13,124,7,100,4,124,1,100,7,124,4,
+    100,8,124,2,144,3,131,1,83,0,124,0,160,6,124,2,
+    161,1,125,8,124,0,160,14,124,8,124,2,161,2,125,9,
+    116,11,160,12,100,9,124,2,161,2,1,0,116,15,106,16,
     12,0,144,1,114,102,124,4,100,1,107,9,144,1,114,102,
     124,3,100,1,107,9,144,1,114,102,116,17,124,9,124,3,
-    116,18,124,8,131,1,131,3,125,6,121,30,124,0,106,19,
-    124,2,124,4,124,6,131,3,1,0,116,11,106,12,100,10,
-    124,4,131,2,1,0,87,0,110,22,4,0,116,2,107,10,
+    116,18,124,8,131,1,131,3,125,6,121,30,124,0,160,19,
+    124,2,124,4,124,6,161,3,1,0,116,11,160,12,100,10,
+    124,4,161,2,1,0,87,0,110,22,4,0,116,2,107,10,
     144,1,114,100,1,0,1,0,1,0,89,0,110,2,88,0,
     124,9,83,0,41,11,122,190,67,111,110,99,114,101,116,101,
     32,105,109,112,108,101,109,101,110,116,97,116,105,111,110,32,
@@ -1180,7 +1180,7 @@ const unsigned char _Py_M__importlib_external[] = {
     10,98,121,116,101,115,95,100,97,116,97,114,147,0,0,0,
     90,11,99,111,100,101,95,111,98,106,101,99,116,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,114,181,0,0,
-    0,213,2,0,0,115,78,0,0,0,0,7,10,1,4,1,
+    0,214,2,0,0,115,78,0,0,0,0,7,10,1,4,1,
     2,1,12,1,14,1,10,2,2,1,14,1,14,1,6,2,
     12,1,2,1,14,1,14,1,6,2,2,1,6,1,8,1,
     12,1,18,1,6,2,8,1,6,1,10,1,4,1,8,1,
@@ -1192,7 +1192,7 @@ const unsigned char _Py_M__importlib_external[] = {
     114,193,0,0,0,114,192,0,0,0,114,196,0,0,0,114,
     200,0,0,0,114,181,0,0,0,114,4,0,0,0,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,114,188,0,
-    0,0,155,2,0,0,115,14,0,0,0,8,2,8,8,8,
+    0,0,156,2,0,0,115,14,0,0,0,8,2,8,8,8,
     13,8,10,8,7,8,10,14,8,114,188,0,0,0,99,0,
     0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,
     0,0,0,115,76,0,0,0,101,0,90,1,100,0,90,2,
@@ -1218,7 +1218,7 @@ const unsigned char _Py_M__importlib_external[] = {
     100,101,114,46,78,41,2,114,98,0,0,0,114,35,0,0,
     0,41,3,114,100,0,0,0,114,119,0,0,0,114,35,0,
     0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,114,179,0,0,0,14,3,0,0,115,4,0,0,0,0,
+    0,114,179,0,0,0,15,3,0,0,115,4,0,0,0,0,
     3,6,1,122,19,70,105,108,101,76,111,97,100,101,114,46,
     95,95,105,110,105,116,95,95,99,2,0,0,0,0,0,0,
     0,2,0,0,0,2,0,0,0,67,0,0,0,115,24,0,
@@ -1227,7 +1227,7 @@ const unsigned char _Py_M__importlib_external[] = {
     9,95,95,99,108,97,115,115,95,95,114,111,0,0,0,41,
     2,114,100,0,0,0,218,5,111,116,104,101,114,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,218,6,95,95,
-    101,113,95,95,20,3,0,0,115,4,0,0,0,0,1,12,
+    101,113,95,95,21,3,0,0,115,4,0,0,0,0,1,12,
     1,122,17,70,105,108,101,76,111,97,100,101,114,46,95,95,
     101,113,95,95,99,1,0,0,0,0,0,0,0,1,0,0,
     0,3,0,0,0,67,0,0,0,115,20,0,0,0,116,0,
@@ -1235,11 +1235,11 @@ const unsigned char _Py_M__importlib_external[] = {
     83,0,41,1,78,41,3,218,4,104,97,115,104,114,98,0,
     0,0,114,35,0,0,0,41,1,114,100,0,0,0,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,218,8,95,
-    95,104,97,115,104,95,95,24,3,0,0,115,2,0,0,0,
+    95,104,97,115,104,95,95,25,3,0,0,115,2,0,0,0,
     0,1,122,19,70,105,108,101,76,111,97,100,101,114,46,95,
     95,104,97,115,104,95,95,99,2,0,0,0,0,0,0,0,
     2,0,0,0,3,0,0,0,3,0,0,0,115,16,0,0,
-    0,116,0,116,1,124,0,131,2,106,2,124,1,131,1,83,
+    0,116,0,116,1,124,0,131,2,160,2,124,1,161,1,83,
     0,41,1,122,100,76,111,97,100,32,97,32,109,111,100,117,
     108,101,32,102,114,111,109,32,97,32,102,105,108,101,46,10,
     10,32,32,32,32,32,32,32,32,84,104,105,115,32,109,101,
@@ -1249,7 +1249,7 @@ const unsigned char _Py_M__importlib_external[] = {
     10,32,32,32,32,32,32,32,32,41,3,218,5,115,117,112,
     101,114,114,204,0,0,0,114,187,0,0,0,41,2,114,100,
     0,0,0,114,119,0,0,0,41,1,114,205,0,0,0,114,
-    4,0,0,0,114,5,0,0,0,114,187,0,0,0,27,3,
+    4,0,0,0,114,5,0,0,0,114,187,0,0,0,28,3,
     0,0,115,2,0,0,0,0,10,122,22,70,105,108,101,76,
     111,97,100,101,114,46,108,111,97,100,95,109,111,100,117,108,
     101,99,2,0,0,0,0,0,0,0,2,0,0,0,1,0,
@@ -1260,19 +1260,19 @@ const unsigned char _Py_M__importlib_external[] = {
     32,98,121,32,116,104,101,32,102,105,110,100,101,114,46,41,
     1,114,35,0,0,0,41,2,114,100,0,0,0,114,119,0,
     0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,114,151,0,0,0,39,3,0,0,115,2,0,0,0,0,
+    0,114,151,0,0,0,40,3,0,0,115,2,0,0,0,0,
     3,122,23,70,105,108,101,76,111,97,100,101,114,46,103,101,
     116,95,102,105,108,101,110,97,109,101,99,2,0,0,0,0,
     0,0,0,3,0,0,0,9,0,0,0,67,0,0,0,115,
-    32,0,0,0,116,0,106,1,124,1,100,1,131,2,143,10,
-    125,2,124,2,106,2,131,0,83,0,81,0,82,0,88,0,
+    32,0,0,0,116,0,160,1,124,1,100,1,161,2,143,10,
+    125,2,124,2,160,2,161,0,83,0,81,0,82,0,88,0,
     100,2,83,0,41,3,122,39,82,101,116,117,114,110,32,116,
     104,101,32,100,97,116,97,32,102,114,111,109,32,112,97,116,
     104,32,97,115,32,114,97,119,32,98,121,116,101,115,46,218,
     1,114,78,41,3,114,49,0,0,0,114,50,0,0,0,90,
     4,114,101,97,100,41,3,114,100,0,0,0,114,35,0,0,
     0,114,54,0,0,0,114,4,0,0,0,114,4,0,0,0,
-    114,5,0,0,0,114,194,0,0,0,44,3,0,0,115,4,
+    114,5,0,0,0,114,194,0,0,0,45,3,0,0,115,4,
     0,0,0,0,2,14,1,122,19,70,105,108,101,76,111,97,
     100,101,114,46,103,101,116,95,100,97,116,97,41,11,114,105,
     0,0,0,114,104,0,0,0,114,106,0,0,0,114,107,0,
@@ -1280,7 +1280,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,114,116,0,0,0,114,187,0,0,0,114,151,0,0,0,
     114,194,0,0,0,114,4,0,0,0,114,4,0,0,0,41,
     1,114,205,0,0,0,114,5,0,0,0,114,204,0,0,0,
-    9,3,0,0,115,14,0,0,0,8,3,4,2,8,6,8,
+    10,3,0,0,115,14,0,0,0,8,3,4,2,8,6,8,
     4,8,3,16,12,12,5,114,204,0,0,0,99,0,0,0,
     0,0,0,0,0,0,0,0,0,4,0,0,0,64,0,0,
     0,115,46,0,0,0,101,0,90,1,100,0,90,2,100,1,
@@ -1301,7 +1301,7 @@ const unsigned char _Py_M__importlib_external[] = {
     218,8,115,116,95,109,116,105,109,101,90,7,115,116,95,115,
     105,122,101,41,3,114,100,0,0,0,114,35,0,0,0,114,
     202,0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,
-    0,0,0,114,191,0,0,0,54,3,0,0,115,4,0,0,
+    0,0,0,114,191,0,0,0,55,3,0,0,115,4,0,0,
     0,0,2,8,1,122,27,83,111,117,114,99,101,70,105,108,
     101,76,111,97,100,101,114,46,112,97,116,104,95,115,116,97,
     116,115,99,4,0,0,0,0,0,0,0,5,0,0,0,5,
@@ -1311,26 +1311,26 @@ const unsigned char _Py_M__importlib_external[] = {
     41,2,114,97,0,0,0,114,192,0,0,0,41,5,114,100,
     0,0,0,114,90,0,0,0,114,89,0,0,0,114,53,0,
     0,0,114,42,0,0,0,114,4,0,0,0,114,4,0,0,
-    0,114,5,0,0,0,114,193,0,0,0,59,3,0,0,115,
+    0,114,5,0,0,0,114,193,0,0,0,60,3,0,0,115,
     4,0,0,0,0,2,8,1,122,32,83,111,117,114,99,101,
     70,105,108,101,76,111,97,100,101,114,46,95,99,97,99,104,
     101,95,98,121,116,101,99,111,100,101,114,214,0,0,0,105,
     182,1,0,0,99,3,0,0,0,1,0,0,0,9,0,0,
-    0,17,0,0,0,67,0,0,0,115,250,0,0,0,116,0,
+    0,18,0,0,0,67,0,0,0,115,250,0,0,0,116,0,
     124,1,131,1,92,2,125,4,125,5,103,0,125,6,120,40,
     124,4,114,56,116,1,124,4,131,1,12,0,114,56,116,0,
-    124,4,131,1,92,2,125,4,125,7,124,6,106,2,124,7,
-    131,1,1,0,113,18,87,0,120,108,116,3,124,6,131,1,
+    124,4,131,1,92,2,125,4,125,7,124,6,160,2,124,7,
+    161,1,1,0,113,18,87,0,120,108,116,3,124,6,131,1,
     68,0,93,96,125,7,116,4,124,4,124,7,131,2,125,4,
-    121,14,116,5,106,6,124,4,131,1,1,0,87,0,113,68,
+    121,14,116,5,160,6,124,4,161,1,1,0,87,0,113,68,
     4,0,116,7,107,10,114,118,1,0,1,0,1,0,119,68,
     89,0,113,68,4,0,116,8,107,10,114,162,1,0,125,8,
-    1,0,122,18,116,9,106,10,100,1,124,4,124,8,131,3,
+    1,0,122,18,116,9,160,10,100,1,124,4,124,8,161,3,
     1,0,100,2,83,0,100,2,125,8,126,8,88,0,113,68,
     88,0,113,68,87,0,121,28,116,11,124,1,124,2,124,3,
-    131,3,1,0,116,9,106,10,100,3,124,1,131,2,1,0,
+    131,3,1,0,116,9,160,10,100,3,124,1,161,2,1,0,
     87,0,110,48,4,0,116,8,107,10,114,244,1,0,125,8,
-    1,0,122,20,116,9,106,10,100,1,124,1,124,8,131,3,
+    1,0,122,20,116,9,160,10,100,1,124,1,124,8,161,3,
     1,0,87,0,89,0,100,2,100,2,125,8,126,8,88,0,
     110,2,88,0,100,2,83,0,41,4,122,27,87,114,105,116,
     101,32,98,121,116,101,115,32,100,97,116,97,32,116,111,32,
@@ -1346,7 +1346,7 @@ const unsigned char _Py_M__importlib_external[] = {
     114,214,0,0,0,218,6,112,97,114,101,110,116,114,94,0,
     0,0,114,27,0,0,0,114,23,0,0,0,114,195,0,0,
     0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
-    114,192,0,0,0,64,3,0,0,115,42,0,0,0,0,2,
+    114,192,0,0,0,65,3,0,0,115,42,0,0,0,0,2,
     12,1,4,2,16,1,12,1,14,2,14,1,10,1,2,1,
     14,1,14,2,6,1,16,3,6,1,8,1,20,1,2,1,
     12,1,16,1,16,2,8,1,122,25,83,111,117,114,99,101,
@@ -1355,7 +1355,7 @@ const unsigned char _Py_M__importlib_external[] = {
     114,106,0,0,0,114,107,0,0,0,114,191,0,0,0,114,
     193,0,0,0,114,192,0,0,0,114,4,0,0,0,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,114,212,0,
-    0,0,50,3,0,0,115,8,0,0,0,8,2,4,2,8,
+    0,0,51,3,0,0,115,8,0,0,0,8,2,4,2,8,
     5,8,5,114,212,0,0,0,99,0,0,0,0,0,0,0,
     0,0,0,0,0,2,0,0,0,64,0,0,0,115,32,0,
     0,0,101,0,90,1,100,0,90,2,100,1,90,3,100,2,
@@ -1366,8 +1366,8 @@ const unsigned char _Py_M__importlib_external[] = {
     32,115,111,117,114,99,101,108,101,115,115,32,102,105,108,101,
     32,105,109,112,111,114,116,115,46,99,2,0,0,0,0,0,
     0,0,5,0,0,0,6,0,0,0,67,0,0,0,115,56,
-    0,0,0,124,0,106,0,124,1,131,1,125,2,124,0,106,
-    1,124,2,131,1,125,3,116,2,124,3,100,1,124,1,100,
+    0,0,0,124,0,160,0,124,1,161,1,125,2,124,0,160,
+    1,124,2,161,1,125,3,116,2,124,3,100,1,124,1,100,
     2,124,2,144,2,131,1,125,4,116,3,124,4,100,1,124,
     1,100,3,124,2,144,2,131,1,83,0,41,4,78,114,98,
     0,0,0,114,35,0,0,0,114,89,0,0,0,41,4,114,
@@ -1375,7 +1375,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,41,5,114,100,0,0,0,114,119,0,0,0,114,
     35,0,0,0,114,53,0,0,0,114,203,0,0,0,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,114,181,0,
-    0,0,99,3,0,0,115,8,0,0,0,0,1,10,1,10,
+    0,0,100,3,0,0,115,8,0,0,0,0,1,10,1,10,
     1,18,1,122,29,83,111,117,114,99,101,108,101,115,115,70,
     105,108,101,76,111,97,100,101,114,46,103,101,116,95,99,111,
     100,101,99,2,0,0,0,0,0,0,0,2,0,0,0,1,
@@ -1385,13 +1385,13 @@ const unsigned char _Py_M__importlib_external[] = {
     111,117,114,99,101,32,99,111,100,101,46,78,114,4,0,0,
     0,41,2,114,100,0,0,0,114,119,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,114,196,0,0,
-    0,105,3,0,0,115,2,0,0,0,0,2,122,31,83,111,
+    0,106,3,0,0,115,2,0,0,0,0,2,122,31,83,111,
     117,114,99,101,108,101,115,115,70,105,108,101,76,111,97,100,
     101,114,46,103,101,116,95,115,111,117,114,99,101,78,41,6,
     114,105,0,0,0,114,104,0,0,0,114,106,0,0,0,114,
     107,0,0,0,114,181,0,0,0,114,196,0,0,0,114,4,
     0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,
-    0,0,114,217,0,0,0,95,3,0,0,115,6,0,0,0,
+    0,0,114,217,0,0,0,96,3,0,0,115,6,0,0,0,
     8,2,4,2,8,6,114,217,0,0,0,99,0,0,0,0,
     0,0,0,0,0,0,0,0,3,0,0,0,64,0,0,0,
     115,92,0,0,0,101,0,90,1,100,0,90,2,100,1,90,
@@ -1413,7 +1413,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,41,1,78,41,2,114,98,0,0,0,114,35,0,0,0,
     41,3,114,100,0,0,0,114,98,0,0,0,114,35,0,0,
     0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
-    114,179,0,0,0,122,3,0,0,115,4,0,0,0,0,1,
+    114,179,0,0,0,123,3,0,0,115,4,0,0,0,0,1,
     6,1,122,28,69,120,116,101,110,115,105,111,110,70,105,108,
     101,76,111,97,100,101,114,46,95,95,105,110,105,116,95,95,
     99,2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,
@@ -1422,7 +1422,7 @@ const unsigned char _Py_M__importlib_external[] = {
     83,0,41,1,78,41,2,114,205,0,0,0,114,111,0,0,
     0,41,2,114,100,0,0,0,114,206,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,114,207,0,0,
-    0,126,3,0,0,115,4,0,0,0,0,1,12,1,122,26,
+    0,127,3,0,0,115,4,0,0,0,0,1,12,1,122,26,
     69,120,116,101,110,115,105,111,110,70,105,108,101,76,111,97,
     100,101,114,46,95,95,101,113,95,95,99,1,0,0,0,0,
     0,0,0,1,0,0,0,3,0,0,0,67,0,0,0,115,
@@ -1430,13 +1430,13 @@ const unsigned char _Py_M__importlib_external[] = {
     106,2,131,1,65,0,83,0,41,1,78,41,3,114,208,0,
     0,0,114,98,0,0,0,114,35,0,0,0,41,1,114,100,
     0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,
-    0,0,114,209,0,0,0,130,3,0,0,115,2,0,0,0,
+    0,0,114,209,0,0,0,131,3,0,0,115,2,0,0,0,
     0,1,122,28,69,120,116,101,110,115,105,111,110,70,105,108,
     101,76,111,97,100,101,114,46,95,95,104,97,115,104,95,95,
-    99,2,0,0,0,0,0,0,0,3,0,0,0,4,0,0,
-    0,67,0,0,0,115,36,0,0,0,116,0,106,1,116,2,
-    106,3,124,1,131,2,125,2,116,0,106,4,100,1,124,1,
-    106,5,124,0,106,6,131,3,1,0,124,2,83,0,41,2,
+    99,2,0,0,0,0,0,0,0,3,0,0,0,5,0,0,
+    0,67,0,0,0,115,36,0,0,0,116,0,160,1,116,2,
+    106,3,124,1,161,2,125,2,116,0,160,4,100,1,124,1,
+    106,5,124,0,106,6,161,3,1,0,124,2,83,0,41,2,
     122,38,67,114,101,97,116,101,32,97,110,32,117,110,105,116,
     105,97,108,105,122,101,100,32,101,120,116,101,110,115,105,111,
     110,32,109,111,100,117,108,101,122,38,101,120,116,101,110,115,
@@ -1447,14 +1447,14 @@ const unsigned char _Py_M__importlib_external[] = {
     99,114,129,0,0,0,114,98,0,0,0,114,35,0,0,0,
     41,3,114,100,0,0,0,114,158,0,0,0,114,184,0,0,
     0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
-    114,180,0,0,0,133,3,0,0,115,10,0,0,0,0,2,
+    114,180,0,0,0,134,3,0,0,115,10,0,0,0,0,2,
     4,1,10,1,6,1,12,1,122,33,69,120,116,101,110,115,
     105,111,110,70,105,108,101,76,111,97,100,101,114,46,99,114,
     101,97,116,101,95,109,111,100,117,108,101,99,2,0,0,0,
-    0,0,0,0,2,0,0,0,4,0,0,0,67,0,0,0,
-    115,36,0,0,0,116,0,106,1,116,2,106,3,124,1,131,
-    2,1,0,116,0,106,4,100,1,124,0,106,5,124,0,106,
-    6,131,3,1,0,100,2,83,0,41,3,122,30,73,110,105,
+    0,0,0,0,2,0,0,0,5,0,0,0,67,0,0,0,
+    115,36,0,0,0,116,0,160,1,116,2,106,3,124,1,161,
+    2,1,0,116,0,160,4,100,1,124,0,106,5,124,0,106,
+    6,161,3,1,0,100,2,83,0,41,3,122,30,73,110,105,
     116,105,97,108,105,122,101,32,97,110,32,101,120,116,101,110,
     115,105,111,110,32,109,111,100,117,108,101,122,40,101,120,116,
     101,110,115,105,111,110,32,109,111,100,117,108,101,32,123,33,
@@ -1464,7 +1464,7 @@ const unsigned char _Py_M__importlib_external[] = {
     110,97,109,105,99,114,129,0,0,0,114,98,0,0,0,114,
     35,0,0,0,41,2,114,100,0,0,0,114,184,0,0,0,
     114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,
-    185,0,0,0,141,3,0,0,115,6,0,0,0,0,2,14,
+    185,0,0,0,142,3,0,0,115,6,0,0,0,0,2,14,
     1,6,1,122,31,69,120,116,101,110,115,105,111,110,70,105,
     108,101,76,111,97,100,101,114,46,101,120,101,99,95,109,111,
     100,117,108,101,99,2,0,0,0,0,0,0,0,2,0,0,
@@ -1481,7 +1481,7 @@ const unsigned char _Py_M__importlib_external[] = {
     41,2,114,179,0,0,0,78,114,4,0,0,0,41,2,114,
     22,0,0,0,218,6,115,117,102,102,105,120,41,1,218,9,
     102,105,108,101,95,110,97,109,101,114,4,0,0,0,114,5,
-    0,0,0,250,9,60,103,101,110,101,120,112,114,62,150,3,
+    0,0,0,250,9,60,103,101,110,101,120,112,114,62,151,3,
     0,0,115,2,0,0,0,4,1,122,49,69,120,116,101,110,
     115,105,111,110,70,105,108,101,76,111,97,100,101,114,46,105,
     115,95,112,97,99,107,97,103,101,46,60,108,111,99,97,108,
@@ -1490,7 +1490,7 @@ const unsigned char _Py_M__importlib_external[] = {
     88,84,69,78,83,73,79,78,95,83,85,70,70,73,88,69,
     83,41,2,114,100,0,0,0,114,119,0,0,0,114,4,0,
     0,0,41,1,114,220,0,0,0,114,5,0,0,0,114,153,
-    0,0,0,147,3,0,0,115,6,0,0,0,0,2,14,1,
+    0,0,0,148,3,0,0,115,6,0,0,0,0,2,14,1,
     12,1,122,30,69,120,116,101,110,115,105,111,110,70,105,108,
     101,76,111,97,100,101,114,46,105,115,95,112,97,99,107,97,
     103,101,99,2,0,0,0,0,0,0,0,2,0,0,0,1,
@@ -1501,7 +1501,7 @@ const unsigned char _Py_M__importlib_external[] = {
     101,97,116,101,32,97,32,99,111,100,101,32,111,98,106,101,
     99,116,46,78,114,4,0,0,0,41,2,114,100,0,0,0,
     114,119,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
-    5,0,0,0,114,181,0,0,0,153,3,0,0,115,2,0,
+    5,0,0,0,114,181,0,0,0,154,3,0,0,115,2,0,
     0,0,0,2,122,28,69,120,116,101,110,115,105,111,110,70,
     105,108,101,76,111,97,100,101,114,46,103,101,116,95,99,111,
     100,101,99,2,0,0,0,0,0,0,0,2,0,0,0,1,
@@ -1511,7 +1511,7 @@ const unsigned char _Py_M__importlib_external[] = {
     117,108,101,115,32,104,97,118,101,32,110,111,32,115,111,117,
     114,99,101,32,99,111,100,101,46,78,114,4,0,0,0,41,
     2,114,100,0,0,0,114,119,0,0,0,114,4,0,0,0,
-    114,4,0,0,0,114,5,0,0,0,114,196,0,0,0,157,
+    114,4,0,0,0,114,5,0,0,0,114,196,0,0,0,158,
     3,0,0,115,2,0,0,0,0,2,122,30,69,120,116,101,
     110,115,105,111,110,70,105,108,101,76,111,97,100,101,114,46,
     103,101,116,95,115,111,117,114,99,101,99,2,0,0,0,0,
@@ -1522,7 +1522,7 @@ const unsigned char _Py_M__importlib_external[] = {
     32,97,115,32,102,111,117,110,100,32,98,121,32,116,104,101,
     32,102,105,110,100,101,114,46,41,1,114,35,0,0,0,41,
     2,114,100,0,0,0,114,119,0,0,0,114,4,0,0,0,
-    114,4,0,0,0,114,5,0,0,0,114,151,0,0,0,161,
+    114,4,0,0,0,114,5,0,0,0,114,151,0,0,0,162,
     3,0,0,115,2,0,0,0,0,3,122,32,69,120,116,101,
     110,115,105,111,110,70,105,108,101,76,111,97,100,101,114,46,
     103,101,116,95,102,105,108,101,110,97,109,101,78,41,14,114,
@@ -1531,7 +1531,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,114,180,0,0,0,114,185,0,0,0,114,153,0,0,
     0,114,181,0,0,0,114,196,0,0,0,114,116,0,0,0,
     114,151,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
-    4,0,0,0,114,5,0,0,0,114,218,0,0,0,114,3,
+    4,0,0,0,114,5,0,0,0,114,218,0,0,0,115,3,
     0,0,115,20,0,0,0,8,6,4,2,8,4,8,4,8,
     3,8,8,8,6,8,6,8,4,8,4,114,218,0,0,0,
     99,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
@@ -1562,9 +1562,9 @@ const unsigned char _Py_M__importlib_external[] = {
     101,32,112,97,114,101,110,116,32,109,111,100,117,108,101,39,
     115,32,112,97,116,104,10,32,32,32,32,105,115,32,115,121,
     115,46,112,97,116,104,46,99,4,0,0,0,0,0,0,0,
-    4,0,0,0,2,0,0,0,67,0,0,0,115,36,0,0,
+    4,0,0,0,3,0,0,0,67,0,0,0,115,36,0,0,
     0,124,1,124,0,95,0,124,2,124,0,95,1,116,2,124,
-    0,106,3,131,0,131,1,124,0,95,4,124,3,124,0,95,
+    0,160,3,161,0,131,1,124,0,95,4,124,3,124,0,95,
     5,100,0,83,0,41,1,78,41,6,218,5,95,110,97,109,
     101,218,5,95,112,97,116,104,114,93,0,0,0,218,16,95,
     103,101,116,95,112,97,114,101,110,116,95,112,97,116,104,218,
@@ -1573,11 +1573,11 @@ const unsigned char _Py_M__importlib_external[] = {
     41,4,114,100,0,0,0,114,98,0,0,0,114,35,0,0,
     0,218,11,112,97,116,104,95,102,105,110,100,101,114,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,114,179,0,
-    0,0,174,3,0,0,115,8,0,0,0,0,1,6,1,6,
+    0,0,175,3,0,0,115,8,0,0,0,0,1,6,1,6,
     1,14,1,122,23,95,78,97,109,101,115,112,97,99,101,80,
     97,116,104,46,95,95,105,110,105,116,95,95,99,1,0,0,
     0,0,0,0,0,4,0,0,0,3,0,0,0,67,0,0,
-    0,115,38,0,0,0,124,0,106,0,106,1,100,1,131,1,
+    0,115,38,0,0,0,124,0,106,0,160,1,100,1,161,1,
     92,3,125,1,125,2,125,3,124,2,100,2,107,2,114,30,
     100,6,83,0,124,1,100,5,102,2,83,0,41,7,122,62,
     82,101,116,117,114,110,115,32,97,32,116,117,112,108,101,32,
@@ -1591,26 +1591,26 @@ const unsigned char _Py_M__importlib_external[] = {
     0,218,3,100,111,116,90,2,109,101,114,4,0,0,0,114,
     4,0,0,0,114,5,0,0,0,218,23,95,102,105,110,100,
     95,112,97,114,101,110,116,95,112,97,116,104,95,110,97,109,
-    101,115,180,3,0,0,115,8,0,0,0,0,2,18,1,8,
+    101,115,181,3,0,0,115,8,0,0,0,0,2,18,1,8,
     2,4,3,122,38,95,78,97,109,101,115,112,97,99,101,80,
     97,116,104,46,95,102,105,110,100,95,112,97,114,101,110,116,
     95,112,97,116,104,95,110,97,109,101,115,99,1,0,0,0,
     0,0,0,0,3,0,0,0,3,0,0,0,67,0,0,0,
-    115,28,0,0,0,124,0,106,0,131,0,92,2,125,1,125,
+    115,28,0,0,0,124,0,160,0,161,0,92,2,125,1,125,
     2,116,1,116,2,106,3,124,1,25,0,124,2,131,2,83,
     0,41,1,78,41,4,114,232,0,0,0,114,110,0,0,0,
     114,7,0,0,0,218,7,109,111,100,117,108,101,115,41,3,
     114,100,0,0,0,90,18,112,97,114,101,110,116,95,109,111,
     100,117,108,101,95,110,97,109,101,90,14,112,97,116,104,95,
     97,116,116,114,95,110,97,109,101,114,4,0,0,0,114,4,
-    0,0,0,114,5,0,0,0,114,227,0,0,0,190,3,0,
+    0,0,0,114,5,0,0,0,114,227,0,0,0,191,3,0,
     0,115,4,0,0,0,0,1,12,1,122,31,95,78,97,109,
     101,115,112,97,99,101,80,97,116,104,46,95,103,101,116,95,
     112,97,114,101,110,116,95,112,97,116,104,99,1,0,0,0,
-    0,0,0,0,3,0,0,0,3,0,0,0,67,0,0,0,
-    115,80,0,0,0,116,0,124,0,106,1,131,0,131,1,125,
-    1,124,1,124,0,106,2,107,3,114,74,124,0,106,3,124,
-    0,106,4,124,1,131,2,125,2,124,2,100,0,107,9,114,
+    0,0,0,0,3,0,0,0,4,0,0,0,67,0,0,0,
+    115,80,0,0,0,116,0,124,0,160,1,161,0,131,1,125,
+    1,124,1,124,0,106,2,107,3,114,74,124,0,160,3,124,
+    0,106,4,124,1,161,2,125,2,124,2,100,0,107,9,114,
     68,124,2,106,5,100,0,107,8,114,68,124,2,106,6,114,
     68,124,2,106,6,124,0,95,7,124,1,124,0,95,2,124,
     0,106,7,83,0,41,1,78,41,8,114,93,0,0,0,114,
@@ -1619,16 +1619,16 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,41,3,114,100,0,0,0,90,11,112,97,114,101,110,
     116,95,112,97,116,104,114,158,0,0,0,114,4,0,0,0,
     114,4,0,0,0,114,5,0,0,0,218,12,95,114,101,99,
-    97,108,99,117,108,97,116,101,194,3,0,0,115,16,0,0,
+    97,108,99,117,108,97,116,101,195,3,0,0,115,16,0,0,
     0,0,2,12,1,10,1,14,3,18,1,6,1,8,1,6,
     1,122,27,95,78,97,109,101,115,112,97,99,101,80,97,116,
     104,46,95,114,101,99,97,108,99,117,108,97,116,101,99,1,
-    0,0,0,0,0,0,0,1,0,0,0,2,0,0,0,67,
-    0,0,0,115,12,0,0,0,116,0,124,0,106,1,131,0,
+    0,0,0,0,0,0,0,1,0,0,0,3,0,0,0,67,
+    0,0,0,115,12,0,0,0,116,0,124,0,160,1,161,0,
     131,1,83,0,41,1,78,41,2,218,4,105,116,101,114,114,
     234,0,0,0,41,1,114,100,0,0,0,114,4,0,0,0,
     114,4,0,0,0,114,5,0,0,0,218,8,95,95,105,116,
-    101,114,95,95,207,3,0,0,115,2,0,0,0,0,1,122,
+    101,114,95,95,208,3,0,0,115,2,0,0,0,0,1,122,
     23,95,78,97,109,101,115,112,97,99,101,80,97,116,104,46,
     95,95,105,116,101,114,95,95,99,3,0,0,0,0,0,0,
     0,3,0,0,0,3,0,0,0,67,0,0,0,115,14,0,
@@ -1636,40 +1636,40 @@ const unsigned char _Py_M__importlib_external[] = {
     41,1,78,41,1,114,226,0,0,0,41,3,114,100,0,0,
     0,218,5,105,110,100,101,120,114,35,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,218,11,95,95,
-    115,101,116,105,116,101,109,95,95,210,3,0,0,115,2,0,
+    115,101,116,105,116,101,109,95,95,211,3,0,0,115,2,0,
     0,0,0,1,122,26,95,78,97,109,101,115,112,97,99,101,
     80,97,116,104,46,95,95,115,101,116,105,116,101,109,95,95,
-    99,1,0,0,0,0,0,0,0,1,0,0,0,2,0,0,
-    0,67,0,0,0,115,12,0,0,0,116,0,124,0,106,1,
-    131,0,131,1,83,0,41,1,78,41,2,114,31,0,0,0,
+    99,1,0,0,0,0,0,0,0,1,0,0,0,3,0,0,
+    0,67,0,0,0,115,12,0,0,0,116,0,124,0,160,1,
+    161,0,131,1,83,0,41,1,78,41,2,114,31,0,0,0,
     114,234,0,0,0,41,1,114,100,0,0,0,114,4,0,0,
     0,114,4,0,0,0,114,5,0,0,0,218,7,95,95,108,
-    101,110,95,95,213,3,0,0,115,2,0,0,0,0,1,122,
+    101,110,95,95,214,3,0,0,115,2,0,0,0,0,1,122,
     22,95,78,97,109,101,115,112,97,99,101,80,97,116,104,46,
     95,95,108,101,110,95,95,99,1,0,0,0,0,0,0,0,
-    1,0,0,0,2,0,0,0,67,0,0,0,115,12,0,0,
-    0,100,1,106,0,124,0,106,1,131,1,83,0,41,2,78,
+    1,0,0,0,3,0,0,0,67,0,0,0,115,12,0,0,
+    0,100,1,160,0,124,0,106,1,161,1,83,0,41,2,78,
     122,20,95,78,97,109,101,115,112,97,99,101,80,97,116,104,
     40,123,33,114,125,41,41,2,114,47,0,0,0,114,226,0,
     0,0,41,1,114,100,0,0,0,114,4,0,0,0,114,4,
     0,0,0,114,5,0,0,0,218,8,95,95,114,101,112,114,
-    95,95,216,3,0,0,115,2,0,0,0,0,1,122,23,95,
+    95,95,217,3,0,0,115,2,0,0,0,0,1,122,23,95,
     78,97,109,101,115,112,97,99,101,80,97,116,104,46,95,95,
     114,101,112,114,95,95,99,2,0,0,0,0,0,0,0,2,
-    0,0,0,2,0,0,0,67,0,0,0,115,12,0,0,0,
-    124,1,124,0,106,0,131,0,107,6,83,0,41,1,78,41,
+    0,0,0,3,0,0,0,67,0,0,0,115,12,0,0,0,
+    124,1,124,0,160,0,161,0,107,6,83,0,41,1,78,41,
     1,114,234,0,0,0,41,2,114,100,0,0,0,218,4,105,
     116,101,109,114,4,0,0,0,114,4,0,0,0,114,5,0,
     0,0,218,12,95,95,99,111,110,116,97,105,110,115,95,95,
-    219,3,0,0,115,2,0,0,0,0,1,122,27,95,78,97,
+    220,3,0,0,115,2,0,0,0,0,1,122,27,95,78,97,
     109,101,115,112,97,99,101,80,97,116,104,46,95,95,99,111,
     110,116,97,105,110,115,95,95,99,2,0,0,0,0,0,0,
-    0,2,0,0,0,2,0,0,0,67,0,0,0,115,16,0,
-    0,0,124,0,106,0,106,1,124,1,131,1,1,0,100,0,
+    0,2,0,0,0,3,0,0,0,67,0,0,0,115,16,0,
+    0,0,124,0,106,0,160,1,124,1,161,1,1,0,100,0,
     83,0,41,1,78,41,2,114,226,0,0,0,114,157,0,0,
     0,41,2,114,100,0,0,0,114,241,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,114,157,0,0,
-    0,222,3,0,0,115,2,0,0,0,0,1,122,21,95,78,
+    0,223,3,0,0,115,2,0,0,0,0,1,122,21,95,78,
     97,109,101,115,112,97,99,101,80,97,116,104,46,97,112,112,
     101,110,100,78,41,14,114,105,0,0,0,114,104,0,0,0,
     114,106,0,0,0,114,107,0,0,0,114,179,0,0,0,114,
@@ -1677,7 +1677,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,114,238,0,0,0,114,239,0,0,0,114,240,0,
     0,0,114,242,0,0,0,114,157,0,0,0,114,4,0,0,
     0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
-    114,224,0,0,0,167,3,0,0,115,22,0,0,0,8,5,
+    114,224,0,0,0,168,3,0,0,115,22,0,0,0,8,5,
     4,2,8,6,8,10,8,4,8,13,8,3,8,3,8,3,
     8,3,8,3,114,224,0,0,0,99,0,0,0,0,0,0,
     0,0,0,0,0,0,3,0,0,0,64,0,0,0,115,80,
@@ -1693,12 +1693,12 @@ const unsigned char _Py_M__importlib_external[] = {
     0,83,0,41,1,78,41,2,114,224,0,0,0,114,226,0,
     0,0,41,4,114,100,0,0,0,114,98,0,0,0,114,35,
     0,0,0,114,230,0,0,0,114,4,0,0,0,114,4,0,
-    0,0,114,5,0,0,0,114,179,0,0,0,228,3,0,0,
+    0,0,114,5,0,0,0,114,179,0,0,0,229,3,0,0,
     115,2,0,0,0,0,1,122,25,95,78,97,109,101,115,112,
     97,99,101,76,111,97,100,101,114,46,95,95,105,110,105,116,
-    95,95,99,2,0,0,0,0,0,0,0,2,0,0,0,2,
-    0,0,0,67,0,0,0,115,12,0,0,0,100,1,106,0,
-    124,1,106,1,131,1,83,0,41,2,122,115,82,101,116,117,
+    95,95,99,2,0,0,0,0,0,0,0,2,0,0,0,3,
+    0,0,0,67,0,0,0,115,12,0,0,0,100,1,160,0,
+    124,1,106,1,161,1,83,0,41,2,122,115,82,101,116,117,
     114,110,32,114,101,112,114,32,102,111,114,32,116,104,101,32,
     109,111,100,117,108,101,46,10,10,32,32,32,32,32,32,32,
     32,84,104,101,32,109,101,116,104,111,100,32,105,115,32,100,
@@ -1710,14 +1710,14 @@ const unsigned char _Py_M__importlib_external[] = {
     97,109,101,115,112,97,99,101,41,62,41,2,114,47,0,0,
     0,114,105,0,0,0,41,2,114,164,0,0,0,114,184,0,
     0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,218,11,109,111,100,117,108,101,95,114,101,112,114,231,3,
+    0,218,11,109,111,100,117,108,101,95,114,101,112,114,232,3,
     0,0,115,2,0,0,0,0,7,122,28,95,78,97,109,101,
     115,112,97,99,101,76,111,97,100,101,114,46,109,111,100,117,
     108,101,95,114,101,112,114,99,2,0,0,0,0,0,0,0,
     2,0,0,0,1,0,0,0,67,0,0,0,115,4,0,0,
     0,100,1,83,0,41,2,78,84,114,4,0,0,0,41,2,
     114,100,0,0,0,114,119,0,0,0,114,4,0,0,0,114,
-    4,0,0,0,114,5,0,0,0,114,153,0,0,0,240,3,
+    4,0,0,0,114,5,0,0,0,114,153,0,0,0,241,3,
     0,0,115,2,0,0,0,0,1,122,27,95,78,97,109,101,
     115,112,97,99,101,76,111,97,100,101,114,46,105,115,95,112,
     97,99,107,97,103,101,99,2,0,0,0,0,0,0,0,2,
@@ -1725,7 +1725,7 @@ const unsigned char _Py_M__importlib_external[] = {
     100,1,83,0,41,2,78,114,30,0,0,0,114,4,0,0,
     0,41,2,114,100,0,0,0,114,119,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,114,196,0,0,
-    0,243,3,0,0,115,2,0,0,0,0,1,122,27,95,78,
+    0,244,3,0,0,115,2,0,0,0,0,1,122,27,95,78,
     97,109,101,115,112,97,99,101,76,111,97,100,101,114,46,103,
     101,116,95,115,111,117,114,99,101,99,2,0,0,0,0,0,
     0,0,2,0,0,0,6,0,0,0,67,0,0,0,115,18,
@@ -1734,7 +1734,7 @@ const unsigned char _Py_M__importlib_external[] = {
     115,116,114,105,110,103,62,114,183,0,0,0,114,198,0,0,
     0,84,41,1,114,199,0,0,0,41,2,114,100,0,0,0,
     114,119,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
-    5,0,0,0,114,181,0,0,0,246,3,0,0,115,2,0,
+    5,0,0,0,114,181,0,0,0,247,3,0,0,115,2,0,
     0,0,0,1,122,25,95,78,97,109,101,115,112,97,99,101,
     76,111,97,100,101,114,46,103,101,116,95,99,111,100,101,99,
     2,0,0,0,0,0,0,0,2,0,0,0,1,0,0,0,
@@ -1744,19 +1744,19 @@ const unsigned char _Py_M__importlib_external[] = {
     101,32,99,114,101,97,116,105,111,110,46,78,114,4,0,0,
     0,41,2,114,100,0,0,0,114,158,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,114,180,0,0,
-    0,249,3,0,0,115,0,0,0,0,122,30,95,78,97,109,
+    0,250,3,0,0,115,0,0,0,0,122,30,95,78,97,109,
     101,115,112,97,99,101,76,111,97,100,101,114,46,99,114,101,
     97,116,101,95,109,111,100,117,108,101,99,2,0,0,0,0,
     0,0,0,2,0,0,0,1,0,0,0,67,0,0,0,115,
     4,0,0,0,100,0,83,0,41,1,78,114,4,0,0,0,
     41,2,114,100,0,0,0,114,184,0,0,0,114,4,0,0,
     0,114,4,0,0,0,114,5,0,0,0,114,185,0,0,0,
-    252,3,0,0,115,2,0,0,0,0,1,122,28,95,78,97,
+    253,3,0,0,115,2,0,0,0,0,1,122,28,95,78,97,
     109,101,115,112,97,99,101,76,111,97,100,101,114,46,101,120,
     101,99,95,109,111,100,117,108,101,99,2,0,0,0,0,0,
-    0,0,2,0,0,0,3,0,0,0,67,0,0,0,115,26,
-    0,0,0,116,0,106,1,100,1,124,0,106,2,131,2,1,
-    0,116,0,106,3,124,0,124,1,131,2,83,0,41,2,122,
+    0,0,2,0,0,0,4,0,0,0,67,0,0,0,115,26,
+    0,0,0,116,0,160,1,100,1,124,0,106,2,161,2,1,
+    0,116,0,160,3,124,0,124,1,161,2,83,0,41,2,122,
     98,76,111,97,100,32,97,32,110,97,109,101,115,112,97,99,
     101,32,109,111,100,117,108,101,46,10,10,32,32,32,32,32,
     32,32,32,84,104,105,115,32,109,101,116,104,111,100,32,105,
@@ -1769,7 +1769,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,114,129,0,0,0,114,226,0,0,0,114,186,0,0,
     0,41,2,114,100,0,0,0,114,119,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,114,187,0,0,
-    0,255,3,0,0,115,6,0,0,0,0,7,6,1,8,1,
+    0,0,4,0,0,115,6,0,0,0,0,7,6,1,8,1,
     122,28,95,78,97,109,101,115,112,97,99,101,76,111,97,100,
     101,114,46,108,111,97,100,95,109,111,100,117,108,101,78,41,
     12,114,105,0,0,0,114,104,0,0,0,114,106,0,0,0,
@@ -1777,7 +1777,7 @@ const unsigned char _Py_M__importlib_external[] = {
     153,0,0,0,114,196,0,0,0,114,181,0,0,0,114,180,
     0,0,0,114,185,0,0,0,114,187,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,114,243,0,0,0,227,3,0,0,115,16,0,0,0,8,
+    0,114,243,0,0,0,228,3,0,0,115,16,0,0,0,8,
     1,8,3,12,9,8,3,8,3,8,3,8,3,8,3,114,
     243,0,0,0,99,0,0,0,0,0,0,0,0,0,0,0,
     0,5,0,0,0,64,0,0,0,115,108,0,0,0,101,0,
@@ -1794,9 +1794,9 @@ const unsigned char _Py_M__importlib_external[] = {
     97,103,101,32,95,95,112,97,116,104,95,95,32,97,116,116,
     114,105,98,117,116,101,115,46,99,1,0,0,0,0,0,0,
     0,2,0,0,0,4,0,0,0,67,0,0,0,115,42,0,
-    0,0,120,36,116,0,106,1,106,2,131,0,68,0,93,22,
-    125,1,116,3,124,1,100,1,131,2,114,12,124,1,106,4,
-    131,0,1,0,113,12,87,0,100,2,83,0,41,3,122,125,
+    0,0,120,36,116,0,106,1,160,2,161,0,68,0,93,22,
+    125,1,116,3,124,1,100,1,131,2,114,12,124,1,160,4,
+    161,0,1,0,113,12,87,0,100,2,83,0,41,3,122,125,
     67,97,108,108,32,116,104,101,32,105,110,118,97,108,105,100,
     97,116,101,95,99,97,99,104,101,115,40,41,32,109,101,116,
     104,111,100,32,111,110,32,97,108,108,32,112,97,116,104,32,
@@ -1811,13 +1811,13 @@ const unsigned char _Py_M__importlib_external[] = {
     97,108,117,101,115,114,108,0,0,0,114,246,0,0,0,41,
     2,114,164,0,0,0,218,6,102,105,110,100,101,114,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,114,246,0,
-    0,0,17,4,0,0,115,6,0,0,0,0,4,16,1,10,
+    0,0,18,4,0,0,115,6,0,0,0,0,4,16,1,10,
     1,122,28,80,97,116,104,70,105,110,100,101,114,46,105,110,
     118,97,108,105,100,97,116,101,95,99,97,99,104,101,115,99,
     2,0,0,0,0,0,0,0,3,0,0,0,12,0,0,0,
     67,0,0,0,115,86,0,0,0,116,0,106,1,100,1,107,
-    9,114,30,116,0,106,1,12,0,114,30,116,2,106,3,100,
-    2,116,4,131,2,1,0,120,50,116,0,106,1,68,0,93,
+    9,114,30,116,0,106,1,12,0,114,30,116,2,160,3,100,
+    2,116,4,161,2,1,0,120,50,116,0,106,1,68,0,93,
     36,125,2,121,8,124,2,124,1,131,1,83,0,4,0,116,
     5,107,10,114,72,1,0,1,0,1,0,119,38,89,0,113,
     38,88,0,113,38,87,0,100,1,83,0,100,1,83,0,41,
@@ -1835,16 +1835,16 @@ const unsigned char _Py_M__importlib_external[] = {
     114,99,0,0,0,41,3,114,164,0,0,0,114,35,0,0,
     0,90,4,104,111,111,107,114,4,0,0,0,114,4,0,0,
     0,114,5,0,0,0,218,11,95,112,97,116,104,95,104,111,
-    111,107,115,25,4,0,0,115,16,0,0,0,0,7,18,1,
+    111,107,115,26,4,0,0,115,16,0,0,0,0,7,18,1,
     12,1,12,1,2,1,8,1,14,1,12,2,122,22,80,97,
     116,104,70,105,110,100,101,114,46,95,112,97,116,104,95,104,
     111,111,107,115,99,2,0,0,0,0,0,0,0,3,0,0,
     0,19,0,0,0,67,0,0,0,115,102,0,0,0,124,1,
-    100,1,107,2,114,42,121,12,116,0,106,1,131,0,125,1,
+    100,1,107,2,114,42,121,12,116,0,160,1,161,0,125,1,
     87,0,110,20,4,0,116,2,107,10,114,40,1,0,1,0,
     1,0,100,2,83,0,88,0,121,14,116,3,106,4,124,1,
     25,0,125,2,87,0,110,40,4,0,116,5,107,10,114,96,
-    1,0,1,0,1,0,124,0,106,6,124,1,131,1,125,2,
+    1,0,1,0,1,0,124,0,160,6,124,1,161,1,125,2,
     124,2,116,3,106,4,124,1,60,0,89,0,110,2,88,0,
     124,2,83,0,41,3,122,210,71,101,116,32,116,104,101,32,
     102,105,110,100,101,114,32,102,111,114,32,116,104,101,32,112,
@@ -1866,17 +1866,17 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,41,3,114,164,0,0,0,114,35,0,0,0,114,
     249,0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,
     0,0,0,218,20,95,112,97,116,104,95,105,109,112,111,114,
-    116,101,114,95,99,97,99,104,101,42,4,0,0,115,22,0,
+    116,101,114,95,99,97,99,104,101,43,4,0,0,115,22,0,
     0,0,0,8,8,1,2,1,12,1,14,3,6,1,2,1,
     14,1,14,1,10,1,16,1,122,31,80,97,116,104,70,105,
     110,100,101,114,46,95,112,97,116,104,95,105,109,112,111,114,
     116,101,114,95,99,97,99,104,101,99,3,0,0,0,0,0,
-    0,0,6,0,0,0,3,0,0,0,67,0,0,0,115,82,
-    0,0,0,116,0,124,2,100,1,131,2,114,26,124,2,106,
-    1,124,1,131,1,92,2,125,3,125,4,110,14,124,2,106,
-    2,124,1,131,1,125,3,103,0,125,4,124,3,100,0,107,
-    9,114,60,116,3,106,4,124,1,124,3,131,2,83,0,116,
-    3,106,5,124,1,100,0,131,2,125,5,124,4,124,5,95,
+    0,0,6,0,0,0,4,0,0,0,67,0,0,0,115,82,
+    0,0,0,116,0,124,2,100,1,131,2,114,26,124,2,160,
+    1,124,1,161,1,92,2,125,3,125,4,110,14,124,2,160,
+    2,124,1,161,1,125,3,103,0,125,4,124,3,100,0,107,
+    9,114,60,116,3,160,4,124,1,124,3,161,2,83,0,116,
+    3,160,5,124,1,100,0,161,2,125,5,124,4,124,5,95,
     6,124,5,83,0,41,2,78,114,117,0,0,0,41,7,114,
     108,0,0,0,114,117,0,0,0,114,176,0,0,0,114,114,
     0,0,0,114,173,0,0,0,114,154,0,0,0,114,150,0,
@@ -1884,21 +1884,21 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,0,114,120,0,0,0,114,121,0,0,0,114,158,0,
     0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
     0,218,16,95,108,101,103,97,99,121,95,103,101,116,95,115,
-    112,101,99,64,4,0,0,115,18,0,0,0,0,4,10,1,
+    112,101,99,65,4,0,0,115,18,0,0,0,0,4,10,1,
     16,2,10,1,4,1,8,1,12,1,12,1,6,1,122,27,
     80,97,116,104,70,105,110,100,101,114,46,95,108,101,103,97,
     99,121,95,103,101,116,95,115,112,101,99,78,99,4,0,0,
     0,0,0,0,0,9,0,0,0,5,0,0,0,67,0,0,
     0,115,170,0,0,0,103,0,125,4,120,160,124,2,68,0,
     93,130,125,5,116,0,124,5,116,1,116,2,102,2,131,2,
-    115,30,113,10,124,0,106,3,124,5,131,1,125,6,124,6,
+    115,30,113,10,124,0,160,3,124,5,161,1,125,6,124,6,
     100,1,107,9,114,10,116,4,124,6,100,2,131,2,114,72,
-    124,6,106,5,124,1,124,3,131,2,125,7,110,12,124,0,
-    106,6,124,1,124,6,131,2,125,7,124,7,100,1,107,8,
+    124,6,160,5,124,1,124,3,161,2,125,7,110,12,124,0,
+    160,6,124,1,124,6,161,2,125,7,124,7,100,1,107,8,
     114,94,113,10,124,7,106,7,100,1,107,9,114,108,124,7,
     83,0,124,7,106,8,125,8,124,8,100,1,107,8,114,130,
-    116,9,100,3,131,1,130,1,124,4,106,10,124,8,131,1,
-    1,0,113,10,87,0,116,11,106,12,124,1,100,1,131,2,
+    116,9,100,3,131,1,130,1,124,4,160,10,124,8,161,1,
+    1,0,113,10,87,0,116,11,160,12,124,1,100,1,161,2,
     125,7,124,4,124,7,95,8,124,7,83,0,100,1,83,0,
     41,4,122,63,70,105,110,100,32,116,104,101,32,108,111,97,
     100,101,114,32,111,114,32,110,97,109,101,115,112,97,99,101,
@@ -1915,15 +1915,15 @@ const unsigned char _Py_M__importlib_external[] = {
     112,97,99,101,95,112,97,116,104,90,5,101,110,116,114,121,
     114,249,0,0,0,114,158,0,0,0,114,121,0,0,0,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,218,9,
-    95,103,101,116,95,115,112,101,99,79,4,0,0,115,40,0,
+    95,103,101,116,95,115,112,101,99,80,4,0,0,115,40,0,
     0,0,0,5,4,1,10,1,14,1,2,1,10,1,8,1,
     10,1,14,2,12,1,8,1,2,1,10,1,4,1,6,1,
     8,1,8,5,14,2,12,1,6,1,122,20,80,97,116,104,
     70,105,110,100,101,114,46,95,103,101,116,95,115,112,101,99,
-    99,4,0,0,0,0,0,0,0,6,0,0,0,4,0,0,
+    99,4,0,0,0,0,0,0,0,6,0,0,0,5,0,0,
     0,67,0,0,0,115,104,0,0,0,124,2,100,1,107,8,
-    114,14,116,0,106,1,125,2,124,0,106,2,124,1,124,2,
-    124,3,131,3,125,4,124,4,100,1,107,8,114,42,100,1,
+    114,14,116,0,106,1,125,2,124,0,160,2,124,1,124,2,
+    124,3,161,3,125,4,124,4,100,1,107,8,114,42,100,1,
     83,0,110,58,124,4,106,3,100,1,107,8,114,96,124,4,
     106,4,125,5,124,5,114,90,100,2,124,4,95,5,116,6,
     124,1,124,5,124,0,106,2,131,3,124,4,95,4,124,4,
@@ -1940,13 +1940,13 @@ const unsigned char _Py_M__importlib_external[] = {
     152,0,0,0,114,224,0,0,0,41,6,114,164,0,0,0,
     114,119,0,0,0,114,35,0,0,0,114,174,0,0,0,114,
     158,0,0,0,114,0,1,0,0,114,4,0,0,0,114,4,
-    0,0,0,114,5,0,0,0,114,175,0,0,0,111,4,0,
+    0,0,0,114,5,0,0,0,114,175,0,0,0,112,4,0,
     0,115,26,0,0,0,0,4,8,1,6,1,14,1,8,1,
     6,1,10,1,6,1,4,3,6,1,16,1,6,2,6,2,
     122,20,80,97,116,104,70,105,110,100,101,114,46,102,105,110,
     100,95,115,112,101,99,99,3,0,0,0,0,0,0,0,4,
-    0,0,0,3,0,0,0,67,0,0,0,115,30,0,0,0,
-    124,0,106,0,124,1,124,2,131,2,125,3,124,3,100,1,
+    0,0,0,4,0,0,0,67,0,0,0,115,30,0,0,0,
+    124,0,160,0,124,1,124,2,161,2,125,3,124,3,100,1,
     107,8,114,24,100,1,83,0,124,3,106,1,83,0,41,2,
     122,170,102,105,110,100,32,116,104,101,32,109,111,100,117,108,
     101,32,111,110,32,115,121,115,46,112,97,116,104,32,111,114,
@@ -1962,7 +1962,7 @@ const unsigned char _Py_M__importlib_external[] = {
     175,0,0,0,114,120,0,0,0,41,4,114,164,0,0,0,
     114,119,0,0,0,114,35,0,0,0,114,158,0,0,0,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,176,
-    0,0,0,133,4,0,0,115,8,0,0,0,0,8,12,1,
+    0,0,0,134,4,0,0,115,8,0,0,0,0,8,12,1,
     8,1,4,1,122,22,80,97,116,104,70,105,110,100,101,114,
     46,102,105,110,100,95,109,111,100,117,108,101,41,12,114,105,
     0,0,0,114,104,0,0,0,114,106,0,0,0,114,107,0,
@@ -1970,7 +1970,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,114,253,0,0,0,114,254,0,0,0,114,1,1,0,0,
     114,175,0,0,0,114,176,0,0,0,114,4,0,0,0,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,245,
-    0,0,0,13,4,0,0,115,22,0,0,0,8,2,4,2,
+    0,0,0,14,4,0,0,115,22,0,0,0,8,2,4,2,
     12,8,12,17,12,22,12,15,2,1,12,31,2,1,14,21,
     2,1,114,245,0,0,0,99,0,0,0,0,0,0,0,0,
     0,0,0,0,3,0,0,0,64,0,0,0,115,90,0,0,
@@ -1992,10 +1992,10 @@ const unsigned char _Py_M__importlib_external[] = {
     101,114,32,105,115,32,104,97,110,100,108,105,110,103,32,104,
     97,115,32,98,101,101,110,32,109,111,100,105,102,105,101,100,
     46,10,10,32,32,32,32,99,2,0,0,0,0,0,0,0,
-    5,0,0,0,5,0,0,0,7,0,0,0,115,88,0,0,
+    5,0,0,0,6,0,0,0,7,0,0,0,115,88,0,0,
     0,103,0,125,3,120,40,124,2,68,0,93,32,92,2,137,
-    0,125,4,124,3,106,0,135,0,102,1,100,1,100,2,134,
-    0,124,4,68,0,131,1,131,1,1,0,113,10,87,0,124,
+    0,125,4,124,3,160,0,135,0,102,1,100,1,100,2,134,
+    0,124,4,68,0,131,1,161,1,1,0,113,10,87,0,124,
     3,124,0,95,1,124,1,112,58,100,3,124,0,95,2,100,
     6,124,0,95,3,116,4,131,0,124,0,95,5,116,4,131,
     0,124,0,95,6,100,5,83,0,41,7,122,154,73,110,105,
@@ -2014,7 +2014,7 @@ const unsigned char _Py_M__importlib_external[] = {
     0,113,2,100,0,83,0,41,1,78,114,4,0,0,0,41,
     2,114,22,0,0,0,114,219,0,0,0,41,1,114,120,0,
     0,0,114,4,0,0,0,114,5,0,0,0,114,221,0,0,
-    0,162,4,0,0,115,2,0,0,0,4,0,122,38,70,105,
+    0,163,4,0,0,115,2,0,0,0,4,0,122,38,70,105,
     108,101,70,105,110,100,101,114,46,95,95,105,110,105,116,95,
     95,46,60,108,111,99,97,108,115,62,46,60,103,101,110,101,
     120,112,114,62,114,58,0,0,0,114,29,0,0,0,78,114,
@@ -2026,7 +2026,7 @@ const unsigned char _Py_M__importlib_external[] = {
     114,100,0,0,0,114,35,0,0,0,218,14,108,111,97,100,
     101,114,95,100,101,116,97,105,108,115,90,7,108,111,97,100,
     101,114,115,114,160,0,0,0,114,4,0,0,0,41,1,114,
-    120,0,0,0,114,5,0,0,0,114,179,0,0,0,156,4,
+    120,0,0,0,114,5,0,0,0,114,179,0,0,0,157,4,
     0,0,115,16,0,0,0,0,4,4,1,14,1,28,1,6,
     2,10,1,6,1,8,1,122,19,70,105,108,101,70,105,110,
     100,101,114,46,95,95,105,110,105,116,95,95,99,1,0,0,
@@ -2037,11 +2037,11 @@ const unsigned char _Py_M__importlib_external[] = {
     109,101,46,114,29,0,0,0,78,114,87,0,0,0,41,1,
     114,4,1,0,0,41,1,114,100,0,0,0,114,4,0,0,
     0,114,4,0,0,0,114,5,0,0,0,114,246,0,0,0,
-    170,4,0,0,115,2,0,0,0,0,2,122,28,70,105,108,
+    171,4,0,0,115,2,0,0,0,0,2,122,28,70,105,108,
     101,70,105,110,100,101,114,46,105,110,118,97,108,105,100,97,
     116,101,95,99,97,99,104,101,115,99,2,0,0,0,0,0,
-    0,0,3,0,0,0,2,0,0,0,67,0,0,0,115,42,
-    0,0,0,124,0,106,0,124,1,131,1,125,2,124,2,100,
+    0,0,3,0,0,0,3,0,0,0,67,0,0,0,115,42,
+    0,0,0,124,0,160,0,124,1,161,1,125,2,124,2,100,
     1,107,8,114,26,100,1,103,0,102,2,83,0,124,2,106,
     1,124,2,106,2,112,38,103,0,102,2,83,0,41,2,122,
     197,84,114,121,32,116,111,32,102,105,110,100,32,97,32,108,
@@ -2059,7 +2059,7 @@ const unsigned char _Py_M__importlib_external[] = {
     32,32,32,32,32,32,78,41,3,114,175,0,0,0,114,120,
     0,0,0,114,150,0,0,0,41,3,114,100,0,0,0,114,
     119,0,0,0,114,158,0,0,0,114,4,0,0,0,114,4,
-    0,0,0,114,5,0,0,0,114,117,0,0,0,176,4,0,
+    0,0,0,114,5,0,0,0,114,117,0,0,0,177,4,0,
     0,115,8,0,0,0,0,7,10,1,8,1,8,1,122,22,
     70,105,108,101,70,105,110,100,101,114,46,102,105,110,100,95,
     108,111,97,100,101,114,99,6,0,0,0,0,0,0,0,7,
@@ -2070,355 +2070,354 @@ const unsigned char _Py_M__importlib_external[] = {
     0,0,41,7,114,100,0,0,0,114,159,0,0,0,114,119,
     0,0,0,114,35,0,0,0,90,4,115,109,115,108,114,174,
     0,0,0,114,120,0,0,0,114,4,0,0,0,114,4,0,
-    0,0,114,5,0,0,0,114,1,1,0,0,188,4,0,0,
+    0,0,114,5,0,0,0,114,1,1,0,0,189,4,0,0,
     115,6,0,0,0,0,1,10,1,12,1,122,20,70,105,108,
     101,70,105,110,100,101,114,46,95,103,101,116,95,115,112,101,
-    99,78,99,3,0,0,0,0,0,0,0,14,0,0,0,15,
+    99,78,99,3,0,0,0,0,0,0,0,14,0,0,0,16,
     0,0,0,67,0,0,0,115,100,1,0,0,100,1,125,3,
-    124,1,106,0,100,2,131,1,100,3,25,0,125,4,121,24,
-    116,1,124,0,106,2,112,34,116,3,106,4,131,0,131,1,
+    124,1,160,0,100,2,161,1,100,3,25,0,125,4,121,24,
+    116,1,124,0,106,2,112,34,116,3,160,4,161,0,131,1,
     106,5,125,5,87,0,110,24,4,0,116,6,107,10,114,66,
     1,0,1,0,1,0,100,10,125,5,89,0,110,2,88,0,
-    124,5,124,0,106,7,107,3,114,92,124,0,106,8,131,0,
+    124,5,124,0,106,7,107,3,114,92,124,0,160,8,161,0,
     1,0,124,5,124,0,95,7,116,9,131,0,114,114,124,0,
-    106,10,125,6,124,4,106,11,131,0,125,7,110,10,124,0,
+    106,10,125,6,124,4,160,11,161,0,125,7,110,10,124,0,
     106,12,125,6,124,4,125,7,124,7,124,6,107,6,114,218,
     116,13,124,0,106,2,124,4,131,2,125,8,120,72,124,0,
     106,14,68,0,93,54,92,2,125,9,125,10,100,5,124,9,
     23,0,125,11,116,13,124,8,124,11,131,2,125,12,116,15,
-    124,12,131,1,114,152,124,0,106,16,124,10,124,1,124,12,
-    124,8,103,1,124,2,131,5,83,0,113,152,87,0,116,17,
+    124,12,131,1,114,152,124,0,160,16,124,10,124,1,124,12,
+    124,8,103,1,124,2,161,5,83,0,113,152,87,0,116,17,
     124,8,131,1,125,3,120,90,124,0,106,14,68,0,93,80,
     92,2,125,9,125,10,116,13,124,0,106,2,124,4,124,9,
     23,0,131,2,125,12,116,18,106,19,100,6,124,12,100,7,
     100,3,144,1,131,2,1,0,124,7,124,9,23,0,124,6,
-    107,6,114,226,116,15,124,12,131,1,114,226,124,0,106,16,
-    124,10,124,1,124,12,100,8,124,2,131,5,83,0,113,226,
-    87,0,124,3,144,1,114,96,116,18,106,19,100,9,124,8,
-    131,2,1,0,116,18,106,20,124,1,100,8,131,2,125,13,
+    107,6,114,226,116,15,124,12,131,1,114,226,124,0,160,16,
+    124,10,124,1,124,12,100,8,124,2,161,5,83,0,113,226,
+    87,0,124,3,144,1,114,96,116,18,160,19,100,9,124,8,
+    161,2,1,0,116,18,160,20,124,1,100,8,161,2,125,13,
     124,8,103,1,124,13,95,21,124,13,83,0,100,8,83,0,
-    41,11,122,125,84,114,121,32,116,111,32,102,105,110,100,32,
-    97,32,108,111,97,100,101,114,32,102,111,114,32,116,104,101,
-    32,115,112,101,99,105,102,105,101,100,32,109,111,100,117,108,
-    101,44,32,111,114,32,116,104,101,32,110,97,109,101,115,112,
-    97,99,101,10,32,32,32,32,32,32,32,32,112,97,99,107,
-    97,103,101,32,112,111,114,116,105,111,110,115,46,32,82,101,
-    116,117,114,110,115,32,40,108,111,97,100,101,114,44,32,108,
-    105,115,116,45,111,102,45,112,111,114,116,105,111,110,115,41,
-    46,70,114,58,0,0,0,114,56,0,0,0,114,29,0,0,
-    0,114,179,0,0,0,122,9,116,114,121,105,110,103,32,123,
-    125,90,9,118,101,114,98,111,115,105,116,121,78,122,25,112,
-    111,115,115,105,98,108,101,32,110,97,109,101,115,112,97,99,
-    101,32,102,111,114,32,123,125,114,87,0,0,0,41,22,114,
-    32,0,0,0,114,39,0,0,0,114,35,0,0,0,114,3,
-    0,0,0,114,45,0,0,0,114,213,0,0,0,114,40,0,
-    0,0,114,4,1,0,0,218,11,95,102,105,108,108,95,99,
-    97,99,104,101,114,6,0,0,0,114,7,1,0,0,114,88,
-    0,0,0,114,6,1,0,0,114,28,0,0,0,114,3,1,
-    0,0,114,44,0,0,0,114,1,1,0,0,114,46,0,0,
-    0,114,114,0,0,0,114,129,0,0,0,114,154,0,0,0,
-    114,150,0,0,0,41,14,114,100,0,0,0,114,119,0,0,
-    0,114,174,0,0,0,90,12,105,115,95,110,97,109,101,115,
-    112,97,99,101,90,11,116,97,105,108,95,109,111,100,117,108,
-    101,114,126,0,0,0,90,5,99,97,99,104,101,90,12,99,
-    97,99,104,101,95,109,111,100,117,108,101,90,9,98,97,115,
-    101,95,112,97,116,104,114,219,0,0,0,114,159,0,0,0,
-    90,13,105,110,105,116,95,102,105,108,101,110,97,109,101,90,
-    9,102,117,108,108,95,112,97,116,104,114,158,0,0,0,114,
-    4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,175,
-    0,0,0,193,4,0,0,115,70,0,0,0,0,3,4,1,
-    14,1,2,1,24,1,14,1,10,1,10,1,8,1,6,2,
-    6,1,6,1,10,2,6,1,4,2,8,1,12,1,16,1,
-    8,1,10,1,8,1,24,4,8,2,16,1,16,1,18,1,
-    12,1,8,1,10,1,12,1,6,1,12,1,12,1,8,1,
-    4,1,122,20,70,105,108,101,70,105,110,100,101,114,46,102,
-    105,110,100,95,115,112,101,99,99,1,0,0,0,0,0,0,
-    0,9,0,0,0,13,0,0,0,67,0,0,0,115,194,0,
-    0,0,124,0,106,0,125,1,121,22,116,1,106,2,124,1,
-    112,22,116,1,106,3,131,0,131,1,125,2,87,0,110,30,
-    4,0,116,4,116,5,116,6,102,3,107,10,114,58,1,0,
-    1,0,1,0,103,0,125,2,89,0,110,2,88,0,116,7,
-    106,8,106,9,100,1,131,1,115,84,116,10,124,2,131,1,
-    124,0,95,11,110,78,116,10,131,0,125,3,120,64,124,2,
-    68,0,93,56,125,4,124,4,106,12,100,2,131,1,92,3,
-    125,5,125,6,125,7,124,6,114,138,100,3,106,13,124,5,
-    124,7,106,14,131,0,131,2,125,8,110,4,124,5,125,8,
-    124,3,106,15,124,8,131,1,1,0,113,96,87,0,124,3,
-    124,0,95,11,116,7,106,8,106,9,116,16,131,1,114,190,
-    100,4,100,5,132,0,124,2,68,0,131,1,124,0,95,17,
-    100,6,83,0,41,7,122,68,70,105,108,108,32,116,104,101,
-    32,99,97,99,104,101,32,111,102,32,112,111,116,101,110,116,
-    105,97,108,32,109,111,100,117,108,101,115,32,97,110,100,32,
-    112,97,99,107,97,103,101,115,32,102,111,114,32,116,104,105,
-    115,32,100,105,114,101,99,116,111,114,121,46,114,0,0,0,
-    0,114,58,0,0,0,122,5,123,125,46,123,125,99,1,0,
-    0,0,0,0,0,0,2,0,0,0,3,0,0,0,83,0,
-    0,0,115,20,0,0,0,104,0,124,0,93,12,125,1,124,
-    1,106,0,131,0,146,2,113,4,83,0,114,4,0,0,0,
-    41,1,114,88,0,0,0,41,2,114,22,0,0,0,90,2,
-    102,110,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,250,9,60,115,101,116,99,111,109,112,62,12,5,0,0,
-    115,2,0,0,0,6,0,122,41,70,105,108,101,70,105,110,
-    100,101,114,46,95,102,105,108,108,95,99,97,99,104,101,46,
-    60,108,111,99,97,108,115,62,46,60,115,101,116,99,111,109,
-    112,62,78,41,18,114,35,0,0,0,114,3,0,0,0,90,
-    7,108,105,115,116,100,105,114,114,45,0,0,0,114,252,0,
-    0,0,218,15,80,101,114,109,105,115,115,105,111,110,69,114,
-    114,111,114,218,18,78,111,116,65,68,105,114,101,99,116,111,
-    114,121,69,114,114,111,114,114,7,0,0,0,114,8,0,0,
-    0,114,9,0,0,0,114,5,1,0,0,114,6,1,0,0,
-    114,83,0,0,0,114,47,0,0,0,114,88,0,0,0,218,
-    3,97,100,100,114,10,0,0,0,114,7,1,0,0,41,9,
-    114,100,0,0,0,114,35,0,0,0,90,8,99,111,110,116,
-    101,110,116,115,90,21,108,111,119,101,114,95,115,117,102,102,
-    105,120,95,99,111,110,116,101,110,116,115,114,241,0,0,0,
-    114,98,0,0,0,114,231,0,0,0,114,219,0,0,0,90,
-    8,110,101,119,95,110,97,109,101,114,4,0,0,0,114,4,
-    0,0,0,114,5,0,0,0,114,9,1,0,0,239,4,0,
-    0,115,34,0,0,0,0,2,6,1,2,1,22,1,20,3,
-    10,3,12,1,12,7,6,1,10,1,16,1,4,1,18,2,
-    4,1,14,1,6,1,12,1,122,22,70,105,108,101,70,105,
-    110,100,101,114,46,95,102,105,108,108,95,99,97,99,104,101,
-    99,1,0,0,0,0,0,0,0,3,0,0,0,3,0,0,
-    0,7,0,0,0,115,18,0,0,0,135,0,135,1,102,2,
-    100,1,100,2,134,0,125,2,124,2,83,0,41,3,97,20,
-    1,0,0,65,32,99,108,97,115,115,32,109,101,116,104,111,
-    100,32,119,104,105,99,104,32,114,101,116,117,114,110,115,32,
-    97,32,99,108,111,115,117,114,101,32,116,111,32,117,115,101,
-    32,111,110,32,115,121,115,46,112,97,116,104,95,104,111,111,
-    107,10,32,32,32,32,32,32,32,32,119,104,105,99,104,32,
-    119,105,108,108,32,114,101,116,117,114,110,32,97,110,32,105,
-    110,115,116,97,110,99,101,32,117,115,105,110,103,32,116,104,
-    101,32,115,112,101,99,105,102,105,101,100,32,108,111,97,100,
-    101,114,115,32,97,110,100,32,116,104,101,32,112,97,116,104,
-    10,32,32,32,32,32,32,32,32,99,97,108,108,101,100,32,
-    111,110,32,116,104,101,32,99,108,111,115,117,114,101,46,10,
-    10,32,32,32,32,32,32,32,32,73,102,32,116,104,101,32,
-    112,97,116,104,32,99,97,108,108,101,100,32,111,110,32,116,
-    104,101,32,99,108,111,115,117,114,101,32,105,115,32,110,111,
-    116,32,97,32,100,105,114,101,99,116,111,114,121,44,32,73,
-    109,112,111,114,116,69,114,114,111,114,32,105,115,10,32,32,
-    32,32,32,32,32,32,114,97,105,115,101,100,46,10,10,32,
-    32,32,32,32,32,32,32,99,1,0,0,0,0,0,0,0,
-    1,0,0,0,4,0,0,0,19,0,0,0,115,32,0,0,
-    0,116,0,124,0,131,1,115,22,116,1,100,1,100,2,124,
-    0,144,1,131,1,130,1,136,0,124,0,136,1,140,1,83,
-    0,41,3,122,45,80,97,116,104,32,104,111,111,107,32,102,
-    111,114,32,105,109,112,111,114,116,108,105,98,46,109,97,99,
-    104,105,110,101,114,121,46,70,105,108,101,70,105,110,100,101,
-    114,46,122,30,111,110,108,121,32,100,105,114,101,99,116,111,
-    114,105,101,115,32,97,114,101,32,115,117,112,112,111,114,116,
-    101,100,114,35,0,0,0,41,2,114,46,0,0,0,114,99,
-    0,0,0,41,1,114,35,0,0,0,41,2,114,164,0,0,
-    0,114,8,1,0,0,114,4,0,0,0,114,5,0,0,0,
-    218,24,112,97,116,104,95,104,111,111,107,95,102,111,114,95,
-    70,105,108,101,70,105,110,100,101,114,24,5,0,0,115,6,
-    0,0,0,0,2,8,1,14,1,122,54,70,105,108,101,70,
-    105,110,100,101,114,46,112,97,116,104,95,104,111,111,107,46,
-    60,108,111,99,97,108,115,62,46,112,97,116,104,95,104,111,
-    111,107,95,102,111,114,95,70,105,108,101,70,105,110,100,101,
-    114,114,4,0,0,0,41,3,114,164,0,0,0,114,8,1,
-    0,0,114,14,1,0,0,114,4,0,0,0,41,2,114,164,
-    0,0,0,114,8,1,0,0,114,5,0,0,0,218,9,112,
-    97,116,104,95,104,111,111,107,14,5,0,0,115,4,0,0,
-    0,0,10,14,6,122,20,70,105,108,101,70,105,110,100,101,
-    114,46,112,97,116,104,95,104,111,111,107,99,1,0,0,0,
-    0,0,0,0,1,0,0,0,2,0,0,0,67,0,0,0,
-    115,12,0,0,0,100,1,106,0,124,0,106,1,131,1,83,
-    0,41,2,78,122,16,70,105,108,101,70,105,110,100,101,114,
-    40,123,33,114,125,41,41,2,114,47,0,0,0,114,35,0,
-    0,0,41,1,114,100,0,0,0,114,4,0,0,0,114,4,
-    0,0,0,114,5,0,0,0,114,240,0,0,0,32,5,0,
-    0,115,2,0,0,0,0,1,122,19,70,105,108,101,70,105,
-    110,100,101,114,46,95,95,114,101,112,114,95,95,41,15,114,
-    105,0,0,0,114,104,0,0,0,114,106,0,0,0,114,107,
-    0,0,0,114,179,0,0,0,114,246,0,0,0,114,123,0,
-    0,0,114,176,0,0,0,114,117,0,0,0,114,1,1,0,
-    0,114,175,0,0,0,114,9,1,0,0,114,177,0,0,0,
-    114,15,1,0,0,114,240,0,0,0,114,4,0,0,0,114,
-    4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,2,
-    1,0,0,147,4,0,0,115,20,0,0,0,8,7,4,2,
-    8,14,8,4,4,2,8,12,8,5,10,46,8,31,12,18,
-    114,2,1,0,0,99,4,0,0,0,0,0,0,0,6,0,
-    0,0,11,0,0,0,67,0,0,0,115,148,0,0,0,124,
-    0,106,0,100,1,131,1,125,4,124,0,106,0,100,2,131,
-    1,125,5,124,4,115,66,124,5,114,36,124,5,106,1,125,
-    4,110,30,124,2,124,3,107,2,114,56,116,2,124,1,124,
-    2,131,2,125,4,110,10,116,3,124,1,124,2,131,2,125,
-    4,124,5,115,86,116,4,124,1,124,2,100,3,124,4,144,
-    1,131,2,125,5,121,36,124,5,124,0,100,2,60,0,124,
-    4,124,0,100,1,60,0,124,2,124,0,100,4,60,0,124,
-    3,124,0,100,5,60,0,87,0,110,20,4,0,116,5,107,
-    10,114,142,1,0,1,0,1,0,89,0,110,2,88,0,100,
-    0,83,0,41,6,78,218,10,95,95,108,111,97,100,101,114,
-    95,95,218,8,95,95,115,112,101,99,95,95,114,120,0,0,
-    0,90,8,95,95,102,105,108,101,95,95,90,10,95,95,99,
-    97,99,104,101,100,95,95,41,6,218,3,103,101,116,114,120,
-    0,0,0,114,217,0,0,0,114,212,0,0,0,114,161,0,
-    0,0,218,9,69,120,99,101,112,116,105,111,110,41,6,90,
-    2,110,115,114,98,0,0,0,90,8,112,97,116,104,110,97,
-    109,101,90,9,99,112,97,116,104,110,97,109,101,114,120,0,
-    0,0,114,158,0,0,0,114,4,0,0,0,114,4,0,0,
-    0,114,5,0,0,0,218,14,95,102,105,120,95,117,112,95,
-    109,111,100,117,108,101,38,5,0,0,115,34,0,0,0,0,
-    2,10,1,10,1,4,1,4,1,8,1,8,1,12,2,10,
-    1,4,1,16,1,2,1,8,1,8,1,8,1,12,1,14,
-    2,114,20,1,0,0,99,0,0,0,0,0,0,0,0,3,
-    0,0,0,3,0,0,0,67,0,0,0,115,38,0,0,0,
-    116,0,116,1,106,2,131,0,102,2,125,0,116,3,116,4,
-    102,2,125,1,116,5,116,6,102,2,125,2,124,0,124,1,
-    124,2,103,3,83,0,41,1,122,95,82,101,116,117,114,110,
-    115,32,97,32,108,105,115,116,32,111,102,32,102,105,108,101,
-    45,98,97,115,101,100,32,109,111,100,117,108,101,32,108,111,
-    97,100,101,114,115,46,10,10,32,32,32,32,69,97,99,104,
-    32,105,116,101,109,32,105,115,32,97,32,116,117,112,108,101,
-    32,40,108,111,97,100,101,114,44,32,115,117,102,102,105,120,
-    101,115,41,46,10,32,32,32,32,41,7,114,218,0,0,0,
-    114,139,0,0,0,218,18,101,120,116,101,110,115,105,111,110,
-    95,115,117,102,102,105,120,101,115,114,212,0,0,0,114,84,
-    0,0,0,114,217,0,0,0,114,74,0,0,0,41,3,90,
-    10,101,120,116,101,110,115,105,111,110,115,90,6,115,111,117,
-    114,99,101,90,8,98,121,116,101,99,111,100,101,114,4,0,
-    0,0,114,4,0,0,0,114,5,0,0,0,114,155,0,0,
-    0,61,5,0,0,115,8,0,0,0,0,5,12,1,8,1,
-    8,1,114,155,0,0,0,99,1,0,0,0,0,0,0,0,
-    12,0,0,0,12,0,0,0,67,0,0,0,115,188,1,0,
-    0,124,0,97,0,116,0,106,1,97,1,116,0,106,2,97,
-    2,116,1,106,3,116,4,25,0,125,1,120,56,100,26,68,
-    0,93,48,125,2,124,2,116,1,106,3,107,7,114,58,116,
-    0,106,5,124,2,131,1,125,3,110,10,116,1,106,3,124,
-    2,25,0,125,3,116,6,124,1,124,2,124,3,131,3,1,
-    0,113,32,87,0,100,5,100,6,103,1,102,2,100,7,100,
-    8,100,6,103,2,102,2,102,2,125,4,120,118,124,4,68,
-    0,93,102,92,2,125,5,125,6,116,7,100,9,100,10,132,
-    0,124,6,68,0,131,1,131,1,115,142,116,8,130,1,124,
-    6,100,11,25,0,125,7,124,5,116,1,106,3,107,6,114,
-    174,116,1,106,3,124,5,25,0,125,8,80,0,113,112,121,
-    16,116,0,106,5,124,5,131,1,125,8,80,0,87,0,113,
-    112,4,0,116,9,107,10,114,212,1,0,1,0,1,0,119,
-    112,89,0,113,112,88,0,113,112,87,0,116,9,100,12,131,
-    1,130,1,116,6,124,1,100,13,124,8,131,3,1,0,116,
-    6,124,1,100,14,124,7,131,3,1,0,116,6,124,1,100,
-    15,100,16,106,10,124,6,131,1,131,3,1,0,121,14,116,
-    0,106,5,100,17,131,1,125,9,87,0,110,26,4,0,116,
-    9,107,10,144,1,114,52,1,0,1,0,1,0,100,18,125,
-    9,89,0,110,2,88,0,116,6,124,1,100,17,124,9,131,
-    3,1,0,116,0,106,5,100,19,131,1,125,10,116,6,124,
-    1,100,19,124,10,131,3,1,0,124,5,100,7,107,2,144,
-    1,114,120,116,0,106,5,100,20,131,1,125,11,116,6,124,
-    1,100,21,124,11,131,3,1,0,116,6,124,1,100,22,116,
-    11,131,0,131,3,1,0,116,12,106,13,116,2,106,14,131,
-    0,131,1,1,0,124,5,100,7,107,2,144,1,114,184,116,
-    15,106,16,100,23,131,1,1,0,100,24,116,12,107,6,144,
-    1,114,184,100,25,116,17,95,18,100,18,83,0,41,27,122,
-    205,83,101,116,117,112,32,116,104,101,32,112,97,116,104,45,
-    98,97,115,101,100,32,105,109,112,111,114,116,101,114,115,32,
-    102,111,114,32,105,109,112,111,114,116,108,105,98,32,98,121,
-    32,105,109,112,111,114,116,105,110,103,32,110,101,101,100,101,
-    100,10,32,32,32,32,98,117,105,108,116,45,105,110,32,109,
-    111,100,117,108,101,115,32,97,110,100,32,105,110,106,101,99,
-    116,105,110,103,32,116,104,101,109,32,105,110,116,111,32,116,
-    104,101,32,103,108,111,98,97,108,32,110,97,109,101,115,112,
-    97,99,101,46,10,10,32,32,32,32,79,116,104,101,114,32,
-    99,111,109,112,111,110,101,110,116,115,32,97,114,101,32,101,
-    120,116,114,97,99,116,101,100,32,102,114,111,109,32,116,104,
-    101,32,99,111,114,101,32,98,111,111,116,115,116,114,97,112,
-    32,109,111,100,117,108,101,46,10,10,32,32,32,32,114,49,
-    0,0,0,114,60,0,0,0,218,8,98,117,105,108,116,105,
-    110,115,114,136,0,0,0,90,5,112,111,115,105,120,250,1,
-    47,218,2,110,116,250,1,92,99,1,0,0,0,0,0,0,
-    0,2,0,0,0,3,0,0,0,115,0,0,0,115,26,0,
-    0,0,124,0,93,18,125,1,116,0,124,1,131,1,100,0,
-    107,2,86,0,1,0,113,2,100,1,83,0,41,2,114,29,
-    0,0,0,78,41,1,114,31,0,0,0,41,2,114,22,0,
-    0,0,114,77,0,0,0,114,4,0,0,0,114,4,0,0,
-    0,114,5,0,0,0,114,221,0,0,0,97,5,0,0,115,
-    2,0,0,0,4,0,122,25,95,115,101,116,117,112,46,60,
-    108,111,99,97,108,115,62,46,60,103,101,110,101,120,112,114,
-    62,114,59,0,0,0,122,30,105,109,112,111,114,116,108,105,
-    98,32,114,101,113,117,105,114,101,115,32,112,111,115,105,120,
-    32,111,114,32,110,116,114,3,0,0,0,114,25,0,0,0,
-    114,21,0,0,0,114,30,0,0,0,90,7,95,116,104,114,
-    101,97,100,78,90,8,95,119,101,97,107,114,101,102,90,6,
-    119,105,110,114,101,103,114,163,0,0,0,114,6,0,0,0,
-    122,4,46,112,121,119,122,6,95,100,46,112,121,100,84,41,
-    4,122,3,95,105,111,122,9,95,119,97,114,110,105,110,103,
-    115,122,8,98,117,105,108,116,105,110,115,122,7,109,97,114,
-    115,104,97,108,41,19,114,114,0,0,0,114,7,0,0,0,
-    114,139,0,0,0,114,233,0,0,0,114,105,0,0,0,90,
-    18,95,98,117,105,108,116,105,110,95,102,114,111,109,95,110,
-    97,109,101,114,109,0,0,0,218,3,97,108,108,218,14,65,
-    115,115,101,114,116,105,111,110,69,114,114,111,114,114,99,0,
-    0,0,114,26,0,0,0,114,11,0,0,0,114,223,0,0,
-    0,114,143,0,0,0,114,21,1,0,0,114,84,0,0,0,
-    114,157,0,0,0,114,162,0,0,0,114,167,0,0,0,41,
-    12,218,17,95,98,111,111,116,115,116,114,97,112,95,109,111,
-    100,117,108,101,90,11,115,101,108,102,95,109,111,100,117,108,
-    101,90,12,98,117,105,108,116,105,110,95,110,97,109,101,90,
-    14,98,117,105,108,116,105,110,95,109,111,100,117,108,101,90,
-    10,111,115,95,100,101,116,97,105,108,115,90,10,98,117,105,
-    108,116,105,110,95,111,115,114,21,0,0,0,114,25,0,0,
-    0,90,9,111,115,95,109,111,100,117,108,101,90,13,116,104,
-    114,101,97,100,95,109,111,100,117,108,101,90,14,119,101,97,
-    107,114,101,102,95,109,111,100,117,108,101,90,13,119,105,110,
-    114,101,103,95,109,111,100,117,108,101,114,4,0,0,0,114,
-    4,0,0,0,114,5,0,0,0,218,6,95,115,101,116,117,
-    112,72,5,0,0,115,82,0,0,0,0,8,4,1,6,1,
-    6,3,10,1,10,1,10,1,12,2,10,1,16,3,22,1,
-    14,2,22,1,8,1,10,1,10,1,4,2,2,1,10,1,
-    6,1,14,1,12,2,8,1,12,1,12,1,18,3,2,1,
-    14,1,16,2,10,1,12,3,10,1,12,3,10,1,10,1,
-    12,3,14,1,14,1,10,1,10,1,10,1,114,29,1,0,
-    0,99,1,0,0,0,0,0,0,0,2,0,0,0,3,0,
-    0,0,67,0,0,0,115,84,0,0,0,116,0,124,0,131,
-    1,1,0,116,1,131,0,125,1,116,2,106,3,106,4,116,
-    5,106,6,124,1,140,0,103,1,131,1,1,0,116,7,106,
-    8,100,1,107,2,114,56,116,2,106,9,106,10,116,11,131,
-    1,1,0,116,2,106,9,106,10,116,12,131,1,1,0,116,
-    5,124,0,95,5,116,13,124,0,95,13,100,2,83,0,41,
-    3,122,41,73,110,115,116,97,108,108,32,116,104,101,32,112,
-    97,116,104,45,98,97,115,101,100,32,105,109,112,111,114,116,
-    32,99,111,109,112,111,110,101,110,116,115,46,114,24,1,0,
-    0,78,41,14,114,29,1,0,0,114,155,0,0,0,114,7,
-    0,0,0,114,250,0,0,0,114,143,0,0,0,114,2,1,
-    0,0,114,15,1,0,0,114,3,0,0,0,114,105,0,0,
-    0,218,9,109,101,116,97,95,112,97,116,104,114,157,0,0,
-    0,114,162,0,0,0,114,245,0,0,0,114,212,0,0,0,
-    41,2,114,28,1,0,0,90,17,115,117,112,112,111,114,116,
-    101,100,95,108,111,97,100,101,114,115,114,4,0,0,0,114,
-    4,0,0,0,114,5,0,0,0,218,8,95,105,110,115,116,
-    97,108,108,140,5,0,0,115,16,0,0,0,0,2,8,1,
-    6,1,20,1,10,1,12,1,12,4,6,1,114,31,1,0,
-    0,41,3,122,3,119,105,110,114,1,0,0,0,114,2,0,
-    0,0,41,56,114,107,0,0,0,114,10,0,0,0,114,11,
-    0,0,0,114,17,0,0,0,114,19,0,0,0,114,28,0,
-    0,0,114,38,0,0,0,114,39,0,0,0,114,43,0,0,
-    0,114,44,0,0,0,114,46,0,0,0,114,55,0,0,0,
-    218,4,116,121,112,101,218,8,95,95,99,111,100,101,95,95,
-    114,138,0,0,0,114,15,0,0,0,114,128,0,0,0,114,
-    14,0,0,0,114,18,0,0,0,90,17,95,82,65,87,95,
-    77,65,71,73,67,95,78,85,77,66,69,82,114,73,0,0,
-    0,114,72,0,0,0,114,84,0,0,0,114,74,0,0,0,
-    90,23,68,69,66,85,71,95,66,89,84,69,67,79,68,69,
-    95,83,85,70,70,73,88,69,83,90,27,79,80,84,73,77,
-    73,90,69,68,95,66,89,84,69,67,79,68,69,95,83,85,
-    70,70,73,88,69,83,114,79,0,0,0,114,85,0,0,0,
-    114,91,0,0,0,114,95,0,0,0,114,97,0,0,0,114,
-    116,0,0,0,114,123,0,0,0,114,135,0,0,0,114,141,
-    0,0,0,114,144,0,0,0,114,149,0,0,0,218,6,111,
-    98,106,101,99,116,114,156,0,0,0,114,161,0,0,0,114,
-    162,0,0,0,114,178,0,0,0,114,188,0,0,0,114,204,
-    0,0,0,114,212,0,0,0,114,217,0,0,0,114,223,0,
-    0,0,114,218,0,0,0,114,224,0,0,0,114,243,0,0,
-    0,114,245,0,0,0,114,2,1,0,0,114,20,1,0,0,
-    114,155,0,0,0,114,29,1,0,0,114,31,1,0,0,114,
-    4,0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,
-    0,0,0,218,8,60,109,111,100,117,108,101,62,8,0,0,
-    0,115,102,0,0,0,4,17,4,3,8,12,8,5,8,5,
-    8,6,8,12,8,10,8,9,8,5,8,7,10,22,10,116,
-    16,1,12,2,4,1,4,2,6,2,6,2,8,2,16,44,
-    8,33,8,19,8,12,8,12,8,28,8,17,14,55,14,12,
-    12,10,8,14,6,3,8,1,12,65,14,64,14,29,16,110,
-    14,41,18,45,18,16,4,3,18,53,14,60,14,42,14,127,
-    0,7,14,127,0,20,10,23,8,11,8,68,
+    41,11,122,102,84,114,121,32,116,111,32,102,105,110,100,32,
+    97,32,115,112,101,99,32,102,111,114,32,116,104,101,32,115,
+    112,101,99,105,102,105,101,100,32,109,111,100,117,108,101,46,
+    32,32,82,101,116,117,114,110,115,32,116,104,101,10,32,32,
+    32,32,32,32,32,32,109,97,116,99,104,105,110,103,32,115,
+    112,101,99,44,32,111,114,32,78,111,110,101,32,105,102,32,
+    110,111,116,32,102,111,117,110,100,46,70,114,58,0,0,0,
+    114,56,0,0,0,114,29,0,0,0,114,179,0,0,0,122,
+    9,116,114,121,105,110,103,32,123,125,90,9,118,101,114,98,
+    111,115,105,116,121,78,122,25,112,111,115,115,105,98,108,101,
+    32,110,97,109,101,115,112,97,99,101,32,102,111,114,32,123,
+    125,114,87,0,0,0,41,22,114,32,0,0,0,114,39,0,
+    0,0,114,35,0,0,0,114,3,0,0,0,114,45,0,0,
+    0,114,213,0,0,0,114,40,0,0,0,114,4,1,0,0,
+    218,11,95,102,105,108,108,95,99,97,99,104,101,114,6,0,
+    0,0,114,7,1,0,0,114,88,0,0,0,114,6,1,0,
+    0,114,28,0,0,0,114,3,1,0,0,114,44,0,0,0,
+    114,1,1,0,0,114,46,0,0,0,114,114,0,0,0,114,
+    129,0,0,0,114,154,0,0,0,114,150,0,0,0,41,14,
+    114,100,0,0,0,114,119,0,0,0,114,174,0,0,0,90,
+    12,105,115,95,110,97,109,101,115,112,97,99,101,90,11,116,
+    97,105,108,95,109,111,100,117,108,101,114,126,0,0,0,90,
+    5,99,97,99,104,101,90,12,99,97,99,104,101,95,109,111,
+    100,117,108,101,90,9,98,97,115,101,95,112,97,116,104,114,
+    219,0,0,0,114,159,0,0,0,90,13,105,110,105,116,95,
+    102,105,108,101,110,97,109,101,90,9,102,117,108,108,95,112,
+    97,116,104,114,158,0,0,0,114,4,0,0,0,114,4,0,
+    0,0,114,5,0,0,0,114,175,0,0,0,194,4,0,0,
+    115,70,0,0,0,0,3,4,1,14,1,2,1,24,1,14,
+    1,10,1,10,1,8,1,6,2,6,1,6,1,10,2,6,
+    1,4,2,8,1,12,1,16,1,8,1,10,1,8,1,24,
+    4,8,2,16,1,16,1,18,1,12,1,8,1,10,1,12,
+    1,6,1,12,1,12,1,8,1,4,1,122,20,70,105,108,
+    101,70,105,110,100,101,114,46,102,105,110,100,95,115,112,101,
+    99,99,1,0,0,0,0,0,0,0,9,0,0,0,14,0,
+    0,0,67,0,0,0,115,194,0,0,0,124,0,106,0,125,
+    1,121,22,116,1,160,2,124,1,112,22,116,1,160,3,161,
+    0,161,1,125,2,87,0,110,30,4,0,116,4,116,5,116,
+    6,102,3,107,10,114,58,1,0,1,0,1,0,103,0,125,
+    2,89,0,110,2,88,0,116,7,106,8,160,9,100,1,161,
+    1,115,84,116,10,124,2,131,1,124,0,95,11,110,78,116,
+    10,131,0,125,3,120,64,124,2,68,0,93,56,125,4,124,
+    4,160,12,100,2,161,1,92,3,125,5,125,6,125,7,124,
+    6,114,138,100,3,160,13,124,5,124,7,160,14,161,0,161,
+    2,125,8,110,4,124,5,125,8,124,3,160,15,124,8,161,
+    1,1,0,113,96,87,0,124,3,124,0,95,11,116,7,106,
+    8,160,9,116,16,161,1,114,190,100,4,100,5,132,0,124,
+    2,68,0,131,1,124,0,95,17,100,6,83,0,41,7,122,
+    68,70,105,108,108,32,116,104,101,32,99,97,99,104,101,32,
+    111,102,32,112,111,116,101,110,116,105,97,108,32,109,111,100,
+    117,108,101,115,32,97,110,100,32,112,97,99,107,97,103,101,
+    115,32,102,111,114,32,116,104,105,115,32,100,105,114,101,99,
+    116,111,114,121,46,114,0,0,0,0,114,58,0,0,0,122,
+    5,123,125,46,123,125,99,1,0,0,0,0,0,0,0,2,
+    0,0,0,4,0,0,0,83,0,0,0,115,20,0,0,0,
+    104,0,124,0,93,12,125,1,124,1,160,0,161,0,146,2,
+    113,4,83,0,114,4,0,0,0,41,1,114,88,0,0,0,
+    41,2,114,22,0,0,0,90,2,102,110,114,4,0,0,0,
+    114,4,0,0,0,114,5,0,0,0,250,9,60,115,101,116,
+    99,111,109,112,62,13,5,0,0,115,2,0,0,0,6,0,
+    122,41,70,105,108,101,70,105,110,100,101,114,46,95,102,105,
+    108,108,95,99,97,99,104,101,46,60,108,111,99,97,108,115,
+    62,46,60,115,101,116,99,111,109,112,62,78,41,18,114,35,
+    0,0,0,114,3,0,0,0,90,7,108,105,115,116,100,105,
+    114,114,45,0,0,0,114,252,0,0,0,218,15,80,101,114,
+    109,105,115,115,105,111,110,69,114,114,111,114,218,18,78,111,
+    116,65,68,105,114,101,99,116,111,114,121,69,114,114,111,114,
+    114,7,0,0,0,114,8,0,0,0,114,9,0,0,0,114,
+    5,1,0,0,114,6,1,0,0,114,83,0,0,0,114,47,
+    0,0,0,114,88,0,0,0,218,3,97,100,100,114,10,0,
+    0,0,114,7,1,0,0,41,9,114,100,0,0,0,114,35,
+    0,0,0,90,8,99,111,110,116,101,110,116,115,90,21,108,
+    111,119,101,114,95,115,117,102,102,105,120,95,99,111,110,116,
+    101,110,116,115,114,241,0,0,0,114,98,0,0,0,114,231,
+    0,0,0,114,219,0,0,0,90,8,110,101,119,95,110,97,
+    109,101,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
+    0,114,9,1,0,0,240,4,0,0,115,34,0,0,0,0,
+    2,6,1,2,1,22,1,20,3,10,3,12,1,12,7,6,
+    1,10,1,16,1,4,1,18,2,4,1,14,1,6,1,12,
+    1,122,22,70,105,108,101,70,105,110,100,101,114,46,95,102,
+    105,108,108,95,99,97,99,104,101,99,1,0,0,0,0,0,
+    0,0,3,0,0,0,3,0,0,0,7,0,0,0,115,18,
+    0,0,0,135,0,135,1,102,2,100,1,100,2,134,0,125,
+    2,124,2,83,0,41,3,97,20,1,0,0,65,32,99,108,
+    97,115,115,32,109,101,116,104,111,100,32,119,104,105,99,104,
+    32,114,101,116,117,114,110,115,32,97,32,99,108,111,115,117,
+    114,101,32,116,111,32,117,115,101,32,111,110,32,115,121,115,
+    46,112,97,116,104,95,104,111,111,107,10,32,32,32,32,32,
+    32,32,32,119,104,105,99,104,32,119,105,108,108,32,114,101,
+    116,117,114,110,32,97,110,32,105,110,115,116,97,110,99,101,
+    32,117,115,105,110,103,32,116,104,101,32,115,112,101,99,105,
+    102,105,101,100,32,108,111,97,100,101,114,115,32,97,110,100,
+    32,116,104,101,32,112,97,116,104,10,32,32,32,32,32,32,
+    32,32,99,97,108,108,101,100,32,111,110,32,116,104,101,32,
+    99,108,111,115,117,114,101,46,10,10,32,32,32,32,32,32,
+    32,32,73,102,32,116,104,101,32,112,97,116,104,32,99,97,
+    108,108,101,100,32,111,110,32,116,104,101,32,99,108,111,115,
+    117,114,101,32,105,115,32,110,111,116,32,97,32,100,105,114,
+    101,99,116,111,114,121,44,32,73,109,112,111,114,116,69,114,
+    114,111,114,32,105,115,10,32,32,32,32,32,32,32,32,114,
+    97,105,115,101,100,46,10,10,32,32,32,32,32,32,32,32,
+    99,1,0,0,0,0,0,0,0,1,0,0,0,4,0,0,
+    0,19,0,0,0,115,32,0,0,0,116,0,124,0,131,1,
+    115,22,116,1,100,1,100,2,124,0,144,1,131,1,130,1,
+    136,0,124,0,136,1,140,1,83,0,41,3,122,45,80,97,
+    116,104,32,104,111,111,107,32,102,111,114,32,105,109,112,111,
+    114,116,108,105,98,46,109,97,99,104,105,110,101,114,121,46,
+    70,105,108,101,70,105,110,100,101,114,46,122,30,111,110,108,
+    121,32,100,105,114,101,99,116,111,114,105,101,115,32,97,114,
+    101,32,115,117,112,112,111,114,116,101,100,114,35,0,0,0,
+    41,2,114,46,0,0,0,114,99,0,0,0,41,1,114,35,
+    0,0,0,41,2,114,164,0,0,0,114,8,1,0,0,114,
+    4,0,0,0,114,5,0,0,0,218,24,112,97,116,104,95,
+    104,111,111,107,95,102,111,114,95,70,105,108,101,70,105,110,
+    100,101,114,25,5,0,0,115,6,0,0,0,0,2,8,1,
+    14,1,122,54,70,105,108,101,70,105,110,100,101,114,46,112,
+    97,116,104,95,104,111,111,107,46,60,108,111,99,97,108,115,
+    62,46,112,97,116,104,95,104,111,111,107,95,102,111,114,95,
+    70,105,108,101,70,105,110,100,101,114,114,4,0,0,0,41,
+    3,114,164,0,0,0,114,8,1,0,0,114,14,1,0,0,
+    114,4,0,0,0,41,2,114,164,0,0,0,114,8,1,0,
+    0,114,5,0,0,0,218,9,112,97,116,104,95,104,111,111,
+    107,15,5,0,0,115,4,0,0,0,0,10,14,6,122,20,
+    70,105,108,101,70,105,110,100,101,114,46,112,97,116,104,95,
+    104,111,111,107,99,1,0,0,0,0,0,0,0,1,0,0,
+    0,3,0,0,0,67,0,0,0,115,12,0,0,0,100,1,
+    160,0,124,0,106,1,161,1,83,0,41,2,78,122,16,70,
+    105,108,101,70,105,110,100,101,114,40,123,33,114,125,41,41,
+    2,114,47,0,0,0,114,35,0,0,0,41,1,114,100,0,
+    0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
+    0,114,240,0,0,0,33,5,0,0,115,2,0,0,0,0,
+    1,122,19,70,105,108,101,70,105,110,100,101,114,46,95,95,
+    114,101,112,114,95,95,41,15,114,105,0,0,0,114,104,0,
+    0,0,114,106,0,0,0,114,107,0,0,0,114,179,0,0,
+    0,114,246,0,0,0,114,123,0,0,0,114,176,0,0,0,
+    114,117,0,0,0,114,1,1,0,0,114,175,0,0,0,114,
+    9,1,0,0,114,177,0,0,0,114,15,1,0,0,114,240,
+    0,0,0,114,4,0,0,0,114,4,0,0,0,114,4,0,
+    0,0,114,5,0,0,0,114,2,1,0,0,148,4,0,0,
+    115,20,0,0,0,8,7,4,2,8,14,8,4,4,2,8,
+    12,8,5,10,46,8,31,12,18,114,2,1,0,0,99,4,
+    0,0,0,0,0,0,0,6,0,0,0,11,0,0,0,67,
+    0,0,0,115,148,0,0,0,124,0,160,0,100,1,161,1,
+    125,4,124,0,160,0,100,2,161,1,125,5,124,4,115,66,
+    124,5,114,36,124,5,106,1,125,4,110,30,124,2,124,3,
+    107,2,114,56,116,2,124,1,124,2,131,2,125,4,110,10,
+    116,3,124,1,124,2,131,2,125,4,124,5,115,86,116,4,
+    124,1,124,2,100,3,124,4,144,1,131,2,125,5,121,36,
+    124,5,124,0,100,2,60,0,124,4,124,0,100,1,60,0,
+    124,2,124,0,100,4,60,0,124,3,124,0,100,5,60,0,
+    87,0,110,20,4,0,116,5,107,10,114,142,1,0,1,0,
+    1,0,89,0,110,2,88,0,100,0,83,0,41,6,78,218,
+    10,95,95,108,111,97,100,101,114,95,95,218,8,95,95,115,
+    112,101,99,95,95,114,120,0,0,0,90,8,95,95,102,105,
+    108,101,95,95,90,10,95,95,99,97,99,104,101,100,95,95,
+    41,6,218,3,103,101,116,114,120,0,0,0,114,217,0,0,
+    0,114,212,0,0,0,114,161,0,0,0,218,9,69,120,99,
+    101,112,116,105,111,110,41,6,90,2,110,115,114,98,0,0,
+    0,90,8,112,97,116,104,110,97,109,101,90,9,99,112,97,
+    116,104,110,97,109,101,114,120,0,0,0,114,158,0,0,0,
+    114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,218,
+    14,95,102,105,120,95,117,112,95,109,111,100,117,108,101,39,
+    5,0,0,115,34,0,0,0,0,2,10,1,10,1,4,1,
+    4,1,8,1,8,1,12,2,10,1,4,1,16,1,2,1,
+    8,1,8,1,8,1,12,1,14,2,114,20,1,0,0,99,
+    0,0,0,0,0,0,0,0,3,0,0,0,3,0,0,0,
+    67,0,0,0,115,38,0,0,0,116,0,116,1,160,2,161,
+    0,102,2,125,0,116,3,116,4,102,2,125,1,116,5,116,
+    6,102,2,125,2,124,0,124,1,124,2,103,3,83,0,41,
+    1,122,95,82,101,116,117,114,110,115,32,97,32,108,105,115,
+    116,32,111,102,32,102,105,108,101,45,98,97,115,101,100,32,
+    109,111,100,117,108,101,32,108,111,97,100,101,114,115,46,10,
+    10,32,32,32,32,69,97,99,104,32,105,116,101,109,32,105,
+    115,32,97,32,116,117,112,108,101,32,40,108,111,97,100,101,
+    114,44,32,115,117,102,102,105,120,101,115,41,46,10,32,32,
+    32,32,41,7,114,218,0,0,0,114,139,0,0,0,218,18,
+    101,120,116,101,110,115,105,111,110,95,115,117,102,102,105,120,
+    101,115,114,212,0,0,0,114,84,0,0,0,114,217,0,0,
+    0,114,74,0,0,0,41,3,90,10,101,120,116,101,110,115,
+    105,111,110,115,90,6,115,111,117,114,99,101,90,8,98,121,
+    116,101,99,111,100,101,114,4,0,0,0,114,4,0,0,0,
+    114,5,0,0,0,114,155,0,0,0,62,5,0,0,115,8,
+    0,0,0,0,5,12,1,8,1,8,1,114,155,0,0,0,
+    99,1,0,0,0,0,0,0,0,12,0,0,0,12,0,0,
+    0,67,0,0,0,115,188,1,0,0,124,0,97,0,116,0,
+    106,1,97,1,116,0,106,2,97,2,116,1,106,3,116,4,
+    25,0,125,1,120,56,100,26,68,0,93,48,125,2,124,2,
+    116,1,106,3,107,7,114,58,116,0,160,5,124,2,161,1,
+    125,3,110,10,116,1,106,3,124,2,25,0,125,3,116,6,
+    124,1,124,2,124,3,131,3,1,0,113,32,87,0,100,5,
+    100,6,103,1,102,2,100,7,100,8,100,6,103,2,102,2,
+    102,2,125,4,120,118,124,4,68,0,93,102,92,2,125,5,
+    125,6,116,7,100,9,100,10,132,0,124,6,68,0,131,1,
+    131,1,115,142,116,8,130,1,124,6,100,11,25,0,125,7,
+    124,5,116,1,106,3,107,6,114,174,116,1,106,3,124,5,
+    25,0,125,8,80,0,113,112,121,16,116,0,160,5,124,5,
+    161,1,125,8,80,0,87,0,113,112,4,0,116,9,107,10,
+    114,212,1,0,1,0,1,0,119,112,89,0,113,112,88,0,
+    113,112,87,0,116,9,100,12,131,1,130,1,116,6,124,1,
+    100,13,124,8,131,3,1,0,116,6,124,1,100,14,124,7,
+    131,3,1,0,116,6,124,1,100,15,100,16,160,10,124,6,
+    161,1,131,3,1,0,121,14,116,0,160,5,100,17,161,1,
+    125,9,87,0,110,26,4,0,116,9,107,10,144,1,114,52,
+    1,0,1,0,1,0,100,18,125,9,89,0,110,2,88,0,
+    116,6,124,1,100,17,124,9,131,3,1,0,116,0,160,5,
+    100,19,161,1,125,10,116,6,124,1,100,19,124,10,131,3,
+    1,0,124,5,100,7,107,2,144,1,114,120,116,0,160,5,
+    100,20,161,1,125,11,116,6,124,1,100,21,124,11,131,3,
+    1,0,116,6,124,1,100,22,116,11,131,0,131,3,1,0,
+    116,12,160,13,116,2,160,14,161,0,161,1,1,0,124,5,
+    100,7,107,2,144,1,114,184,116,15,160,16,100,23,161,1,
+    1,0,100,24,116,12,107,6,144,1,114,184,100,25,116,17,
+    95,18,100,18,83,0,41,27,122,205,83,101,116,117,112,32,
+    116,104,101,32,112,97,116,104,45,98,97,115,101,100,32,105,
+    109,112,111,114,116,101,114,115,32,102,111,114,32,105,109,112,
+    111,114,116,108,105,98,32,98,121,32,105,109,112,111,114,116,
+    105,110,103,32,110,101,101,100,101,100,10,32,32,32,32,98,
+    117,105,108,116,45,105,110,32,109,111,100,117,108,101,115,32,
+    97,110,100,32,105,110,106,101,99,116,105,110,103,32,116,104,
+    101,109,32,105,110,116,111,32,116,104,101,32,103,108,111,98,
+    97,108,32,110,97,109,101,115,112,97,99,101,46,10,10,32,
+    32,32,32,79,116,104,101,114,32,99,111,109,112,111,110,101,
+    110,116,115,32,97,114,101,32,101,120,116,114,97,99,116,101,
+    100,32,102,114,111,109,32,116,104,101,32,99,111,114,101,32,
+    98,111,111,116,115,116,114,97,112,32,109,111,100,117,108,101,
+    46,10,10,32,32,32,32,114,49,0,0,0,114,60,0,0,
+    0,218,8,98,117,105,108,116,105,110,115,114,136,0,0,0,
+    90,5,112,111,115,105,120,250,1,47,218,2,110,116,250,1,
+    92,99,1,0,0,0,0,0,0,0,2,0,0,0,3,0,
+    0,0,115,0,0,0,115,26,0,0,0,124,0,93,18,125,
+    1,116,0,124,1,131,1,100,0,107,2,86,0,1,0,113,
+    2,100,1,83,0,41,2,114,29,0,0,0,78,41,1,114,
+    31,0,0,0,41,2,114,22,0,0,0,114,77,0,0,0,
+    114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,
+    221,0,0,0,98,5,0,0,115,2,0,0,0,4,0,122,
+    25,95,115,101,116,117,112,46,60,108,111,99,97,108,115,62,
+    46,60,103,101,110,101,120,112,114,62,114,59,0,0,0,122,
+    30,105,109,112,111,114,116,108,105,98,32,114,101,113,117,105,
+    114,101,115,32,112,111,115,105,120,32,111,114,32,110,116,114,
+    3,0,0,0,114,25,0,0,0,114,21,0,0,0,114,30,
+    0,0,0,90,7,95,116,104,114,101,97,100,78,90,8,95,
+    119,101,97,107,114,101,102,90,6,119,105,110,114,101,103,114,
+    163,0,0,0,114,6,0,0,0,122,4,46,112,121,119,122,
+    6,95,100,46,112,121,100,84,41,4,122,3,95,105,111,122,
+    9,95,119,97,114,110,105,110,103,115,122,8,98,117,105,108,
+    116,105,110,115,122,7,109,97,114,115,104,97,108,41,19,114,
+    114,0,0,0,114,7,0,0,0,114,139,0,0,0,114,233,
+    0,0,0,114,105,0,0,0,90,18,95,98,117,105,108,116,
+    105,110,95,102,114,111,109,95,110,97,109,101,114,109,0,0,
+    0,218,3,97,108,108,218,14,65,115,115,101,114,116,105,111,
+    110,69,114,114,111,114,114,99,0,0,0,114,26,0,0,0,
+    114,11,0,0,0,114,223,0,0,0,114,143,0,0,0,114,
+    21,1,0,0,114,84,0,0,0,114,157,0,0,0,114,162,
+    0,0,0,114,167,0,0,0,41,12,218,17,95,98,111,111,
+    116,115,116,114,97,112,95,109,111,100,117,108,101,90,11,115,
+    101,108,102,95,109,111,100,117,108,101,90,12,98,117,105,108,
+    116,105,110,95,110,97,109,101,90,14,98,117,105,108,116,105,
+    110,95,109,111,100,117,108,101,90,10,111,115,95,100,101,116,
+    97,105,108,115,90,10,98,117,105,108,116,105,110,95,111,115,
+    114,21,0,0,0,114,25,0,0,0,90,9,111,115,95,109,
+    111,100,117,108,101,90,13,116,104,114,101,97,100,95,109,111,
+    100,117,108,101,90,14,119,101,97,107,114,101,102,95,109,111,
+    100,117,108,101,90,13,119,105,110,114,101,103,95,109,111,100,
+    117,108,101,114,4,0,0,0,114,4,0,0,0,114,5,0,
+    0,0,218,6,95,115,101,116,117,112,73,5,0,0,115,82,
+    0,0,0,0,8,4,1,6,1,6,3,10,1,10,1,10,
+    1,12,2,10,1,16,3,22,1,14,2,22,1,8,1,10,
+    1,10,1,4,2,2,1,10,1,6,1,14,1,12,2,8,
+    1,12,1,12,1,18,3,2,1,14,1,16,2,10,1,12,
+    3,10,1,12,3,10,1,10,1,12,3,14,1,14,1,10,
+    1,10,1,10,1,114,29,1,0,0,99,1,0,0,0,0,
+    0,0,0,2,0,0,0,4,0,0,0,67,0,0,0,115,
+    84,0,0,0,116,0,124,0,131,1,1,0,116,1,131,0,
+    125,1,116,2,106,3,160,4,116,5,106,6,124,1,140,0,
+    103,1,161,1,1,0,116,7,106,8,100,1,107,2,114,56,
+    116,2,106,9,160,10,116,11,161,1,1,0,116,2,106,9,
+    160,10,116,12,161,1,1,0,116,5,124,0,95,5,116,13,
+    124,0,95,13,100,2,83,0,41,3,122,41,73,110,115,116,
+    97,108,108,32,116,104,101,32,112,97,116,104,45,98,97,115,
+    101,100,32,105,109,112,111,114,116,32,99,111,109,112,111,110,
+    101,110,116,115,46,114,24,1,0,0,78,41,14,114,29,1,
+    0,0,114,155,0,0,0,114,7,0,0,0,114,250,0,0,
+    0,114,143,0,0,0,114,2,1,0,0,114,15,1,0,0,
+    114,3,0,0,0,114,105,0,0,0,218,9,109,101,116,97,
+    95,112,97,116,104,114,157,0,0,0,114,162,0,0,0,114,
+    245,0,0,0,114,212,0,0,0,41,2,114,28,1,0,0,
+    90,17,115,117,112,112,111,114,116,101,100,95,108,111,97,100,
+    101,114,115,114,4,0,0,0,114,4,0,0,0,114,5,0,
+    0,0,218,8,95,105,110,115,116,97,108,108,141,5,0,0,
+    115,16,0,0,0,0,2,8,1,6,1,20,1,10,1,12,
+    1,12,4,6,1,114,31,1,0,0,41,3,122,3,119,105,
+    110,114,1,0,0,0,114,2,0,0,0,41,56,114,107,0,
+    0,0,114,10,0,0,0,114,11,0,0,0,114,17,0,0,
+    0,114,19,0,0,0,114,28,0,0,0,114,38,0,0,0,
+    114,39,0,0,0,114,43,0,0,0,114,44,0,0,0,114,
+    46,0,0,0,114,55,0,0,0,218,4,116,121,112,101,218,
+    8,95,95,99,111,100,101,95,95,114,138,0,0,0,114,15,
+    0,0,0,114,128,0,0,0,114,14,0,0,0,114,18,0,
+    0,0,90,17,95,82,65,87,95,77,65,71,73,67,95,78,
+    85,77,66,69,82,114,73,0,0,0,114,72,0,0,0,114,
+    84,0,0,0,114,74,0,0,0,90,23,68,69,66,85,71,
+    95,66,89,84,69,67,79,68,69,95,83,85,70,70,73,88,
+    69,83,90,27,79,80,84,73,77,73,90,69,68,95,66,89,
+    84,69,67,79,68,69,95,83,85,70,70,73,88,69,83,114,
+    79,0,0,0,114,85,0,0,0,114,91,0,0,0,114,95,
+    0,0,0,114,97,0,0,0,114,116,0,0,0,114,123,0,
+    0,0,114,135,0,0,0,114,141,0,0,0,114,144,0,0,
+    0,114,149,0,0,0,218,6,111,98,106,101,99,116,114,156,
+    0,0,0,114,161,0,0,0,114,162,0,0,0,114,178,0,
+    0,0,114,188,0,0,0,114,204,0,0,0,114,212,0,0,
+    0,114,217,0,0,0,114,223,0,0,0,114,218,0,0,0,
+    114,224,0,0,0,114,243,0,0,0,114,245,0,0,0,114,
+    2,1,0,0,114,20,1,0,0,114,155,0,0,0,114,29,
+    1,0,0,114,31,1,0,0,114,4,0,0,0,114,4,0,
+    0,0,114,4,0,0,0,114,5,0,0,0,218,8,60,109,
+    111,100,117,108,101,62,8,0,0,0,115,102,0,0,0,4,
+    17,4,3,8,12,8,5,8,5,8,6,8,12,8,10,8,
+    9,8,5,8,7,10,22,10,117,16,1,12,2,4,1,4,
+    2,6,2,6,2,8,2,16,44,8,33,8,19,8,12,8,
+    12,8,28,8,17,14,55,14,12,12,10,8,14,6,3,8,
+    1,12,65,14,64,14,29,16,110,14,41,18,45,18,16,4,
+    3,18,53,14,60,14,42,14,127,0,7,14,127,0,20,10,
+    23,8,11,8,68,
 };
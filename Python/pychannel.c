@@ -0,0 +1,455 @@
+/* Channels: passing buffers between interpreters without copying.
+   See Include/pychannel.h. */
+
+#include "Python.h"
+
+#ifdef WITH_THREAD
+
+#include "pythread.h"
+
+/* Quick overview:
+
+   Channels live in a process-wide registry, a linked list searched by id,
+   so that they don't belong to the interpreter which created them.  The
+   registry and the channels are only touched with the registry lock held:
+   the GIL in the default build, a _PyLock when Python is built without it.
+   The lock is never held while creating or releasing Python objects.
+
+   A buffer in transit is a Py_buffer, which holds a reference to the
+   object which exported it.  The receiver moves it into a channel_buffer
+   object, whose dealloc releases it, and returns a memoryview of that.  The
+   exporter is only released through its own type, which interpreters
+   share, so it doesn't matter which interpreter drops the last view.
+
+   A receiver which finds the channel empty waits like a thread calling
+   queue.SimpleQueue.get() (see Modules/_queuemodule.c): it links a waiter,
+   allocated on its own stack, and blocks on the lock of the waiter.  send
+   hands its buffer directly to the first waiter, and close wakes all of
+   them up without a buffer.
+
+   A closed channel is unlinked and freed as soon as it is empty.  Ids are
+   never reused, so an id lower than next_id which isn't in the registry
+   belongs to a channel which was closed and drained. */
+
+typedef struct chanitem {
+    struct chanitem *next;
+    Py_buffer view;
+} chanitem;
+
+typedef struct chanwaiter {
+    struct chanwaiter *next;
+    _PyThread_lock lock;        /* Held until the waiter is woken up */
+    chanitem *item;             /* The buffer handed over, or NULL */
+    int done;                   /* Woken up, with a buffer or by close */
+} chanwaiter;
+
+typedef struct channel {
+    struct channel *next;
+    Py_ssize_t id;
+    int closed;
+    chanitem *first;
+    chanitem *last;
+    chanwaiter *waiters_head;
+    chanwaiter *waiters_tail;
+} channel;
+
+static channel *channels = NULL;
+static Py_ssize_t next_id = 1;
+
+#ifdef WITHOUT_GIL
+static _PyLock channels_lock = _PyLock_INIT;
+#define CHANNELS_LOCK() _PyLock_Acquire(&channels_lock)
+#define CHANNELS_UNLOCK() _PyLock_Release(&channels_lock)
+#else
+#define CHANNELS_LOCK() ((void)0)
+#define CHANNELS_UNLOCK() ((void)0)
+#endif
+
+/* Return the channel with the given id, or NULL.  Called with the registry
+   lock held. */
+static channel *
+channel_find(Py_ssize_t id)
+{
+    channel *ch;
+
+    for (ch = channels; ch != NULL; ch = ch->next) {
+        if (ch->id == id)
+            return ch;
+    }
+    return NULL;
+}
+
+/* Unlink and free a closed, empty channel with no waiters.  Called with
+   the registry lock held. */
+static void
+channel_remove(channel *ch)
+{
+    channel **link = &channels;
+
+    assert(ch->closed && ch->first == NULL && ch->waiters_head == NULL);
+    while (*link != ch)
+        link = &(*link)->next;
+    *link = ch->next;
+    PyMem_RawFree(ch);
+}
+
+/* Raise the error for an id which doesn't name an open channel.  closed
+   tells whether it named one, computed with the registry lock held. */
+static void
+channel_error(Py_ssize_t id, int closed)
+{
+    if (closed)
+        PyErr_Format(PyExc_ValueError, "channel %zd is closed", id);
+    else
+        PyErr_Format(PyExc_ValueError, "no channel with id %zd", id);
+}
+
+/* Give item to the first waiter, or queue it at the back (or front) of the
+   channel.  Called with the registry lock held. */
+static void
+channel_deliver(channel *ch, chanitem *item, int front)
+{
+    chanwaiter *w = ch->waiters_head;
+
+    if (w != NULL) {
+        assert(ch->first == NULL);
+        ch->waiters_head = w->next;
+        if (ch->waiters_head == NULL)
+            ch->waiters_tail = NULL;
+        w->item = item;
+        w->done = 1;
+        _PyThread_lock_release(&w->lock);
+    }
+    else if (front) {
+        item->next = ch->first;
+        ch->first = item;
+        if (ch->last == NULL)
+            ch->last = item;
+    }
+    else {
+        item->next = NULL;
+        if (ch->last != NULL)
+            ch->last->next = item;
+        else
+            ch->first = item;
+        ch->last = item;
+    }
+}
+
+/* Take the oldest buffer of a non-empty channel, and free the channel if
+   it was closed and is now empty.  Called with the registry lock held. */
+static chanitem *
+channel_pop(channel *ch)
+{
+    chanitem *item = ch->first;
+
+    ch->first = item->next;
+    if (ch->first == NULL) {
+        ch->last = NULL;
+        if (ch->closed)
+            channel_remove(ch);
+    }
+    return item;
+}
+
+/* Stop waiting: unlink w, unless it was woken up meanwhile.  Return the
+   buffer handed to it, or NULL.  The channel can't have been freed while
+   w was linked: close wakes up all the waiters. */
+static chanitem *
+channel_cancel_wait(channel *ch, chanwaiter *w)
+{
+    chanitem *item;
+
+    CHANNELS_LOCK();
+    item = w->item;
+    if (!w->done) {
+        chanwaiter **link = &ch->waiters_head, *prev = NULL;
+        while (*link != w) {
+            prev = *link;
+            link = &prev->next;
+        }
+        *link = w->next;
+        if (ch->waiters_tail == w)
+            ch->waiters_tail = prev;
+    }
+    CHANNELS_UNLOCK();
+    return item;
+}
+
+static void
+chanitem_free(chanitem *item)
+{
+    PyBuffer_Release(&item->view);
+    PyMem_RawFree(item);
+}
+
+
+/* channel_buffer objects own the buffers received */
+
+typedef struct {
+    PyObject_HEAD
+    Py_buffer view;
+} channelbufferobject;
+
+static int
+channelbuffer_getbuffer(channelbufferobject *self, Py_buffer *view,
+                        int flags)
+{
+    return PyBuffer_FillInfo(view, (PyObject *)self, self->view.buf,
+                             self->view.len, 1, flags);
+}
+
+static void
+channelbuffer_dealloc(channelbufferobject *self)
+{
+    PyBuffer_Release(&self->view);
+    PyObject_Del(self);
+}
+
+static PyBufferProcs channelbuffer_as_buffer = {
+    (getbufferproc)channelbuffer_getbuffer,
+    NULL,
+};
+
+PyTypeObject _PyChannelBuffer_Type = {
+    PyVarObject_HEAD_INIT(&PyType_Type, 0)
+    "channel_buffer",                           /* tp_name */
+    sizeof(channelbufferobject),                /* tp_basicsize */
+    0,                                          /* tp_itemsize */
+    (destructor)channelbuffer_dealloc,          /* tp_dealloc */
+    0,                                          /* tp_print */
+    0,                                          /* tp_getattr */
+    0,                                          /* tp_setattr */
+    0,                                          /* tp_reserved */
+    0,                                          /* tp_repr */
+    0,                                          /* tp_as_number */
+    0,                                          /* tp_as_sequence */
+    0,                                          /* tp_as_mapping */
+    0,                                          /* tp_hash */
+    0,                                          /* tp_call */
+    0,                                          /* tp_str */
+    0,                                          /* tp_getattro */
+    0,                                          /* tp_setattro */
+    &channelbuffer_as_buffer,                   /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+    0,                                          /* tp_doc */
+};
+
+/* Turn a received buffer into a read-only memoryview.  Consumes item. */
+static PyObject *
+channel_wrap(chanitem *item)
+{
+    channelbufferobject *b;
+    PyObject *view;
+
+    b = PyObject_New(channelbufferobject, &_PyChannelBuffer_Type);
+    if (b == NULL) {
+        chanitem_free(item);
+        return NULL;
+    }
+    b->view = item->view;
+    PyMem_RawFree(item);
+    view = PyMemoryView_FromObject((PyObject *)b);
+    Py_DECREF(b);
+    return view;
+}
+
+
+Py_ssize_t
+_PyChannel_Create(void)
+{
+    channel *ch;
+    Py_ssize_t id;
+
+    ch = PyMem_RawCalloc(1, sizeof(channel));
+    if (ch == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    CHANNELS_LOCK();
+    id = ch->id = next_id++;
+    ch->next = channels;
+    channels = ch;
+    CHANNELS_UNLOCK();
+    return id;
+}
+
+int
+_PyChannel_Send(Py_ssize_t id, PyObject *obj)
+{
+    channel *ch;
+    chanitem *item;
+    int closed;
+
+    item = PyMem_RawMalloc(sizeof(chanitem));
+    if (item == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    if (PyObject_GetBuffer(obj, &item->view, PyBUF_SIMPLE) < 0) {
+        PyMem_RawFree(item);
+        return -1;
+    }
+    CHANNELS_LOCK();
+    ch = channel_find(id);
+    if (ch == NULL || ch->closed) {
+        closed = ch != NULL || (id > 0 && id < next_id);
+        CHANNELS_UNLOCK();
+        chanitem_free(item);
+        channel_error(id, closed);
+        return -1;
+    }
+    channel_deliver(ch, item, 0);
+    CHANNELS_UNLOCK();
+    return 0;
+}
+
+PyObject *
+_PyChannel_Recv(Py_ssize_t id, _PyTime_t timeout)
+{
+    channel *ch;
+    chanitem *item;
+    chanwaiter w;
+    PyLockStatus r;
+    _PyTime_t endtime = 0;
+    int closed;
+
+    CHANNELS_LOCK();
+    ch = channel_find(id);
+    if (ch == NULL) {
+        closed = id > 0 && id < next_id;
+        CHANNELS_UNLOCK();
+        if (closed)
+            PyErr_SetNone(PyExc_EOFError);
+        else
+            channel_error(id, 0);
+        return NULL;
+    }
+    if (ch->first != NULL) {
+        item = channel_pop(ch);
+        CHANNELS_UNLOCK();
+        return channel_wrap(item);
+    }
+    /* Closed channels are freed once empty */
+    assert(!ch->closed);
+    if (timeout == 0) {
+        CHANNELS_UNLOCK();
+        PyErr_SetString(PyExc_TimeoutError, "the channel is empty");
+        return NULL;
+    }
+    /* Initializing a futex lock doesn't allocate anything */
+    if (_PyThread_lock_init(&w.lock) < 0) {
+        CHANNELS_UNLOCK();
+        PyErr_SetString(PyExc_RuntimeError, "can't allocate lock");
+        return NULL;
+    }
+    _PyThread_lock_acquire_timed(&w.lock, -1, 0);
+    w.next = NULL;
+    w.item = NULL;
+    w.done = 0;
+    if (ch->waiters_tail != NULL)
+        ch->waiters_tail->next = &w;
+    else
+        ch->waiters_head = &w;
+    ch->waiters_tail = &w;
+    CHANNELS_UNLOCK();
+
+    if (timeout > 0)
+        endtime = _PyTime_GetMonotonicClock() + timeout;
+    for (;;) {
+        _PyTime_t microseconds;
+
+        if (timeout < 0)
+            microseconds = -1;
+        else
+            microseconds = _PyTime_AsMicroseconds(timeout,
+                                                  _PyTime_ROUND_CEILING);
+        Py_BEGIN_ALLOW_THREADS
+        r = _PyThread_lock_acquire_timed(&w.lock, microseconds, 1);
+        Py_END_ALLOW_THREADS
+        if (r == PY_LOCK_ACQUIRED) {
+            /* Woken up, and unlinked, by send or close */
+            item = w.item;
+            if (item == NULL)
+                PyErr_SetNone(PyExc_EOFError);
+            break;
+        }
+        if (r == PY_LOCK_INTR) {
+            /* Run signal handlers, and give up if they raise */
+            if (Py_MakePendingCalls() < 0) {
+                item = channel_cancel_wait(ch, &w);
+                if (item != NULL) {
+                    /* Too late: give it back, unless the channel was
+                       closed and freed meanwhile */
+                    CHANNELS_LOCK();
+                    ch = channel_find(id);
+                    if (ch != NULL) {
+                        channel_deliver(ch, item, 1);
+                        item = NULL;
+                    }
+                    CHANNELS_UNLOCK();
+                    if (item != NULL) {
+                        chanitem_free(item);
+                        item = NULL;
+                    }
+                }
+                break;
+            }
+            if (timeout < 0)
+                continue;
+            timeout = endtime - _PyTime_GetMonotonicClock();
+            if (timeout > 0)
+                continue;
+        }
+        /* Timed out */
+        item = channel_cancel_wait(ch, &w);
+        if (item == NULL) {
+            if (w.done)
+                PyErr_SetNone(PyExc_EOFError);
+            else
+                PyErr_SetString(PyExc_TimeoutError,
+                                "no buffer received in time");
+        }
+        break;
+    }
+    /* Unlock the lock so it's safe to free it: it is still held, unless
+       send or close released it after we stopped waiting */
+    _PyThread_lock_acquire_timed(&w.lock, 0, 0);
+    _PyThread_lock_release(&w.lock);
+    _PyThread_lock_fini(&w.lock);
+    if (item == NULL)
+        return NULL;
+    return channel_wrap(item);
+}
+
+int
+_PyChannel_Close(Py_ssize_t id)
+{
+    channel *ch;
+    chanwaiter *w;
+    int closed;
+
+    CHANNELS_LOCK();
+    ch = channel_find(id);
+    if (ch == NULL || ch->closed) {
+        closed = ch != NULL || (id > 0 && id < next_id);
+        CHANNELS_UNLOCK();
+        channel_error(id, closed);
+        return -1;
+    }
+    ch->closed = 1;
+    /* Waiters only wait on empty channels */
+    while ((w = ch->waiters_head) != NULL) {
+        ch->waiters_head = w->next;
+        w->item = NULL;
+        w->done = 1;
+        _PyThread_lock_release(&w->lock);
+    }
+    ch->waiters_tail = NULL;
+    if (ch->first == NULL)
+        channel_remove(ch);
+    CHANNELS_UNLOCK();
+    return 0;
+}
+
+#endif /* WITH_THREAD */
@@ -555,6 +555,12 @@ Py_FinalizeEx(void)
        after taking the GIL (in PyEval_RestoreThread()). */
     _Py_Finalizing = tstate;
     initialized = 0;
+#ifdef WITHOUT_GIL
+    /* Without the GIL, daemon threads would keep running alongside the
+       finalization.  Park them for good instead: the world is never
+       started again. */
+    _PyEval_StopTheWorld();
+#endif
 
     /* Flush sys.stdout and sys.stderr */
     if (flush_std_files() < 0) {
@@ -0,0 +1,77 @@
+/* Per-object locks, used when the interpreter is built without the global
+   interpreter lock.  See Include/pylock.h. */
+
+#include "Python.h"
+
+#ifdef WITHOUT_GIL
+
+#include "pythread.h"
+
+#ifdef HAVE_SCHED_H
+#include <sched.h>
+#endif
+
+/* Number of failed attempts to take a contended lock before the thread
+   detaches from the interpreter and yields its CPU */
+#define LOCK_SPIN_COUNT 100
+
+static void
+lock_backoff(void)
+{
+    PyThreadState *tstate = _PyThreadState_UncheckedGet();
+
+    /* The owner may be waiting for us to detach, for instance because it
+       wants to stop the world (see _PyEval_StopTheWorld()): detach while
+       we wait, so that it can make progress. */
+    if (tstate != NULL)
+        PyEval_SaveThread();
+#ifdef HAVE_SCHED_H
+    sched_yield();
+#endif
+    if (tstate != NULL)
+        PyEval_RestoreThread(tstate);
+}
+
+void
+_PyLock_Acquire(_PyLock *lock)
+{
+    long self = PyThread_get_thread_ident();
+    long expected;
+    int spin = 0;
+
+    if (__atomic_load_n(&lock->owner, __ATOMIC_RELAXED) == self) {
+        /* Recursive acquisition: only the owner writes depth */
+        lock->depth++;
+        return;
+    }
+    for (;;) {
+        expected = 0;
+        if (__atomic_compare_exchange_n(&lock->owner, &expected, self, 0,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            lock->depth = 1;
+            return;
+        }
+        if (++spin >= LOCK_SPIN_COUNT) {
+            lock_backoff();
+            spin = 0;
+        }
+    }
+}
+
+void
+_PyLock_Release(_PyLock *lock)
+{
+    assert(_PyLock_IsOwned(lock));
+    assert(lock->depth > 0);
+    if (--lock->depth == 0)
+        __atomic_store_n(&lock->owner, 0, __ATOMIC_RELEASE);
+}
+
+int
+_PyLock_IsOwned(_PyLock *lock)
+{
+    return (__atomic_load_n(&lock->owner, __ATOMIC_RELAXED)
+            == PyThread_get_thread_ident());
+}
+
+#endif /* WITHOUT_GIL */
@@ -5,8 +5,17 @@
 
 #define GET_TSTATE() \
     ((PyThreadState*)_Py_atomic_load_relaxed(&_PyThreadState_Current))
+#ifdef WITHOUT_GIL
+#define SET_TSTATE(value) \
+    do { \
+        _Py_ThreadId = (Py_uintptr_t)(value); \
+        _Py_atomic_store_relaxed(&_PyThreadState_Current, \
+                                 (Py_uintptr_t)(value)); \
+    } while (0)
+#else
 #define SET_TSTATE(value) \
     _Py_atomic_store_relaxed(&_PyThreadState_Current, (Py_uintptr_t)(value))
+#endif
 #define GET_INTERP_STATE() \
     (GET_TSTATE()->interp)
 
@@ -36,31 +45,257 @@ extern "C" {
 
 int _PyGILState_check_enabled = 1;
 
+/* The lists of interpreters and of their thread states.
+
+   Code which changes the lists (creating and deleting interpreter and
+   thread states) serializes on head_mutex.  Code which only walks them,
+   like sys._current_frames(), takes no lock: it brackets the walk with
+   READERS_ENTER() and READERS_EXIT(), and the links are published with
+   STORE_LINK() so that a reader only ever sees initialized states.
+
+   A reader can still be looking at a thread state after it has been
+   unlinked, so the memory of deleted thread states isn't freed right
+   away: they are put on the retired_tstates list (chained through their
+   prev field, which readers don't use), and the list is freed by the
+   next writer which sees no reader active.  A reader which starts after
+   that point can't reach a retired thread state any more.  Interpreter
+   states are rarely deleted: PyInterpreterState_Delete() just waits for
+   the readers to leave. */
+#ifdef HAVE_SCHED_H
+#include <sched.h>
+#endif
+
 #ifdef WITH_THREAD
 #include "pythread.h"
-static PyThread_type_lock head_mutex = NULL; /* Protects interp->tstate_head */
+static PyThread_type_lock head_mutex = NULL; /* Serializes list writers */
 #define HEAD_INIT() (void)(head_mutex || (head_mutex = PyThread_allocate_lock()))
 #define HEAD_LOCK() PyThread_acquire_lock(head_mutex, WAIT_LOCK)
 #define HEAD_UNLOCK() PyThread_release_lock(head_mutex)
 
+static long tstate_readers = 0;
+#define READERS_ENTER() \
+    do { \
+        __atomic_add_fetch(&tstate_readers, 1, __ATOMIC_SEQ_CST); \
+        __atomic_thread_fence(__ATOMIC_SEQ_CST); \
+    } while (0)
+#define READERS_EXIT() \
+    (void)__atomic_sub_fetch(&tstate_readers, 1, __ATOMIC_SEQ_CST)
+#define READERS_ACTIVE() \
+    (__atomic_thread_fence(__ATOMIC_SEQ_CST), \
+     __atomic_load_n(&tstate_readers, __ATOMIC_SEQ_CST) != 0)
+#define LOAD_LINK(link) __atomic_load_n(&(link), __ATOMIC_ACQUIRE)
+#define STORE_LINK(link, value) \
+    __atomic_store_n(&(link), (value), __ATOMIC_RELEASE)
+
+/* Protects the tls_slots arrays of the thread states and the free slot
+   numbers.  A spinlock: it is never held while running Python code. */
+static int tls_lock = 0;
+#ifdef HAVE_SCHED_H
+#define TLS_LOCK() \
+    while (__atomic_exchange_n(&tls_lock, 1, __ATOMIC_ACQUIRE)) \
+        sched_yield()
+#else
+#define TLS_LOCK() \
+    while (__atomic_exchange_n(&tls_lock, 1, __ATOMIC_ACQUIRE))
+#endif
+#define TLS_UNLOCK() __atomic_store_n(&tls_lock, 0, __ATOMIC_RELEASE)
+
 /* The single PyInterpreterState used by this process'
    GILState implementation
 */
 static PyInterpreterState *autoInterpreterState = NULL;
+
+/* The thread state of the current thread for the GILState API: a
+   thread-local variable where the compiler supports them, a TLS key
+   otherwise.  The variable of a thread can outlive the interpreter, so
+   it is only valid if it was set since the last _PyGILState_Init(). */
+#ifdef Py_THREAD_LOCAL
+static Py_THREAD_LOCAL PyThreadState *autoTstate = NULL;
+static Py_THREAD_LOCAL unsigned long autoTstateGeneration = 0;
+static unsigned long autoGeneration = 0;
+#define AUTO_TSTATE_GET() \
+    (autoTstateGeneration == autoGeneration ? autoTstate : NULL)
+#define AUTO_TSTATE_SET(value) \
+    (autoTstate = (value), autoTstateGeneration = autoGeneration, 0)
+#define AUTO_TSTATE_DELETE() (void)(autoTstate = NULL)
+#else
 static int autoTLSkey = -1;
+#define AUTO_TSTATE_GET() \
+    ((PyThreadState *)PyThread_get_key_value(autoTLSkey))
+#define AUTO_TSTATE_SET(value) \
+    PyThread_set_key_value(autoTLSkey, (void *)(value))
+#define AUTO_TSTATE_DELETE() PyThread_delete_key_value(autoTLSkey)
+#endif
 #else
 #define HEAD_INIT() /* Nothing */
 #define HEAD_LOCK() /* Nothing */
 #define HEAD_UNLOCK() /* Nothing */
+#define READERS_ENTER() /* Nothing */
+#define READERS_EXIT() /* Nothing */
+#define READERS_ACTIVE() 0
+#define LOAD_LINK(link) (link)
+#define STORE_LINK(link, value) ((link) = (value))
+#define TLS_LOCK() /* Nothing */
+#define TLS_UNLOCK() /* Nothing */
 #endif
 
 static PyInterpreterState *interp_head = NULL;
+static PyThreadState *retired_tstates = NULL; /* Protected by head_mutex */
 
 /* Assuming the current thread holds the GIL, this is the
    PyThreadState for the current thread. */
+#ifdef _Py_TSTATE_THREAD_LOCAL
+Py_THREAD_LOCAL _Py_atomic_address _PyThreadState_Current = {0};
+#else
 _Py_atomic_address _PyThreadState_Current = {0};
+#endif
+#ifdef WITHOUT_GIL
+/* The same, for the benefit of biased reference counting */
+Py_THREAD_LOCAL Py_uintptr_t _Py_ThreadId = 0;
+#endif
 PyThreadFrameGetter _PyThreadState_GetFrame = NULL;
 
+#ifdef WITHOUT_GIL
+/* Biased reference counting (see Include/object.h).
+
+   refcnt_merge_lock protects the merge queues of all the thread states, as
+   well as refcnt_merge_head, the list of live thread states which other
+   threads look objects' owners up in.  It is a spinlock: it is only held
+   for a few instructions, and never while running Python code. */
+#ifdef HAVE_SCHED_H
+#include <sched.h>
+#define REFCNT_MERGE_YIELD() sched_yield()
+#else
+#define REFCNT_MERGE_YIELD()
+#endif
+static int refcnt_merge_lock = 0;
+#define REFCNT_MERGE_LOCK() \
+    while (__atomic_exchange_n(&refcnt_merge_lock, 1, __ATOMIC_ACQUIRE)) \
+        REFCNT_MERGE_YIELD()
+#define REFCNT_MERGE_UNLOCK() \
+    __atomic_store_n(&refcnt_merge_lock, 0, __ATOMIC_RELEASE)
+
+static PyThreadState *refcnt_merge_head = NULL;
+
+/* Merge the reference counts of the objects of a queue taken from a thread
+   state, drop the references the queue held, and free it */
+static void
+merge_queued_refcnts(PyObject **queue, Py_ssize_t len)
+{
+    Py_ssize_t i;
+
+    for (i = 0; i < len; i++) {
+        if (_Py_ExplicitMergeRefCnt(queue[i], -1) == 0)
+            _Py_Dealloc(queue[i]);
+    }
+    PyMem_RawFree(queue);
+}
+
+/* Hand op, and the reference the caller dropped, to the thread that owns
+   it.  If that thread is gone, merge the reference counts right away. */
+void
+_PyThreadState_QueueRefCntMerge(PyObject *op)
+{
+    PyThreadState *owner, *p;
+    PyObject **queue;
+    Py_ssize_t allocated, refcnt;
+
+    owner = (PyThreadState *)__atomic_load_n(&op->ob_owner, __ATOMIC_RELAXED);
+    REFCNT_MERGE_LOCK();
+    for (p = refcnt_merge_head; p != NULL; p = p->refcnt_merge_next) {
+        if (p == owner)
+            break;
+    }
+    if (p != NULL) {
+        if (p->refcnt_merge_len == p->refcnt_merge_allocated) {
+            allocated = p->refcnt_merge_allocated * 2 + 16;
+            queue = (PyObject **)PyMem_RawRealloc(p->refcnt_merge_queue,
+                                                  allocated * sizeof(PyObject *));
+            if (queue == NULL) {
+                /* The object leaks, there is nothing better to do */
+                REFCNT_MERGE_UNLOCK();
+                return;
+            }
+            p->refcnt_merge_queue = queue;
+            p->refcnt_merge_allocated = allocated;
+        }
+        p->refcnt_merge_queue[p->refcnt_merge_len++] = op;
+        if (p->refcnt_merge_len == 1)
+            _PyEval_SignalRefCntMerge(p);
+        REFCNT_MERGE_UNLOCK();
+        return;
+    }
+    /* Holding the lock prevents a new thread state from reusing the
+       owner's address while we are at it */
+    refcnt = _Py_ExplicitMergeRefCnt(op, -1);
+    REFCNT_MERGE_UNLOCK();
+    if (refcnt == 0)
+        _Py_Dealloc(op);
+}
+
+/* Merge the reference counts of the objects handed back to tstate, which
+   must be the current thread state */
+void
+_PyThreadState_MergeRefCnts(PyThreadState *tstate)
+{
+    PyObject **queue;
+    Py_ssize_t len;
+
+    REFCNT_MERGE_LOCK();
+    queue = tstate->refcnt_merge_queue;
+    len = tstate->refcnt_merge_len;
+    tstate->refcnt_merge_queue = NULL;
+    tstate->refcnt_merge_len = 0;
+    tstate->refcnt_merge_allocated = 0;
+    REFCNT_MERGE_UNLOCK();
+    merge_queued_refcnts(queue, len);
+}
+
+static void
+refcnt_merge_register(PyThreadState *tstate)
+{
+    tstate->refcnt_merge_queue = NULL;
+    tstate->refcnt_merge_len = 0;
+    tstate->refcnt_merge_allocated = 0;
+    REFCNT_MERGE_LOCK();
+    tstate->refcnt_merge_next = refcnt_merge_head;
+    refcnt_merge_head = tstate;
+    REFCNT_MERGE_UNLOCK();
+}
+
+/* Called when tstate is about to be freed: the objects it owns are
+   orphaned, and those it was handed back are merged by the caller.  When
+   the interpreter is being torn down there is no caller thread state to
+   run their destructors with anymore, so they leak, like the frames of the
+   daemon threads they usually come from. */
+static void
+refcnt_merge_unregister(PyThreadState *tstate)
+{
+    PyThreadState **p;
+    PyObject **queue;
+    Py_ssize_t len;
+
+    REFCNT_MERGE_LOCK();
+    for (p = &refcnt_merge_head; *p != NULL; p = &(*p)->refcnt_merge_next) {
+        if (*p == tstate) {
+            *p = tstate->refcnt_merge_next;
+            break;
+        }
+    }
+    queue = tstate->refcnt_merge_queue;
+    len = tstate->refcnt_merge_len;
+    tstate->refcnt_merge_queue = NULL;
+    tstate->refcnt_merge_len = 0;
+    tstate->refcnt_merge_allocated = 0;
+    REFCNT_MERGE_UNLOCK();
+    if (_PyThreadState_UncheckedGet() == NULL) {
+        PyMem_RawFree(queue);
+        return;
+    }
+    merge_queued_refcnts(queue, len);
+}
+#endif /* WITHOUT_GIL */
+
 #ifdef WITH_THREAD
 static void _PyGILState_NoteThreadState(PyThreadState* tstate);
 #endif
@@ -103,7 +338,7 @@ PyInterpreterState_New(void)
 
         HEAD_LOCK();
         interp->next = interp_head;
-        interp_head = interp;
+        STORE_LINK(interp_head, interp);
         HEAD_UNLOCK();
     }
 
@@ -131,6 +366,23 @@ PyInterpreterState_Clear(PyInterpreterState *interp)
 }
 
 
+/* Free the retired thread states if no reader can be looking at them.
+   Called with head_mutex held. */
+static void
+free_retired_tstates(void)
+{
+    PyThreadState *p, *next;
+
+    if (READERS_ACTIVE())
+        return;
+    for (p = retired_tstates; p != NULL; p = next) {
+        next = p->prev;
+        PyMem_RawFree(p);
+    }
+    retired_tstates = NULL;
+}
+
+
 static void
 zapthreads(PyInterpreterState *interp)
 {
@@ -158,7 +410,13 @@ PyInterpreterState_Delete(PyInterpreterState *interp)
     }
     if (interp->tstate_head != NULL)
         Py_FatalError("PyInterpreterState_Delete: remaining threads");
-    *p = interp->next;
+    STORE_LINK(*p, interp->next);
+    while (READERS_ACTIVE()) {
+#ifdef HAVE_SCHED_H
+        sched_yield();
+#endif
+    }
+    free_retired_tstates();
     HEAD_UNLOCK();
     PyMem_RawFree(interp);
 #ifdef WITH_THREAD
@@ -225,6 +483,24 @@ new_threadstate(PyInterpreterState *interp, int init)
         tstate->coroutine_wrapper = NULL;
         tstate->in_coroutine_wrapper = 0;
 
+        tstate->gil_acquire_count = 0;
+        tstate->gil_wait_count = 0;
+        tstate->gil_wait_time = 0;
+        tstate->gil_hold_time = 0;
+        tstate->gil_taken_at = 0;
+
+        tstate->eval_breaker = 0;
+        tstate->pendingcalls_to_do = 0;
+        tstate->pendingfirst = 0;
+        tstate->pendinglast = 0;
+
+        tstate->tls_slots = NULL;
+        tstate->tls_nslots = 0;
+
+#ifdef WITHOUT_GIL
+        refcnt_merge_register(tstate);
+#endif
+
         if (init)
             _PyThreadState_Init(tstate);
 
@@ -233,7 +509,7 @@ new_threadstate(PyInterpreterState *interp, int init)
         tstate->next = interp->tstate_head;
         if (tstate->next)
             tstate->next->prev = tstate;
-        interp->tstate_head = tstate;
+        STORE_LINK(interp->tstate_head, tstate);
         HEAD_UNLOCK();
     }
 
@@ -376,6 +652,24 @@ _PyState_ClearModules(void)
     }
 }
 
+/* Drop the thread-local storage of tstate */
+static void
+tstate_clear_tls(PyThreadState *tstate)
+{
+    PyObject **slots;
+    Py_ssize_t i, n;
+
+    TLS_LOCK();
+    slots = tstate->tls_slots;
+    n = tstate->tls_nslots;
+    tstate->tls_slots = NULL;
+    tstate->tls_nslots = 0;
+    TLS_UNLOCK();
+    for (i = 0; i < n; i++)
+        Py_XDECREF(slots[i]);
+    PyMem_RawFree(slots);
+}
+
 void
 PyThreadState_Clear(PyThreadState *tstate)
 {
@@ -386,6 +680,7 @@ PyThreadState_Clear(PyThreadState *tstate)
     Py_CLEAR(tstate->frame);
 
     Py_CLEAR(tstate->dict);
+    tstate_clear_tls(tstate);
     Py_CLEAR(tstate->async_exc);
 
     Py_CLEAR(tstate->curexc_type);
@@ -417,16 +712,25 @@ tstate_delete_common(PyThreadState *tstate)
         Py_FatalError("PyThreadState_Delete: NULL interp");
     HEAD_LOCK();
     if (tstate->prev)
-        tstate->prev->next = tstate->next;
+        STORE_LINK(tstate->prev->next, tstate->next);
     else
-        interp->tstate_head = tstate->next;
+        STORE_LINK(interp->tstate_head, tstate->next);
     if (tstate->next)
         tstate->next->prev = tstate->prev;
     HEAD_UNLOCK();
+#ifdef WITHOUT_GIL
+    refcnt_merge_unregister(tstate);
+#endif
     if (tstate->on_delete != NULL) {
         tstate->on_delete(tstate->on_delete_data);
     }
-    PyMem_RawFree(tstate);
+    /* A reader may still be looking at tstate: retire it rather than
+       freeing it.  tstate->next must stay valid for that reader. */
+    HEAD_LOCK();
+    tstate->prev = retired_tstates;
+    retired_tstates = tstate;
+    free_retired_tstates();
+    HEAD_UNLOCK();
 }
 
 
@@ -436,8 +740,8 @@ PyThreadState_Delete(PyThreadState *tstate)
     if (tstate == GET_TSTATE())
         Py_FatalError("PyThreadState_Delete: tstate is still current");
 #ifdef WITH_THREAD
-    if (autoInterpreterState && PyThread_get_key_value(autoTLSkey) == tstate)
-        PyThread_delete_key_value(autoTLSkey);
+    if (autoInterpreterState && AUTO_TSTATE_GET() == tstate)
+        AUTO_TSTATE_DELETE();
 #endif /* WITH_THREAD */
     tstate_delete_common(tstate);
 }
@@ -452,10 +756,13 @@ PyThreadState_DeleteCurrent()
         Py_FatalError(
             "PyThreadState_DeleteCurrent: no current tstate");
     tstate_delete_common(tstate);
-    if (autoInterpreterState && PyThread_get_key_value(autoTLSkey) == tstate)
-        PyThread_delete_key_value(autoTLSkey);
+    if (autoInterpreterState && AUTO_TSTATE_GET() == tstate)
+        AUTO_TSTATE_DELETE();
     SET_TSTATE(NULL);
     PyEval_ReleaseLock();
+#ifdef WITHOUT_GIL
+    _PyObject_ReleaseHeap();
+#endif
 }
 #endif /* WITH_THREAD */
 
@@ -484,7 +791,7 @@ _PyThreadState_DeleteExcept(PyThreadState *tstate)
     if (tstate->next)
         tstate->next->prev = tstate->prev;
     tstate->prev = tstate->next = NULL;
-    interp->tstate_head = tstate;
+    STORE_LINK(interp->tstate_head, tstate);
     HEAD_UNLOCK();
     /* Clear and deallocate all stale thread states.  Even if this
        executes Python code, we should be safe since it executes
@@ -492,6 +799,9 @@ _PyThreadState_DeleteExcept(PyThreadState *tstate)
     for (p = garbage; p; p = next) {
         next = p->next;
         PyThreadState_Clear(p);
+#ifdef WITHOUT_GIL
+        refcnt_merge_unregister(p);
+#endif
         PyMem_RawFree(p);
     }
 }
@@ -579,29 +889,34 @@ PyThreadState_SetAsyncExc(long id, PyObject *exc) {
     /* Although the GIL is held, a few C API functions can be called
      * without the GIL held, and in particular some that create and
      * destroy thread and interpreter states.  Those can mutate the
-     * list of thread states we're traversing, so to prevent that we lock
-     * head_mutex for the duration.
+     * list of thread states we're traversing, so walk it as a reader.
      */
-    HEAD_LOCK();
-    for (p = interp->tstate_head; p != NULL; p = p->next) {
+    READERS_ENTER();
+    for (p = LOAD_LINK(interp->tstate_head); p != NULL;
+         p = LOAD_LINK(p->next)) {
         if (p->thread_id == id) {
             /* Tricky:  we need to decref the current value
              * (if any) in p->async_exc, but that can in turn
              * allow arbitrary Python code to run, including
-             * perhaps calls to this function.  To prevent
-             * deadlock, we need to release head_mutex before
-             * the decref.
+             * perhaps calls to this function.  Leave the list
+             * before the decref.
              */
-            PyObject *old_exc = p->async_exc;
+            PyObject *old_exc;
             Py_XINCREF(exc);
+#ifdef WITH_THREAD
+            old_exc = __atomic_exchange_n(&p->async_exc, exc,
+                                          __ATOMIC_SEQ_CST);
+#else
+            old_exc = p->async_exc;
             p->async_exc = exc;
-            HEAD_UNLOCK();
+#endif
+            _PyEval_SignalAsyncExc(p);
+            READERS_EXIT();
             Py_XDECREF(old_exc);
-            _PyEval_SignalAsyncExc();
             return 1;
         }
     }
-    HEAD_UNLOCK();
+    READERS_EXIT();
     return 0;
 }
 
@@ -612,22 +927,22 @@ PyThreadState_SetAsyncExc(long id, PyObject *exc) {
 PyInterpreterState *
 PyInterpreterState_Head(void)
 {
-    return interp_head;
+    return LOAD_LINK(interp_head);
 }
 
 PyInterpreterState *
 PyInterpreterState_Next(PyInterpreterState *interp) {
-    return interp->next;
+    return LOAD_LINK(interp->next);
 }
 
 PyThreadState *
 PyInterpreterState_ThreadHead(PyInterpreterState *interp) {
-    return interp->tstate_head;
+    return LOAD_LINK(interp->tstate_head);
 }
 
 PyThreadState *
 PyThreadState_Next(PyThreadState *tstate) {
-    return tstate->next;
+    return LOAD_LINK(tstate->next);
 }
 
 /* The implementation of sys._current_frames().  This is intended to be
@@ -649,12 +964,13 @@ _PyThread_CurrentFrames(void)
      *     for t in all of i's thread states:
      *          if t's frame isn't NULL, map t's id to its frame
      * Because these lists can mutate even when the GIL is held, we
-     * need to grab head_mutex for the duration.
+     * walk them as a reader.
      */
-    HEAD_LOCK();
-    for (i = interp_head; i != NULL; i = i->next) {
+    READERS_ENTER();
+    for (i = LOAD_LINK(interp_head); i != NULL; i = LOAD_LINK(i->next)) {
         PyThreadState *t;
-        for (t = i->tstate_head; t != NULL; t = t->next) {
+        for (t = LOAD_LINK(i->tstate_head); t != NULL;
+             t = LOAD_LINK(t->next)) {
             PyObject *id;
             int stat;
             struct _frame *frame = t->frame;
@@ -669,11 +985,198 @@ _PyThread_CurrentFrames(void)
                 goto Fail;
         }
     }
-    HEAD_UNLOCK();
+    READERS_EXIT();
     return result;
 
  Fail:
-    HEAD_UNLOCK();
+    READERS_EXIT();
+    Py_DECREF(result);
+    return NULL;
+}
+
+/* Call func(t, arg) for the thread states t of the thread `id`, in every
+   interpreter, until it returns non-zero; return that value, or 0.  The
+   lists are walked as a reader, so t can't be freed while func runs. */
+int
+_PyThreadState_ForThread(long id, int (*func)(PyThreadState *, void *),
+                         void *arg)
+{
+    PyInterpreterState *i;
+    int result = 0;
+
+    READERS_ENTER();
+    for (i = LOAD_LINK(interp_head); i != NULL; i = LOAD_LINK(i->next)) {
+        PyThreadState *t;
+        for (t = LOAD_LINK(i->tstate_head); t != NULL;
+             t = LOAD_LINK(t->next)) {
+            if (t->thread_id == id) {
+                result = func(t, arg);
+                if (result != 0)
+                    goto done;
+            }
+        }
+    }
+ done:
+    READERS_EXIT();
+    return result;
+}
+
+/* Slot-indexed thread-local storage.  Slot numbers are handed out by
+   _PyThreadState_NewTLSSlot() and recycled by _PyThreadState_FreeTLSSlot(),
+   which first empties the slot in every thread state.  The owner of a
+   slot number must make sure that no thread uses it any more when it
+   frees it, so a slot is only written concurrently by its thread and by
+   tstate_clear_tls(); the lock orders that, and the growth of the arrays,
+   against the other threads. */
+static Py_ssize_t tls_next_slot = 0;
+static Py_ssize_t *tls_free_slots = NULL;
+static Py_ssize_t tls_nfree_slots = 0;
+static Py_ssize_t tls_free_slots_allocated = 0;
+
+Py_ssize_t
+_PyThreadState_NewTLSSlot(void)
+{
+    Py_ssize_t index;
+
+    TLS_LOCK();
+    if (tls_nfree_slots > 0)
+        index = tls_free_slots[--tls_nfree_slots];
+    else
+        index = tls_next_slot++;
+    TLS_UNLOCK();
+    return index;
+}
+
+void
+_PyThreadState_FreeTLSSlot(Py_ssize_t index)
+{
+    PyInterpreterState *i;
+
+    READERS_ENTER();
+    for (i = LOAD_LINK(interp_head); i != NULL; i = LOAD_LINK(i->next)) {
+        PyThreadState *t;
+        for (t = LOAD_LINK(i->tstate_head); t != NULL;
+             t = LOAD_LINK(t->next)) {
+            PyObject *value = NULL;
+            TLS_LOCK();
+            if (index < t->tls_nslots) {
+                value = t->tls_slots[index];
+                t->tls_slots[index] = NULL;
+            }
+            TLS_UNLOCK();
+            Py_XDECREF(value);
+        }
+    }
+    READERS_EXIT();
+
+    /* If the free list can't grow, the slot number is simply never
+       reused. */
+    TLS_LOCK();
+    if (tls_nfree_slots == tls_free_slots_allocated) {
+        Py_ssize_t allocated = tls_free_slots_allocated * 2 + 16;
+        Py_ssize_t *free_slots = PyMem_RawRealloc(
+            tls_free_slots, allocated * sizeof(Py_ssize_t));
+        if (free_slots == NULL) {
+            TLS_UNLOCK();
+            return;
+        }
+        tls_free_slots = free_slots;
+        tls_free_slots_allocated = allocated;
+    }
+    tls_free_slots[tls_nfree_slots++] = index;
+    TLS_UNLOCK();
+}
+
+/* Store a new reference to value (which may be NULL) in the slot index of
+   tstate, which must be the current thread state.  Return 0 on success,
+   or -1 with an exception set. */
+int
+_PyThreadState_SetTLSSlot(PyThreadState *tstate, Py_ssize_t index,
+                          PyObject *value)
+{
+    PyObject *old = NULL;
+
+    assert(index >= 0);
+    if (index >= tstate->tls_nslots) {
+        PyObject **slots, **old_slots;
+        Py_ssize_t n;
+
+        if (value == NULL)
+            return 0;
+        /* Only this thread grows its array, so tls_nslots can only shrink
+           (to 0) behind our back. */
+        n = index + 1 + (index >> 1);
+        slots = PyMem_RawMalloc(n * sizeof(PyObject *));
+        if (slots == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        TLS_LOCK();
+        old_slots = tstate->tls_slots;
+        if (old_slots != NULL)
+            memcpy(slots, old_slots,
+                   tstate->tls_nslots * sizeof(PyObject *));
+        memset(slots + tstate->tls_nslots, 0,
+               (n - tstate->tls_nslots) * sizeof(PyObject *));
+        tstate->tls_slots = slots;
+        tstate->tls_nslots = n;
+        TLS_UNLOCK();
+        PyMem_RawFree(old_slots);
+    }
+    Py_XINCREF(value);
+    TLS_LOCK();
+    old = tstate->tls_slots[index];
+    tstate->tls_slots[index] = value;
+    TLS_UNLOCK();
+    Py_XDECREF(old);
+    return 0;
+}
+
+/* Return a dict mapping the id of every thread to a dict of its GIL
+   statistics, for sys._gil_stats(). */
+PyObject *
+_PyThread_GILStats(void)
+{
+    PyObject *result;
+    PyInterpreterState *i;
+
+    result = PyDict_New();
+    if (result == NULL)
+        return NULL;
+
+    READERS_ENTER();
+    for (i = LOAD_LINK(interp_head); i != NULL; i = LOAD_LINK(i->next)) {
+        PyThreadState *t;
+        for (t = LOAD_LINK(i->tstate_head); t != NULL;
+             t = LOAD_LINK(t->next)) {
+            PyObject *id, *value;
+            int stat;
+
+            id = PyLong_FromLong(t->thread_id);
+            if (id == NULL)
+                goto Fail;
+            value = Py_BuildValue(
+                "{sn,sn,sd,sd}",
+                "acquisitions", t->gil_acquire_count,
+                "contended", t->gil_wait_count,
+                "wait_time", _PyTime_AsSecondsDouble(t->gil_wait_time),
+                "hold_time", _PyTime_AsSecondsDouble(t->gil_hold_time));
+            if (value == NULL) {
+                Py_DECREF(id);
+                goto Fail;
+            }
+            stat = PyDict_SetItem(result, id, value);
+            Py_DECREF(id);
+            Py_DECREF(value);
+            if (stat < 0)
+                goto Fail;
+        }
+    }
+    READERS_EXIT();
+    return result;
+
+ Fail:
+    READERS_EXIT();
     Py_DECREF(result);
     return NULL;
 }
@@ -704,11 +1207,15 @@ void
 _PyGILState_Init(PyInterpreterState *i, PyThreadState *t)
 {
     assert(i && t); /* must init with valid states */
+#ifdef Py_THREAD_LOCAL
+    autoGeneration++;
+#else
     autoTLSkey = PyThread_create_key();
     if (autoTLSkey == -1)
         Py_FatalError("Could not allocate TLS entry");
+#endif
     autoInterpreterState = i;
-    assert(PyThread_get_key_value(autoTLSkey) == NULL);
+    assert(AUTO_TSTATE_GET() == NULL);
     assert(t->gilstate_counter == 0);
 
     _PyGILState_NoteThreadState(t);
@@ -723,8 +1230,12 @@ _PyGILState_GetInterpreterStateUnsafe(void)
 void
 _PyGILState_Fini(void)
 {
+#ifdef Py_THREAD_LOCAL
+    AUTO_TSTATE_DELETE();
+#else
     PyThread_delete_key(autoTLSkey);
     autoTLSkey = -1;
+#endif
     autoInterpreterState = NULL;
 }
 
@@ -735,6 +1246,7 @@ _PyGILState_Fini(void)
 void
 _PyGILState_Reinit(void)
 {
+#ifndef Py_THREAD_LOCAL
     PyThreadState *tstate = PyGILState_GetThisThreadState();
     PyThread_delete_key(autoTLSkey);
     if ((autoTLSkey = PyThread_create_key()) == -1)
@@ -744,6 +1256,7 @@ _PyGILState_Reinit(void)
      * the new key. */
     if (tstate && PyThread_set_key_value(autoTLSkey, (void *)tstate) < 0)
         Py_FatalError("Couldn't create autoTLSkey mapping");
+#endif
 }
 
 /* When a thread state is created for a thread by some mechanism other than
@@ -754,7 +1267,7 @@ _PyGILState_Reinit(void)
 static void
 _PyGILState_NoteThreadState(PyThreadState* tstate)
 {
-    /* If autoTLSkey isn't initialized, this must be the very first
+    /* If the GILState API isn't initialized, this must be the very first
        threadstate created in Py_Initialize().  Don't do anything for now
        (we'll be back here when _PyGILState_Init is called). */
     if (!autoInterpreterState)
@@ -772,8 +1285,8 @@ _PyGILState_NoteThreadState(PyThreadState* tstate)
        The first thread state created for that given OS level thread will
        "win", which seems reasonable behaviour.
     */
-    if (PyThread_get_key_value(autoTLSkey) == NULL) {
-        if (PyThread_set_key_value(autoTLSkey, (void *)tstate) < 0)
+    if (AUTO_TSTATE_GET() == NULL) {
+        if (AUTO_TSTATE_SET(tstate) < 0)
             Py_FatalError("Couldn't create autoTLSkey mapping");
     }
 
@@ -787,7 +1300,7 @@ PyGILState_GetThisThreadState(void)
 {
     if (autoInterpreterState == NULL)
         return NULL;
-    return (PyThreadState *)PyThread_get_key_value(autoTLSkey);
+    return AUTO_TSTATE_GET();
 }
 
 int
@@ -798,7 +1311,7 @@ PyGILState_Check(void)
     if (!_PyGILState_check_enabled)
         return 1;
 
-    if (autoTLSkey == -1)
+    if (autoInterpreterState == NULL)
         return 1;
 
     tstate = GET_TSTATE();
@@ -819,7 +1332,7 @@ PyGILState_Ensure(void)
        called Py_Initialize() and usually PyEval_InitThreads().
     */
     assert(autoInterpreterState); /* Py_Initialize() hasn't been called! */
-    tcur = (PyThreadState *)PyThread_get_key_value(autoTLSkey);
+    tcur = AUTO_TSTATE_GET();
     if (tcur == NULL) {
         /* At startup, Python has no concrete GIL. If PyGILState_Ensure() is
            called from a new thread for the first time, we need the create the
@@ -851,8 +1364,7 @@ PyGILState_Ensure(void)
 void
 PyGILState_Release(PyGILState_STATE oldstate)
 {
-    PyThreadState *tcur = (PyThreadState *)PyThread_get_key_value(
-                                                            autoTLSkey);
+    PyThreadState *tcur = AUTO_TSTATE_GET();
     if (tcur == NULL)
         Py_FatalError("auto-releasing thread-state, "
                       "but no thread-state for this thread");
@@ -599,6 +599,47 @@ PyDoc_STRVAR(getswitchinterval_doc,
 "getswitchinterval() -> current thread switch interval; see setswitchinterval()."
 );
 
+static PyObject *
+sys_setgilpolicy(PyObject *self, PyObject *args)
+{
+    const char *policy;
+    if (!PyArg_ParseTuple(args, "s:setgilpolicy", &policy))
+        return NULL;
+    if (strcmp(policy, "interval") == 0)
+        _PyEval_SetGILPolicy(_Py_GIL_POLICY_INTERVAL);
+    else if (strcmp(policy, "fair") == 0)
+        _PyEval_SetGILPolicy(_Py_GIL_POLICY_FAIR);
+    else {
+        PyErr_Format(PyExc_ValueError,
+                     "unknown GIL policy: %R", PyTuple_GET_ITEM(args, 0));
+        return NULL;
+    }
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+PyDoc_STRVAR(setgilpolicy_doc,
+"setgilpolicy(policy)\n\
+\n\
+Set the policy used to hand the GIL from one thread to another.\n\
+'interval' (the default) lets the first thread to run take the GIL, and\n\
+asks the holder to drop it after the switch interval.  'fair' serves\n\
+waiting threads in FIFO order, threads coming back from a blocking call\n\
+first, and doesn't make the latter wait for the switch interval."
+);
+
+static PyObject *
+sys_getgilpolicy(PyObject *self, PyObject *args)
+{
+    if (_PyEval_GetGILPolicy() == _Py_GIL_POLICY_FAIR)
+        return PyUnicode_FromString("fair");
+    return PyUnicode_FromString("interval");
+}
+
+PyDoc_STRVAR(getgilpolicy_doc,
+"getgilpolicy() -> current GIL scheduling policy; see setgilpolicy()."
+);
+
 #endif /* WITH_THREAD */
 
 #ifdef WITH_TSC
@@ -1012,7 +1053,7 @@ Return the size of object in bytes.");
 static PyObject *
 sys_getrefcount(PyObject *self, PyObject *arg)
 {
-    return PyLong_FromSsize_t(arg->ob_refcnt);
+    return PyLong_FromSsize_t(Py_REFCNT(arg));
 }
 
 #ifdef Py_REF_DEBUG
@@ -1103,6 +1144,69 @@ sys_current_frames(PyObject *self, PyObject *noargs)
     return _PyThread_CurrentFrames();
 }
 
+PyDoc_STRVAR(gil_stats_doc,
+"_gil_stats() -> dictionary\n\
+\n\
+Return a dictionary of statistics about the contention on the GIL since\n\
+it was created: the number of acquisitions, of acquisitions which had to\n\
+wait, of forced drops and of switches, the total and maximum time spent\n\
+waiting for and holding the GIL, in seconds, and histograms of those\n\
+times.  'threads' maps each current thread's id to its own totals.\n\
+\n\
+This function should be used for specialized purposes only."
+);
+
+static PyObject *
+gil_histogram(Py_ssize_t *counts)
+{
+    PyObject *result;
+    int i;
+
+    result = PyTuple_New(_Py_GIL_STATS_BUCKETS);
+    if (result == NULL)
+        return NULL;
+    for (i = 0; i < _Py_GIL_STATS_BUCKETS; i++) {
+        PyObject *count = PyLong_FromSsize_t(counts[i]);
+        if (count == NULL) {
+            Py_DECREF(result);
+            return NULL;
+        }
+        PyTuple_SET_ITEM(result, i, count);
+    }
+    return result;
+}
+
+static PyObject *
+sys_gil_stats(PyObject *self, PyObject *noargs)
+{
+    _PyGILStats stats;
+    PyObject *wait_histogram, *hold_histogram, *threads;
+    PyObject *result = NULL;
+
+    _PyEval_GetGILStats(&stats);
+    wait_histogram = gil_histogram(stats.wait_histogram);
+    hold_histogram = gil_histogram(stats.hold_histogram);
+    threads = _PyThread_GILStats();
+    if (wait_histogram != NULL && hold_histogram != NULL && threads != NULL)
+        result = Py_BuildValue(
+            "{sn,sn,sn,sn,sd,sd,sd,sd,sO,sO,sO}",
+            "acquisitions", stats.acquisitions,
+            "contended", stats.contended,
+            "forced_drops", stats.forced_drops,
+            "switches", stats.switches,
+            "wait_time", _PyTime_AsSecondsDouble(stats.wait_time),
+            "max_wait", _PyTime_AsSecondsDouble(stats.max_wait),
+            "hold_time", _PyTime_AsSecondsDouble(stats.hold_time),
+            "max_hold", _PyTime_AsSecondsDouble(stats.max_hold),
+            "wait_histogram", wait_histogram,
+            "hold_histogram", hold_histogram,
+            "threads", threads);
+    Py_XDECREF(wait_histogram);
+    Py_XDECREF(hold_histogram);
+    Py_XDECREF(threads);
+    return result;
+}
+
 PyDoc_STRVAR(call_tracing_doc,
 "call_tracing(func, args) -> object\n\
 \n\
@@ -1152,7 +1256,10 @@ sys_debugmallocstats(PyObject *self, PyObject *args)
 {
 #ifdef WITH_PYMALLOC
     if (_PyMem_PymallocEnabled()) {
+        /* Other threads would change the numbers under our feet */
+        _PyEval_StopTheWorld();
         _PyObject_DebugMallocStats(stderr);
+        _PyEval_StartTheWorld();
         fputc('\n', stderr);
     }
 #endif
@@ -1214,6 +1321,8 @@ static PyMethodDef sys_methods[] = {
      sys_clear_type_cache__doc__},
     {"_current_frames", sys_current_frames, METH_NOARGS,
      current_frames_doc},
+    {"_gil_stats",      sys_gil_stats, METH_NOARGS,
+     gil_stats_doc},
     {"displayhook",     sys_displayhook, METH_O, displayhook_doc},
     {"exc_info",        sys_exc_info, METH_NOARGS, exc_info_doc},
     {"excepthook",      sys_excepthook, METH_VARARGS, excepthook_doc},
@@ -1264,6 +1373,10 @@ static PyMethodDef sys_methods[] = {
      setswitchinterval_doc},
     {"getswitchinterval",       sys_getswitchinterval, METH_NOARGS,
      getswitchinterval_doc},
+    {"setgilpolicy",            sys_setgilpolicy, METH_VARARGS,
+     setgilpolicy_doc},
+    {"getgilpolicy",            sys_getgilpolicy, METH_NOARGS,
+     getgilpolicy_doc},
 #endif
 #ifdef HAVE_DLOPEN
     {"setdlopenflags", sys_setdlopenflags, METH_VARARGS,
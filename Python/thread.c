@@ -98,6 +98,39 @@ static size_t _pythread_stacksize = 0;
 #endif
 */
 
+#ifndef _Py_HAVE_FUTEX_LOCKS
+/* Embedded locks wrap a lock of the platform's threading library */
+
+int
+_PyThread_lock_init(_PyThread_lock *lock)
+{
+    lock->lock = PyThread_allocate_lock();
+    return (lock->lock != NULL) ? 0 : -1;
+}
+
+void
+_PyThread_lock_fini(_PyThread_lock *lock)
+{
+    if (lock->lock != NULL) {
+        PyThread_free_lock(lock->lock);
+        lock->lock = NULL;
+    }
+}
+
+PyLockStatus
+_PyThread_lock_acquire_timed(_PyThread_lock *lock, PY_TIMEOUT_T microseconds,
+                             int intr_flag)
+{
+    return PyThread_acquire_lock_timed(lock->lock, microseconds, intr_flag);
+}
+
+void
+_PyThread_lock_release(_PyThread_lock *lock)
+{
+    PyThread_release_lock(lock->lock);
+}
+#endif
+
 /* return the current thread stack size */
 size_t
 PyThread_get_stacksize(void)
@@ -412,7 +445,9 @@ PyThread_GetInfo(void)
     PyStructSequence_SET_ITEM(threadinfo, pos++, value);
 
 #ifdef _POSIX_THREADS
-#ifdef USE_SEMAPHORES
+#if defined(_Py_HAVE_FUTEX_LOCKS)
+    value = PyUnicode_FromString("futex");
+#elif defined(USE_SEMAPHORES)
     value = PyUnicode_FromString("semaphore");
 #else
     value = PyUnicode_FromString("mutex+cond");
@@ -266,7 +266,186 @@ PyThread_exit_thread(void)
     pthread_exit(0);
 }
 
-#ifdef USE_SEMAPHORES
+#ifdef _Py_HAVE_FUTEX_LOCKS
+
+/*
+ * Lock support, using a futex word.
+ *
+ * The lock word is 0 when unlocked, 1 when locked and 2 when locked and
+ * some thread may be sleeping on it ("Futexes Are Tricky", Ulrich Drepper,
+ * mutex #2).  Taking a free lock is a single compare-and-swap.  A thread
+ * which finds the lock taken spins for a while before setting the word to
+ * 2 and sleeping in futex(FUTEX_WAIT); releasing the lock only enters the
+ * kernel to wake a thread if the word was 2.
+ */
+
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#define FUTEX_UNLOCKED  0
+#define FUTEX_LOCKED    1
+#define FUTEX_CONTENDED 2
+
+/* Upper bound of the spin count; the actual bound adapts to the number of
+   spins which were needed on earlier acquisitions of the lock, like the
+   PTHREAD_MUTEX_ADAPTIVE_NP mutexes of glibc. */
+#define FUTEX_MAX_SPINS 100
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define CPU_RELAX() __asm__ __volatile__("pause")
+#else
+#define CPU_RELAX() ((void)0)
+#endif
+
+/* Sleep while *addr == val.  abstime is an absolute CLOCK_MONOTONIC
+   deadline, or NULL to wait forever. */
+static int
+futex_wait(int *addr, int val, const struct timespec *abstime)
+{
+    return syscall(SYS_futex, addr, FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG,
+                   val, abstime, NULL, FUTEX_BITSET_MATCH_ANY);
+}
+
+static void
+futex_wake(int *addr, int nthreads)
+{
+    syscall(SYS_futex, addr, FUTEX_WAKE | FUTEX_PRIVATE_FLAG,
+            nthreads, NULL, NULL, 0);
+}
+
+int
+_PyThread_lock_init(_PyThread_lock *lock)
+{
+    if (!initialized)
+        PyThread_init_thread();
+    lock->state = FUTEX_UNLOCKED;
+    lock->spins = 0;
+    return 0;
+}
+
+void
+_PyThread_lock_fini(_PyThread_lock *lock)
+{
+    /* nothing to release */
+}
+
+PyLockStatus
+_PyThread_lock_acquire_timed(_PyThread_lock *lock, PY_TIMEOUT_T microseconds,
+                             int intr_flag)
+{
+    struct timespec deadline, *pdeadline = NULL;
+    int c, spins, max_spins, avg_spins;
+
+    c = FUTEX_UNLOCKED;
+    if (__atomic_compare_exchange_n(&lock->state, &c, FUTEX_LOCKED, 0,
+                                    __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        return PY_LOCK_ACQUIRED;
+    if (microseconds == 0)
+        return PY_LOCK_FAILURE;
+
+    /* The holder is likely to release the lock soon: spin before paying
+       for a system call.  spins is only a hint, so races on it are
+       harmless. */
+    avg_spins = __atomic_load_n(&lock->spins, __ATOMIC_RELAXED);
+    max_spins = Py_MIN(FUTEX_MAX_SPINS, avg_spins * 2 + 10);
+    for (spins = 0; spins < max_spins; spins++) {
+        CPU_RELAX();
+        c = __atomic_load_n(&lock->state, __ATOMIC_RELAXED);
+        if (c == FUTEX_UNLOCKED
+            && __atomic_compare_exchange_n(&lock->state, &c, FUTEX_LOCKED, 0,
+                                           __ATOMIC_ACQUIRE,
+                                           __ATOMIC_RELAXED))
+            break;
+    }
+    __atomic_store_n(&lock->spins, avg_spins + (spins - avg_spins) / 8,
+                     __ATOMIC_RELAXED);
+    if (spins < max_spins)
+        return PY_LOCK_ACQUIRED;
+
+    if (microseconds > 0) {
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += microseconds / 1000000;
+        deadline.tv_nsec += (microseconds % 1000000) * 1000;
+        if (deadline.tv_nsec >= 1000000000) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000;
+        }
+        pdeadline = &deadline;
+    }
+
+    /* Mark the lock as contended, so that the holder wakes us up */
+    c = __atomic_exchange_n(&lock->state, FUTEX_CONTENDED, __ATOMIC_ACQUIRE);
+    while (c != FUTEX_UNLOCKED) {
+        if (futex_wait(&lock->state, FUTEX_CONTENDED, pdeadline) < 0) {
+            /* EAGAIN means that the lock word changed before we slept */
+            if (errno == ETIMEDOUT)
+                return PY_LOCK_FAILURE;
+            if (errno == EINTR && intr_flag)
+                return PY_LOCK_INTR;
+        }
+        c = __atomic_exchange_n(&lock->state, FUTEX_CONTENDED,
+                                __ATOMIC_ACQUIRE);
+    }
+    return PY_LOCK_ACQUIRED;
+}
+
+void
+_PyThread_lock_release(_PyThread_lock *lock)
+{
+    if (__atomic_exchange_n(&lock->state, FUTEX_UNLOCKED, __ATOMIC_RELEASE)
+        == FUTEX_CONTENDED)
+        futex_wake(&lock->state, 1);
+}
+
+PyThread_type_lock
+PyThread_allocate_lock(void)
+{
+    _PyThread_lock *lock;
+
+    dprintf(("PyThread_allocate_lock called\n"));
+    lock = (_PyThread_lock *)PyMem_RawMalloc(sizeof(_PyThread_lock));
+    if (lock)
+        _PyThread_lock_init(lock);
+    dprintf(("PyThread_allocate_lock() -> %p\n", lock));
+    return (PyThread_type_lock)lock;
+}
+
+void
+PyThread_free_lock(PyThread_type_lock lock)
+{
+    dprintf(("PyThread_free_lock(%p) called\n", lock));
+    if (!lock)
+        return;
+    _PyThread_lock_fini((_PyThread_lock *)lock);
+    PyMem_RawFree(lock);
+}
+
+PyLockStatus
+PyThread_acquire_lock_timed(PyThread_type_lock lock, PY_TIMEOUT_T microseconds,
+                            int intr_flag)
+{
+    PyLockStatus success;
+
+    dprintf(("PyThread_acquire_lock_timed(%p, %lld, %d) called\n",
+             lock, microseconds, intr_flag));
+    success = _PyThread_lock_acquire_timed((_PyThread_lock *)lock,
+                                           microseconds, intr_flag);
+    dprintf(("PyThread_acquire_lock_timed(%p, %lld, %d) -> %d\n",
+             lock, microseconds, intr_flag, success));
+    return success;
+}
+
+void
+PyThread_release_lock(PyThread_type_lock lock)
+{
+    dprintf(("PyThread_release_lock(%p) called\n", lock));
+    _PyThread_lock_release((_PyThread_lock *)lock);
+}
+
+#elif defined(USE_SEMAPHORES)
 
 /*
  * Lock support.
@@ -548,7 +727,7 @@ PyThread_release_lock(PyThread_type_lock lock)
     CHECK_STATUS("pthread_mutex_unlock[3]");
 }
 
-#endif /* USE_SEMAPHORES */
+#endif /* _Py_HAVE_FUTEX_LOCKS */
 
 int
 PyThread_acquire_lock(PyThread_type_lock lock, int waitflag)
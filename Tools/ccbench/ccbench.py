@@ -131,8 +131,21 @@ def task_hashing():
         hashlib.sha1(s).digest()
     return compute, (arg, )
 
+def task_shared_objects():
+    """shared objects access (Python)"""
+    # Every thread takes and drops references to the same objects, which is
+    # what stresses reference counting in an interpreter without a GIL.
+    shared = [(i, str(i), float(i)) for i in range(100)]
 
-throughput_tasks = [task_pidigits, task_regex]
+    def walk(l):
+        n = 0
+        for a, b, c in l:
+            n += a
+        return n
+    return walk, (shared, )
+
+
+throughput_tasks = [task_pidigits, task_regex, task_shared_objects]
 for mod in 'bz2', 'hashlib':
     try:
         globals()[mod] = __import__(mod)
@@ -634,6 +634,22 @@ class PyBuildExt(build_ext):
         exts.append( Extension("_bisect", ["_bisectmodule.c"]) )
         # heapq
         exts.append( Extension("_heapq", ["_heapqmodule.c"]) )
+        # work queue of concurrent.futures.ThreadPoolExecutor
+        if sysconfig.get_config_var('WITH_THREAD'):
+            exts.append( Extension("_executor", ["_executormodule.c"]) )
+        else:
+            missing.append('_executor')
+        # C implementation of queue.SimpleQueue
+        if sysconfig.get_config_var('WITH_THREAD'):
+            exts.append( Extension("_queue", ["_queuemodule.c"]) )
+        else:
+            missing.append('_queue')
+        # Sub-interpreters and channels
+        if sysconfig.get_config_var('WITH_THREAD'):
+            exts.append( Extension("_subinterpreters",
+                                   ["_subinterpretersmodule.c"]) )
+        else:
+            missing.append('_subinterpreters')
         # C-optimized pickle replacement
         exts.append( Extension("_pickle", ["_pickle.c"]) )
         # atexit